@@ -0,0 +1,78 @@
+#ifndef BENCHDATA_HPP
+#define BENCHDATA_HPP
+
+/**
+ * @file BenchData.hpp
+ * @brief Builders for the models and controllers the benchmarks run against.
+ *
+ * Everything is built outside the timed loops. Titles are numbered ("Assignment 17") so a benchmark
+ * can look up any entity by title without keeping a list of them, and every third assignment is left
+ * incomplete so grade calculations see a realistic mix.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include "controller/TermController.hpp"
+#include "model/Term.hpp"
+
+namespace bench {
+    using namespace std::chrono_literals;
+
+    inline constexpr const char* categories[] = {"Homework", "Midterm", "Final Exam"};
+
+    inline std::string numbered(const char* prefix, std::size_t i) {
+        return std::string{prefix} + " " + std::to_string(i);
+    }
+
+    inline Assignment makeAssignment(std::size_t i) {
+        bool completed = (i % 3 != 0);
+        return Assignment{numbered("Assignment", i), "", categories[i % 3], std::chrono::year_month_day{2026y/2/1},
+            completed, completed ? static_cast<float>(60 + i % 40) : 0.0f};
+    }
+
+    inline Course makeCourse(std::size_t assignments, std::size_t index = 0) {
+        Course course{numbered("Course", index), "", std::chrono::year_month_day{2026y/1/2},
+            std::chrono::year_month_day{2026y/5/12}, 3, true};
+
+        for (std::size_t i = 0; i < assignments; ++i) {
+            course.addAssignment(makeAssignment(i));
+        }
+
+        return course;
+    }
+
+    inline Term makeTerm(std::size_t courses, std::size_t assignmentsPerCourse) {
+        Term term{"Spring 2026", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/24}, true};
+
+        for (std::size_t i = 0; i < courses; ++i) {
+            term.addCourse(makeCourse(assignmentsPerCourse, i));
+        }
+
+        return term;
+    }
+
+    // fills a controller with one selected term holding the given number of courses, the first of which is
+    // selected and holds the given number of assignments
+    inline void fillController(TermController& controller, std::size_t courses, std::size_t assignments) {
+        controller.addTerm("Spring 2026", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/24}, true);
+        controller.selectTerm("Spring 2026");
+        CourseController& courseController = controller.getCourseController();
+
+        for (std::size_t i = 0; i < courses; ++i) {
+            courseController.addCourse(numbered("Course", i), "", std::chrono::year_month_day{2026y/1/2},
+                std::chrono::year_month_day{2026y/5/12}, 3, true);
+        }
+
+        courseController.selectCourse(numbered("Course", 0));
+        AssignmentController& assignmentController = courseController.getAssignmentController();
+
+        for (std::size_t i = 0; i < assignments; ++i) {
+            Assignment assignment = makeAssignment(i);
+            assignmentController.addAssignment(assignment.getTitle(), "", assignment.getCategory(),
+                assignment.getDueDate(), assignment.getCompleted(), assignment.getGrade());
+        }
+    }
+}
+
+#endif  // BENCHDATA_HPP
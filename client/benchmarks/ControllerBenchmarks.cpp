@@ -0,0 +1,317 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <QCoreApplication>
+#include "BenchData.hpp"
+#include "controller/AsyncOperation.hpp"
+#include "controller/SharedTermController.hpp"
+#include "io/TermTreeJson.hpp"
+#include "synth/HistoryGenerator.hpp"
+#include "utils/ThreadPool.hpp"
+
+// ====================================
+// LOOKUP BENCHMARKS
+// ====================================
+
+// looks up an assignment id by a differently-cased title among n assignments
+static void BM_GetAssignmentId(benchmark::State& state) {
+    TermController controller;
+    bench::fillController(controller, 1, static_cast<std::size_t>(state.range(0)));
+    const AssignmentController& assignmentController = controller.getCourseController().getAssignmentController();
+    std::string title = "ASSIGNMENT " + std::to_string(state.range(0) / 2);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(assignmentController.getAssignmentId(title));
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_GetAssignmentId)->RangeMultiplier(8)->Range(8, 4096)->Complexity();
+
+// looks up a course id by a differently-cased title among n courses
+static void BM_GetCourseId(benchmark::State& state) {
+    TermController controller;
+    bench::fillController(controller, static_cast<std::size_t>(state.range(0)), 0);
+    const CourseController& courseController = controller.getCourseController();
+    std::string title = "COURSE " + std::to_string(state.range(0) / 2);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(courseController.getCourseId(title));
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_GetCourseId)->RangeMultiplier(8)->Range(8, 4096)->Complexity();
+
+
+// ====================================
+// SEARCH BENCHMARKS
+// ====================================
+
+// imports a term of n assignments, 512 to a course; the numbered titles repeat in every course
+static void importSearchTerm(TermController& controller, std::size_t assignments) {
+    controller.importTerm(bench::makeTerm(assignments / 512, 512));
+}
+
+// searches n assignments by a word every title shares plus a number, which matches one assignment per course
+static void BM_SearchTitle(benchmark::State& state) {
+    TermController controller;
+    importSearchTerm(controller, static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(controller.search("assignment 257"));
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_SearchTitle)->RangeMultiplier(4)->Range(512, 131072)->Complexity();
+
+// searches n assignments by a category word that a third of them share, keeping the best 20
+static void BM_SearchCategory(benchmark::State& state) {
+    TermController controller;
+    importSearchTerm(controller, static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(controller.search("midterm"));
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_SearchCategory)->RangeMultiplier(4)->Range(512, 131072)->Complexity();
+
+
+// ====================================
+// UNDO BENCHMARKS
+// ====================================
+
+// undoes and redoes one assignment title edit in a term of n assignments; flat, since only the title and its grams are replayed
+static void BM_UndoRedoEdit(benchmark::State& state) {
+    TermController controller;
+    importSearchTerm(controller, static_cast<std::size_t>(state.range(0)));
+    controller.selectTerm("Spring 2026");
+    controller.getCourseController().selectCourse(bench::numbered("Course", 0));
+    AssignmentController& assignmentController = controller.getCourseController().getAssignmentController();
+    assignmentController.editTitle(assignmentController.getAssignmentId("Assignment 1"), "Renamed");
+
+    for (auto _ : state) {
+        controller.undo();
+        controller.redo();
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_UndoRedoEdit)->RangeMultiplier(4)->Range(512, 131072)->Complexity();
+
+// undoes and redoes removing a course of 512 assignments from a term of n; mostly the course, plus one pass of the change tracker over the term
+static void BM_UndoRedoRemoveCourse(benchmark::State& state) {
+    TermController controller;
+    importSearchTerm(controller, static_cast<std::size_t>(state.range(0)));
+    controller.selectTerm("Spring 2026");
+    controller.getCourseController().removeCourse(bench::numbered("Course", 0));
+
+    for (auto _ : state) {
+        controller.undo();
+        controller.redo();
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_UndoRedoRemoveCourse)->RangeMultiplier(4)->Range(512, 131072)->Complexity();
+
+
+// ====================================
+// SNAPSHOT BENCHMARKS
+// ====================================
+
+// edits one of n terms of 256 assignments each and publishes; copies that term and shares the other n - 1
+static void BM_PublishAfterEdit(benchmark::State& state) {
+    TermController controller;
+    for (std::size_t i = 0; i < static_cast<std::size_t>(state.range(0)); ++i) {
+        Term term = bench::makeTerm(4, 64);
+        term.setTitle(bench::numbered("Term", i));
+        controller.importTerm(std::move(term));
+    }
+    controller.publishSnapshot();
+    const std::string id = controller.getTermId("Term 0");
+    bool active = true;
+
+    for (auto _ : state) {
+        active = !active;
+        controller.editActive(id, active);
+        benchmark::DoNotOptimize(controller.publishSnapshot());
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_PublishAfterEdit)->RangeMultiplier(4)->Range(4, 1024)->Complexity();
+
+
+// ====================================
+// CONCURRENCY BENCHMARKS
+// ====================================
+
+// one controller shared by every thread of a run; thread 0 builds it before the others start and drops it after
+static std::unique_ptr<SharedTermController> sharedController;
+static constexpr std::size_t sharedTerms = 8;
+
+static void setUpShared() {
+    sharedController = std::make_unique<SharedTermController>();
+    sharedController->write([](TermController& controller) {
+        for (std::size_t i = 0; i < sharedTerms; ++i) {
+            Term term = bench::makeTerm(4, 64);
+            term.setTitle(bench::numbered("Term", i));
+            controller.importTerm(std::move(term));
+        }
+    });
+}
+
+// toggles a term by title, since only thread 0 may touch the controller before the timed loop starts
+static void toggleShared(const std::string& title, bool active) {
+    sharedController->write([&title, active](TermController& controller) {
+        controller.editActive(controller.getTermId(title), active);
+    });
+}
+
+// searches under the shared lock; readers never wait on each other
+static void BM_SharedRead(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        setUpShared();
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sharedController->read([](const TermController& controller) {
+            return controller.search("assignment", 10).size();
+        }));
+    }
+
+    if (state.thread_index() == 0) {
+        sharedController.reset();
+    }
+}
+BENCHMARK(BM_SharedRead)->ThreadRange(1, 32)->UseRealTime();
+
+// the same reads with one write in 16, each thread toggling its own term; readers queue behind every write
+static void BM_SharedMixed(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        setUpShared();
+    }
+    const std::size_t term = static_cast<std::size_t>(state.thread_index()) % sharedTerms;
+    const std::string title = bench::numbered("Term", term);
+    std::size_t op = 0;
+    bool active = true;
+
+    for (auto _ : state) {
+        if (++op % 16 == 0) {
+            active = !active;
+            toggleShared(title, active);
+        } else {
+            benchmark::DoNotOptimize(sharedController->read([](const TermController& controller) {
+                return controller.search("assignment", 10).size();
+            }));
+        }
+    }
+
+    if (state.thread_index() == 0) {
+        sharedController.reset();
+    }
+}
+BENCHMARK(BM_SharedMixed)->ThreadRange(1, 32)->UseRealTime();
+
+// reads the published snapshot while one write in 16 goes through the lock; snapshot readers take no lock at all
+static void BM_SharedSnapshotMixed(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        setUpShared();
+    }
+    const std::size_t term = static_cast<std::size_t>(state.thread_index()) % sharedTerms;
+    const std::string title = bench::numbered("Term", term);
+    std::size_t op = 0;
+    bool active = true;
+
+    for (auto _ : state) {
+        if (++op % 16 == 0) {
+            active = !active;
+            toggleShared(title, active);
+        } else {
+            std::shared_ptr<const Snapshot> snapshot = sharedController->getSnapshot();
+            benchmark::DoNotOptimize(snapshot->terms[term]->getCourseList().size());
+        }
+    }
+
+    if (state.thread_index() == 0) {
+        sharedController.reset();
+    }
+}
+BENCHMARK(BM_SharedSnapshotMixed)->ThreadRange(1, 32)->UseRealTime();
+
+
+// ====================================
+// RECOMPUTE BENCHMARKS
+// ====================================
+
+// recomputes every grade in a 1M-assignment history (100 terms x 50 courses x 200) on a pool of n threads;
+// the history is built once and shared by every run, since building it takes far longer than recomputing it
+static void BM_RecomputeAll(benchmark::State& state) {
+    static TermController controller;
+    static bool filled = false;
+    if (!filled) {
+        synth::HistoryGenerator{synth::HistoryConfig{.terms = 100, .coursesPerTerm = 50,
+            .assignmentsPerCourse = 200}}.fill(controller);
+        filled = true;
+    }
+    utils::ThreadPool pool{static_cast<std::size_t>(state.range(0))};
+
+    for (auto _ : state) {
+        controller.recomputeAll(pool);
+    }
+
+    state.SetItemsProcessed(state.iterations() * 1'000'000);
+}
+BENCHMARK(BM_RecomputeAll)->RangeMultiplier(2)->Range(1, 32)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+
+// ====================================
+// ASYNC OPERATION BENCHMARKS
+// ====================================
+
+// imports a 100k-assignment history (10 terms x 50 courses x 200) through importAsync while pumping events the
+// way the UI thread does; longest_frame_ms is the longest the event loop went without getting control back,
+// which has to stay under a 16 ms frame
+static void BM_ImportAsync(benchmark::State& state) {
+    static int argc = 1;
+    static char name[] = "CourseCompanion_bench";
+    static char* argv[] = {name, nullptr};
+    static QCoreApplication app{argc, argv};
+    static const std::string path =
+        (std::filesystem::temp_directory_path() / "CourseCompanion_bench_import.json").string();
+    static bool written = false;
+    if (!written) {
+        TermController source;
+        synth::HistoryGenerator{synth::HistoryConfig{.terms = 10, .coursesPerTerm = 50,
+            .assignmentsPerCourse = 200}}.fill(source);
+        std::ofstream file{path};
+        io::exportTermTree(source, file);
+        written = true;
+    }
+    double longestFrame = 0.0;
+
+    for (auto _ : state) {
+        TermController controller;
+        AsyncOperation* operation = controller.importAsync(path);
+
+        while (operation->isRunning()) {
+            auto start = std::chrono::steady_clock::now();
+            QCoreApplication::processEvents();
+            longestFrame = std::max(longestFrame,
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});     // the rest of the frame, spent idle
+        }
+    }
+
+    state.counters["longest_frame_ms"] = longestFrame;
+    state.SetItemsProcessed(state.iterations() * 100'000);
+}
+BENCHMARK(BM_ImportAsync)->Iterations(3)->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+#include "BenchData.hpp"
+
+// ====================================
+// COURSE BENCHMARKS
+// ====================================
+
+// adds and removes one assignment in a course of n; both recompute the course grade
+static void BM_CourseAddRemoveAssignment(benchmark::State& state) {
+    Course course = bench::makeCourse(static_cast<std::size_t>(state.range(0)));
+    Assignment extra = bench::makeAssignment(static_cast<std::size_t>(state.range(0)));
+    std::string id = extra.getId();
+
+    for (auto _ : state) {
+        course.addAssignment(extra);
+        course.removeAssignment(id);
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_CourseAddRemoveAssignment)->RangeMultiplier(4)->Range(4, 4096)->Complexity();
+
+// recomputes the grade of a course of n assignments
+static void BM_CourseSetGradePct(benchmark::State& state) {
+    Course course = bench::makeCourse(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        course.setGradePct();
+        benchmark::DoNotOptimize(course.getGradePct());
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_CourseSetGradePct)->RangeMultiplier(4)->Range(4, 4096)->Complexity();
+
+
+// ====================================
+// TERM BENCHMARKS
+// ====================================
+
+// adds and removes one course in a term of n; calculateOvrGpa is private, and these are the calls that run it
+static void BM_TermCalculateOvrGpa(benchmark::State& state) {
+    Term term = bench::makeTerm(static_cast<std::size_t>(state.range(0)), 8);
+    Course extra = bench::makeCourse(8, static_cast<std::size_t>(state.range(0)));
+    std::string id = extra.getId();
+
+    for (auto _ : state) {
+        term.addCourse(extra);
+        term.removeCourse(id);
+        benchmark::DoNotOptimize(term.getOvrGpa());
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_TermCalculateOvrGpa)->RangeMultiplier(4)->Range(1, 256)->Complexity();
@@ -0,0 +1,128 @@
+#include <benchmark/benchmark.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "controller/TermController.hpp"
+#include "net/ApiService.hpp"
+#include "net/HttpClient.hpp"
+#include "net/HttpServer.hpp"
+#include "net/ResponseCache.hpp"
+#include "synth/HistoryGenerator.hpp"
+
+namespace {
+    TermController& fillHistory(TermController& controller) {
+        synth::HistoryGenerator{synth::HistoryConfig{.terms = 10, .coursesPerTerm = 10, .assignmentsPerCourse = 20}}
+            .fill(controller);
+        return controller;
+    }
+
+    // the daemon's stack on a loopback port, serving a synthetic history from its own thread
+    struct Daemon {
+        TermController controller{};
+        ApiService service{fillHistory(controller)};
+        HttpServer server{"127.0.0.1", 0, [this](const HttpRequest& request) { return service.handle(request); }};
+        std::thread loop{[this]() { server.run(); }};
+
+        ~Daemon() {
+            server.stop();
+            loop.join();
+        }
+
+        std::string treeTarget() const {
+            return "/terms/" + controller.getTermList().front().first + "/tree";
+        }
+
+        std::string courseTarget() const {
+            const Term& term = controller.getTermList().front().second;
+            return "/courses/" + term.getCourseList().front().first;
+        }
+    };
+}
+
+// ====================================
+// DAEMON BENCHMARKS
+// ====================================
+
+// one keep-alive client waiting for each response before sending the next, as SyncEngine does
+static void BM_DaemonRoundTrip(benchmark::State& state) {
+    Daemon daemon;
+    HttpClient client{"127.0.0.1", daemon.server.getPort()};
+    std::string target = daemon.courseTarget();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(client.request("GET", target));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DaemonRoundTrip)->UseRealTime();
+
+// batches of n pipelined requests on one connection, which measures the server rather than the round trip
+static void BM_DaemonPipelined(benchmark::State& state) {
+    Daemon daemon;
+    std::string target = daemon.courseTarget();
+    std::string batch;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        batch.append("GET ").append(target).append(" HTTP/1.1\r\nHost: bench\r\n\r\n");
+    }
+
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(daemon.server.getPort());
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        state.SkipWithError("Could not connect to the daemon.");
+        ::close(fd);
+        return;
+    }
+
+    std::vector<char> buffer(256 * 1024);
+    for (auto _ : state) {
+        ::send(fd, batch.data(), batch.size(), MSG_NOSIGNAL);
+
+        // each response is four header lines and a blank one, and a JSON body never holds a raw newline
+        std::int64_t lines = 0;
+        while (lines < state.range(0) * 5) {
+            ssize_t received = ::recv(fd, buffer.data(), buffer.size(), 0);
+            if (received <= 0) {
+                state.SkipWithError("The daemon closed the connection.");
+                break;
+            }
+            for (ssize_t i = 0; i < received; ++i) {
+                lines += buffer[static_cast<std::size_t>(i)] == '\n';
+            }
+        }
+    }
+    ::close(fd);
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DaemonPipelined)->Arg(16)->Arg(256)->UseRealTime();
+
+// polling one whole term for changes, plainly (0) or through a ResponseCache (1), which the daemon answers with an
+// empty 304 while the term is unchanged
+static void BM_DaemonTreePoll(benchmark::State& state) {
+    Daemon daemon;
+    HttpClient client{"127.0.0.1", daemon.server.getPort()};
+    ResponseCache cache;
+    std::string target = daemon.treeTarget();
+
+    for (auto _ : state) {
+        if (state.range(0) == 0) {
+            benchmark::DoNotOptimize(client.request("GET", target));
+        } else {
+            benchmark::DoNotOptimize(cache.get(client, target));
+        }
+    }
+
+    // the share of polls that came back without a body
+    state.counters["not_modified"] = benchmark::Counter(static_cast<double>(cache.getHitCount()),
+        benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DaemonTreePoll)->Arg(0)->Arg(1)->UseRealTime();
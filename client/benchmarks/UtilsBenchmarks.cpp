@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include "trace/Trace.hpp"
+#include "utils/ThreadPool.hpp"
+#include "utils/utils.hpp"
+
+// ====================================
+// DATE BENCHMARKS
+// ====================================
+
+// parses a batch of n dates, as an import of n records would
+static void BM_ParseDate(benchmark::State& state) {
+    std::vector<std::string> dates;
+    for (int i = 0; i < state.range(0); ++i) {
+        dates.push_back("2026-" + std::to_string(1 + i % 12) + "-" + std::to_string(1 + i % 28));
+    }
+
+    for (auto _ : state) {
+        for (const std::string& date : dates) {
+            benchmark::DoNotOptimize(utils::parseDate(date));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_ParseDate)->RangeMultiplier(8)->Range(8, 4096)->Complexity();
+
+
+// ====================================
+// UUID BENCHMARKS
+// ====================================
+
+// generates a batch of n ids, as creating n entities would
+static void BM_GenerateUuid(benchmark::State& state) {
+    for (auto _ : state) {
+        for (int i = 0; i < state.range(0); ++i) {
+            benchmark::DoNotOptimize(utils::generateUuid());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_GenerateUuid)->RangeMultiplier(8)->Range(8, 4096)->Complexity();
+
+
+// ====================================
+// TRACE BENCHMARKS
+// ====================================
+
+// cost of one TRACE_SCOPE while tracing is off, which is what every instrumented call pays by default
+static void BM_TraceScopeDisabled(benchmark::State& state) {
+    trace::disable();
+    for (auto _ : state) {
+        TRACE_SCOPE("bench::disabled");
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_TraceScopeDisabled);
+
+// cost of one TRACE_SCOPE while profiling, with or without Chrome trace events
+static void BM_TraceScopeEnabled(benchmark::State& state) {
+    trace::enable(state.range(0) != 0);
+    for (auto _ : state) {
+        TRACE_SCOPE("bench::enabled");
+        benchmark::ClobberMemory();
+    }
+    trace::disable();
+    trace::reset();
+}
+BENCHMARK(BM_TraceScopeEnabled)->Arg(0)->Arg(1);
+
+
+// ====================================
+// SCHEDULER BENCHMARKS
+// ====================================
+
+// 64k items of about a microsecond each on a pool of n threads; real time falls as n grows up to the core count
+static void BM_ParallelForScaling(benchmark::State& state) {
+    utils::ThreadPool pool{static_cast<std::size_t>(state.range(0))};
+    std::vector<double> results(1 << 16);
+
+    for (auto _ : state) {
+        pool.parallelFor(results.size(), [&results](std::size_t i) {
+            double x = static_cast<double>(i);
+            for (int step = 0; step < 256; ++step) {
+                x = x * 0.999 + 1.0;
+            }
+            results[i] = x;
+        });
+        benchmark::DoNotOptimize(results.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(results.size()));
+}
+BENCHMARK(BM_ParallelForScaling)->RangeMultiplier(2)->Range(1, 32)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// queues 16k empty tasks from outside the pool and waits; the cost of a task with nothing in it
+static void BM_TaskGroupOverhead(benchmark::State& state) {
+    utils::ThreadPool pool{static_cast<std::size_t>(state.range(0))};
+
+    for (auto _ : state) {
+        utils::TaskGroup group{pool};
+        for (int i = 0; i < (1 << 14); ++i) {
+            group.run([]() {});
+        }
+        group.wait();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (1 << 14));
+}
+BENCHMARK(BM_TaskGroupOverhead)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+#include <sstream>
+#include "BenchData.hpp"
+#include "view/cli/CliView.hpp"
+
+// ====================================
+// CLI LISTING BENCHMARKS
+// ====================================
+
+// the CLI only lists through its menus, so each run scripts the menu path to one listing and back out;
+// the fixed menu output is small next to the listing once n grows
+
+// lists n courses by opening the course selection prompt
+static void BM_CliCourseListing(benchmark::State& state) {
+    TermController controller;
+    bench::fillController(controller, static_cast<std::size_t>(state.range(0)), 0);
+    const std::string script = "S\nSpring 2026\nS\nCourse 0\nX\nX\nX\n";
+    std::size_t bytes = 0;
+
+    for (auto _ : state) {
+        std::istringstream is{script};
+        std::ostringstream os;
+        CliView view{controller, is, os};
+        view.run();
+        bytes = os.str().size();
+    }
+
+    state.counters["bytes"] = static_cast<double>(bytes);
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_CliCourseListing)->RangeMultiplier(8)->Range(8, 512)->Complexity();
+
+// lists n assignments through the view assignments menu
+static void BM_CliAssignmentListing(benchmark::State& state) {
+    TermController controller;
+    bench::fillController(controller, 1, static_cast<std::size_t>(state.range(0)));
+    const std::string script = "S\nSpring 2026\nS\nCourse 0\nV\nA\nX\nX\nX\n";
+    std::size_t bytes = 0;
+
+    for (auto _ : state) {
+        std::istringstream is{script};
+        std::ostringstream os;
+        CliView view{controller, is, os};
+        view.run();
+        bytes = os.str().size();
+    }
+
+    state.counters["bytes"] = static_cast<double>(bytes);
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_CliAssignmentListing)->RangeMultiplier(8)->Range(8, 4096)->Complexity();
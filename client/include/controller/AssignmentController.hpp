@@ -10,24 +10,29 @@
  */
 
 #include <string>
+#include <string_view>
 #include <chrono>
 #include <QObject>
 #include <unordered_map>
 #include "model/Course.hpp"
 #include "model/Assignment.hpp"
+#include "model/DueIndex.hpp"
+#include "controller/ControllerContext.hpp"
+#include "controller/UndoLog.hpp"
+#include "utils/utils.hpp"
 
 class AssignmentController : public QObject {
     Q_OBJECT
 
     public:
-        explicit AssignmentController(Course& course);
+        AssignmentController(Course& course, const ControllerContext& context);
         AssignmentController(const AssignmentController&) = delete;
         AssignmentController& operator=(const AssignmentController&) = delete;
         AssignmentController(AssignmentController&&) = delete;
         AssignmentController& operator=(AssignmentController&&) = delete;
 
         const std::unordered_map<std::string, Assignment>& getAssignmentList() const;
-        std::string getAssignmentId(const std::string& title) const;
+        const std::string& getAssignmentId(std::string_view title) const;
 
         void addAssignment(const std::string& title, const std::string& description, const std::string& category,
             const std::chrono::year_month_day& dueDate, bool completed, float grade);
@@ -41,13 +46,25 @@ class AssignmentController : public QObject {
         void removeAssignment(const std::string& title);
         const Assignment& findAssignment(const std::string& title) const;
         Assignment& findAssignment(const std::string& title);
+        void applyRemoteAssignment(const Assignment& assignment);
+        void removeRemoteAssignment(const std::string& id);
 
     signals:
         void dataChanged();
 
     private:
         Course& course_;
-        std::unordered_map<std::string, std::string> titleToId_{};
+        const ControllerContext& context_;     // owned by the TermController, or by a test
+        utils::TitleIndex titleToId_{};
+
+        void updateCompleted(const std::string& id, bool completed);
+        void moveDueEntry(const DueKey& before, const Assignment& assignment);
+        void updateSearchEntry(const Assignment& assignment);
+        void restoreAssignment(const Assignment& assignment);
+        void restoreGrade(const std::string& id, float grade, bool completed);
+        void recordPresence(const char* label, const Assignment& assignment, bool added);
+        void recordGrade(const char* label, const std::string& id, float gradeBefore, bool completedBefore);
+        void recordChange(const std::string& id, bool removed = false);
 };
 
 #endif  // ASSIGNMENTCONTROLLER_HPP
\ No newline at end of file
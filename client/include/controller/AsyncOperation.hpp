@@ -0,0 +1,81 @@
+#ifndef ASYNCOPERATION_HPP
+#define ASYNCOPERATION_HPP
+
+/**
+ * @file AsyncOperation.hpp
+ * @brief Definition of AsyncOperation, the handle a controller returns for work too long to run inside a slot.
+ *
+ * An operation has up to two parts. The background part runs on the shared thread pool and must not touch the
+ * controllers; it parses, serializes or reads a published Snapshot. The step part runs on the thread that owns
+ * the operation (the UI thread), once per pass of its event loop, until it reports that it is done; it is where
+ * the model changes, and each call is expected to stop after about stepBudget so the window keeps redrawing.
+ * Either part may be left out. Once the operation ends, the step is destroyed on the pool, so it mustn't
+ * capture anything that has to be destroyed on its own thread.
+ *
+ * Everything the caller sees arrives as a queued signal on the owning thread, so a caller can connect to the
+ * operation after starting it without missing anything. progressChanged is coalesced: however often the work
+ * reports progress, at most one update is queued at a time. Exactly one of finished, failed or cancelled ends
+ * the operation.
+ *
+ * cancel() takes effect the next time the work reports progress, which then throws OperationCancelled, and
+ * before the next step. Destroying a running operation cancels it and waits for its background part to stop.
+ *
+ * Provides declarations only; see AsyncOperation.cpp for implementations.
+ */
+
+#include <atomic>           // for progress and cancellation across threads
+#include <chrono>           // for the step budget
+#include <cstddef>          // for progress counts
+#include <functional>       // for the two parts
+#include <stdexcept>        // for OperationCancelled
+#include <QObject>
+#include <QString>
+#include "utils/ThreadPool.hpp"
+
+// thrown out of reportProgress once the operation has been cancelled
+class OperationCancelled : public std::runtime_error {
+    public:
+        OperationCancelled() : std::runtime_error{"Operation cancelled."} {}
+};
+
+class AsyncOperation : public QObject {
+    Q_OBJECT
+
+    public:
+        static constexpr std::chrono::milliseconds stepBudget{8};    // half a frame at 60 Hz
+
+        explicit AsyncOperation(QObject* parent = nullptr);
+        ~AsyncOperation() override;
+        AsyncOperation(const AsyncOperation&) = delete;
+        AsyncOperation& operator=(const AsyncOperation&) = delete;
+
+        double getProgress() const;     // from 0 to 1
+        bool isRunning() const;
+        bool isCancelled() const;
+        void cancel();
+
+        // for the controller starting the operation; step returns true once it has nothing left to do
+        void start(std::function<void(AsyncOperation&)> background, std::function<bool()> step = {});
+        void reportProgress(std::size_t done, std::size_t total);      // from either part
+
+    signals:
+        void progressChanged(double progress);
+        void finished();
+        void failed(const QString& message);
+        void cancelled();
+
+    private:
+        std::atomic<double> progress_{0.0};
+        std::atomic<bool> cancelled_{false};
+        std::atomic<bool> progressQueued_{false};
+        std::atomic<bool> running_{false};
+        std::function<bool()> step_{};
+        utils::TaskGroup background_{utils::ThreadPool::shared()};     // last, so it is waited on first
+
+        void runStep();
+        void fail(std::exception_ptr error);
+        void finish();
+        void releaseStep();
+};
+
+#endif  // ASYNCOPERATION_HPP
@@ -0,0 +1,130 @@
+#ifndef CONTROLLERCACHE_HPP
+#define CONTROLLERCACHE_HPP
+
+/**
+ * @file ControllerCache.hpp
+ * @brief Definition of ControllerCache, a bounded least-recently-used cache of child controllers keyed on entity ID.
+ *
+ * TermController keeps one CourseController per term and CourseController keeps one AssignmentController per
+ * course, so reselecting an entity reuses its controller and the title index it already built. Controllers are
+ * QObjects and cannot move, so each lives in its own allocation and keeps its address for as long as it is
+ * cached. Once more than the capacity are cached, the least recently obtained one is destroyed, except for the
+ * pinned one: the active controller a view holds on to, which changes to other entities (e.g. from a pull) go
+ * through the cache as well and must not evict.
+ *
+ * Header-only, since it is a template.
+ */
+
+#include <string>           // for entity IDs
+#include <cstddef>          // for sizes
+#include <iterator>         // for prev
+#include <list>             // for recency order
+#include <memory>           // for owning non-movable controllers
+#include <unordered_map>    // for ID -> entry lookup
+#include <utility>          // for forwarding constructor arguments
+
+template <typename Controller>
+class ControllerCache {
+    public:
+        static constexpr std::size_t defaultCapacity = 8;
+
+        explicit ControllerCache(std::size_t capacity = defaultCapacity) : capacity_{capacity < 1 ? 1 : capacity} {}
+        ControllerCache(const ControllerCache&) = delete;
+        ControllerCache& operator=(const ControllerCache&) = delete;
+
+        std::size_t size() const {
+            return index_.size();
+        }
+
+        std::size_t getCapacity() const {
+            return capacity_;
+        }
+
+        // at least one controller is always kept, so the most recently obtained one stays valid
+        void setCapacity(std::size_t capacity) {
+            capacity_ = capacity < 1 ? 1 : capacity;
+            evictOverflow();
+        }
+
+        bool contains(const std::string& id) const {
+            return index_.contains(id);
+        }
+
+        // returns the cached controller without changing its recency, or nullptr
+        Controller* find(const std::string& id) const {
+            auto it = index_.find(id);
+            return it == index_.end() ? nullptr : it->second->controller.get();
+        }
+
+        // returns the controller for id, building it from args on a miss, and marks it most recently used
+        template <typename... Args>
+        Controller& obtain(const std::string& id, Args&&... args) {
+            auto it = index_.find(id);
+
+            if (it != index_.end()) {
+                entries_.splice(entries_.begin(), entries_, it->second);
+                return *it->second->controller;
+            }
+
+            entries_.push_front(Entry{id, std::make_unique<Controller>(std::forward<Args>(args)...)});
+            index_.emplace(id, entries_.begin());
+            evictOverflow();
+            return *entries_.front().controller;
+        }
+
+        // keeps id's controller from being evicted until another is pinned or it is erased
+        void pin(const std::string& id) {
+            pinned_ = id;
+        }
+
+        // drops the controller for id, if cached; called when its entity is removed
+        void erase(const std::string& id) {
+            if (id == pinned_) {
+                pinned_.clear();
+            }
+
+            auto it = index_.find(id);
+
+            if (it == index_.end()) {
+                return;
+            }
+
+            entries_.erase(it->second);
+            index_.erase(it);
+        }
+
+        void clear() {
+            index_.clear();
+            entries_.clear();
+            pinned_.clear();
+        }
+
+    private:
+        struct Entry {
+            std::string id;
+            std::unique_ptr<Controller> controller;
+        };
+
+        std::size_t capacity_;
+        std::list<Entry> entries_{};    // most recently obtained first
+        std::unordered_map<std::string, typename std::list<Entry>::iterator> index_{};
+        std::string pinned_{};
+
+        // the pinned and the most recently obtained controllers stay, so with a capacity of one both may be cached
+        void evictOverflow() {
+            while (entries_.size() > capacity_) {
+                auto victim = std::prev(entries_.end());
+                if (victim->id == pinned_) {
+                    --victim;
+                }
+                if (victim == entries_.begin()) {
+                    return;
+                }
+
+                index_.erase(victim->id);
+                entries_.erase(victim);
+            }
+        }
+};
+
+#endif  // CONTROLLERCACHE_HPP
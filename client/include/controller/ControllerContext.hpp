@@ -0,0 +1,31 @@
+#ifndef CONTROLLERCONTEXT_HPP
+#define CONTROLLERCONTEXT_HPP
+
+/**
+ * @file ControllerContext.hpp
+ * @brief Definition of ControllerContext, the shared state every course and assignment controller reports to.
+ *
+ * TermController owns the change tracker, both indexes, the undo log and the snapshot publisher, and hands the
+ * one context naming them by reference to every CourseController it creates, cached or temporary, which passes
+ * it on to its AssignmentControllers. Every path through the controllers therefore reaches the same state.
+ *
+ * Operations that must not reach part of it say so in their own code rather than through a narrower context:
+ * applying the server's changes updates the indexes and the snapshot but is neither recorded for sync nor
+ * undone. A controller built on its own, e.g. in a test, may leave any member null, and it is skipped.
+ */
+
+#include "model/DueIndex.hpp"
+#include "model/SearchIndex.hpp"
+#include "controller/SnapshotPublisher.hpp"
+#include "controller/UndoLog.hpp"
+#include "sync/ChangeTracker.hpp"
+
+struct ControllerContext {
+    ChangeTracker* tracker = nullptr;          // receives every local edit for sync
+    DueIndex* dueIndex = nullptr;              // every assignment in every term, by due date
+    SearchIndex* searchIndex = nullptr;        // every term, course and assignment, by the words in them
+    UndoLog* undoLog = nullptr;                // receives every local edit for undo
+    SnapshotPublisher* snapshots = nullptr;    // marked with every committed change
+};
+
+#endif  // CONTROLLERCONTEXT_HPP
@@ -10,29 +10,33 @@
  */
 
 #include <string>
+#include <string_view>
 #include <chrono>
-#include <unordered_map>
-#include <vector>
-#include <optional>
+#include <cstddef>
+#include <memory>
 #include <QObject>
 #include "model/Term.hpp"
 #include "model/Course.hpp"
 #include "controller/AssignmentController.hpp"
+#include "controller/ControllerCache.hpp"
+#include "controller/ControllerContext.hpp"
+#include "controller/UndoLog.hpp"
+#include "utils/utils.hpp"
 
 class CourseController : public QObject {
     Q_OBJECT
 
     public:
-        explicit CourseController(Term& term);
+        CourseController(Term& term, const ControllerContext& context);
         CourseController(const CourseController&) = delete;
         CourseController& operator=(const CourseController&) = delete;
         CourseController(CourseController&&) = delete;
         CourseController& operator=(CourseController&&) = delete;
 
-        const std::unordered_map<std::string, Course>& getCourseList() const;
-        const std::vector<std::string>& getCourseOrder() const;
-        std::string getCourseId(const std::string& title) const;
+        const CourseList& getCourseList() const;
+        const std::string& getCourseId(std::string_view title) const;
         AssignmentController& getAssignmentController();
+        ControllerCache<AssignmentController>& getAssignmentControllerCache();
 
         void addCourse(const std::string& title, const std::string& description, const std::chrono::year_month_day& startDate,
             const std::chrono::year_month_day& endDate, int numCredits, bool active);
@@ -43,9 +47,16 @@ class CourseController : public QObject {
         void editNumCredits(const std::string& id, int newNumCredits);
         void editActive(const std::string& id, bool newActive);
         void removeCourse(const std::string& title);
+        void moveCourse(const std::string& id, std::size_t position);
         const Course& findCourse(const std::string& title) const;
         Course& findCourse(const std::string& title);
         void selectCourse(const std::string& title);
+        void applyRemoteCourse(const Course& course);
+        void applyRemoteAssignment(const std::string& courseId, const Assignment& assignment);
+        void removeRemoteCourse(const std::string& id);
+        void removeRemoteAssignment(const std::string& courseId, const std::string& assignmentId);
+        void replay(const std::string& courseId, const UndoCommand::Step<AssignmentController>& step,
+            UndoCommand::Direction direction);
 
     signals:
         void dataChanged();
@@ -53,10 +64,20 @@ class CourseController : public QObject {
 
     private:
         Term& term_;
+        const ControllerContext& context_;     // owned by the TermController, or by a test
         Course* activeCourse_ = nullptr;
-        std::unordered_map<std::string, std::string> titleToId_{};
-        std::vector<std::string> courseOrder_{};  // preserves insertion order, since courseList_ (an unordered_map) does not
-        std::optional<AssignmentController> assignmentController_{};
+        utils::TitleIndex titleToId_{};
+        ControllerCache<AssignmentController> assignmentControllers_{};    // one per recently selected course
+        AssignmentController* assignmentController_ = nullptr;     // the active course's, owned by the cache
+
+        AssignmentController& obtainAssignmentController(const std::string& courseId);
+        void updateSearchEntry(const Course& course);
+        void restoreCourse(const Course& course, const std::string& nextId);
+        void moveCourseBefore(const std::string& id, const std::string& nextId);
+        std::string getNextCourseId(const std::string& id) const;
+        void recordPresence(const char* label, std::shared_ptr<const Course> course, std::string nextId, bool added);
+        void markSnapshot();
+        void recordChange(const std::string& id, bool removed = false);
 };
 
 #endif  // COURSECONTROLLER_HPP
\ No newline at end of file
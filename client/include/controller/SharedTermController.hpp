@@ -0,0 +1,105 @@
+#ifndef SHAREDTERMCONTROLLER_HPP
+#define SHAREDTERMCONTROLLER_HPP
+
+/**
+ * @file SharedTermController.hpp
+ * @brief Definition of a thread-safe facade over TermController, for a service with many readers and few writers.
+ *
+ * TermController and its child controllers are written for one UI thread: they keep the selected term and course as
+ * raw pointers and update shared indexes in place. The facade owns one TermController behind a reader-writer lock.
+ * A reader runs a callable against the const controller under a shared lock, so any number run at once; a writer
+ * runs one against the controller under an exclusive lock and publishes a snapshot before letting go, so readers
+ * that can work from the last committed state use getSnapshot() and take no lock at all.
+ *
+ * Nothing is addressed by selection. Course and assignment edits name their term and course by ID, and the facade
+ * selects them inside the same exclusive lock, so the active pointers are never visible to a caller and never
+ * outlive the lock that made them. Callables get references into the live model that are only valid while they
+ * run, so they return copies; read and write return by value to match.
+ *
+ * The lock covers the whole tree rather than one term. An edit in any term also updates the cross-term due-date and
+ * search indexes, the change tracker, the undo log and the snapshot marks, so writers to different terms would
+ * serialize on those anyway, and per-term locks would only add a second lock to every operation.
+ *
+ * std::shared_mutex makes no promise about fairness, and glibc's lets a new reader in while a writer waits, so a
+ * steady stream of readers could hold writers off indefinitely. Writers count themselves in before they wait, and
+ * readers that see one waiting stand aside until it is through.
+ *
+ * Provides declarations and the callable-taking templates; see SharedTermController.cpp for the rest.
+ */
+
+#include <string>           // for term and course IDs
+#include <atomic>           // for counting waiting writers
+#include <memory>           // for snapshots
+#include <mutex>            // for exclusive locks
+#include <shared_mutex>     // for the reader-writer lock
+#include <type_traits>      // for callable results
+#include <utility>          // for as_const and forwarding
+#include "controller/TermController.hpp"
+
+class SharedTermController {
+    public:
+        SharedTermController() = default;
+        SharedTermController(const SharedTermController&) = delete;
+        SharedTermController& operator=(const SharedTermController&) = delete;
+
+        std::shared_ptr<const Snapshot> getSnapshot() const;
+
+        // runs read(const TermController&) alongside other readers
+        template <typename Read>
+        auto read(Read&& read) const {
+            for (int waiting = waitingWriters_.load(); waiting > 0; waiting = waitingWriters_.load()) {
+                waitingWriters_.wait(waiting);
+            }
+            std::shared_lock lock{mutex_};
+            return std::forward<Read>(read)(std::as_const(controller_));
+        }
+
+        // runs write(TermController&) alone, then publishes what it changed, even if it throws partway
+        template <typename Write>
+        auto write(Write&& write) {
+            ++waitingWriters_;
+            std::unique_lock lock{mutex_};
+            if (--waitingWriters_ == 0) {
+                waitingWriters_.notify_all();
+            }
+
+            try {
+                if constexpr (std::is_void_v<std::invoke_result_t<Write, TermController&>>) {
+                    std::forward<Write>(write)(controller_);
+                    controller_.publishSnapshot();
+                } else {
+                    auto result = std::forward<Write>(write)(controller_);
+                    controller_.publishSnapshot();
+                    return result;
+                }
+            } catch (...) {
+                controller_.publishSnapshot();
+                throw;
+            }
+        }
+
+        // runs edit(CourseController&) against one term's courses
+        template <typename Edit>
+        auto writeTerm(const std::string& termId, Edit&& edit) {
+            return write([&termId, &edit](TermController& controller) {
+                controller.selectTerm(controller.getTermList().at(termId).getTitle());
+                return std::forward<Edit>(edit)(controller.getCourseController());
+            });
+        }
+
+        // runs edit(AssignmentController&) against one course's assignments
+        template <typename Edit>
+        auto writeCourse(const std::string& termId, const std::string& courseId, Edit&& edit) {
+            return writeTerm(termId, [&courseId, &edit](CourseController& courses) {
+                courses.selectCourse(courses.getCourseList().at(courseId).getTitle());
+                return std::forward<Edit>(edit)(courses.getAssignmentController());
+            });
+        }
+
+    private:
+        mutable std::shared_mutex mutex_{};
+        mutable std::atomic<int> waitingWriters_{0};     // readers hold back while this is nonzero
+        TermController controller_{};
+};
+
+#endif  // SHAREDTERMCONTROLLER_HPP
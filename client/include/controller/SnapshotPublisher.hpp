@@ -0,0 +1,63 @@
+#ifndef SNAPSHOTPUBLISHER_HPP
+#define SNAPSHOTPUBLISHER_HPP
+
+/**
+ * @file SnapshotPublisher.hpp
+ * @brief Definition of the snapshot publisher, which hands other threads immutable copies of the term tree.
+ *
+ * The controllers own the model and change it in place, so nothing but the thread that drives them may read it.
+ * Work that runs elsewhere (an export, a sync, statistics) reads a Snapshot instead: a reference-counted, const
+ * copy of every term that never changes once published, so it needs no locks however long the work takes.
+ *
+ * The controllers mark the term or course each committed change touches. Publishing copies only the terms that
+ * were marked and shares every other term with the previous snapshot, then swaps the new snapshot in atomically,
+ * RCU-style: readers that already hold the old one keep it until they let go, and later readers get the new one.
+ * Marking is cheap and publishing is up to the thread that owns the controllers, so a burst of edits such as an
+ * import costs one copy of each term it touched rather than one per edit.
+ *
+ * Provides declarations only; see SnapshotPublisher.cpp for implementations.
+ */
+
+#include <string>           // for term and course IDs
+#include <cstdint>          // for versions
+#include <memory>           // for shared snapshots and terms
+#include <mutex>            // for swapping the published snapshot
+#include <unordered_map>    // for published terms by ID
+#include <unordered_set>    // for marked IDs
+#include <vector>           // for snapshot terms
+#include "model/Term.hpp"
+
+// every term as it was when published, in the user's order
+struct Snapshot {
+    std::uint64_t version{0};                               // 0 before anything is published
+    std::vector<std::shared_ptr<const Term>> terms{};
+
+    const Term* findTerm(const std::string& id) const;     // null if the term wasn't there
+};
+
+class SnapshotPublisher {
+    public:
+        explicit SnapshotPublisher(const TermList& terms);
+        SnapshotPublisher(const SnapshotPublisher&) = delete;
+        SnapshotPublisher& operator=(const SnapshotPublisher&) = delete;
+
+        std::shared_ptr<const Snapshot> getSnapshot() const;    // safe from any thread
+        bool hasChanges() const;
+
+        // called by the controllers, on the thread that owns them
+        void markTerm(const std::string& id);
+        void markCourse(const std::string& id);
+        std::shared_ptr<const Snapshot> publish();
+
+    private:
+        const TermList& terms_;
+        mutable std::mutex currentMutex_{};    // held only to copy or swap the pointer, never while reading
+        std::shared_ptr<const Snapshot> current_;
+        std::unordered_map<std::string, std::shared_ptr<const Term>> published_{};     // the current snapshot's terms
+        std::unordered_set<std::string> markedTerms_{};
+        std::unordered_set<std::string> markedCourses_{};
+        std::string lastMarked_{};  // edits come in runs against one entity, which then skip the hash lookup
+        bool changed_{false};   // also set by changes that mark no term that still exists, e.g. a removal
+};
+
+#endif  // SNAPSHOTPUBLISHER_HPP
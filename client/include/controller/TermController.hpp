@@ -10,13 +10,25 @@
  */
 
 #include <string>
+#include <string_view>
 #include <chrono>
-#include <unordered_map>
+#include <cstddef>
+#include <memory>
 #include <vector>
-#include <optional>
 #include <QObject>
 #include "model/Term.hpp"
+#include "model/DueIndex.hpp"
+#include "model/SearchIndex.hpp"
+#include "controller/AsyncOperation.hpp"
 #include "controller/CourseController.hpp"
+#include "controller/ControllerCache.hpp"
+#include "controller/ControllerContext.hpp"
+#include "controller/SnapshotPublisher.hpp"
+#include "controller/UndoLog.hpp"
+#include "sync/ChangeTracker.hpp"
+#include "utils/utils.hpp"
+#include "utils/OrderedMap.hpp"
+#include "utils/ThreadPool.hpp"
 
 class TermController : public QObject {
     Q_OBJECT
@@ -26,33 +38,77 @@ class TermController : public QObject {
         TermController(const TermController&) = delete;
         TermController& operator=(const TermController&) = delete;
 
-        const std::unordered_map<std::string, Term>& getTermList() const;
-        const std::vector<std::string>& getTermOrder() const;
-        std::string getTermId(const std::string& title) const;
+        const TermList& getTermList() const;
+        const std::string& getTermId(std::string_view title) const;
         CourseController& getCourseController();
+        ControllerCache<CourseController>& getCourseControllerCache();
         const Term& getActiveTerm() const;
+        ChangeTracker& getChangeTracker();
+        const DueIndex& getDueIndex() const;
+        std::vector<DueAssignment> getAssignmentsDue(const std::chrono::year_month_day& from,
+            const std::chrono::year_month_day& to, bool incompleteOnly = false) const;
+        const SearchIndex& getSearchIndex() const;
+        std::vector<SearchResult> search(std::string_view query, std::size_t limit = SearchIndex::defaultLimit) const;
+        UndoLog& getUndoLog();
+        const UndoLog& getUndoLog() const;
+        std::shared_ptr<const Snapshot> getSnapshot() const;
+        std::shared_ptr<const Snapshot> publishSnapshot();
 
         void addTerm(const std::string& title, const std::chrono::year_month_day& startDate,
             const std::chrono::year_month_day& endDate, bool active);
+        void importTerm(Term term);
         void editTitle(const std::string& id, const std::string& newTitle);
         void editStartDate(const std::string& id, const std::chrono::year_month_day& newStartDate);
         void editEndDate(const std::string& id, const std::chrono::year_month_day& newEndDate);
         void editActive(const std::string& id, bool newActive);
         void removeTerm(const std::string& title);
+        void moveTerm(const std::string& id, std::size_t position);
         const Term& findTerm(const std::string& title) const;
         Term& findTerm(const std::string& title);
         void selectTerm(const std::string& title);
+        void applyRemoteTerm(const Term& term);
+        void applyRemoteCourse(const std::string& termId, const Course& course);
+        void applyRemoteAssignment(const std::string& termId, const std::string& courseId,
+            const Assignment& assignment);
+        void removeRemoteTerm(const std::string& id);
+        void removeRemoteCourse(const std::string& termId, const std::string& courseId);
+        void removeRemoteAssignment(const std::string& termId, const std::string& courseId,
+            const std::string& assignmentId);
+        void undo();
+        void redo();
+        void recomputeAll();
+        void recomputeAll(utils::ThreadPool& pool);
+        AsyncOperation* exportAsync(const std::string& path);     // owned by this controller; see AsyncOperation.hpp
+        AsyncOperation* importAsync(const std::string& path);
+        AsyncOperation* recomputeAllAsync();
 
     signals:
         void dataChanged();
         void termSelected();
 
     private:
-        std::unordered_map<std::string, Term> termList_{};
-        std::unordered_map<std::string, std::string> titleToId_{};
-        std::vector<std::string> termOrder_{};
+        TermList termList_{};
+        utils::TitleIndex titleToId_{};
         Term* activeTerm_ = nullptr;
-        std::optional<CourseController> courseController_{};
+        ChangeTracker changeTracker_{};    // every local edit to the tree, for sync
+        DueIndex dueIndex_{};              // every assignment in every term, by due date
+        SearchIndex searchIndex_{};        // every term, course and assignment, by the words in them
+        UndoLog undoLog_{};                // local edits at every level, for undo and redo
+        SnapshotPublisher snapshots_{termList_};  // immutable copies of the tree, for other threads
+        // the five above, handed to every course controller and through it to every assignment controller
+        ControllerContext context_{&changeTracker_, &dueIndex_, &searchIndex_, &undoLog_, &snapshots_};
+        ControllerCache<CourseController> courseControllers_{};   // one per recently selected term
+        CourseController* courseController_ = nullptr;    // the active term's, owned by the cache
+
+        void insertTerm(Term term);
+        void insertCourse(const std::string& termId, const Course& course);
+        CourseController& obtainCourseController(Term& term);
+        void recordTree(const Term& term, bool remote);
+        void restoreTerm(const Term& term, const std::string& nextId);
+        void moveTermBefore(const std::string& id, const std::string& nextId);
+        std::string getNextTermId(const std::string& id) const;
+        void recordPresence(const char* label, std::shared_ptr<const Term> term, std::string nextId, bool added);
+        void replay(const std::string& ownerId, const UndoCommand::Action& action, UndoCommand::Direction direction);
 };
 
 #endif  // TERMCONTROLLER_HPP
\ No newline at end of file
@@ -0,0 +1,111 @@
+#ifndef UNDOLOG_HPP
+#define UNDOLOG_HPP
+
+/**
+ * @file UndoLog.hpp
+ * @brief Definition of the undo log, which records each local edit as an action that can be run either way.
+ *
+ * Every controller mutation records an UndoCommand holding only what the edit changed: the old and new value of
+ * one field, or the one entity that was added or removed. Undoing or redoing replays the edit in the chosen
+ * direction through the same controller methods a user edit would call, so titles, the due-date and search indexes
+ * and the change tracker all stay in step, and the cost is that of the edit rather than of the tree. Both
+ * directions share one action, so a removed term or course is held once.
+ *
+ * The log is bounded by a memory budget rather than a depth: each command carries an estimate of the bytes it
+ * holds, and once undo and redo together exceed the budget the oldest commands are dropped. Imports and edits
+ * that arrive from the server are not recorded. A command whose replay throws, say because the server has since
+ * deleted what it edits, is dropped, so the history behind it stays reachable.
+ *
+ * Provides declarations only; see UndoLog.cpp for implementations.
+ */
+
+#include <string>           // for owner IDs
+#include <cstddef>          // for sizes
+#include <deque>            // for the undo and redo stacks
+#include <functional>       // for recorded actions
+#include <type_traits>      // for sizing captured values
+#include <utility>          // for moving captured values
+#include <variant>          // for the controller an action runs against
+
+class TermController;
+class CourseController;
+class AssignmentController;
+
+// one undoable edit, run against the kind of controller that made it
+struct UndoCommand {
+    enum class Direction {
+        undo,
+        redo
+    };
+
+    template <typename Controller>
+    using Step = std::function<void(Controller&, Direction)>;
+    using Action = std::variant<Step<TermController>, Step<CourseController>, Step<AssignmentController>>;
+
+    const char* label{""};      // what the edit did, e.g. "edit course title"
+    std::string ownerId{};      // the term of a course action or the course of an assignment action; empty otherwise
+    Action action{};
+    std::size_t bytes{0};       // estimated memory held, including the command itself
+};
+
+class UndoLog {
+    public:
+        using Replay = std::function<void(const std::string& ownerId, const UndoCommand::Action& action,
+            UndoCommand::Direction direction)>;
+
+        static constexpr std::size_t defaultBudget = 1 << 20;
+
+        explicit UndoLog(std::size_t budget = defaultBudget);
+        UndoLog(const UndoLog&) = delete;
+        UndoLog& operator=(const UndoLog&) = delete;
+
+        std::size_t getBudget() const;
+        void setBudget(std::size_t budget);
+        std::size_t getBytes() const;
+        std::size_t getUndoCount() const;
+        std::size_t getRedoCount() const;
+        bool canUndo() const;
+        bool canRedo() const;
+        const char* getUndoLabel() const;
+        const char* getRedoLabel() const;
+        bool isReplaying() const;
+
+        void record(const char* label, std::string ownerId, UndoCommand::Action action, std::size_t payloadBytes);
+
+        // records an edit to one field as a call of the same controller method with the old or the new value
+        template <typename Controller, typename Edit, typename Value>
+        void recordEdit(const char* label, std::string ownerId, const std::string& id, Edit edit, Value before,
+            Value after) {
+            if (replaying_) {
+                return;
+            }
+
+            std::size_t payloadBytes = id.capacity();
+            if constexpr (std::is_same_v<Value, std::string>) {
+                payloadBytes += before.capacity() + after.capacity();
+            }
+
+            record(label, std::move(ownerId), UndoCommand::Step<Controller>{
+                [id, edit, before = std::move(before), after = std::move(after)](Controller& controller,
+                    UndoCommand::Direction direction) {
+                    (controller.*edit)(id, direction == UndoCommand::Direction::undo ? before : after);
+                }}, payloadBytes);
+        }
+
+        void undo(const Replay& replay);
+        void redo(const Replay& replay);
+        void clear();
+
+    private:
+        std::deque<UndoCommand> undo_{};    // oldest first
+        std::deque<UndoCommand> redo_{};    // most recently undone last
+        std::size_t budget_;
+        std::size_t bytes_{0};
+        bool replaying_{false};
+
+        void trim();
+        void replayTop(std::deque<UndoCommand>& from, std::deque<UndoCommand>& to, const Replay& replay,
+            UndoCommand::Direction direction);
+};
+
+#endif  // UNDOLOG_HPP
@@ -0,0 +1,43 @@
+#ifndef ENTITYJSON_HPP
+#define ENTITYJSON_HPP
+
+/**
+ * @file EntityJson.hpp
+ * @brief Definition of the JSON encoding of single Term, Course and Assignment records.
+ *
+ * Records have the same fields as the server's TermCreate, CourseCreate and AssignmentCreate models,
+ * so the same functions serve file import/export and request/response bodies. Reading produces model
+ * objects through fromRow, paired with the parent id the record pointed at; linking records into a
+ * tree is left to the caller. A term record may also carry its courses in a "courses" array, and a
+ * course record its assignments in an "assignments" array, as the server's tree route returns them;
+ * nested records take their parent id from the enclosing record. writeTermTree writes that nested form.
+ *
+ * Provides declarations only; see EntityJson.cpp for implementations.
+ */
+
+#include <istream>          // for input streams
+#include <string>           // for parent ids
+#include <utility>          // for pair
+#include <vector>           // for record lists
+#include "io/JsonWriter.hpp"
+#include "model/EntityKind.hpp"
+#include "model/Term.hpp"
+
+namespace io {
+    // records read from one document, in document order
+    struct EntityBatch {
+        std::vector<Term> terms{};
+        std::vector<std::pair<std::string, Course>> courses{};          // term_id -> Course
+        std::vector<std::pair<std::string, Assignment>> assignments{};  // course_id -> Assignment
+    };
+
+    void writeTerm(JsonWriter& writer, const Term& term);
+    void writeCourse(JsonWriter& writer, const std::string& termId, const Course& course);
+    void writeAssignment(JsonWriter& writer, const std::string& courseId, const Assignment& assignment);
+    void writeTermTree(JsonWriter& writer, const Term& term);
+
+    EntityBatch readTermTree(std::istream& is);
+    EntityBatch readRecords(std::istream& is, EntityKind kind);
+}
+
+#endif  // ENTITYJSON_HPP
@@ -0,0 +1,68 @@
+#ifndef JSONREADER_HPP
+#define JSONREADER_HPP
+
+/**
+ * @file JsonReader.hpp
+ * @brief Definition of the JsonReader class, an event-based (SAX-style) JSON parser over an input stream.
+ *
+ * The reader pulls the stream through a fixed-size buffer and reports each token to a JsonHandler as
+ * soon as it is complete. No document tree is built, so memory use is bounded by the buffer, the
+ * longest single string and the nesting depth, regardless of how large the input is.
+ *
+ * Provides declarations only; see JsonReader.cpp for implementations.
+ */
+
+#include <string>           // for string scratch buffer
+#include <string_view>      // for token values passed to the handler
+#include <istream>          // for input streams
+#include <vector>           // for read buffer
+
+// receives parse events from JsonReader; string views are only valid for the duration of the call
+class JsonHandler {
+    public:
+        virtual ~JsonHandler() = default;
+
+        virtual void startObject() = 0;
+        virtual void endObject() = 0;
+        virtual void startArray() = 0;
+        virtual void endArray() = 0;
+        virtual void key(std::string_view name) = 0;
+        virtual void stringValue(std::string_view value) = 0;
+        virtual void numberValue(double value) = 0;
+        virtual void boolValue(bool value) = 0;
+        virtual void nullValue() = 0;
+};
+
+class JsonReader {
+    public:
+        explicit JsonReader(std::istream& is, std::size_t bufferSize = 64 * 1024);
+
+        void parse(JsonHandler& handler);
+
+    private:
+        static constexpr std::size_t maxDepth_{64};
+
+        std::istream& in_;
+        std::vector<char> buffer_;
+        std::size_t pos_{0};        // next unread byte in buffer_
+        std::size_t end_{0};        // one past the last valid byte in buffer_
+        std::size_t consumed_{0};   // bytes discarded from earlier buffer loads, for error offsets
+        std::string scratch_{};     // reused for string and number tokens
+
+        bool fill();
+        int peek();
+        int get();
+        void expect(char c);
+        void skipWhitespace();
+        [[noreturn]] void fail(const std::string& reason) const;
+
+        void parseValue(JsonHandler& handler, std::size_t depth);
+        void parseObject(JsonHandler& handler, std::size_t depth);
+        void parseArray(JsonHandler& handler, std::size_t depth);
+        void parseString();
+        void parseNumber(JsonHandler& handler);
+        void parseLiteral(const char* literal);
+        unsigned parseHex4();
+};
+
+#endif  // JSONREADER_HPP
@@ -0,0 +1,43 @@
+#ifndef JSONWRITER_HPP
+#define JSONWRITER_HPP
+
+/**
+ * @file JsonWriter.hpp
+ * @brief Definition of the JsonWriter class, which streams JSON text directly to an output stream.
+ *
+ * Values are written as soon as they are produced; no document is built in memory. The writer only
+ * tracks one flag per open object or array so it knows where commas belong.
+ *
+ * Provides declarations only; see JsonWriter.cpp for implementations.
+ */
+
+#include <string_view>      // for non-owning string input
+#include <ostream>          // for output streams
+#include <vector>           // for nesting state
+
+class JsonWriter {
+    public:
+        explicit JsonWriter(std::ostream& os);
+
+        void startObject();
+        void endObject();
+        void startArray();
+        void endArray();
+        void key(std::string_view name);
+        void stringValue(std::string_view value);
+        void numberValue(int value);
+        void numberValue(float value);
+        void numberValue(double value);
+        void boolValue(bool value);
+        void nullValue();
+
+    private:
+        std::ostream& out_;
+        std::vector<bool> firstInScope_{};  // one entry per open object/array; true until the first element is written
+        bool afterKey_{false};              // a key was just written, so the next value needs no comma
+
+        void prepareValue();
+        void writeEscaped(std::string_view str);
+};
+
+#endif  // JSONWRITER_HPP
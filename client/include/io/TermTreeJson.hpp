@@ -0,0 +1,42 @@
+#ifndef TERMTREEJSON_HPP
+#define TERMTREEJSON_HPP
+
+/**
+ * @file TermTreeJson.hpp
+ * @brief Definition of the JSON import and export of the whole TermController tree.
+ *
+ * The document is an object with three flat arrays, "terms", "courses" and "assignments", whose
+ * records have the same fields as the server's TermCreate, CourseCreate and AssignmentCreate models
+ * (courses and assignments point at their parent through term_id and course_id). Export streams
+ * straight from the model, or from a published Snapshot off the controller's thread, through JsonWriter;
+ * import streams through JsonReader and only keeps the record currently being read, plus the model objects
+ * it has already built.
+ *
+ * Import is split in two for callers that keep the controller on another thread: readTerms parses and links a
+ * document into finished terms without touching any controller, so it can run anywhere, and importTerms checks
+ * them against the controller and adds them. Both readTerms and the snapshot export take an optional progress
+ * callback, which may throw to stop the work.
+ *
+ * Provides declarations only; see TermTreeJson.cpp for implementations.
+ */
+
+#include <cstddef>          // for progress counts
+#include <functional>       // for progress callbacks
+#include <istream>          // for input streams
+#include <ostream>          // for output streams
+#include <vector>           // for read terms
+#include "controller/SnapshotPublisher.hpp"
+#include "controller/TermController.hpp"
+
+namespace io {
+    using Progress = std::function<void(std::size_t done, std::size_t total)>;
+
+    void exportTermTree(const TermController& controller, std::ostream& os);
+    void exportTermTree(const Snapshot& snapshot, std::ostream& os, const Progress& progress = {});  // from any thread
+    void importTermTree(std::istream& is, TermController& controller);
+    std::vector<Term> readTerms(std::istream& is, const Progress& progress = {});     // from any thread; bytes read
+    void checkImport(const std::vector<Term>& terms, const TermController& controller);
+    void importTerms(std::vector<Term> terms, TermController& controller);
+}
+
+#endif  // TERMTREEJSON_HPP
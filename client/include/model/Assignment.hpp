@@ -42,6 +42,8 @@ class Assignment {
         bool operator==(const Assignment &other) const;
 
     private:
+        friend class MemoryAccounting;     // reads string and container capacities for memory reports
+
         std::string id_{};  // UUID v4 automatically generated during construction
         std::string title_{};
         std::string description_{};
@@ -50,6 +52,9 @@ class Assignment {
         bool completed_{false};
         float grade_{0.0f};
 
+        Assignment(std::string id, std::string title, std::string description, std::string category,
+            std::chrono::year_month_day dueDate, bool completed, float grade);
+
         void validateGrade(float grade);
 };
 
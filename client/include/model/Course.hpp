@@ -15,8 +15,11 @@
 #include <chrono>           // for date and time-related variables
 #include <iostream>         // for i/o streams
 #include <map>              // for GPA scale
+#include <set>              // for the due-date index
+#include <vector>           // for due-date query results
 #include <unordered_map>    // for weights, GPA values, and assignmentList
 #include "model/Assignment.hpp"   // for usage of Assignment objects in Course
+#include "model/DueIndex.hpp"     // for the due-date index key
 
 class Course {
     public:
@@ -36,6 +39,8 @@ class Course {
         float getGpaVal() const;
         bool getActive() const;
         std::map<float, std::string> getGradeScale() const;     // need to test
+        std::vector<const Assignment*> getAssignmentsDue(std::chrono::year_month_day from, std::chrono::year_month_day to,
+            bool incompleteOnly = false) const;
         void setTitle(std::string newTitle);
         void setDescription(std::string newDescription);
         void setStartDate(std::chrono::year_month_day newStartDate);
@@ -48,12 +53,15 @@ class Course {
         void setLetterGrade();
         void setGpaVal();
         void setActive(bool newActive);
+        void setAssignmentDueDate(const std::string& id, std::chrono::year_month_day newDueDate);
+        void setAssignmentCompleted(const std::string& id, bool newCompleted);
 
         void printCourseInfo(std::ostream& os = std::cout) const;
         void addAssignment(const Assignment& assignment);
+        void addAssignment(Assignment&& assignment);
         void removeAssignment(const std::string& id);
         const Assignment& findAssignment(const std::string& id) const;    // non-mutable version
-        Assignment& findAssignment(const std::string& id);    // mutable version
+        Assignment& findAssignment(const std::string& id);    // mutable version; due date and completion go through the setters above
         static Course fromRow(std::string id, std::string title, std::string description,
             std::chrono::year_month_day startDate, std::chrono::year_month_day endDate,
             int numCredits, bool active);
@@ -61,12 +69,15 @@ class Course {
         bool operator==(const Course &other) const;
 
     private:
+        friend class MemoryAccounting;     // reads string and container capacities for memory reports
+
         std::string id_{};  // UUID v4 automatically generated during construction
         std::string title_{};
         std::string description_{};
         std::chrono::year_month_day startDate_{};
         std::chrono::year_month_day endDate_{};
         std::unordered_map<std::string, Assignment> assignmentList_{};  // id -> Assignment
+        std::set<DueKey> dueIndex_{};   // assignments ordered by completion, due date and id
         static const std::unordered_map<std::string, float> gradeWeightsDefault_;   // default grade weights if not set
         std::unordered_map<std::string, float> gradeWeights_{gradeWeightsDefault_}; // weights of each assignment category
         std::unordered_map<std::string, float> gradesByCategory_;   // average percentage grade per category for categories with at least one completed assignment
@@ -79,6 +90,9 @@ class Course {
         std::map<float, std::string> gradeScale_{gradeScaleDefault_};     // lower grade thresholds for letter grades
         static const std::unordered_map<std::string, float> gpaScale_;       // GPA values based on letter grades
 
+        Course(std::string id, std::string title, std::string description, std::chrono::year_month_day startDate,
+            std::chrono::year_month_day endDate, int numCredits, bool active);
+
         void validateGradeWeights(const std::unordered_map<std::string, float>& gradeWeights);
         void validateNumCredits(int numCredits);
         void validateGradePct(float gradePct);
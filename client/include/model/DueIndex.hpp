@@ -0,0 +1,117 @@
+#ifndef DUEINDEX_HPP
+#define DUEINDEX_HPP
+
+/**
+ * @file DueIndex.hpp
+ * @brief Definition of the due-date index, which keeps assignments ordered by due date for range queries.
+ *
+ * Entries are keyed on completion, then due date, then assignment ID, so incomplete assignments form one
+ * contiguous run and "due between two dates" costs two tree searches plus one step per match. Each Course
+ * indexes its own assignments with a set of DueKeys; TermController keeps a DueIndex across every term.
+ *
+ * Provides declarations only; see DueIndex.cpp for implementations.
+ */
+
+#include <string>           // for string variables
+#include <chrono>           // for date and time-related variables
+#include <compare>          // for key ordering
+#include <map>              // for the ordered index
+#include <tuple>            // for tie in merged walks
+#include <unordered_map>    // for course -> term lookup
+
+class Assignment;
+class Course;
+class Term;
+
+// position of one assignment in a due-date index; incomplete assignments sort before completed ones
+struct DueKey {
+    bool completed{false};
+    std::chrono::sys_days dueDate{};
+    std::string id{};
+
+    static DueKey of(const Assignment& assignment);
+    auto operator<=>(const DueKey& other) const = default;
+};
+
+// one result of a cross-term due-date query
+struct DueAssignment {
+    const Term* term{nullptr};
+    const Course* course{nullptr};
+    const Assignment* assignment{nullptr};
+};
+
+namespace due {
+    inline const DueKey& keyOf(const DueKey& entry) {
+        return entry;
+    }
+
+    template <typename Value>
+    const DueKey& keyOf(const std::pair<const DueKey, Value>& entry) {
+        return entry.first;
+    }
+
+    // calls visit on each entry of a set or map keyed on DueKey that is due from `from` to `to` inclusive,
+    // in due-date order; with both completion runs in range, the two are merged as they are walked
+    template <typename Index, typename Visit>
+    void forEachDue(const Index& index, std::chrono::sys_days from, std::chrono::sys_days to, bool incompleteOnly,
+        Visit visit) {
+        if (to < from) {
+            return;
+        }
+
+        const std::chrono::sys_days end = to + std::chrono::days{1};
+        auto open = index.lower_bound(DueKey{false, from, {}});
+        auto openEnd = index.lower_bound(DueKey{false, end, {}});
+
+        if (incompleteOnly) {
+            for (; open != openEnd; ++open) {
+                visit(*open);
+            }
+            return;
+        }
+
+        auto done = index.lower_bound(DueKey{true, from, {}});
+        auto doneEnd = index.lower_bound(DueKey{true, end, {}});
+
+        while (open != openEnd || done != doneEnd) {
+            bool takeOpen = done == doneEnd || (open != openEnd &&
+                std::tie(keyOf(*open).dueDate, keyOf(*open).id) < std::tie(keyOf(*done).dueDate, keyOf(*done).id));
+
+            if (takeOpen) {
+                visit(*open++);
+            } else {
+                visit(*done++);
+            }
+        }
+    }
+}
+
+class DueIndex {
+    public:
+        std::size_t size() const;
+        bool contains(const DueKey& key) const;
+
+        void addTerm(const Term& term);
+        void removeTerm(const Term& term);
+        void addCourse(const Course& course, const std::string& termId);
+        void removeCourse(const Course& course);
+        void addAssignment(const Assignment& assignment, const std::string& courseId);
+        void removeAssignment(const Assignment& assignment);
+        void moveAssignment(const DueKey& before, const Assignment& assignment);   // after a due date or completion edit
+
+        // calls visit(key, courseId, termId) for each assignment due from `from` to `to`, in due-date order
+        template <typename Visit>
+        void forEachDue(std::chrono::sys_days from, std::chrono::sys_days to, bool incompleteOnly, Visit visit) const {
+            due::forEachDue(entries_, from, to, incompleteOnly, [&visit](const auto& entry) {
+                visit(entry.first, entry.second->first, entry.second->second);
+            });
+        }
+
+    private:
+        using CourseTerm = std::pair<const std::string, std::string>;
+
+        std::unordered_map<std::string, std::string> courseTerms_{};     // course ID -> term ID
+        std::map<DueKey, const CourseTerm*> entries_{};     // key -> its course's entry above, which outlives it
+};
+
+#endif  // DUEINDEX_HPP
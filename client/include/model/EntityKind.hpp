@@ -0,0 +1,15 @@
+#ifndef ENTITYKIND_HPP
+#define ENTITYKIND_HPP
+
+/**
+ * @file EntityKind.hpp
+ * @brief Definition of the EntityKind enum, which names the three record types shared by the client and the server.
+ */
+
+enum class EntityKind {
+    term,
+    course,
+    assignment
+};
+
+#endif  // ENTITYKIND_HPP
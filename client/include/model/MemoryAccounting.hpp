@@ -0,0 +1,75 @@
+#ifndef MEMORYACCOUNTING_HPP
+#define MEMORYACCOUNTING_HPP
+
+/**
+ * @file MemoryAccounting.hpp
+ * @brief Definition of the MemoryAccounting class, which reports how much memory the model uses.
+ *
+ * A Footprint is the bytes an object occupies (its own size plus everything it owns on the heap)
+ * and the number of heap blocks behind them. Heap usage is derived from string capacities and
+ * container sizes using the node layouts of libstdc++ and libc++, so it counts the bytes requested
+ * from the allocator, not allocator overhead. Statics such as the default grade scale are shared
+ * by every course and are not counted.
+ *
+ * measure() splits a controller's tree into per-type shares: each assignment's share is its node in
+ * the course's map, its key and its own heap; each course's share likewise excludes its assignments,
+ * and each term's excludes its courses. The shares add up to the whole tree.
+ *
+ * Provides declarations only; see MemoryAccounting.cpp for implementations.
+ */
+
+#include <cstddef>          // for sizes
+#include <ostream>          // for reports
+#include <string>           // for term titles
+#include <vector>           // for per-term rows
+#include "controller/TermController.hpp"
+#include "model/Assignment.hpp"
+#include "model/Course.hpp"
+#include "model/Term.hpp"
+
+struct Footprint {
+    std::size_t bytes{0};
+    std::size_t allocations{0};
+
+    Footprint& operator+=(const Footprint& other);
+};
+
+Footprint operator+(Footprint a, const Footprint& b);
+
+struct MemoryReport {
+    struct TermUsage {
+        std::string title;
+        std::size_t courseCount{0};
+        std::size_t assignmentCount{0};
+        Footprint footprint{};     // the term with all of its courses and assignments
+    };
+
+    std::size_t termCount{0};
+    std::size_t courseCount{0};
+    std::size_t assignmentCount{0};
+    Footprint terms{};          // each share excludes the entity's children
+    Footprint courses{};
+    Footprint assignments{};
+    Footprint container{};      // the controller's term map itself
+    std::vector<TermUsage> perTerm{};
+
+    Footprint total() const;
+};
+
+class MemoryAccounting {
+    public:
+        static Footprint of(const Assignment& assignment);
+        static Footprint of(const Course& course);      // including its assignments
+        static Footprint of(const Term& term);          // including its courses and their assignments
+
+        static MemoryReport measure(const TermController& controller);
+        static void writeReport(const MemoryReport& report, std::ostream& os);
+
+    private:
+        // heap owned directly by the entity, excluding its children and its own size
+        static Footprint heapOf(const Assignment& assignment);
+        static Footprint heapOf(const Course& course);
+        static Footprint heapOf(const Term& term);
+};
+
+#endif  // MEMORYACCOUNTING_HPP
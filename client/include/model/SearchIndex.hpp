@@ -0,0 +1,120 @@
+#ifndef SEARCHINDEX_HPP
+#define SEARCHINDEX_HPP
+
+/**
+ * @file SearchIndex.hpp
+ * @brief Definition of the full-text search index over term, course and assignment titles, descriptions and categories.
+ *
+ * Every indexed entity gets a slot holding its case-folded fields, and one inverted index maps grams of its words
+ * (runs of letters and digits) to sorted slot lists: every trigram, so a query term of three or more characters
+ * can match anywhere inside a word, and the first one and two characters, so a shorter term can match the start
+ * of one. A query walks the shortest postings list, skipping ahead in the others, then checks and scores each
+ * survivor against its fields: title matches outrank category matches, which outrank description matches, and whole words
+ * outrank prefixes, which outrank matches inside a word. Every query term must match.
+ *
+ * Each gram also counts how many entities have it in each field, which bounds the best score a query
+ * can reach. Ties go to the lower slot, so once the best `limit` matches all reach that bound the walk stops;
+ * a broad query such as a category name costs about `limit` candidates rather than one per match.
+ *
+ * Removing an entity leaves its slot in the postings rather than shifting every list it appears in, since a common
+ * gram can be held by nearly every entity. Candidates are checked against their fields anyway, so a stale slot is
+ * only skipped; it is dropped if the slot is reused without the gram, and the postings are rebuilt once stale
+ * slots outnumber live ones. An edit then costs the grams it touches, not the size of the index.
+ *
+ * TermController keeps one SearchIndex across every term and threads it down to the course and assignment
+ * controllers, which keep it current as entities are added, edited and removed.
+ *
+ * Provides declarations only; see SearchIndex.cpp for implementations.
+ */
+
+#include <string>           // for string variables
+#include <string_view>      // for queries and fields
+#include <array>            // for per-entity fields
+#include <cstddef>          // for sizes
+#include <cstdint>          // for slots and packed grams
+#include <unordered_map>    // for ID -> slot and the gram index
+#include <utility>          // for (gram, field) pairs
+#include <vector>           // for postings and results
+#include "model/EntityKind.hpp"
+
+class Assignment;
+class Course;
+class Term;
+
+// one match from SearchIndex::search, best first
+struct SearchHit {
+    EntityKind kind{EntityKind::term};
+    std::string id{};
+    std::string courseId{};     // the course an assignment belongs to; empty otherwise
+    std::string termId{};       // the term a course or assignment belongs to; empty for a term
+    float score{0.0f};
+};
+
+// one result of a cross-term search, resolved to the entities it names
+struct SearchResult {
+    const Term* term{nullptr};
+    const Course* course{nullptr};          // null when the match is a term
+    const Assignment* assignment{nullptr};  // null when the match is a term or course
+    float score{0.0f};
+};
+
+class SearchIndex {
+    public:
+        static constexpr std::size_t defaultLimit = 20;
+
+        std::size_t size() const;
+        bool contains(const std::string& id) const;
+        void reserve(std::size_t count);    // room for count more entities without rehashing, e.g. before an import
+
+        void addTerm(const Term& term);         // the term, its courses and their assignments
+        void removeTerm(const Term& term);
+        void addCourse(const Course& course, const std::string& termId);    // the course and its assignments
+        void removeCourse(const Course& course);
+        void addAssignment(const Assignment& assignment, const std::string& courseId);
+        void removeAssignment(const Assignment& assignment);
+
+        // re-reads an entity's fields after a title, description or category edit
+        void updateTerm(const Term& term);
+        void updateCourse(const Course& course);
+        void updateAssignment(const Assignment& assignment);
+
+        std::vector<SearchHit> search(std::string_view query, std::size_t limit = defaultLimit) const;
+
+    private:
+        using Postings = std::vector<std::uint32_t>;    // slots, ascending
+
+        struct Entry {
+            Postings postings{};
+            std::array<std::uint32_t, 3> fieldCounts{};     // entities with it in their title, category, description
+            std::uint32_t live{0};                          // postings whose slot still has the gram
+        };
+
+        static constexpr std::uint32_t noParent = UINT32_MAX;
+
+        struct Document {
+            EntityKind kind{EntityKind::term};
+            std::string id{};                       // empty while the slot is free
+            std::uint32_t parent{noParent};         // the slot of the course or term it belongs to
+            std::array<std::string, 3> fields{};    // title, category and description, case-folded
+        };
+
+        std::vector<Document> docs_{};
+        std::vector<std::uint32_t> freeSlots_{};
+        std::unordered_map<std::string, std::uint32_t> slots_{};    // entity ID -> slot
+        std::unordered_map<std::uint32_t, Entry> grams_{};
+        std::vector<std::pair<std::uint32_t, std::size_t>> scratchGrams_{};    // (gram, field), reused between edits
+        std::size_t livePostings_{0};
+        std::size_t stalePostings_{0};      // slots left behind by removals and edits
+
+        std::uint32_t slotOf(const std::string& id, const char* missing) const;
+        void insert(EntityKind kind, const std::string& id, std::uint32_t parent, std::string_view title,
+            std::string_view category, std::string_view description);
+        void update(const std::string& id, std::string_view title, std::string_view category,
+            std::string_view description);
+        void erase(const std::string& id);
+        void indexFields(std::uint32_t slot, bool add);
+        void compactIfStale();
+        float score(const Document& document, const std::vector<std::string_view>& terms) const;
+};
+
+#endif  // SEARCHINDEX_HPP
@@ -13,8 +13,11 @@
 #include <string>           // for string variables
 #include <chrono>           // for date and time-related variables
 #include <iostream>         // for i/o streams
-#include <unordered_map>    // for courseList
+#include <cstddef>          // for positions
 #include "model/Course.hpp"   // for usage of Course objects in vector
+#include "utils/OrderedMap.hpp"  // for courseList
+
+using CourseList = utils::OrderedMap<std::string, Course>;     // id -> Course, in the user's order
 
 class Term {
     public:
@@ -25,7 +28,7 @@ class Term {
         std::string getTitle() const;
         std::chrono::year_month_day getStartDate() const;
         std::chrono::year_month_day getEndDate() const;
-        const std::unordered_map<std::string, Course>& getCourseList() const;
+        const CourseList& getCourseList() const;
         int getTotalCredits() const;
         float getOvrGpa() const;
         bool getActive() const;
@@ -36,7 +39,13 @@ class Term {
 
         void printTermInfo(std::ostream &os = std::cout) const;
         void addCourse(const Course& course);
+        void addCourse(Course&& course);
         void removeCourse(const std::string& id);
+        void moveCourse(const std::string& id, std::size_t position);
+        void moveCourseBefore(const std::string& id, const std::string& nextId);
+        void recalculateGpa();      // after the courses' grades were recomputed in place
+        int calculateTotalCredits() const;
+        float calculateOvrGpa() const;  // from the courses' current grades, whether or not ovrGpa_ has caught up
         const Course& findCourse(const std::string& id) const;    // non-mutable version
         Course& findCourse(const std::string& id);    // mutable version
         static Term fromRow(std::string id, std::string title, std::chrono::year_month_day startDate,
@@ -45,17 +54,21 @@ class Term {
         bool operator==(const Term &other) const;
 
     private:
+        friend class MemoryAccounting;     // reads string and container capacities for memory reports
+
         std::string id_{};  // UUID v4 automatically generated during construction
         std::string title_{};
         std::chrono::year_month_day startDate_{};
         std::chrono::year_month_day endDate_{};
-        std::unordered_map<std::string, Course> courseList_{};  // id -> Course
+        CourseList courseList_{};
         int totalCredits_{0};
         float ovrGpa_{0.0};
         bool active_{true}; // indicates whether the term is currently ongoing
 
-        int calculateTotalCredits();    // calculates total credits - need to auto call during add or remove Course
-        float calculateOvrGpa();        // calculates overall gpa - need to auto call during add or remove Course
+        Term(std::string id, std::string title, std::chrono::year_month_day startDate,
+            std::chrono::year_month_day endDate, bool active);
 };
 
+using TermList = utils::OrderedMap<std::string, Term>;     // id -> Term, in the user's order
+
 #endif  // TERM_HPP
\ No newline at end of file
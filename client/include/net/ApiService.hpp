@@ -0,0 +1,110 @@
+#ifndef APISERVICE_HPP
+#define APISERVICE_HPP
+
+/**
+ * @file ApiService.hpp
+ * @brief Definition of the ApiService class, which answers the server's REST routes from a TermController.
+ *
+ * The routes, status codes and error details follow server/app/routes/{terms,courses,assignments}.py, so a
+ * client written against the Python server works against this one: the same record shapes (see EntityJson.hpp),
+ * 201 on create, 204 on delete, 404 for an unknown ID, 409 for a duplicate ID or title and 400 for a parent
+ * that doesn't exist. Deleting a term or course deletes what it holds, as the server's foreign keys do. Bodies
+ * that don't parse get 422 with the reader's message as the detail.
+ *
+ * Writes go through the controller's applyRemote* and removeRemote* methods, which address records by ID and leave
+ * the selection, the undo log and the change tracker alone; the service keeps which term each course is in and
+ * which course each assignment is in, so every route is a hash lookup or two rather than a search of the tree.
+ * It also keeps every list's ids in id order, so a page is a range of that index found by one search rather than
+ * a sort of the whole list.
+ * Responses are streamed straight into the response body with a
+ * JsonWriter. Every 200 answer to a GET carries an ETag hashed from its body, and a GET whose If-None-Match
+ * names it gets 304 Not Modified with no body, as the server answers conditional requests. List routes take
+ * the server's ?after=<id>&limit=N keyset pagination, in id order, and ?format=ndjson for one record per line.
+ * /courses/{id}/grade and /terms/{id}/gpa answer from the model's own grade calculation, which the server's
+ * aggregate queries reproduce float for float (see tests/golden/grades.json).
+ * Like the controller, the service is not thread-safe; HttpServer calls it from its one thread.
+ *
+ * Provides declarations only; see ApiService.cpp for implementations.
+ */
+
+#include <cstddef>          // for page sizes
+#include <functional>       // for transparent id comparison
+#include <optional>         // for the after parameter
+#include <set>              // for id-ordered page indexes
+#include <string>           // for ids
+#include <string_view>      // for request data
+#include <unordered_map>    // for parent indexes
+#include "controller/TermController.hpp"
+#include "net/HttpServer.hpp"
+
+class ApiService {
+    public:
+        static constexpr std::size_t defaultPageSize = 100;    // limit when only after is given, as on the server
+        static constexpr std::size_t maxPageSize = 1000;
+
+        explicit ApiService(TermController& controller);   // indexes whatever the controller already holds
+        ApiService(const ApiService&) = delete;
+        ApiService& operator=(const ApiService&) = delete;
+
+        HttpResponse handle(const HttpRequest& request);
+
+    private:
+        // a list route's query parameters; without after or limit the whole list is returned, in model order
+        struct ListQuery {
+            std::optional<std::string> after{};
+            std::size_t limit{0};
+            bool ndjson{false};
+
+            bool paged() const { return after || limit != 0; }
+        };
+
+        using IdSet = std::set<std::string, std::less<>>;
+
+        // the ids of one kind of record in id order, across the tree and per parent
+        struct PageIndex {
+            IdSet all{};
+            std::unordered_map<std::string, IdSet> byParent{};
+
+            void insert(const std::string& parentId, const std::string& id);
+            void erase(const std::string& parentId, const std::string& id);
+            void eraseParent(const std::string& parentId);
+            const IdSet* find(const std::string& parentId) const;   // null if the parent holds nothing
+        };
+
+        TermController& controller_;
+        std::unordered_map<std::string, std::string> courseTerms_{};        // course id -> term id
+        std::unordered_map<std::string, std::string> assignmentCourses_{};  // assignment id -> course id
+        IdSet termPages_{};
+        PageIndex coursePages_{};       // by term
+        PageIndex assignmentPages_{};   // by course
+
+        HttpResponse route(const HttpRequest& request);
+        static ListQuery parseListQuery(std::string_view target);
+
+        HttpResponse listTerms(const ListQuery& query) const;
+        HttpResponse getTerm(const std::string& id) const;
+        HttpResponse getTermTree(const std::string& id) const;
+        HttpResponse getTermGpa(const std::string& id) const;
+        HttpResponse createTerm(std::string_view body);
+        HttpResponse updateTerm(const std::string& id, std::string_view body);
+        HttpResponse deleteTerm(const std::string& id);
+
+        HttpResponse listCourses(const ListQuery& query) const;
+        HttpResponse listCoursesByTerm(const std::string& termId, const ListQuery& query) const;
+        HttpResponse getCourse(const std::string& id) const;
+        HttpResponse getCourseGrade(const std::string& id) const;
+        HttpResponse createCourse(std::string_view body);
+        HttpResponse updateCourse(const std::string& id, std::string_view body);
+        HttpResponse deleteCourse(const std::string& id);
+
+        HttpResponse listAssignments(const ListQuery& query) const;
+        HttpResponse listAssignmentsByCourse(const std::string& courseId, const ListQuery& query) const;
+        HttpResponse getAssignment(const std::string& id) const;
+        HttpResponse createAssignment(std::string_view body);
+        HttpResponse updateAssignment(const std::string& id, std::string_view body);
+        HttpResponse deleteAssignment(const std::string& id);
+
+        const Course* findCourse(const std::string& id) const;
+};
+
+#endif  // APISERVICE_HPP
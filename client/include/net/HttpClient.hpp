@@ -0,0 +1,63 @@
+#ifndef HTTPCLIENT_HPP
+#define HTTPCLIENT_HPP
+
+/**
+ * @file HttpClient.hpp
+ * @brief Definition of the HttpClient class, a small blocking HTTP/1.1 client for talking to the server.
+ *
+ * The client keeps one persistent (keep-alive) connection and sends requests on it one at a time, so
+ * a sync of several changes pays for a single TCP handshake. Bodies are read by Content-Length or
+ * chunked transfer encoding. It only speaks plain HTTP; the server is expected to sit on localhost or
+ * behind a TLS-terminating proxy.
+ *
+ * Provides declarations only; see HttpClient.cpp for implementations.
+ */
+
+#include <chrono>           // for timeouts
+#include <cstdint>          // for port numbers
+#include <string>           // for request and response data
+#include <string_view>      // for header lookups
+#include <utility>          // for header pairs
+#include <vector>           // for header lists
+
+struct HttpResponse {
+    int status{0};
+    std::vector<std::pair<std::string, std::string>> headers{};  // names are lowercased
+    std::string body{};
+
+    std::string header(std::string_view name) const;
+};
+
+class HttpClient {
+    public:
+        HttpClient(std::string host, std::uint16_t port);
+        ~HttpClient();
+        HttpClient(const HttpClient&) = delete;
+        HttpClient& operator=(const HttpClient&) = delete;
+
+        void setTimeout(std::chrono::milliseconds timeout);
+        std::size_t getConnectionCount() const;
+
+        HttpResponse request(std::string_view method, std::string_view target, std::string_view body = {},
+            const std::vector<std::pair<std::string, std::string>>& headers = {});
+        void disconnect();
+
+    private:
+        std::string host_{};
+        std::uint16_t port_{0};
+        std::chrono::milliseconds timeout_{10000};
+        int socket_{-1};
+        std::size_t connectionCount_{0};
+        std::string readBuffer_{};      // bytes received but not yet consumed
+        std::size_t readPos_{0};
+
+        void connect();
+        void sendAll(std::string_view data);
+        bool receiveMore();
+        std::string readLine();
+        void readExact(std::string& out, std::size_t count);
+        HttpResponse readResponse(std::string_view method);
+        void readChunkedBody(HttpResponse& response);
+};
+
+#endif  // HTTPCLIENT_HPP
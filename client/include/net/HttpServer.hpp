@@ -0,0 +1,99 @@
+#ifndef HTTPSERVER_HPP
+#define HTTPSERVER_HPP
+
+/**
+ * @file HttpServer.hpp
+ * @brief Definition of the HttpServer class, a single-threaded HTTP/1.1 server built on epoll (Linux only).
+ *
+ * One thread runs the event loop and calls the handler for every request, so the handler can work on
+ * state that isn't thread-safe (a TermController, say) without locking. Sockets are non-blocking and
+ * connections are kept alive; requests pipelined on one connection are answered in order, each
+ * response appended to the connection's write buffer and sent in as few writes as the socket allows.
+ * Request bodies must be sent with Content-Length: chunked requests get 501, bodies over maxBodySize
+ * get 413, headers over maxHeaderSize get 431 and malformed requests get 400, and each of those closes
+ * the connection. A connection with more than maxPendingOutput waiting to be sent isn't read from until
+ * the client catches up, so a client that pipelines without reading can't grow the buffer without bound.
+ * Likewise, reading stops once the unparsed input could hold the largest request allowed, until it is parsed.
+ * When the process runs out of file descriptors, new connections are accepted and closed at once rather than
+ * left waiting in the backlog.
+ *
+ * HttpRequest holds views into the connection's read buffer, valid only until the handler returns.
+ *
+ * Provides declarations only; see HttpServer.cpp for implementations.
+ */
+
+#include <atomic>           // for the connection count
+#include <cstddef>          // for sizes
+#include <cstdint>          // for port numbers
+#include <functional>       // for the handler
+#include <memory>           // for connections
+#include <string>           // for buffers
+#include <string_view>      // for request data
+#include <utility>          // for header pairs
+#include <vector>           // for headers and connections
+#include "net/HttpClient.hpp"   // for HttpResponse
+
+struct HttpRequest {
+    std::string_view method{};
+    std::string_view target{};      // path and query, as sent
+    std::vector<std::pair<std::string_view, std::string_view>> headers{};
+    std::string_view body{};
+
+    std::string_view header(std::string_view name) const;     // case-insensitive; empty if missing
+};
+
+class HttpServer {
+    public:
+        using Handler = std::function<HttpResponse(const HttpRequest&)>;
+
+        static constexpr std::size_t maxHeaderSize = 64 * 1024;
+        static constexpr std::size_t maxBodySize = 8 * 1024 * 1024;
+        static constexpr std::size_t maxPendingOutput = 1024 * 1024;
+
+        HttpServer(const std::string& host, std::uint16_t port, Handler handler);   // port 0 picks a free one
+        ~HttpServer();
+        HttpServer(const HttpServer&) = delete;
+        HttpServer& operator=(const HttpServer&) = delete;
+
+        std::uint16_t getPort() const;
+        std::size_t getConnectionCount() const;     // connections currently open
+
+        void run();     // serves until stop() is called
+        void stop();    // safe to call from any thread, or from the handler
+
+    private:
+        struct Connection {
+            int fd{-1};
+            std::string in{};           // bytes received and not yet consumed
+            std::size_t inPos{0};
+            std::string out{};          // responses not yet sent
+            std::size_t outPos{0};
+            std::uint32_t events{0};    // what the connection is registered with epoll for
+            bool continueSent{false};   // answered Expect: 100-continue for the request being read
+            bool closing{false};        // close once out has been sent
+            bool peerClosed{false};     // the client has shut down its side; nothing more will arrive
+        };
+
+        Handler handler_;
+        int listenFd_{-1};
+        int epollFd_{-1};
+        int wakeFd_{-1};
+        int spareFd_{-1};               // held in reserve so a connection can be accepted and refused at the fd limit
+        bool listening_{true};          // whether the listening socket is in the epoll set
+        std::uint16_t port_{0};
+        std::vector<std::unique_ptr<Connection>> connections_{};     // indexed by file descriptor
+        std::atomic<std::size_t> connectionCount_{0};
+        HttpRequest request_{};         // reused for every request, so its header list keeps its capacity
+
+        void accept();
+        bool refuse();
+        void read(Connection& connection);
+        void flush(Connection& connection);
+        bool parse(Connection& connection);
+        void watch(Connection& connection, std::uint32_t events);
+        void respond(Connection& connection, const HttpResponse& response, bool close);
+        void fail(Connection& connection, int status, std::string_view detail);
+        void close(Connection& connection);
+};
+
+#endif  // HTTPSERVER_HPP
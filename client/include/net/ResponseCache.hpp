@@ -0,0 +1,42 @@
+#ifndef RESPONSECACHE_HPP
+#define RESPONSECACHE_HPP
+
+/**
+ * @file ResponseCache.hpp
+ * @brief Definition of the ResponseCache class, which revalidates stored GET responses by their ETag.
+ *
+ * A GET through the cache sends If-None-Match with the tag the server last gave for that target. When the
+ * server answers 304 Not Modified, which has no body, the stored headers and body are filled in and the
+ * status is left at 304, so a caller gets the payload either way and can also tell that it has not changed
+ * since the last time and skip reprocessing it. Only 200 responses that carry an ETag are stored; any other
+ * answer drops what was stored for the target.
+ *
+ * Entries are kept per target until they are erased or the cache is cleared. A caller that could not make use
+ * of a payload erases its target, so the next GET is unconditional rather than answered 304 for data it never
+ * applied. The cache is not thread-safe.
+ *
+ * Provides declarations only; see ResponseCache.cpp for implementations.
+ */
+
+#include <cstddef>          // for counts
+#include <string>           // for targets
+#include <unordered_map>    // for entries by target
+#include "net/HttpClient.hpp"
+
+class ResponseCache {
+    public:
+        HttpResponse get(HttpClient& client, const std::string& target);
+
+        bool contains(const std::string& target) const;
+        void erase(const std::string& target);
+        void clear();
+
+        std::size_t size() const;
+        std::size_t getHitCount() const;    // GETs the server answered 304
+
+    private:
+        std::unordered_map<std::string, HttpResponse> entries_{};
+        std::size_t hitCount_{0};
+};
+
+#endif  // RESPONSECACHE_HPP
@@ -0,0 +1,77 @@
+#ifndef CHANGETRACKER_HPP
+#define CHANGETRACKER_HPP
+
+/**
+ * @file ChangeTracker.hpp
+ * @brief Definition of the ChangeTracker class, which records which entities changed since the last sync.
+ *
+ * The controllers report every local mutation here. Each entity gets a version counter that is bumped
+ * on every change, so a sync can send the version it saw and only clear the dirty flag if nothing
+ * changed while the request was in flight. Repeated edits to one entity collapse into a single pending
+ * change, and entities that are created and removed between syncs never reach the server at all.
+ * Entities are also filed under their parent, so removing a term or course visits only its own descendants
+ * rather than every entity ever tracked.
+ *
+ * Provides declarations only; see ChangeTracker.cpp for implementations.
+ */
+
+#include <cstdint>          // for version counters
+#include <string>           // for ids
+#include <unordered_map>    // for per-entity state and the children of each parent
+#include <utility>          // for map nodes
+#include <vector>           // for pending change lists and sibling lists
+#include "model/EntityKind.hpp"
+
+// a pending change as handed to the sync engine
+struct EntityChange {
+    EntityKind kind{EntityKind::term};
+    std::string id{};
+    std::string parentId{};     // term id for courses, course id for assignments, empty for terms
+    std::uint64_t version{0};
+    bool removed{false};
+    bool onServer{false};       // the server is known to have a row for this id
+};
+
+class ChangeTracker {
+    public:
+        void recordUpsert(EntityKind kind, const std::string& id, const std::string& parentId = "");
+        void recordRemoval(EntityKind kind, const std::string& id, const std::string& parentId = "");
+        void recordRemote(EntityKind kind, const std::string& id, const std::string& parentId = "");
+        void forget(EntityKind kind, const std::string& id);
+        void markSynced(const std::string& id, std::uint64_t version);
+        void clear();
+        void reserve(std::size_t count);    // room for count more entities without rehashing, e.g. before an import
+
+        bool isDirty(const std::string& id) const;
+        bool isOnServer(const std::string& id) const;
+        std::uint64_t getVersion(const std::string& id) const;
+        std::size_t getPendingCount() const;
+        std::vector<EntityChange> getPendingChanges() const;
+
+    private:
+        struct Entry {
+            EntityKind kind{EntityKind::term};
+            std::string parentId{};
+            std::uint64_t version{0};
+            std::uint64_t syncedVersion{0};
+            std::uint64_t sequence{0};  // order of the latest change, so pending changes replay in edit order
+            bool removed{false};
+            bool onServer{false};
+            std::size_t childSlot{0};   // position among its parent's children, while parentId is set
+        };
+
+        using Node = std::pair<const std::string, Entry>;
+
+        std::unordered_map<std::string, Entry> entries_{};  // id -> Entry
+        std::unordered_map<std::string, std::vector<Node*>> children_{};    // parent id -> its tracked children
+        std::uint64_t nextSequence_{0};
+        std::size_t pendingCount_{0};
+
+        Entry& touch(EntityKind kind, const std::string& id, const std::string& parentId);
+        void link(Node& node, const std::string& parentId);
+        void unlink(Node& node);
+        void erase(std::unordered_map<std::string, Entry>::iterator it);
+        void forgetChildren(const std::string& parentId);
+};
+
+#endif  // CHANGETRACKER_HPP
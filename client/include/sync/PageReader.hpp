@@ -0,0 +1,43 @@
+#ifndef PAGEREADER_HPP
+#define PAGEREADER_HPP
+
+/**
+ * @file PageReader.hpp
+ * @brief Definition of the PageReader class, which reads one of the server's list routes a page at a time.
+ *
+ * Each call to next() requests the route with ?after=<last id>&limit=N, the server's keyset pagination,
+ * and parses that page with io::readRecords, so a caller holds one page of records at a time however long
+ * the list is. Pages come back in id order, and a page shorter than the limit is the last one. A non-2xx
+ * answer throws std::runtime_error, as a transport failure from HttpClient does.
+ *
+ * Provides declarations only; see PageReader.cpp for implementations.
+ */
+
+#include <cstddef>          // for page sizes and counts
+#include <string>           // for targets and ids
+#include "io/EntityJson.hpp"
+#include "model/EntityKind.hpp"
+#include "net/HttpClient.hpp"
+
+class PageReader {
+    public:
+        static constexpr std::size_t defaultLimit = 500;   // the server caps a page at 1000
+
+        PageReader(HttpClient& client, std::string target, EntityKind kind, std::size_t limit = defaultLimit);
+
+        bool next(io::EntityBatch& page);   // false once the list is exhausted, leaving page empty
+        std::size_t getRequestCount() const;
+
+    private:
+        HttpClient& client_;
+        std::string target_{};
+        EntityKind kind_{EntityKind::term};
+        std::size_t limit_{defaultLimit};
+        std::string after_{};               // id of the last record read; empty before the first page
+        bool done_{false};
+        std::size_t requestCount_{0};
+
+        std::string pageTarget() const;
+};
+
+#endif  // PAGEREADER_HPP
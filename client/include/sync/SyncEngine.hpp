@@ -0,0 +1,70 @@
+#ifndef SYNCENGINE_HPP
+#define SYNCENGINE_HPP
+
+/**
+ * @file SyncEngine.hpp
+ * @brief Definition of the SyncEngine class, which pushes local changes to the server as deltas.
+ *
+ * A push reads the pending changes from the TermController's ChangeTracker and sends one request per
+ * changed entity on the existing REST routes: POST for entities the server has not seen, PUT for
+ * updates and DELETE for removals (removing a parent covers its children through the server's
+ * cascading deletes). Each response is read back through fromRow and applied to the model by id if
+ * the server's copy differs, and the entity is only marked clean if it did not change again while its
+ * request was in flight.
+ *
+ * A pull hydrates one term from the server's /terms/{id}/tree route in a single request, rather than
+ * one request for the term, one for its courses and one per course for assignments. Pulls go through a
+ * ResponseCache, so pulling a term again costs a 304 with no body while it is unchanged on the server, and
+ * then nothing is reapplied. Local courses and assignments that the tree no longer holds were deleted on the
+ * server by another client, and are removed here too unless they have local changes still to push; a term
+ * the server answers 404 for goes the same way. pullAll reads the term list through a PageReader and pulls
+ * each term as its page arrives, so a long list is never held whole.
+ *
+ * Provides declarations only; see SyncEngine.cpp for implementations.
+ */
+
+#include <cstddef>          // for counts
+#include <string>           // for error messages
+#include <unordered_set>    // for dropped entities
+#include <vector>           // for error lists
+#include "controller/TermController.hpp"
+#include "io/EntityJson.hpp"
+#include "net/HttpClient.hpp"
+#include "net/ResponseCache.hpp"
+#include "sync/ChangeTracker.hpp"
+#include "sync/PageReader.hpp"
+
+struct SyncReport {
+    std::size_t requestCount{0};        // HTTP requests sent, including retries
+    std::size_t syncedCount{0};         // changes the server accepted
+    std::size_t unchangedCount{0};      // pulls the server answered 304 Not Modified
+    std::size_t removedCount{0};        // local entities a pull removed because the server no longer has them
+    std::vector<std::string> errors{};  // one message per change that is still pending
+};
+
+class SyncEngine {
+    public:
+        SyncEngine(TermController& controller, HttpClient& client);
+
+        SyncReport push();
+        SyncReport pullTerm(const std::string& termId);
+        SyncReport pullAll(std::size_t pageSize = PageReader::defaultLimit);
+
+    private:
+        TermController& controller_;
+        HttpClient& client_;
+        ResponseCache cache_{};             // pulled trees, revalidated by ETag
+
+        bool pushRemoval(const EntityChange& change, SyncReport& report);
+        bool pushUpsert(const EntityChange& change, SyncReport& report);
+        HttpResponse send(std::string_view method, const std::string& target, const std::string& body,
+            SyncReport& report);
+        std::string encode(const EntityChange& change) const;
+        void reconcile(const EntityChange& change, const std::string& sentBody, const HttpResponse& response);
+        template <typename Apply>
+        void applyPulled(const std::string& id, const std::string& parentId, std::unordered_set<std::string>& dropped,
+            SyncReport& report, Apply apply);
+        void removeAbsent(const std::string& termId, const io::EntityBatch& batch, SyncReport& report);
+};
+
+#endif  // SYNCENGINE_HPP
@@ -0,0 +1,61 @@
+#ifndef HISTORYGENERATOR_HPP
+#define HISTORYGENERATOR_HPP
+
+/**
+ * @file HistoryGenerator.hpp
+ * @brief Definition of the HistoryGenerator class, which builds seeded synthetic academic histories.
+ *
+ * A history is a run of consecutive Fall/Spring/Summer terms, each with the same number of courses
+ * and each course with the same number of assignments: mostly homework, a midterm or two and a
+ * final exam, spread across the term. Grades follow a per-course ability, the last term is the
+ * active one, and in it only the assignments due before its midpoint are completed.
+ *
+ * Every term, course and assignment draws from its own random stream derived from the seed and its
+ * position, so the output depends only on the configuration (not on the platform's standard library
+ * or on wall-clock time), and any part of the history can be regenerated without the rest. Ids are
+ * UUID v4-formatted strings from the same streams.
+ *
+ * Provides declarations only; see HistoryGenerator.cpp for implementations.
+ */
+
+#include <cstddef>          // for counts
+#include <cstdint>          // for the seed
+#include <ostream>          // for output streams
+#include "controller/TermController.hpp"
+#include "model/Term.hpp"
+
+namespace synth {
+    struct HistoryConfig {
+        std::uint64_t seed{1};
+        std::size_t terms{4};
+        std::size_t coursesPerTerm{5};
+        std::size_t assignmentsPerCourse{20};
+        int firstYear{2022};    // the first term is the fall of this year
+    };
+
+    class HistoryGenerator {
+        public:
+            explicit HistoryGenerator(HistoryConfig config);
+
+            const HistoryConfig& getConfig() const;
+            std::size_t getAssignmentCount() const;
+
+            Term makeTerm(std::size_t termIndex) const;     // the term alone, without courses
+            Term buildTerm(std::size_t termIndex) const;    // the term with its courses and assignments
+
+            void fill(TermController& controller) const;
+            void writeJson(std::ostream& os) const;
+            void writeSql(std::ostream& os) const;
+
+        private:
+            HistoryConfig config_;
+
+            template <typename Visit>
+            void forEachCourse(const Term& term, std::size_t termIndex, Visit visit) const;
+            template <typename Visit>
+            void forEachAssignment(const Term& term, std::size_t termIndex, const Course& course,
+                std::size_t courseIndex, Visit visit) const;
+    };
+}
+
+#endif  // HISTORYGENERATOR_HPP
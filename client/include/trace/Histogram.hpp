@@ -0,0 +1,53 @@
+#ifndef HISTOGRAM_HPP
+#define HISTOGRAM_HPP
+
+/**
+ * @file Histogram.hpp
+ * @brief Definition of the Histogram class, a fixed-size log-linear latency histogram.
+ *
+ * Values (nanoseconds) are bucketed the way HDR histograms do it: exact below 32, then 32 linear
+ * sub-buckets per power of two, so any recorded value is reported within about 3% across the full
+ * 64-bit range without resizing. A histogram has a single writer; record uses relaxed loads and
+ * stores rather than read-modify-write operations, and readers on other threads see a consistent
+ * enough view for reporting without any locks.
+ *
+ * Provides declarations only; see Histogram.cpp for implementations.
+ */
+
+#include <array>            // for buckets
+#include <atomic>           // for single-writer counters
+#include <cstddef>          // for sizes
+#include <cstdint>          // for fixed-width values
+
+namespace trace {
+    class Histogram {
+        public:
+            static constexpr int subBucketBits = 5;
+            static constexpr std::size_t subBuckets = std::size_t{1} << subBucketBits;
+            static constexpr std::size_t bucketCount = (64 - subBucketBits + 1) * subBuckets;
+
+            void record(std::uint64_t value);      // only ever called by the owning thread
+            void merge(const Histogram& other);    // adds another histogram's values into this one
+            void reset();
+
+            std::uint64_t getCount() const;
+            std::uint64_t getTotal() const;
+            std::uint64_t getMin() const;
+            std::uint64_t getMax() const;
+            std::uint64_t getPercentile(double percentile) const;  // percentile in [0, 100]
+
+            static std::size_t bucketIndex(std::uint64_t value);
+            static std::uint64_t bucketUpperBound(std::size_t index);
+
+        private:
+            std::array<std::atomic<std::uint64_t>, bucketCount> buckets_{};
+            std::atomic<std::uint64_t> count_{0};
+            std::atomic<std::uint64_t> total_{0};
+            std::atomic<std::uint64_t> min_{UINT64_MAX};
+            std::atomic<std::uint64_t> max_{0};
+
+            static void add(std::atomic<std::uint64_t>& target, std::uint64_t value);
+    };
+}
+
+#endif  // HISTOGRAM_HPP
@@ -0,0 +1,119 @@
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+/**
+ * @file Trace.hpp
+ * @brief Hot-path tracing: scoped timers, counters, and their summary and Chrome trace output.
+ *
+ * TRACE_SCOPE("name") times the rest of the enclosing scope and TRACE_COUNT("name", n) adds n to
+ * a counter. Each expansion registers its site once; sites with the same name share one timer or
+ * counter. While tracing is disabled (the default), a timer costs one relaxed atomic load, and
+ * building with COURSECOMPANION_NO_TRACING (the ENABLE_TRACING CMake option) removes the macros
+ * entirely.
+ *
+ * Every thread records into its own histograms, counters and event buffer, so recording takes no
+ * locks and shares no cache lines; only registering a new site or a new thread locks. Reports
+ * merge the per-thread data on demand, and threads that have exited are still included.
+ *
+ * Provides declarations only; see Trace.cpp for implementations.
+ */
+
+#include <atomic>           // for the enabled flag
+#include <cstddef>          // for sizes
+#include <cstdint>          // for timestamps
+#include <ostream>          // for reports
+#include <string>           // for site names
+#include <vector>           // for collected stats
+
+namespace trace {
+    enum class SiteKind {
+        timer,
+        counter
+    };
+
+    // a named place in the code that records a timer or a counter; one static instance per macro expansion
+    class Site {
+        public:
+            Site(const char* name, SiteKind kind);
+
+            std::size_t getIndex() const;
+
+        private:
+            std::size_t index_;
+    };
+
+    struct TimerStats {
+        std::string name;
+        std::uint64_t count{0};
+        std::uint64_t total{0};     // all durations are in nanoseconds
+        std::uint64_t min{0};
+        std::uint64_t p50{0};
+        std::uint64_t p90{0};
+        std::uint64_t p99{0};
+        std::uint64_t max{0};
+    };
+
+    struct CounterStats {
+        std::string name;
+        std::int64_t value{0};
+    };
+
+    namespace detail {
+        extern std::atomic<bool> enabled;
+    }
+
+    inline bool isEnabled() {
+        return detail::enabled.load(std::memory_order_relaxed);
+    }
+
+    void enable(bool recordEvents = true);     // events are only needed for the Chrome trace
+    void disable();
+    void reset();                               // drops everything recorded so far
+
+    std::uint64_t now();                        // nanoseconds since the process started tracing
+    void recordTime(const Site& site, std::uint64_t start, std::uint64_t duration);
+    void recordCount(const Site& site, std::int64_t amount);
+
+    std::vector<TimerStats> collectTimers();    // sorted by total time, longest first
+    std::vector<CounterStats> collectCounters();
+    void writeSummary(std::ostream& os);
+    void writeChromeTrace(std::ostream& os);   // chrome://tracing and Perfetto both read this format
+
+    class ScopedTimer {
+        public:
+            explicit ScopedTimer(const Site& site) : site_{isEnabled() ? &site : nullptr}, start_{site_ ? now() : 0} {}
+            ~ScopedTimer() {
+                if (site_ != nullptr) {
+                    recordTime(*site_, start_, now() - start_);
+                }
+            }
+
+            ScopedTimer(const ScopedTimer&) = delete;
+            ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+        private:
+            const Site* site_;
+            std::uint64_t start_;
+    };
+}
+
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL(a, b)
+
+#ifndef COURSECOMPANION_NO_TRACING
+#define TRACE_SCOPE(name) \
+    static const ::trace::Site TRACE_CONCAT(traceSite_, __LINE__){name, ::trace::SiteKind::timer}; \
+    ::trace::ScopedTimer TRACE_CONCAT(traceTimer_, __LINE__){TRACE_CONCAT(traceSite_, __LINE__)}
+#define TRACE_COUNT(name, amount) \
+    do { \
+        if (::trace::isEnabled()) { \
+            static const ::trace::Site traceSite_{name, ::trace::SiteKind::counter}; \
+            ::trace::recordCount(traceSite_, static_cast<std::int64_t>(amount)); \
+        } \
+    } while (false)
+#else
+#define TRACE_SCOPE(name) static_cast<void>(0)
+#define TRACE_COUNT(name, amount) static_cast<void>(0)
+#endif
+
+#endif  // TRACE_HPP
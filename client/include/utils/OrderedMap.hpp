@@ -0,0 +1,224 @@
+#ifndef ORDEREDMAP_HPP
+#define ORDEREDMAP_HPP
+
+/**
+ * @file OrderedMap.hpp
+ * @brief Definition of utils::OrderedMap, a hash map that iterates in insertion order and can be reordered.
+ *
+ * Entries live in a std::list, in the order they were added or last moved to, and a hash index maps each key to
+ * its list node. Lookup, insertion and removal are O(1) on average; moving an entry is O(1) when the destination
+ * is given as an iterator or as the key of the entry it should precede. Nodes never move, so references and
+ * iterators to an entry stay valid until it is erased, as they do in std::unordered_map. The index refers to each
+ * key stored in its list node rather than copying it.
+ *
+ * The interface follows std::unordered_map where the two overlap, so range-for over [key, value] pairs, find,
+ * at, contains and erase read the same. Header-only, since it is a template.
+ */
+
+#include <cstddef>          // for sizes
+#include <functional>       // for hash, equal_to and reference_wrapper
+#include <iterator>         // for prev
+#include <list>             // for entries in order
+#include <stdexcept>        // for exceptions
+#include <tuple>            // for piecewise construction
+#include <unordered_map>    // for key -> entry lookup
+#include <utility>          // for pair
+
+namespace utils {
+    template <typename Key, typename Value, typename Hash = std::hash<Key>, typename Equal = std::equal_to<Key>>
+    class OrderedMap {
+        public:
+            using key_type = Key;
+            using mapped_type = Value;
+            using value_type = std::pair<const Key, Value>;
+            using size_type = std::size_t;
+            using iterator = typename std::list<value_type>::iterator;
+            using const_iterator = typename std::list<value_type>::const_iterator;
+
+            OrderedMap() = default;
+            OrderedMap(OrderedMap&&) noexcept = default;     // list and hash nodes move with their containers
+            OrderedMap& operator=(OrderedMap&&) noexcept = default;
+
+            // entries are copied in order; the index is rebuilt to point into the new list
+            OrderedMap(const OrderedMap& other) {
+                index_.reserve(other.size());
+                for (const value_type& entry : other.entries_) {
+                    emplace(entry.first, entry.second);
+                }
+            }
+
+            OrderedMap& operator=(const OrderedMap& other) {
+                if (this != &other) {
+                    OrderedMap copy{other};
+                    *this = std::move(copy);
+                }
+                return *this;
+            }
+
+            size_type size() const noexcept { return entries_.size(); }
+            bool empty() const noexcept { return entries_.empty(); }
+            size_type bucket_count() const noexcept { return index_.bucket_count(); }
+
+            iterator begin() noexcept { return entries_.begin(); }
+            iterator end() noexcept { return entries_.end(); }
+            const_iterator begin() const noexcept { return entries_.begin(); }
+            const_iterator end() const noexcept { return entries_.end(); }
+
+            value_type& front() { return entries_.front(); }
+            const value_type& front() const { return entries_.front(); }
+            value_type& back() { return entries_.back(); }
+            const value_type& back() const { return entries_.back(); }
+
+            iterator find(const Key& key) {
+                auto it = index_.find(std::cref(key));
+                return it == index_.end() ? entries_.end() : it->second;
+            }
+
+            const_iterator find(const Key& key) const {
+                auto it = index_.find(std::cref(key));
+                return it == index_.end() ? entries_.cend() : const_iterator{it->second};
+            }
+
+            bool contains(const Key& key) const {
+                return index_.contains(std::cref(key));
+            }
+
+            Value& at(const Key& key) {
+                auto it = index_.find(std::cref(key));
+                if (it == index_.end()) {
+                    throw std::out_of_range("OrderedMap::at");
+                }
+                return it->second->second;
+            }
+
+            const Value& at(const Key& key) const {
+                auto it = index_.find(std::cref(key));
+                if (it == index_.end()) {
+                    throw std::out_of_range("OrderedMap::at");
+                }
+                return it->second->second;
+            }
+
+            // appends key -> Value{args...} unless the key is present; like try_emplace, args are untouched then
+            template <typename... Args>
+            std::pair<iterator, bool> emplace(const Key& key, Args&&... args) {
+                auto found = index_.find(std::cref(key));
+                if (found != index_.end()) {
+                    return {found->second, false};
+                }
+
+                entries_.emplace_back(std::piecewise_construct, std::forward_as_tuple(key),
+                    std::forward_as_tuple(std::forward<Args>(args)...));
+                auto it = std::prev(entries_.end());
+
+                try {
+                    index_.emplace(std::cref(it->first), it);
+                } catch (...) {
+                    entries_.pop_back();
+                    throw;
+                }
+                return {it, true};
+            }
+
+            iterator erase(const_iterator pos) {
+                index_.erase(std::cref(pos->first));
+                return entries_.erase(pos);
+            }
+
+            size_type erase(const Key& key) {
+                auto it = index_.find(std::cref(key));
+                if (it == index_.end()) {
+                    return 0;
+                }
+
+                iterator entry = it->second;
+                index_.erase(it);
+                entries_.erase(entry);
+                return 1;
+            }
+
+            void clear() noexcept {
+                index_.clear();
+                entries_.clear();
+            }
+
+            // moves the entry at pos in front of before; with before == end(), to the back
+            void moveBefore(const_iterator pos, const_iterator before) {
+                entries_.splice(before, entries_, pos);
+            }
+
+            // moves key's entry in front of next's entry, or to the back if next is not in the map
+            void moveBefore(const Key& key, const Key& next) {
+                const_iterator pos = find(key);
+                if (pos == end()) {
+                    throw std::out_of_range("OrderedMap::moveBefore");
+                }
+
+                const_iterator before = find(next);
+                if (before != pos) {
+                    moveBefore(pos, before);
+                }
+            }
+
+            // the key of the entry after key's, or nullptr if key's entry is the last
+            const Key* nextKey(const Key& key) const {
+                const_iterator pos = find(key);
+                if (pos == end()) {
+                    throw std::out_of_range("OrderedMap::nextKey");
+                }
+
+                ++pos;
+                return pos == end() ? nullptr : &pos->first;
+            }
+
+            // moves key's entry to position (clamped to the back); O(position)
+            void move(const Key& key, size_type position) {
+                const_iterator pos = find(key);
+                if (pos == end()) {
+                    throw std::out_of_range("OrderedMap::move");
+                }
+
+                const_iterator before = entries_.cbegin();
+                for (size_type i = 0; before != entries_.cend() && i < position; ++before) {
+                    if (before != pos) {
+                        ++i;
+                    }
+                }
+                if (before == pos) {
+                    return;
+                }
+                moveBefore(pos, before);
+            }
+
+            // the zero-based position of key's entry; O(position)
+            size_type indexOf(const Key& key) const {
+                const_iterator pos = find(key);
+                if (pos == end()) {
+                    throw std::out_of_range("OrderedMap::indexOf");
+                }
+
+                size_type index = 0;
+                for (const_iterator it = entries_.cbegin(); it != pos; ++it) {
+                    ++index;
+                }
+                return index;
+            }
+
+        private:
+            using KeyRef = std::reference_wrapper<const Key>;
+
+            // a KeyRef converts to const Key&, so the map's own hash and equality apply through it
+            struct RefHash {
+                std::size_t operator()(const Key& key) const { return Hash{}(key); }
+            };
+
+            struct RefEqual {
+                bool operator()(const Key& a, const Key& b) const { return Equal{}(a, b); }
+            };
+
+            std::list<value_type> entries_{};
+            std::unordered_map<KeyRef, iterator, RefHash, RefEqual> index_{};   // keys refer into entries_
+    };
+}
+
+#endif  // ORDEREDMAP_HPP
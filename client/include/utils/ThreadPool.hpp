@@ -0,0 +1,113 @@
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+/**
+ * @file ThreadPool.hpp
+ * @brief Definition of utils::ThreadPool, a work-stealing task scheduler, and utils::TaskGroup, a set of tasks
+ * that can be waited on or cancelled together.
+ *
+ * Every worker owns a deque of tasks. A worker pushes the tasks it spawns onto the back of its own deque and
+ * takes its next task from the back too, so it keeps working on what it just split off while that is still in
+ * cache; an idle worker steals from the front of someone else's, which is where the oldest and, for split
+ * work, largest tasks are. Threads outside the pool push onto the workers' deques in turn. A worker that finds
+ * nothing anywhere sleeps until a task is pushed.
+ *
+ * Tasks run in a TaskGroup. wait() returns once every task in the group has finished, and runs the group's
+ * queued tasks itself in the meantime, so a task can start a group of its own and wait on it without tying up
+ * a worker. It never runs another group's tasks, so a thread that waits on a short loop (the UI thread, say)
+ * can't find itself running someone's long background job.
+ * cancel() skips every task in the group that hasn't started; tasks that are running can check isCancelled()
+ * and stop early. The first exception a task throws cancels the rest of its group and is rethrown by wait().
+ *
+ * parallelFor(count, body) calls body(i) once for every i below count. It splits the range in half until the
+ * pieces are small, pushing one half and working on the other, so idle workers steal large pieces and the
+ * load evens out however uneven the items are. A pool of n threads starts n - 1 workers, since the thread that
+ * waits on a group works too, and a pool of one runs everything on the caller, in order.
+ *
+ * Provides declarations only; see ThreadPool.cpp for implementations.
+ */
+
+#include <atomic>               // for counters and flags
+#include <condition_variable>   // for sleeping workers
+#include <cstddef>              // for counts
+#include <deque>                // for per-worker task queues
+#include <exception>            // for exceptions thrown by tasks
+#include <functional>           // for tasks and loop bodies
+#include <memory>               // for queues
+#include <mutex>                // for queues and sleeping
+#include <thread>               // for workers
+#include <vector>               // for workers and queues
+
+namespace utils {
+    class TaskGroup;
+
+    class ThreadPool {
+        public:
+            explicit ThreadPool(std::size_t threads = std::thread::hardware_concurrency());
+            ~ThreadPool();
+            ThreadPool(const ThreadPool&) = delete;
+            ThreadPool& operator=(const ThreadPool&) = delete;
+
+            static ThreadPool& shared();    // one thread per core, and never fewer than two; started on first use
+
+            std::size_t getThreadCount() const;     // including the thread that waits
+            void parallelFor(std::size_t count, const std::function<void(std::size_t)>& body);
+
+        private:
+            friend class TaskGroup;
+
+            struct Task {
+                std::function<void()> work;
+                TaskGroup* group;
+            };
+
+            // one worker's tasks; padded so neighbouring queues' locks don't share a cache line
+            struct alignas(64) Queue {
+                std::mutex mutex{};
+                std::deque<Task> tasks{};
+            };
+
+            std::vector<std::unique_ptr<Queue>> queues_{};  // one per worker, or one for the caller if there are none
+            std::vector<std::thread> workers_{};
+            std::atomic<std::size_t> queued_{0};        // tasks pushed and not yet taken, across every queue
+            std::atomic<std::size_t> sleeping_{0};      // threads blocked on wake_
+            std::atomic<std::size_t> nextQueue_{0};     // where the next task from outside the pool goes
+            std::mutex sleepMutex_{};
+            std::condition_variable wake_{};
+            bool stopping_{false};
+
+            void push(Task task);
+            bool runOne(const TaskGroup* only = nullptr);   // runs one queued task, of only's if given; false if none
+            void execute(Task& task);
+            void sleepUntil(const std::function<bool()>& ready);
+            void wakeAll();
+            void work(std::size_t index);
+    };
+
+    class TaskGroup {
+        public:
+            explicit TaskGroup(ThreadPool& pool);
+            ~TaskGroup();   // waits for every task, dropping any exception
+            TaskGroup(const TaskGroup&) = delete;
+            TaskGroup& operator=(const TaskGroup&) = delete;
+
+            void run(std::function<void()> task);
+            void wait();
+            void cancel();
+            bool isCancelled() const;
+
+        private:
+            friend class ThreadPool;
+
+            ThreadPool& pool_;
+            std::atomic<std::size_t> pending_{0};   // tasks run() and not yet finished or skipped
+            std::atomic<std::size_t> queued_{0};    // of those, the ones no thread has taken yet
+            std::atomic<bool> cancelled_{false};
+            std::mutex errorMutex_{};
+            std::exception_ptr error_{};
+
+            void fail(std::exception_ptr error);
+    };
+}
+
+#endif  // THREADPOOL_HPP
@@ -10,14 +10,47 @@
  */
 
 #include <string>           // for string variables
+#include <string_view>      // for non-owning string input
+#include <span>             // for batch parsing input and output
+#include <stdexcept>        // for exceptions
 #include <chrono>           // for date and time-related variables
 #include <iostream>         // for i/o streams
+#include <unordered_map>    // for title indexes
 #include <QDate>
 #include "model/Assignment.hpp"   // for references to Assignment
 
 namespace utils {
+    // case-insensitive hash and equality for titles; transparent, so a map keyed with them can be searched with any
+    // string_view without building a lowered copy of it
+    struct CaseInsensitiveHash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view str) const noexcept;
+    };
+
+    struct CaseInsensitiveEqual {
+        using is_transparent = void;
+        bool operator()(std::string_view a, std::string_view b) const noexcept;
+    };
+
+    // lowered title -> id; each key is folded once, when its entity is indexed
+    using TitleIndex = std::unordered_map<std::string, std::string, CaseInsensitiveHash, CaseInsensitiveEqual>;
+
+    std::string titleKey(std::string_view title);
+    bool eraseTitle(TitleIndex& index, std::string_view title);
+
+    // thrown when a date string is malformed; position is the zero-based offset of the offending character
+    class DateParseError : public std::invalid_argument {
+        public:
+            DateParseError(const std::string& message, std::size_t position);
+            std::size_t getPosition() const;
+
+        private:
+            std::size_t position_{0};
+    };
+
     std::chrono::year_month_day getTodayDate();
-    std::chrono::year_month_day parseDate(const std::string &input);
+    std::chrono::year_month_day parseDate(std::string_view input);
+    void parseDates(std::span<const std::string_view> inputs, std::span<std::chrono::year_month_day> outputs);
     std::chrono::year_month_day parseDateFromQt(const QDate& qdate);
     QDate parseDateToQt(const std::chrono::year_month_day& date);
     bool isOnlyWhitespace(const std::string str);
@@ -52,6 +52,7 @@ class CliView {
         void displaySecondaryDelim() const;
         void displayIntro() const;
         void displayTermMenu() const;
+        void displayUndoChoices() const;
         void displayCourseMenu() const;
         void displayAssignmentMenu() const;
         void displayViewAssignmentMenu() const;
@@ -60,6 +61,8 @@ class CliView {
         void displayAssignmentListInfo() const;
         void displayCompletedAssignmentInfo() const;
         void displayIncompleteAssignmentInfo() const;
+        void displayDueAssignment(const Assignment& assignment, const Term* term, const Course* course) const;
+        void displaySearchResult(const SearchResult& result) const;
         void displayInvalidSelection() const;
 
         void promptAddTerm();
@@ -76,6 +79,9 @@ class CliView {
         void promptAddAssignmentGrade();
         void promptRemoveAssignmentGrade();
         void promptViewAssignment();
+        void promptViewDueDates(bool selectedCourseOnly);
+        void promptSearch();
+        void undoOrRedo(bool redo);
 
         char getCharInput(const std::string& label, const char defaultVal) const;
         std::string getStringInput(const std::string& label, const std::string &defaultVal) const;
@@ -13,8 +13,14 @@
 #include <QHBoxLayout>
 #include <QVBoxLayout>
 #include <QLabel>
+#include <QLineEdit>
+#include <QMenu>
+#include <QProgressBar>
 #include <QPushButton>
 #include <QStackedWidget>
+#include <QEvent>
+#include <QPoint>
+#include <cstddef>
 #include "controller/TermController.hpp"
 
 class MainWindow : public QMainWindow {
@@ -23,21 +29,41 @@ class MainWindow : public QMainWindow {
     public:
         explicit MainWindow(QWidget* parent = nullptr);
 
+    protected:
+        bool eventFilter(QObject* watched, QEvent* event) override;   // drags term rows to reorder them
+
     private:
         TermController  controller_;
         QWidget*        centralWidget_;
         QHBoxLayout*    layout_;
         QWidget*        sidebar_;
         QStackedWidget* stack_;
+        QLineEdit*      searchBox_;
+        QWidget*        searchListWidget_;
+        QVBoxLayout*    searchListLayout_;
+        QWidget*        termListWidget_;
         QVBoxLayout*    termListLayout_;
+        QVBoxLayout*    dueListLayout_;
         QString         selectedTermTitle_;
+        QPoint          dragStartPos_;
+        QMenu*          fileMenu_;
+        QProgressBar*   progressBar_;
+        QPushButton*    cancelButton_;
+        AsyncOperation* operation_ = nullptr;     // the one running, if any; owned by the controller until it ends
 
         void setupUi();
+        void setupFileMenu();
+        void watchOperation(AsyncOperation* operation, const QString& failureTitle);
         void addTermRow(const Term& term);
+        void startTermDrag(QPushButton* overlay);
+        std::size_t termDropPosition(const QPoint& pos, const QString& termId) const;
 
     private slots:
         void refreshTermList();
+        void refreshDueList();
+        void refreshSearchResults();
         void onTermRowClicked(const QString& title);
+        void undoOrRedo(bool redo);
         void updateTermPageVisibility();
 };
 
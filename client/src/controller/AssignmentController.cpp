@@ -1,17 +1,25 @@
 #include "controller/AssignmentController.hpp"
 
 #include <exception>
+#include "model/MemoryAccounting.hpp"
+#include "trace/Trace.hpp"
 #include "utils/utils.hpp"
 
-AssignmentController::AssignmentController(Course& course) : course_{course} {}
+// indexes assignments that are already in the course, so titles stay resolvable when a course is reselected or imported
+AssignmentController::AssignmentController(Course& course, const ControllerContext& context)
+    : course_{course}, context_{context} {
+    for (const auto& [id, assignment] : course_.getAssignmentList()) {
+        titleToId_.emplace(utils::titleKey(assignment.getTitle()), id);
+    }
+}
 
 const std::unordered_map<std::string, Assignment>& AssignmentController::getAssignmentList() const {
     return course_.getAssignmentList();
 }
 
-std::string AssignmentController::getAssignmentId(const std::string& title) const {
-    std::string titleLower = utils::stringLower(title);
-    auto it = titleToId_.find(titleLower);
+// matches the title in any case without allocating; the returned id lives until the assignment is removed
+const std::string& AssignmentController::getAssignmentId(std::string_view title) const {
+    auto it = titleToId_.find(title);
 
     if (it == titleToId_.end()) {
         throw std::out_of_range("Assignment not found.");
@@ -22,6 +30,7 @@ std::string AssignmentController::getAssignmentId(const std::string& title) cons
 
 void AssignmentController::addAssignment(const std::string& title, const std::string& description, const std::string& category,
     const std::chrono::year_month_day& dueDate, bool completed, float grade) {
+    TRACE_SCOPE("AssignmentController::addAssignment");
     Assignment assignment{title, description, category, dueDate, completed, grade};
 
     if (!course_.getGradeWeights().contains(category)) {
@@ -34,36 +43,62 @@ void AssignmentController::addAssignment(const std::string& title, const std::st
         throw std::runtime_error("An unexpected error occurred when adding the assignment.");
     }
 
-    auto inserted = titleToId_.emplace(utils::stringLower(assignment.getTitle()), assignment.getId()).second;
+    auto inserted = titleToId_.emplace(utils::titleKey(assignment.getTitle()), assignment.getId()).second;
 
     if (!inserted) {
         course_.removeAssignment(assignment.getId());
         throw std::logic_error("Assignment with the same title already exists.");
     }
+
+    if (context_.dueIndex != nullptr) {
+        context_.dueIndex->addAssignment(assignment, course_.getId());
+    }
+    if (context_.searchIndex != nullptr) {
+        context_.searchIndex->addAssignment(assignment, course_.getId());
+    }
+    recordChange(assignment.getId());
+    recordPresence("add assignment", assignment, true);
     emit dataChanged();
 }
 
 void AssignmentController::editTitle(const std::string& id, const std::string& newTitle) {
+    TRACE_SCOPE("AssignmentController::editTitle");
     Assignment& assignment = course_.findAssignment(id);
-    std::string oldTitle = assignment.getTitle();
 
-    if (titleToId_.contains(utils::stringLower(newTitle))) {
+    if (titleToId_.contains(newTitle)) {
         throw std::logic_error("An assignment with this title already exists.");
     }
 
-    assignment.setTitle(newTitle);
-    titleToId_.erase(utils::stringLower(oldTitle));
-    titleToId_.emplace(utils::stringLower(newTitle), id);
+    std::string oldTitle = assignment.getTitle();
+    assignment.setTitle(newTitle);     // validates the title, so a rejected one leaves the index alone
+    auto node = titleToId_.extract(titleToId_.find(oldTitle));
+    node.key() = utils::titleKey(newTitle);
+    titleToId_.insert(std::move(node));
+    updateSearchEntry(assignment);
+    recordChange(id);
+    if (context_.undoLog != nullptr) {
+        context_.undoLog->recordEdit<AssignmentController>("edit assignment title", course_.getId(), id,
+            &AssignmentController::editTitle, std::move(oldTitle), newTitle);
+    }
     emit dataChanged();
 }
 
 void AssignmentController::editDescription(const std::string& id, const std::string& newDescription) {
+    TRACE_SCOPE("AssignmentController::editDescription");
     Assignment& assignment = course_.findAssignment(id);
+    std::string oldDescription = assignment.getDescription();
     assignment.setDescription(newDescription);
+    updateSearchEntry(assignment);
+    recordChange(id);
+    if (context_.undoLog != nullptr) {
+        context_.undoLog->recordEdit<AssignmentController>("edit assignment description", course_.getId(), id,
+            &AssignmentController::editDescription, std::move(oldDescription), newDescription);
+    }
     emit dataChanged();
 }
 
 void AssignmentController::editCategory(const std::string& id, const std::string& newCategory) {
+    TRACE_SCOPE("AssignmentController::editCategory");
     Assignment& assignment = course_.findAssignment(id);
 
     if (utils::isOnlyWhitespace(newCategory)) {
@@ -74,27 +109,49 @@ void AssignmentController::editCategory(const std::string& id, const std::string
         throw std::out_of_range("Invalid category. Category must be in grade weights.");
     }
 
+    std::string oldCategory = assignment.getCategory();
     assignment.setCategory(newCategory);
+    updateSearchEntry(assignment);
+    recordChange(id);
+    if (context_.undoLog != nullptr) {
+        context_.undoLog->recordEdit<AssignmentController>("edit assignment category", course_.getId(), id,
+            &AssignmentController::editCategory, std::move(oldCategory), newCategory);
+    }
     emit dataChanged();
 }
 
 void AssignmentController::editDueDate(const std::string& id, const std::chrono::year_month_day& newDueDate) {
+    TRACE_SCOPE("AssignmentController::editDueDate");
     Assignment& assignment = course_.findAssignment(id);
-    assignment.setDueDate(newDueDate);
+    DueKey before = DueKey::of(assignment);
+    std::chrono::year_month_day oldDueDate = assignment.getDueDate();
+    course_.setAssignmentDueDate(id, newDueDate);
+    moveDueEntry(before, assignment);
+    recordChange(id);
+    if (context_.undoLog != nullptr) {
+        context_.undoLog->recordEdit<AssignmentController>("edit assignment due date", course_.getId(), id,
+            &AssignmentController::editDueDate, oldDueDate, newDueDate);
+    }
     emit dataChanged();
 }
 
 void AssignmentController::addGrade(const std::string& title, float grade) {
-    std::string id = getAssignmentId(title);
+    TRACE_SCOPE("AssignmentController::addGrade");
+    const std::string& id = getAssignmentId(title);
     Assignment& selectedAssignment = course_.findAssignment(id);
+    float oldGrade = selectedAssignment.getGrade();
+    bool oldCompleted = selectedAssignment.getCompleted();
 
     grade = utils::floatRound(grade, 2);
     selectedAssignment.setGrade(grade);
-    selectedAssignment.setCompleted(true);
+    updateCompleted(id, true);
+    recordChange(id);
+    recordGrade("add grade", id, oldGrade, oldCompleted);
     emit dataChanged();
 }
 
 void AssignmentController::addGrade(const std::string& title, float pointsEarned, float totalPoints) {
+    TRACE_SCOPE("AssignmentController::addGrade");
     if (utils::floatEqual(totalPoints, 0.0f)) {
         throw std::invalid_argument("Division by zero not allowed.");
     }
@@ -104,27 +161,210 @@ void AssignmentController::addGrade(const std::string& title, float pointsEarned
 }
 
 void AssignmentController::removeGrade(const std::string& title) {
-    std::string id = getAssignmentId(title);
+    TRACE_SCOPE("AssignmentController::removeGrade");
+    const std::string& id = getAssignmentId(title);
     Assignment& selectedAssignment = course_.findAssignment(id);
+    float oldGrade = selectedAssignment.getGrade();
+    bool oldCompleted = selectedAssignment.getCompleted();
 
     selectedAssignment.setGrade(0.0f);
-    selectedAssignment.setCompleted(false);
+    updateCompleted(id, false);
+    recordChange(id);
+    recordGrade("remove grade", id, oldGrade, oldCompleted);
     emit dataChanged();
 }
 
 void AssignmentController::removeAssignment(const std::string& title) {
-    std::string id = getAssignmentId(title);
+    TRACE_SCOPE("AssignmentController::removeAssignment");
+    auto it = titleToId_.find(title);
+
+    if (it == titleToId_.end()) {
+        throw std::out_of_range("Assignment not found.");
+    }
+
+    const std::string& id = it->second;
+    Assignment removed = course_.findAssignment(id);
+    if (context_.dueIndex != nullptr) {
+        context_.dueIndex->removeAssignment(course_.findAssignment(id));
+    }
+    if (context_.searchIndex != nullptr) {
+        context_.searchIndex->removeAssignment(course_.findAssignment(id));
+    }
     course_.removeAssignment(id);
-    titleToId_.erase(utils::stringLower(title));
+    recordChange(id, true);
+    recordPresence("remove assignment", removed, false);
+    titleToId_.erase(it);     // last, since id refers into this entry
     emit dataChanged();
 }
 
 const Assignment& AssignmentController::findAssignment(const std::string& title) const {
-    std::string id = getAssignmentId(title);
-    return course_.findAssignment(id);
+    return course_.findAssignment(getAssignmentId(title));
 }
 
 Assignment& AssignmentController::findAssignment(const std::string& title) {
-    std::string id = getAssignmentId(title);
-    return course_.findAssignment(id);
+    return course_.findAssignment(getAssignmentId(title));
+}
+
+// replaces the local copy of an assignment with the server's, adding it if it is new; not recorded as a local change
+void AssignmentController::applyRemoteAssignment(const Assignment& assignment) {
+    TRACE_SCOPE("AssignmentController::applyRemoteAssignment");
+    std::string id = assignment.getId();
+    auto owner = titleToId_.find(assignment.getTitle());
+
+    if (owner != titleToId_.end() && owner->second != id) {
+        throw std::logic_error("Assignment with the same title already exists.");
+    }
+
+    auto existing = course_.getAssignmentList().find(id);
+    if (existing != course_.getAssignmentList().end()) {
+        utils::eraseTitle(titleToId_, existing->second.getTitle());
+        if (context_.dueIndex != nullptr) {
+            context_.dueIndex->removeAssignment(existing->second);
+        }
+        if (context_.searchIndex != nullptr) {
+            context_.searchIndex->removeAssignment(existing->second);
+        }
+        course_.removeAssignment(id);
+    }
+
+    // going through the course recalculates its grade
+    course_.addAssignment(assignment);
+    if (context_.dueIndex != nullptr) {
+        context_.dueIndex->addAssignment(assignment, course_.getId());
+    }
+    if (context_.searchIndex != nullptr) {
+        context_.searchIndex->addAssignment(assignment, course_.getId());
+    }
+    titleToId_.insert_or_assign(utils::titleKey(assignment.getTitle()), id);
+    if (context_.snapshots != nullptr) {
+        context_.snapshots->markCourse(course_.getId());
+    }
+    emit dataChanged();
+}
+
+// removes an assignment the server no longer has; not recorded as a local change
+void AssignmentController::removeRemoteAssignment(const std::string& id) {
+    TRACE_SCOPE("AssignmentController::removeRemoteAssignment");
+    const Assignment& assignment = course_.findAssignment(id);
+
+    utils::eraseTitle(titleToId_, assignment.getTitle());
+    if (context_.dueIndex != nullptr) {
+        context_.dueIndex->removeAssignment(assignment);
+    }
+    if (context_.searchIndex != nullptr) {
+        context_.searchIndex->removeAssignment(assignment);
+    }
+    course_.removeAssignment(id);
+    if (context_.snapshots != nullptr) {
+        context_.snapshots->markCourse(course_.getId());
+    }
+    emit dataChanged();
+}
+
+// marks an assignment complete or incomplete in both due-date indexes; regrading a completed assignment moves nothing
+void AssignmentController::updateCompleted(const std::string& id, bool completed) {
+    const Assignment& assignment = course_.findAssignment(id);
+
+    if (assignment.getCompleted() == completed) {
+        return;
+    }
+
+    DueKey before = DueKey::of(assignment);
+    course_.setAssignmentCompleted(id, completed);
+    moveDueEntry(before, assignment);
+}
+
+// keeps the cross-term index in step after the course has re-keyed its own entry
+void AssignmentController::moveDueEntry(const DueKey& before, const Assignment& assignment) {
+    if (context_.dueIndex != nullptr) {
+        context_.dueIndex->moveAssignment(before, assignment);
+    }
+}
+
+// puts back an assignment with the ID it had, to undo its removal or redo its addition
+void AssignmentController::restoreAssignment(const Assignment& assignment) {
+    if (titleToId_.contains(assignment.getTitle())) {
+        throw std::logic_error("Assignment with the same title already exists.");
+    }
+
+    course_.addAssignment(assignment);
+    titleToId_.emplace(utils::titleKey(assignment.getTitle()), assignment.getId());
+    if (context_.dueIndex != nullptr) {
+        context_.dueIndex->addAssignment(assignment, course_.getId());
+    }
+    if (context_.searchIndex != nullptr) {
+        context_.searchIndex->addAssignment(assignment, course_.getId());
+    }
+    recordChange(assignment.getId());
+    emit dataChanged();
+}
+
+// sets a grade and completion together, as they were before or after addGrade or removeGrade
+void AssignmentController::restoreGrade(const std::string& id, float grade, bool completed) {
+    course_.findAssignment(id).setGrade(grade);
+    updateCompleted(id, completed);
+    recordChange(id);
+    emit dataChanged();
+}
+
+// records adding or removing an assignment; one way removes it by ID and the other restores the copy
+void AssignmentController::recordPresence(const char* label, const Assignment& assignment, bool added) {
+    if (context_.undoLog == nullptr || context_.undoLog->isReplaying()) {
+        return;
+    }
+
+    std::size_t payloadBytes = MemoryAccounting::of(assignment).bytes;
+    context_.undoLog->record(label, course_.getId(), UndoCommand::Step<AssignmentController>{
+        [assignment, added](AssignmentController& controller, UndoCommand::Direction direction) {
+            if ((direction == UndoCommand::Direction::undo) == added) {
+                controller.removeAssignment(controller.course_.findAssignment(assignment.getId()).getTitle());
+            } else {
+                controller.restoreAssignment(assignment);
+            }
+        }}, payloadBytes);
+}
+
+void AssignmentController::recordGrade(const char* label, const std::string& id, float gradeBefore,
+    bool completedBefore) {
+    if (context_.undoLog == nullptr || context_.undoLog->isReplaying()) {
+        return;
+    }
+
+    const Assignment& assignment = course_.findAssignment(id);
+    float gradeAfter = assignment.getGrade();
+    bool completedAfter = assignment.getCompleted();
+
+    context_.undoLog->record(label, course_.getId(), UndoCommand::Step<AssignmentController>{
+        [id, gradeBefore, completedBefore, gradeAfter, completedAfter](AssignmentController& controller,
+            UndoCommand::Direction direction) {
+            if (direction == UndoCommand::Direction::undo) {
+                controller.restoreGrade(id, gradeBefore, completedBefore);
+            } else {
+                controller.restoreGrade(id, gradeAfter, completedAfter);
+            }
+        }}, id.capacity());
+}
+
+// re-reads an assignment's searchable fields after an edit
+void AssignmentController::updateSearchEntry(const Assignment& assignment) {
+    if (context_.searchIndex != nullptr) {
+        context_.searchIndex->updateAssignment(assignment);
+    }
+}
+
+// notes a local edit for the next sync and the next snapshot
+void AssignmentController::recordChange(const std::string& id, bool removed) {
+    if (context_.snapshots != nullptr) {
+        context_.snapshots->markCourse(course_.getId());
+    }
+
+    if (context_.tracker == nullptr) {
+        return;
+    }
+
+    if (removed) {
+        context_.tracker->recordRemoval(EntityKind::assignment, id, course_.getId());
+    } else {
+        context_.tracker->recordUpsert(EntityKind::assignment, id, course_.getId());
+    }
 }
\ No newline at end of file
@@ -0,0 +1,127 @@
+#include "controller/AsyncOperation.hpp"
+
+/**
+ * @file AsyncOperation.cpp
+ * @brief Implementation of AsyncOperation, the handle a controller returns for work too long to run inside a slot.
+ *
+ * Calls queued with this operation as their context run on its thread and are dropped if it is destroyed first.
+ * A background part that ends, for any reason, queues one call that either starts the steps or ends the
+ * operation, so nothing is left waiting on a signal that never comes.
+ */
+
+#include <exception>        // for passing errors between threads
+#include <utility>          // for move
+
+AsyncOperation::AsyncOperation(QObject* parent) : QObject{parent} {}
+
+// background_ is destroyed next, and waits for a background part that is still running
+AsyncOperation::~AsyncOperation() {
+    cancel();
+}
+
+double AsyncOperation::getProgress() const {
+    return progress_.load();
+}
+
+bool AsyncOperation::isRunning() const {
+    return running_.load();
+}
+
+bool AsyncOperation::isCancelled() const {
+    return cancelled_.load();
+}
+
+void AsyncOperation::cancel() {
+    cancelled_ = true;
+}
+
+// runs background on the pool, then step on this operation's thread until it returns true
+void AsyncOperation::start(std::function<void(AsyncOperation&)> background, std::function<bool()> step) {
+    running_ = true;
+    step_ = std::move(step);
+
+    if (!background) {
+        QMetaObject::invokeMethod(this, [this]() { runStep(); }, Qt::QueuedConnection);
+        return;
+    }
+
+    background_.run([this, background = std::move(background)]() {
+        try {
+            if (cancelled_) {
+                throw OperationCancelled{};
+            }
+            background(*this);
+            QMetaObject::invokeMethod(this, [this]() { runStep(); }, Qt::QueuedConnection);
+        } catch (...) {
+            QMetaObject::invokeMethod(this, [this, error = std::current_exception()]() { fail(error); },
+                Qt::QueuedConnection);
+        }
+    });
+}
+
+// records progress and queues an update unless one is already waiting; throws once the operation is cancelled
+void AsyncOperation::reportProgress(std::size_t done, std::size_t total) {
+    if (cancelled_) {
+        throw OperationCancelled{};
+    }
+
+    progress_ = total == 0 ? 0.0 : static_cast<double>(done) / static_cast<double>(total);
+
+    if (!progressQueued_.exchange(true)) {
+        QMetaObject::invokeMethod(this, [this]() {
+            progressQueued_ = false;
+            emit progressChanged(progress_.load());
+        }, Qt::QueuedConnection);
+    }
+}
+
+// one step, then back to the event loop; the next step is queued behind whatever arrived meanwhile
+void AsyncOperation::runStep() {
+    try {
+        if (cancelled_) {
+            throw OperationCancelled{};
+        }
+        if (step_ && !step_()) {
+            QMetaObject::invokeMethod(this, [this]() { runStep(); }, Qt::QueuedConnection);
+            return;
+        }
+    } catch (...) {
+        fail(std::current_exception());
+        return;
+    }
+
+    finish();
+}
+
+void AsyncOperation::fail(std::exception_ptr error) {
+    running_ = false;
+    releaseStep();
+
+    try {
+        std::rethrow_exception(error);
+    } catch (const OperationCancelled&) {
+        emit cancelled();
+    } catch (const std::exception& e) {
+        emit failed(QString::fromStdString(e.what()));
+    } catch (...) {
+        emit failed(QStringLiteral("Unknown error."));
+    }
+}
+
+// what the step captured can be large (an import's parsed terms), so it is freed on the pool rather than
+// in the frame that ends the operation
+void AsyncOperation::releaseStep() {
+    if (step_) {
+        background_.run([step = std::move(step_)]() mutable { step = nullptr; });
+        step_ = nullptr;
+    }
+}
+
+void AsyncOperation::finish() {
+    running_ = false;
+    releaseStep();
+    progress_ = 1.0;
+
+    emit progressChanged(1.0);
+    emit finished();
+}
@@ -1,22 +1,25 @@
 #include "controller/CourseController.hpp"
 
 #include <exception>
-#include <algorithm>
+#include "model/MemoryAccounting.hpp"
+#include "trace/Trace.hpp"
 #include "utils/utils.hpp"
 
-CourseController::CourseController(Term& term) : term_{term} {}
-
-const std::unordered_map<std::string, Course>& CourseController::getCourseList() const {
-    return term_.getCourseList();
+// indexes courses that are already in the term, so titles stay resolvable when a term is reselected or imported
+CourseController::CourseController(Term& term, const ControllerContext& context)
+    : term_{term}, context_{context} {
+    for (const auto& [id, course] : term_.getCourseList()) {
+        titleToId_.emplace(utils::titleKey(course.getTitle()), id);
+    }
 }
 
-const std::vector<std::string>& CourseController::getCourseOrder() const {
-    return courseOrder_;
+const CourseList& CourseController::getCourseList() const {
+    return term_.getCourseList();
 }
 
-std::string CourseController::getCourseId(const std::string& title) const {
-    std::string titleLower = utils::stringLower(title);
-    auto it = titleToId_.find(titleLower);
+// matches the title in any case without allocating; the returned id lives until the course is removed
+const std::string& CourseController::getCourseId(std::string_view title) const {
+    auto it = titleToId_.find(title);
 
     if (it == titleToId_.end()) {
         throw std::out_of_range("Course not found.");
@@ -26,15 +29,20 @@ std::string CourseController::getCourseId(const std::string& title) const {
 }
 
 AssignmentController& CourseController::getAssignmentController() {
-    if (!assignmentController_.has_value()) {
+    if (assignmentController_ == nullptr) {
         throw std::logic_error("No course selected.");
     }
 
     return *assignmentController_;
 }
 
+ControllerCache<AssignmentController>& CourseController::getAssignmentControllerCache() {
+    return assignmentControllers_;
+}
+
 void CourseController::addCourse(const std::string& title, const std::string& description, const std::chrono::year_month_day& startDate,
     const std::chrono::year_month_day& endDate, int numCredits, bool active) {
+    TRACE_SCOPE("CourseController::addCourse");
     Course course{title, description, startDate, endDate, numCredits, active};
 
     try {
@@ -43,94 +51,367 @@ void CourseController::addCourse(const std::string& title, const std::string& de
         throw std::runtime_error("An unexpected error occurred when adding the course.");
     }
 
-    auto inserted = titleToId_.emplace(utils::stringLower(course.getTitle()), course.getId()).second;
+    auto inserted = titleToId_.emplace(utils::titleKey(course.getTitle()), course.getId()).second;
 
     if (!inserted) {
         term_.removeCourse(course.getId());
         throw std::logic_error("Course with the same title already exists.");
     }
 
-    courseOrder_.push_back(course.getId());
+    if (context_.dueIndex != nullptr) {
+        context_.dueIndex->addCourse(course, term_.getId());
+    }
+    if (context_.searchIndex != nullptr) {
+        context_.searchIndex->addCourse(course, term_.getId());
+    }
+    recordChange(course.getId());
+    if (context_.undoLog != nullptr && !context_.undoLog->isReplaying()) {
+        recordPresence("add course", std::make_shared<const Course>(course), "", true);
+    }
     emit dataChanged();
 }
 
 void CourseController::editTitle(const std::string& id, const std::string& newTitle) {
+    TRACE_SCOPE("CourseController::editTitle");
     Course& course = term_.findCourse(id);
-    std::string oldTitle = course.getTitle();
 
-    if (titleToId_.contains(utils::stringLower(newTitle))) {
+    if (titleToId_.contains(newTitle)) {
         throw std::logic_error("A course with this title already exists.");
     }
 
-    course.setTitle(newTitle);
-    titleToId_.erase(utils::stringLower(oldTitle));
-    titleToId_.emplace(utils::stringLower(newTitle), id);
+    std::string oldTitle = course.getTitle();
+    course.setTitle(newTitle);     // validates the title, so a rejected one leaves the index alone
+    auto node = titleToId_.extract(titleToId_.find(oldTitle));
+    node.key() = utils::titleKey(newTitle);
+    titleToId_.insert(std::move(node));
+    updateSearchEntry(course);
+    recordChange(id);
+    if (context_.undoLog != nullptr) {
+        context_.undoLog->recordEdit<CourseController>("edit course title", term_.getId(), id,
+            &CourseController::editTitle, std::move(oldTitle), newTitle);
+    }
     emit dataChanged();
 }
 
 void CourseController::editDescription(const std::string& id, const std::string& newDescription) {
+    TRACE_SCOPE("CourseController::editDescription");
     Course& course = term_.findCourse(id);
+    std::string oldDescription = course.getDescription();
     course.setDescription(newDescription);
+    updateSearchEntry(course);
+    recordChange(id);
+    if (context_.undoLog != nullptr) {
+        context_.undoLog->recordEdit<CourseController>("edit course description", term_.getId(), id,
+            &CourseController::editDescription, std::move(oldDescription), newDescription);
+    }
     emit dataChanged();
 }
 
 void CourseController::editStartDate(const std::string& id, const std::chrono::year_month_day& newStartDate) {
+    TRACE_SCOPE("CourseController::editStartDate");
     Course& course = term_.findCourse(id);
+    std::chrono::year_month_day oldStartDate = course.getStartDate();
     course.setStartDate(newStartDate);
+    recordChange(id);
+    if (context_.undoLog != nullptr) {
+        context_.undoLog->recordEdit<CourseController>("edit course start date", term_.getId(), id,
+            &CourseController::editStartDate, oldStartDate, newStartDate);
+    }
     emit dataChanged();
 }
 
 void CourseController::editEndDate(const std::string& id, const std::chrono::year_month_day& newEndDate) {
+    TRACE_SCOPE("CourseController::editEndDate");
     Course& course = term_.findCourse(id);
+    std::chrono::year_month_day oldEndDate = course.getEndDate();
     course.setEndDate(newEndDate);
+    recordChange(id);
+    if (context_.undoLog != nullptr) {
+        context_.undoLog->recordEdit<CourseController>("edit course end date", term_.getId(), id,
+            &CourseController::editEndDate, oldEndDate, newEndDate);
+    }
     emit dataChanged();
 }
 
 void CourseController::editNumCredits(const std::string& id, int newNumCredits) {
+    TRACE_SCOPE("CourseController::editNumCredits");
     Course& course = term_.findCourse(id);
+    int oldNumCredits = course.getNumCredits();
     course.setNumCredits(newNumCredits);
+    recordChange(id);
+    if (context_.undoLog != nullptr) {
+        context_.undoLog->recordEdit<CourseController>("edit course credits", term_.getId(), id,
+            &CourseController::editNumCredits, oldNumCredits, newNumCredits);
+    }
     emit dataChanged();
 }
 
 void CourseController::editActive(const std::string& id, bool newActive) {
+    TRACE_SCOPE("CourseController::editActive");
     Course& course = term_.findCourse(id);
+    bool oldActive = course.getActive();
     course.setActive(newActive);
+    recordChange(id);
+    if (context_.undoLog != nullptr) {
+        context_.undoLog->recordEdit<CourseController>("edit course active", term_.getId(), id,
+            &CourseController::editActive, oldActive, newActive);
+    }
     emit dataChanged();
 }
 
 void CourseController::removeCourse(const std::string& title) {
+    TRACE_SCOPE("CourseController::removeCourse");
     const std::string id = getCourseId(title);
 
     if (activeCourse_ != nullptr && activeCourse_->getId() == id) {
         activeCourse_ = nullptr;
-        assignmentController_.reset();
+        assignmentController_ = nullptr;
+    }
+    assignmentControllers_.erase(id);
+
+    if (context_.dueIndex != nullptr) {
+        context_.dueIndex->removeCourse(term_.findCourse(id));
+    }
+    if (context_.searchIndex != nullptr) {
+        context_.searchIndex->removeCourse(term_.findCourse(id));
+    }
+
+    // moved out rather than copied, since the term only recalculates its totals once the course is gone
+    std::shared_ptr<const Course> removed;
+    std::string nextId;
+    if (context_.undoLog != nullptr && !context_.undoLog->isReplaying()) {
+        removed = std::make_shared<const Course>(std::move(term_.findCourse(id)));
+        nextId = getNextCourseId(id);
     }
 
     term_.removeCourse(id);
-    titleToId_.erase(utils::stringLower(title));
-    courseOrder_.erase(std::remove(courseOrder_.begin(), courseOrder_.end(), id), courseOrder_.end());
+    utils::eraseTitle(titleToId_, title);
+    recordChange(id, true);
+    if (removed) {
+        recordPresence("remove course", std::move(removed), std::move(nextId), false);
+    }
     emit dataChanged();
 }
 
+// moves a course to the given zero-based position in the term; order is local and not synced
+void CourseController::moveCourse(const std::string& id, std::size_t position) {
+    TRACE_SCOPE("CourseController::moveCourse");
+    if (!term_.getCourseList().contains(id)) {
+        throw std::out_of_range("Course not found.");
+    }
+
+    // undone and redone by neighbour rather than by position, which would take a walk along the list to find
+    std::string oldNextId = getNextCourseId(id);
+    term_.moveCourse(id, position);
+    if (context_.undoLog != nullptr) {
+        context_.undoLog->recordEdit<CourseController>("move course", term_.getId(), id,
+            &CourseController::moveCourseBefore, std::move(oldNextId), getNextCourseId(id));
+    }
+    markSnapshot();
+    emit dataChanged();
+}
+
+// moves a course in front of the one with nextId, or to the end of the term if nextId is empty or gone
+void CourseController::moveCourseBefore(const std::string& id, const std::string& nextId) {
+    term_.moveCourseBefore(id, nextId);
+    markSnapshot();
+    emit dataChanged();
+}
+
+// the ID of the course after the given one in the term, or empty if it is the last
+std::string CourseController::getNextCourseId(const std::string& id) const {
+    const std::string* next = term_.getCourseList().nextKey(id);
+    return next != nullptr ? *next : std::string{};
+}
+
 const Course& CourseController::findCourse(const std::string& title) const {
-    std::string id = getCourseId(title);
-    return term_.findCourse(id);
+    return term_.findCourse(getCourseId(title));
 }
 
 Course& CourseController::findCourse(const std::string& title) {
-    std::string id = getCourseId(title);
-    return term_.findCourse(id);
+    return term_.findCourse(getCourseId(title));
 }
 
 void CourseController::selectCourse(const std::string& title) {
-    std::string id = getCourseId(title);
+    TRACE_SCOPE("CourseController::selectCourse");
+    const std::string& id = getCourseId(title);
 
     try {
         Course& courseRef = term_.findCourse(id);
+        // a course selected before gets its controller back with its title index intact
+        assignmentController_ = &assignmentControllers_.obtain(id, courseRef, context_);
+        assignmentControllers_.pin(id);
         activeCourse_ = &courseRef;
-        assignmentController_.emplace(*activeCourse_);
     } catch (const std::out_of_range& e) {
         throw std::out_of_range("Course not found.");
     }
     emit courseSelected();
+}
+
+// copies the server's fields onto the local course by id, keeping its assignments, or adds it if it is new;
+// not recorded as a local change
+void CourseController::applyRemoteCourse(const Course& course) {
+    TRACE_SCOPE("CourseController::applyRemoteCourse");
+    std::string id = course.getId();
+    auto owner = titleToId_.find(course.getTitle());
+
+    if (owner != titleToId_.end() && owner->second != id) {
+        throw std::logic_error("Course with the same title already exists.");
+    }
+
+    if (!term_.getCourseList().contains(id)) {
+        term_.addCourse(course);
+        if (context_.dueIndex != nullptr) {
+            context_.dueIndex->addCourse(term_.findCourse(id), term_.getId());
+        }
+        if (context_.searchIndex != nullptr) {
+            context_.searchIndex->addCourse(term_.findCourse(id), term_.getId());
+        }
+    } else {
+        // updated in place so activeCourse_ and the assignment controller stay valid
+        Course& local = term_.findCourse(id);
+        utils::eraseTitle(titleToId_, local.getTitle());
+        local.setTitle(course.getTitle());
+        local.setDescription(course.getDescription());
+        local.setStartDate(course.getStartDate());
+        local.setEndDate(course.getEndDate());
+        local.setNumCredits(course.getNumCredits());
+        local.setActive(course.getActive());
+        updateSearchEntry(local);
+    }
+
+    titleToId_.insert_or_assign(utils::titleKey(course.getTitle()), id);
+    markSnapshot();
+    emit dataChanged();
+}
+
+// routes an assignment from the server to its course's assignment controller, which is cached for the course's other
+// changes, so that controller's index stays in step
+void CourseController::applyRemoteAssignment(const std::string& courseId, const Assignment& assignment) {
+    TRACE_SCOPE("CourseController::applyRemoteAssignment");
+    obtainAssignmentController(courseId).applyRemoteAssignment(assignment);
+    markSnapshot();
+    emit dataChanged();
+}
+
+// removes a course the server no longer has, with its assignments; not recorded as a local change
+void CourseController::removeRemoteCourse(const std::string& id) {
+    TRACE_SCOPE("CourseController::removeRemoteCourse");
+    const Course& course = term_.findCourse(id);
+
+    if (activeCourse_ != nullptr && activeCourse_->getId() == id) {
+        activeCourse_ = nullptr;
+        assignmentController_ = nullptr;
+    }
+    assignmentControllers_.erase(id);
+
+    if (context_.dueIndex != nullptr) {
+        context_.dueIndex->removeCourse(course);
+    }
+    if (context_.searchIndex != nullptr) {
+        context_.searchIndex->removeCourse(course);
+    }
+    utils::eraseTitle(titleToId_, course.getTitle());
+    term_.removeCourse(id);
+    markSnapshot();
+    emit dataChanged();
+}
+
+// routes the removal of an assignment the server no longer has to its course, like applyRemoteAssignment
+void CourseController::removeRemoteAssignment(const std::string& courseId, const std::string& assignmentId) {
+    TRACE_SCOPE("CourseController::removeRemoteAssignment");
+    obtainAssignmentController(courseId).removeRemoteAssignment(assignmentId);
+    markSnapshot();
+    emit dataChanged();
+}
+
+// runs an undo or redo step against a course's assignment controller: its cached one, or a temporary one that keeps
+// the indexes and the change tracker in step
+void CourseController::replay(const std::string& courseId, const UndoCommand::Step<AssignmentController>& step,
+    UndoCommand::Direction direction) {
+    if (AssignmentController* cached = assignmentControllers_.find(courseId)) {
+        step(*cached, direction);
+    } else {
+        AssignmentController temporary{term_.findCourse(courseId), context_};
+        step(temporary, direction);
+    }
+    emit dataChanged();
+}
+
+// the course's cached assignment controller, built on a miss
+AssignmentController& CourseController::obtainAssignmentController(const std::string& courseId) {
+    return assignmentControllers_.obtain(courseId, term_.findCourse(courseId), context_);
+}
+
+// puts back a course and its assignments with the IDs they had, at its old position, to undo its removal or redo
+// its addition
+void CourseController::restoreCourse(const Course& course, const std::string& nextId) {
+    if (titleToId_.contains(course.getTitle())) {
+        throw std::logic_error("Course with the same title already exists.");
+    }
+
+    term_.addCourse(course);
+    term_.moveCourseBefore(course.getId(), nextId);
+    titleToId_.emplace(utils::titleKey(course.getTitle()), course.getId());
+
+    const Course& restored = term_.findCourse(course.getId());
+    if (context_.dueIndex != nullptr) {
+        context_.dueIndex->addCourse(restored, term_.getId());
+    }
+    if (context_.searchIndex != nullptr) {
+        context_.searchIndex->addCourse(restored, term_.getId());
+    }
+
+    // removing the course dropped its assignments from the tracker along with it
+    recordChange(course.getId());
+    if (context_.tracker != nullptr) {
+        for (const auto& [id, assignment] : restored.getAssignmentList()) {
+            context_.tracker->recordUpsert(EntityKind::assignment, id, course.getId());
+        }
+    }
+    emit dataChanged();
+}
+
+// records adding or removing a course; one way removes it by ID and the other restores the shared copy
+void CourseController::recordPresence(const char* label, std::shared_ptr<const Course> course, std::string nextId,
+    bool added) {
+    std::size_t payloadBytes = MemoryAccounting::of(*course).bytes + nextId.capacity();
+    context_.undoLog->record(label, term_.getId(), UndoCommand::Step<CourseController>{
+        [course = std::move(course), nextId = std::move(nextId), added](CourseController& controller,
+            UndoCommand::Direction direction) {
+            if ((direction == UndoCommand::Direction::undo) == added) {
+                controller.removeCourse(controller.term_.findCourse(course->getId()).getTitle());
+            } else {
+                controller.restoreCourse(*course, nextId);
+            }
+        }}, payloadBytes);
+}
+
+// re-reads a course's searchable fields after an edit
+void CourseController::updateSearchEntry(const Course& course) {
+    if (context_.searchIndex != nullptr) {
+        context_.searchIndex->updateCourse(course);
+    }
+}
+
+// marks the term for the next snapshot; each course is copied along with its term
+void CourseController::markSnapshot() {
+    if (context_.snapshots != nullptr) {
+        context_.snapshots->markTerm(term_.getId());
+    }
+}
+
+// notes a local edit for the next sync and the next snapshot
+void CourseController::recordChange(const std::string& id, bool removed) {
+    markSnapshot();
+
+    if (context_.tracker == nullptr) {
+        return;
+    }
+
+    if (removed) {
+        context_.tracker->recordRemoval(EntityKind::course, id, term_.getId());
+    } else {
+        context_.tracker->recordUpsert(EntityKind::course, id, term_.getId());
+    }
 }
\ No newline at end of file
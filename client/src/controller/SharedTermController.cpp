@@ -0,0 +1,11 @@
+#include "controller/SharedTermController.hpp"
+
+/**
+ * @file SharedTermController.cpp
+ * @brief Implementation of the thread-safe facade over TermController.
+ */
+
+// the last state a writer committed; takes no lock, so it never waits on a writer
+std::shared_ptr<const Snapshot> SharedTermController::getSnapshot() const {
+    return controller_.getSnapshot();
+}
@@ -0,0 +1,96 @@
+#include "controller/SnapshotPublisher.hpp"
+
+/**
+ * @file SnapshotPublisher.cpp
+ * @brief Implementation of the snapshot publisher, which hands other threads immutable copies of the term tree.
+ */
+
+const Term* Snapshot::findTerm(const std::string& id) const {
+    for (const std::shared_ptr<const Term>& term : terms) {
+        if (term->getId() == id) {
+            return term.get();
+        }
+    }
+
+    return nullptr;
+}
+
+SnapshotPublisher::SnapshotPublisher(const TermList& terms)
+    : terms_{terms}, current_{std::make_shared<const Snapshot>()} {}
+
+std::shared_ptr<const Snapshot> SnapshotPublisher::getSnapshot() const {
+    std::lock_guard<std::mutex> lock{currentMutex_};
+    return current_;
+}
+
+bool SnapshotPublisher::hasChanges() const {
+    return changed_;
+}
+
+// a term that was added, removed, moved or edited
+void SnapshotPublisher::markTerm(const std::string& id) {
+    if (changed_ && lastMarked_ == id) {
+        return;
+    }
+
+    markedTerms_.insert(id);
+    lastMarked_ = id;
+    changed_ = true;
+}
+
+// a course that was edited or had its assignments changed; resolved to its term when publishing
+void SnapshotPublisher::markCourse(const std::string& id) {
+    if (changed_ && lastMarked_ == id) {
+        return;
+    }
+
+    markedCourses_.insert(id);
+    lastMarked_ = id;
+    changed_ = true;
+}
+
+// copies the marked terms, shares the rest with the current snapshot and swaps the result in
+std::shared_ptr<const Snapshot> SnapshotPublisher::publish() {
+    // only this thread swaps current_, so it can read it without the lock
+    const std::shared_ptr<const Snapshot>& previous = current_;
+
+    if (!changed_) {
+        return previous;
+    }
+
+    auto next = std::make_shared<Snapshot>();
+    next->version = previous->version + 1;
+    next->terms.reserve(terms_.size());
+
+    for (const auto& [id, term] : terms_) {
+        bool marked = markedTerms_.contains(id);
+        for (auto it = markedCourses_.begin(); !marked && it != markedCourses_.end(); ++it) {
+            marked = term.getCourseList().contains(*it);
+        }
+
+        std::shared_ptr<const Term>& shared = published_[id];
+        if (marked || shared == nullptr) {
+            shared = std::make_shared<const Term>(term);
+        }
+        next->terms.push_back(shared);
+    }
+
+    // a marked term that is no longer in the list was removed
+    for (const std::string& id : markedTerms_) {
+        if (!terms_.contains(id)) {
+            published_.erase(id);
+        }
+    }
+
+    markedTerms_.clear();
+    markedCourses_.clear();
+    lastMarked_.clear();
+    changed_ = false;
+
+    std::shared_ptr<const Snapshot> published = std::move(next);
+    {
+        std::lock_guard<std::mutex> lock{currentMutex_};
+        current_ = published;
+    }
+    return published;
+}
@@ -6,19 +6,40 @@
  */
 
 #include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+#include "io/TermTreeJson.hpp"
+#include "model/MemoryAccounting.hpp"
+#include "trace/Trace.hpp"
 #include "utils/utils.hpp"
 
-const std::unordered_map<std::string, Term>& TermController::getTermList() const {
-    return termList_;
+namespace {
+    // courses an asynchronous recompute hands to the pool at once, between checks of the step's clock
+    constexpr std::size_t recomputeSlice = 64;
+
+    void recomputeGrade(Course& course) {
+        course.setGradePct();
+        course.setLetterGrade();
+        course.setGpaVal();
+    }
+
+    bool pastDeadline(std::chrono::steady_clock::time_point deadline) {
+        return std::chrono::steady_clock::now() >= deadline;
+    }
 }
 
-const std::vector<std::string>& TermController::getTermOrder() const {
-    return termOrder_;
+const TermList& TermController::getTermList() const {
+    return termList_;
 }
 
-std::string TermController::getTermId(const std::string& title) const {
-    std::string titleLower = utils::stringLower(title);
-    auto it = titleToId_.find(titleLower);
+// matches the title in any case without allocating; the returned id lives until the term is removed
+const std::string& TermController::getTermId(std::string_view title) const {
+    auto it = titleToId_.find(title);
 
     if (it == titleToId_.end()) {
         throw std::out_of_range("Term not found.");
@@ -28,13 +49,17 @@ std::string TermController::getTermId(const std::string& title) const {
 }
 
 CourseController& TermController::getCourseController() {
-    if (!courseController_.has_value()) {
+    if (courseController_ == nullptr) {
         throw std::logic_error("No term selected.");
     }
 
     return *courseController_;
 }
 
+ControllerCache<CourseController>& TermController::getCourseControllerCache() {
+    return courseControllers_;
+}
+
 const Term& TermController::getActiveTerm() const {
     if (activeTerm_ == nullptr) {
         throw std::logic_error("No term selected.");
@@ -42,85 +67,695 @@ const Term& TermController::getActiveTerm() const {
     return *activeTerm_;
 }
 
+ChangeTracker& TermController::getChangeTracker() {
+    return changeTracker_;
+}
+
+const DueIndex& TermController::getDueIndex() const {
+    return dueIndex_;
+}
+
+// assignments from every term due from `from` to `to` inclusive, in due-date order
+std::vector<DueAssignment> TermController::getAssignmentsDue(const std::chrono::year_month_day& from,
+    const std::chrono::year_month_day& to, bool incompleteOnly) const {
+    TRACE_SCOPE("TermController::getAssignmentsDue");
+    std::vector<DueAssignment> due;
+
+    dueIndex_.forEachDue(std::chrono::sys_days{from}, std::chrono::sys_days{to}, incompleteOnly,
+        [this, &due](const DueKey& key, const std::string& courseId, const std::string& termId) {
+            const Term& term = termList_.at(termId);
+            const Course& course = term.findCourse(courseId);
+            due.push_back(DueAssignment{&term, &course, &course.findAssignment(key.id)});
+        });
+
+    return due;
+}
+
+const SearchIndex& TermController::getSearchIndex() const {
+    return searchIndex_;
+}
+
+// terms, courses and assignments from every term that match every word of the query, best first
+std::vector<SearchResult> TermController::search(std::string_view query, std::size_t limit) const {
+    TRACE_SCOPE("TermController::search");
+    std::vector<SearchResult> results;
+
+    for (const SearchHit& hit : searchIndex_.search(query, limit)) {
+        SearchResult result{nullptr, nullptr, nullptr, hit.score};
+
+        if (hit.kind == EntityKind::term) {
+            result.term = &termList_.at(hit.id);
+        } else {
+            result.term = &termList_.at(hit.termId);
+            result.course = &result.term->findCourse(hit.kind == EntityKind::course ? hit.id : hit.courseId);
+            if (hit.kind == EntityKind::assignment) {
+                result.assignment = &result.course->findAssignment(hit.id);
+            }
+        }
+
+        results.push_back(result);
+    }
+
+    return results;
+}
+
+UndoLog& TermController::getUndoLog() {
+    return undoLog_;
+}
+
+const UndoLog& TermController::getUndoLog() const {
+    return undoLog_;
+}
+
+// the most recently published snapshot; safe to call from any thread, and never blocks the one making edits
+std::shared_ptr<const Snapshot> TermController::getSnapshot() const {
+    return snapshots_.getSnapshot();
+}
+
+// publishes every change committed since the last snapshot, copying only the terms they touched
+std::shared_ptr<const Snapshot> TermController::publishSnapshot() {
+    TRACE_SCOPE("TermController::publishSnapshot");
+    return snapshots_.publish();
+}
+
 void TermController::addTerm(const std::string& title, const std::chrono::year_month_day& startDate,
     const std::chrono::year_month_day& endDate, bool active) {
+    TRACE_SCOPE("TermController::addTerm");
     Term term{title, startDate, endDate, active};
 
     auto termIt = termList_.emplace(term.getId(), std::move(term)).first;
-    auto titleInserted = titleToId_.emplace(utils::stringLower(termIt->second.getTitle()), termIt->first).second;
+    auto titleInserted = titleToId_.emplace(utils::titleKey(termIt->second.getTitle()), termIt->first).second;
 
     if (!titleInserted) {
         termList_.erase(termIt);
         throw std::logic_error("Term with the same title already exists.");
     }
 
-    termOrder_.push_back(termIt->first);
+    searchIndex_.addTerm(termIt->second);
+    changeTracker_.recordUpsert(EntityKind::term, termIt->first);
+    snapshots_.markTerm(termIt->first);
+    recordPresence("add term", std::make_shared<const Term>(termIt->second), "", true);
     emit dataChanged();
 }
 
+// adds an already-built Term (e.g. read from a file) as-is, keeping its ID and courses
+void TermController::importTerm(Term term) {
+    TRACE_SCOPE("TermController::importTerm");
+    std::string id = term.getId();
+    insertTerm(std::move(term));
+    recordTree(termList_.at(id), false);
+    emit dataChanged();
+}
+
+void TermController::insertTerm(Term term) {
+    if (termList_.contains(term.getId())) {
+        throw std::logic_error("Term with the same ID already exists.");
+    }
+
+    std::string id = term.getId();
+    auto titleInserted = titleToId_.emplace(utils::titleKey(term.getTitle()), id).second;
+
+    if (!titleInserted) {
+        throw std::logic_error("Term with the same title already exists.");
+    }
+
+    auto termIt = termList_.emplace(id, std::move(term)).first;
+    dueIndex_.addTerm(termIt->second);
+    searchIndex_.addTerm(termIt->second);
+    snapshots_.markTerm(id);
+}
+
+// adds a course from an import to a term already in the list, through the term's course controller so the
+// controller's title index stays current
+void TermController::insertCourse(const std::string& termId, const Course& course) {
+    obtainCourseController(termList_.at(termId)).applyRemoteCourse(course);
+
+    changeTracker_.recordUpsert(EntityKind::course, course.getId(), termId);
+    for (const auto& [assignmentId, assignment] : course.getAssignmentList()) {
+        changeTracker_.recordUpsert(EntityKind::assignment, assignmentId, course.getId());
+    }
+    snapshots_.markTerm(termId);
+}
+
+// puts back a term and everything under it with the IDs they had, at its old position, to undo its removal or
+// redo its addition
+void TermController::restoreTerm(const Term& term, const std::string& nextId) {
+    insertTerm(term);
+    termList_.moveBefore(term.getId(), nextId);
+    recordTree(term, false);
+    emit dataChanged();
+}
+
+// records adding or removing a term; one way removes it by ID and the other restores the shared copy
+void TermController::recordPresence(const char* label, std::shared_ptr<const Term> term, std::string nextId,
+    bool added) {
+    if (undoLog_.isReplaying()) {
+        return;
+    }
+
+    std::size_t payloadBytes = MemoryAccounting::of(*term).bytes + nextId.capacity();
+    undoLog_.record(label, "", UndoCommand::Step<TermController>{
+        [term = std::move(term), nextId = std::move(nextId), added](TermController& controller,
+            UndoCommand::Direction direction) {
+            if ((direction == UndoCommand::Direction::undo) == added) {
+                controller.removeTerm(controller.termList_.at(term->getId()).getTitle());
+            } else {
+                controller.restoreTerm(*term, nextId);
+            }
+        }}, payloadBytes);
+}
+
+// records a term and everything under it, either as new local data or as data that is already on the server
+void TermController::recordTree(const Term& term, bool remote) {
+    auto record = [this, remote](EntityKind kind, const std::string& id, const std::string& parentId) {
+        if (remote) {
+            changeTracker_.recordRemote(kind, id, parentId);
+        } else {
+            changeTracker_.recordUpsert(kind, id, parentId);
+        }
+    };
+
+    record(EntityKind::term, term.getId(), "");
+    for (const auto& [courseId, course] : term.getCourseList()) {
+        record(EntityKind::course, courseId, term.getId());
+        for (const auto& [assignmentId, assignment] : course.getAssignmentList()) {
+            record(EntityKind::assignment, assignmentId, courseId);
+        }
+    }
+}
+
 void TermController::editTitle(const std::string& id, const std::string& newTitle) {
+    TRACE_SCOPE("TermController::editTitle");
     Term& term = termList_.at(id);
-    std::string oldTitle = term.getTitle();
 
-    if (titleToId_.contains(utils::stringLower(newTitle))) {
+    if (titleToId_.contains(newTitle)) {
         throw std::logic_error("A term with this title already exists.");
     }
 
-    term.setTitle(newTitle);
-    titleToId_.erase(utils::stringLower(oldTitle));
-    titleToId_.emplace(utils::stringLower(newTitle), id);
+    std::string oldTitle = term.getTitle();
+    term.setTitle(newTitle);     // validates the title, so a rejected one leaves the index alone
+    auto node = titleToId_.extract(titleToId_.find(oldTitle));
+    node.key() = utils::titleKey(newTitle);
+    titleToId_.insert(std::move(node));
+    searchIndex_.updateTerm(term);
+    changeTracker_.recordUpsert(EntityKind::term, id);
+    snapshots_.markTerm(id);
+    undoLog_.recordEdit<TermController>("edit term title", "", id, &TermController::editTitle, std::move(oldTitle),
+        newTitle);
     emit dataChanged();
 }
 
 void TermController::editStartDate(const std::string& id, const std::chrono::year_month_day& newStartDate) {
+    TRACE_SCOPE("TermController::editStartDate");
     Term& term = termList_.at(id);
+    std::chrono::year_month_day oldStartDate = term.getStartDate();
     term.setStartDate(newStartDate);
+    changeTracker_.recordUpsert(EntityKind::term, id);
+    snapshots_.markTerm(id);
+    undoLog_.recordEdit<TermController>("edit term start date", "", id, &TermController::editStartDate, oldStartDate,
+        newStartDate);
     emit dataChanged();
 }
 
 void TermController::editEndDate(const std::string& id, const std::chrono::year_month_day& newEndDate) {
+    TRACE_SCOPE("TermController::editEndDate");
     Term& term = termList_.at(id);
+    std::chrono::year_month_day oldEndDate = term.getEndDate();
     term.setEndDate(newEndDate);
+    changeTracker_.recordUpsert(EntityKind::term, id);
+    snapshots_.markTerm(id);
+    undoLog_.recordEdit<TermController>("edit term end date", "", id, &TermController::editEndDate, oldEndDate,
+        newEndDate);
     emit dataChanged();
 }
 
 void TermController::editActive(const std::string& id, bool newActive) {
+    TRACE_SCOPE("TermController::editActive");
     Term& term = termList_.at(id);
+    bool oldActive = term.getActive();
     term.setActive(newActive);
+    changeTracker_.recordUpsert(EntityKind::term, id);
+    snapshots_.markTerm(id);
+    undoLog_.recordEdit<TermController>("edit term active", "", id, &TermController::editActive, oldActive, newActive);
     emit dataChanged();
 }
 
 void TermController::removeTerm(const std::string& title) {
+    TRACE_SCOPE("TermController::removeTerm");
     const std::string id = getTermId(title);
 
     if (activeTerm_ != nullptr && activeTerm_->getId() == id) { 
         activeTerm_ = nullptr; 
-        courseController_.reset(); 
+        courseController_ = nullptr; 
     }
+    courseControllers_.erase(id);
+
+    dueIndex_.removeTerm(termList_.at(id));
+    searchIndex_.removeTerm(termList_.at(id));
+
+    // moved out rather than copied, since nothing reads it once it is out of the indexes
+    std::string nextId = getNextTermId(id);
+    auto removed = std::make_shared<const Term>(std::move(termList_.at(id)));
 
     termList_.erase(id);
-    titleToId_.erase(utils::stringLower(title));
-    termOrder_.erase(std::remove(termOrder_.begin(), termOrder_.end(), id), termOrder_.end());
+    utils::eraseTitle(titleToId_, title);
+    changeTracker_.recordRemoval(EntityKind::term, id);
+    snapshots_.markTerm(id);
+    recordPresence("remove term", std::move(removed), std::move(nextId), false);
     emit dataChanged();
 }
 
+// moves a term to the given zero-based position in the list, e.g. after a drag in the sidebar; order is local
+// and not synced
+void TermController::moveTerm(const std::string& id, std::size_t position) {
+    TRACE_SCOPE("TermController::moveTerm");
+    if (!termList_.contains(id)) {
+        throw std::out_of_range("Term not found.");
+    }
+
+    // undone and redone by neighbour rather than by position, which would take a walk along the list to find
+    std::string oldNextId = getNextTermId(id);
+    termList_.move(id, position);
+    snapshots_.markTerm(id);
+    undoLog_.recordEdit<TermController>("move term", "", id, &TermController::moveTermBefore, std::move(oldNextId),
+        getNextTermId(id));
+    emit dataChanged();
+}
+
+// moves a term in front of the one with nextId, or to the end of the list if nextId is empty or gone
+void TermController::moveTermBefore(const std::string& id, const std::string& nextId) {
+    termList_.moveBefore(id, nextId);
+    snapshots_.markTerm(id);
+    emit dataChanged();
+}
+
+// the ID of the term after the given one in the list, or empty if it is the last
+std::string TermController::getNextTermId(const std::string& id) const {
+    const std::string* next = termList_.nextKey(id);
+    return next != nullptr ? *next : std::string{};
+}
+
 const Term& TermController::findTerm(const std::string& title) const {
-    std::string id = getTermId(title);
-    return termList_.at(id);
+    return termList_.at(getTermId(title));
 }
 
 Term& TermController::findTerm(const std::string& title) {
-    std::string id = getTermId(title);
-    return termList_.at(id);
+    return termList_.at(getTermId(title));
 }
 
 void TermController::selectTerm(const std::string& title) {
+    TRACE_SCOPE("TermController::selectTerm");
     try {
         Term& termRef = findTerm(title);
+        // a term selected before gets its controller back, along with its course order and selected course
+        courseController_ = &courseControllers_.obtain(termRef.getId(), termRef, context_);
+        courseControllers_.pin(termRef.getId());
         activeTerm_ = &termRef;
-        courseController_.emplace(*activeTerm_);
     } catch (const std::out_of_range& e) {
         throw std::out_of_range("Term not found.");
     }
     emit termSelected();
+}
+
+// applies a term from the server by id, updating the local copy's fields (keeping its courses) or adding it
+// if it is new; not recorded as a local change
+void TermController::applyRemoteTerm(const Term& term) {
+    TRACE_SCOPE("TermController::applyRemoteTerm");
+    std::string id = term.getId();
+    auto owner = titleToId_.find(term.getTitle());
+
+    if (owner != titleToId_.end() && owner->second != id) {
+        throw std::logic_error("Term with the same title already exists.");
+    }
+
+    auto existing = termList_.find(id);
+
+    if (existing == termList_.end()) {
+        insertTerm(term);
+        recordTree(termList_.at(id), true);
+    } else {
+        Term& local = existing->second;
+        utils::eraseTitle(titleToId_, local.getTitle());
+        local.setTitle(term.getTitle());
+        local.setStartDate(term.getStartDate());
+        local.setEndDate(term.getEndDate());
+        local.setActive(term.getActive());
+        searchIndex_.updateTerm(local);
+        titleToId_.emplace(utils::titleKey(term.getTitle()), id);
+        changeTracker_.recordRemote(EntityKind::term, id);
+        snapshots_.markTerm(id);
+    }
+
+    emit dataChanged();
+}
+
+// routes a course from the server to its term's course controller, which is cached for the term's other changes
+void TermController::applyRemoteCourse(const std::string& termId, const Course& course) {
+    TRACE_SCOPE("TermController::applyRemoteCourse");
+    auto it = termList_.find(termId);
+
+    if (it == termList_.end()) {
+        throw std::out_of_range("Term not found.");
+    }
+
+    obtainCourseController(it->second).applyRemoteCourse(course);
+
+    changeTracker_.recordRemote(EntityKind::course, course.getId(), termId);
+    snapshots_.markTerm(termId);
+    emit dataChanged();
+}
+
+// routes an assignment from the server to its course, like applyRemoteCourse
+void TermController::applyRemoteAssignment(const std::string& termId, const std::string& courseId,
+    const Assignment& assignment) {
+    TRACE_SCOPE("TermController::applyRemoteAssignment");
+    auto it = termList_.find(termId);
+
+    if (it == termList_.end()) {
+        throw std::out_of_range("Term not found.");
+    }
+
+    obtainCourseController(it->second).applyRemoteAssignment(courseId, assignment);
+    changeTracker_.recordRemote(EntityKind::assignment, assignment.getId(), courseId);
+    snapshots_.markTerm(termId);
+    emit dataChanged();
+}
+
+// removes a term the server no longer has, with everything under it; not recorded as a local change
+void TermController::removeRemoteTerm(const std::string& id) {
+    TRACE_SCOPE("TermController::removeRemoteTerm");
+    auto it = termList_.find(id);
+
+    if (it == termList_.end()) {
+        throw std::out_of_range("Term not found.");
+    }
+
+    if (activeTerm_ != nullptr && activeTerm_->getId() == id) {
+        activeTerm_ = nullptr;
+        courseController_ = nullptr;
+    }
+    courseControllers_.erase(id);
+
+    dueIndex_.removeTerm(it->second);
+    searchIndex_.removeTerm(it->second);
+    utils::eraseTitle(titleToId_, it->second.getTitle());
+    termList_.erase(id);
+    changeTracker_.forget(EntityKind::term, id);
+    snapshots_.markTerm(id);
+    emit dataChanged();
+}
+
+// routes the removal of a course the server no longer has to its term, like applyRemoteCourse
+void TermController::removeRemoteCourse(const std::string& termId, const std::string& courseId) {
+    TRACE_SCOPE("TermController::removeRemoteCourse");
+    auto it = termList_.find(termId);
+
+    if (it == termList_.end()) {
+        throw std::out_of_range("Term not found.");
+    }
+
+    obtainCourseController(it->second).removeRemoteCourse(courseId);
+
+    changeTracker_.forget(EntityKind::course, courseId);
+    snapshots_.markTerm(termId);
+    emit dataChanged();
+}
+
+void TermController::removeRemoteAssignment(const std::string& termId, const std::string& courseId,
+    const std::string& assignmentId) {
+    TRACE_SCOPE("TermController::removeRemoteAssignment");
+    auto it = termList_.find(termId);
+
+    if (it == termList_.end()) {
+        throw std::out_of_range("Term not found.");
+    }
+
+    obtainCourseController(it->second).removeRemoteAssignment(courseId, assignmentId);
+
+    changeTracker_.forget(EntityKind::assignment, assignmentId);
+    snapshots_.markTerm(termId);
+    emit dataChanged();
+}
+
+// the term's cached course controller, built on a miss; changes from the server go through it rather than a
+// temporary, which would index every course title in the term again for each change
+CourseController& TermController::obtainCourseController(Term& term) {
+    return courseControllers_.obtain(term.getId(), term, context_);
+}
+
+// reverts the most recent local edit at any level, through the controller that made it
+void TermController::undo() {
+    TRACE_SCOPE("TermController::undo");
+    undoLog_.undo([this](const std::string& ownerId, const UndoCommand::Action& action,
+        UndoCommand::Direction direction) { replay(ownerId, action, direction); });
+    emit dataChanged();
+}
+
+// makes the most recently undone edit again
+void TermController::redo() {
+    TRACE_SCOPE("TermController::redo");
+    undoLog_.redo([this](const std::string& ownerId, const UndoCommand::Action& action,
+        UndoCommand::Direction direction) { replay(ownerId, action, direction); });
+    emit dataChanged();
+}
+
+// recomputes every course's grade and every term's GPA, e.g. after a change to how grades are calculated
+void TermController::recomputeAll() {
+    recomputeAll(utils::ThreadPool::shared());
+}
+
+// courses are independent, so they fan out across the pool; each term then sums its own courses
+void TermController::recomputeAll(utils::ThreadPool& pool) {
+    TRACE_SCOPE("TermController::recomputeAll");
+
+    std::vector<Course*> courses;
+    std::vector<Term*> terms;
+    terms.reserve(termList_.size());
+    for (auto& [id, term] : termList_) {
+        terms.push_back(&term);
+        for (const auto& [courseId, course] : term.getCourseList()) {
+            courses.push_back(&term.findCourse(courseId));
+        }
+    }
+    TRACE_COUNT("TermController::recomputeAll courses", courses.size());
+
+    pool.parallelFor(courses.size(), [&courses](std::size_t i) { recomputeGrade(*courses[i]); });
+    pool.parallelFor(terms.size(), [&terms](std::size_t i) { terms[i]->recalculateGpa(); });
+
+    for (const auto& [id, term] : termList_) {
+        snapshots_.markTerm(id);
+    }
+    emit dataChanged();
+}
+
+// serializes the tree as it stands now on the pool into a file beside the target, which replaces the target only
+// once it is complete; a cancelled or failed export removes that file and leaves whatever was at the path as it was
+AsyncOperation* TermController::exportAsync(const std::string& path) {
+    TRACE_SCOPE("TermController::exportAsync");
+    auto* operation = new AsyncOperation{this};
+
+    operation->start([snapshot = publishSnapshot(), path](AsyncOperation& op) {
+        const std::filesystem::path target{path};
+        std::filesystem::path partial{target};
+        partial += ".part";
+
+        try {
+            {
+                std::ofstream file{partial};
+                if (!file) {
+                    throw std::runtime_error("Could not open " + path + " for writing.");
+                }
+
+                io::exportTermTree(*snapshot, file, [&op](std::size_t done, std::size_t total) {
+                    op.reportProgress(done, total);
+                });
+                if (!file.flush()) {
+                    throw std::runtime_error("Could not write " + path + ".");
+                }
+            }
+            std::filesystem::rename(partial, target);
+        } catch (...) {
+            std::error_code ignored;
+            std::filesystem::remove(partial, ignored);
+            throw;
+        }
+    });
+    return operation;
+}
+
+// parses the file on the pool, then adds its terms here a course at a time; progress is half parsing, half adding
+//
+// Nothing is added if any term collides with one already here when the adding starts. Each step adds as many
+// courses as fit in the step budget; an import that is cancelled, or fails because a term with the same title
+// was added in the meantime, removes the terms it had already added, so none of them is queued for sync.
+AsyncOperation* TermController::importAsync(const std::string& path) {
+    TRACE_SCOPE("TermController::importAsync");
+    auto* operation = new AsyncOperation{this};
+    auto terms = std::make_shared<std::vector<Term>>();
+
+    // a term, then each of its courses; the parsed terms aren't touched again, so the pointers stay valid
+    struct Item {
+        const Term* term;
+        const Course* course;   // null for the term itself
+    };
+    auto items = std::make_shared<std::vector<Item>>();
+    auto next = std::make_shared<std::size_t>(0);
+    auto added = std::make_shared<std::vector<std::string>>();     // IDs of the terms added so far
+
+    // the step is released by the time either signal arrives, so this holds on to the IDs by itself
+    auto rollBack = [this, added]() {
+        for (const std::string& id : *added) {
+            removeRemoteTerm(id);
+        }
+        added->clear();
+    };
+    connect(operation, &AsyncOperation::cancelled, this, rollBack);
+    connect(operation, &AsyncOperation::failed, this, rollBack);
+
+    operation->start([path, terms](AsyncOperation& op) {
+        std::ifstream file{path};
+        if (!file) {
+            throw std::runtime_error("Could not open " + path + " for reading.");
+        }
+
+        *terms = io::readTerms(file, [&op](std::size_t done, std::size_t total) {
+            op.reportProgress(done, 2 * total);
+        });
+    }, [this, operation, terms, items, next, added]() {
+        auto deadline = std::chrono::steady_clock::now() + AsyncOperation::stepBudget;
+
+        if (items->empty()) {
+            io::checkImport(*terms, *this);
+            std::size_t entities = 0;
+            for (const Term& term : *terms) {
+                items->push_back(Item{&term, nullptr});
+                for (const auto& [courseId, course] : term.getCourseList()) {
+                    items->push_back(Item{&term, &course});
+                    entities += course.getAssignmentList().size();
+                }
+            }
+
+            // grown once here, rather than rehashed in the middle of whichever step crosses the next threshold
+            entities += items->size();
+            searchIndex_.reserve(entities);
+            changeTracker_.reserve(entities);
+        }
+
+        while (*next < items->size()) {
+            const Item& item = (*items)[*next];
+            if (item.course == nullptr) {
+                insertTerm(Term::fromRow(item.term->getId(), item.term->getTitle(), item.term->getStartDate(),
+                    item.term->getEndDate(), item.term->getActive()));
+                changeTracker_.recordUpsert(EntityKind::term, item.term->getId());
+                added->push_back(item.term->getId());
+            } else {
+                insertCourse(item.term->getId(), *item.course);
+            }
+            ++*next;
+
+            if (pastDeadline(deadline)) {
+                break;
+            }
+        }
+
+        emit dataChanged();
+        operation->reportProgress(items->size() + *next, 2 * items->size());
+        return *next == items->size();
+    });
+    return operation;
+}
+
+// recomputes a slice of courses at a time on the pool, and the GPAs of their terms after each, so the tree is
+// consistent between steps and after a cancel; courses removed in the meantime are skipped
+AsyncOperation* TermController::recomputeAllAsync() {
+    TRACE_SCOPE("TermController::recomputeAllAsync");
+    auto* operation = new AsyncOperation{this};
+    auto courses = std::make_shared<std::vector<std::pair<std::string, std::string>>>();   // term ID, course ID
+    auto next = std::make_shared<std::size_t>(0);
+
+    // by ID rather than by pointer, since the tree can change between steps
+    for (const auto& [termId, term] : termList_) {
+        for (const auto& [courseId, course] : term.getCourseList()) {
+            courses->emplace_back(termId, courseId);
+        }
+    }
+
+    operation->start({}, [this, operation, courses, next]() {
+        auto deadline = std::chrono::steady_clock::now() + AsyncOperation::stepBudget;
+
+        while (*next < courses->size()) {
+            std::size_t end = std::min(*next + recomputeSlice, courses->size());
+            std::vector<Course*> slice;
+            std::unordered_set<std::string> termIds;
+
+            for (std::size_t i = *next; i < end; ++i) {
+                const auto& [termId, courseId] = (*courses)[i];
+                auto termIt = termList_.find(termId);
+                if (termIt != termList_.end() && termIt->second.getCourseList().contains(courseId)) {
+                    slice.push_back(&termIt->second.findCourse(courseId));
+                    termIds.insert(termId);
+                }
+            }
+
+            utils::ThreadPool::shared().parallelFor(slice.size(), [&slice](std::size_t i) {
+                recomputeGrade(*slice[i]);
+            });
+            for (const std::string& termId : termIds) {
+                termList_.at(termId).recalculateGpa();
+                snapshots_.markTerm(termId);
+            }
+            *next = end;
+
+            if (pastDeadline(deadline)) {
+                break;
+            }
+        }
+
+        emit dataChanged();
+        operation->reportProgress(*next, courses->size());
+        return *next == courses->size();
+    });
+    return operation;
+}
+
+// runs an undo or redo step against the controller that made the edit: this one for a term, the term's course
+// controller for a course, and through that, the course's assignment controller for an assignment
+void TermController::replay(const std::string& ownerId, const UndoCommand::Action& action,
+    UndoCommand::Direction direction) {
+    if (const auto* step = std::get_if<UndoCommand::Step<TermController>>(&action)) {
+        (*step)(*this, direction);
+        return;
+    }
+
+    const auto* assignmentStep = std::get_if<UndoCommand::Step<AssignmentController>>(&action);
+    auto owner = termList_.end();
+
+    if (assignmentStep == nullptr) {
+        owner = termList_.find(ownerId);
+    } else {
+        for (auto it = termList_.begin(); it != termList_.end() && owner == termList_.end(); ++it) {
+            if (it->second.getCourseList().contains(ownerId)) {
+                owner = it;
+            }
+        }
+    }
+
+    if (owner == termList_.end()) {
+        throw std::out_of_range(assignmentStep == nullptr ? "Term not found." : "Course not found.");
+    }
+
+    auto run = [&ownerId, &action, direction, assignmentStep](CourseController& controller) {
+        if (assignmentStep != nullptr) {
+            controller.replay(ownerId, *assignmentStep, direction);
+        } else {
+            std::get<UndoCommand::Step<CourseController>>(action)(controller, direction);
+        }
+    };
+
+    if (CourseController* cached = courseControllers_.find(owner->first)) {
+        run(*cached);
+    } else {
+        CourseController temporary{owner->second, context_};
+        run(temporary);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,149 @@
+#include "controller/UndoLog.hpp"
+
+/**
+ * @file UndoLog.cpp
+ * @brief Implementation of the undo log, which records each local edit as an action that can be run either way.
+ */
+
+#include <stdexcept>    // for exceptions
+#include <utility>      // for moving commands between stacks
+
+namespace {
+    // clears the replaying flag however the replayed action ends, so a failed undo doesn't silence later edits
+    class ReplayScope {
+        public:
+            explicit ReplayScope(bool& replaying) : replaying_{replaying} { replaying_ = true; }
+            ~ReplayScope() { replaying_ = false; }
+            ReplayScope(const ReplayScope&) = delete;
+            ReplayScope& operator=(const ReplayScope&) = delete;
+
+        private:
+            bool& replaying_;
+    };
+}
+
+UndoLog::UndoLog(std::size_t budget) : budget_{budget} {}
+
+std::size_t UndoLog::getBudget() const {
+    return budget_;
+}
+
+void UndoLog::setBudget(std::size_t budget) {
+    budget_ = budget;
+    trim();
+}
+
+std::size_t UndoLog::getBytes() const {
+    return bytes_;
+}
+
+std::size_t UndoLog::getUndoCount() const {
+    return undo_.size();
+}
+
+std::size_t UndoLog::getRedoCount() const {
+    return redo_.size();
+}
+
+bool UndoLog::canUndo() const {
+    return !undo_.empty();
+}
+
+bool UndoLog::canRedo() const {
+    return !redo_.empty();
+}
+
+const char* UndoLog::getUndoLabel() const {
+    if (undo_.empty()) {
+        throw std::logic_error("Nothing to undo.");
+    }
+
+    return undo_.back().label;
+}
+
+const char* UndoLog::getRedoLabel() const {
+    if (redo_.empty()) {
+        throw std::logic_error("Nothing to redo.");
+    }
+
+    return redo_.back().label;
+}
+
+// true while an undo or redo is running, when the controller methods it calls must not record themselves
+bool UndoLog::isReplaying() const {
+    return replaying_;
+}
+
+// adds an edit that has just been made; a new edit discards whatever could have been redone
+void UndoLog::record(const char* label, std::string ownerId, UndoCommand::Action action, std::size_t payloadBytes) {
+    if (replaying_) {
+        return;
+    }
+
+    UndoCommand command{label, std::move(ownerId), std::move(action), 0};
+    command.bytes = sizeof(UndoCommand) + command.ownerId.capacity() + payloadBytes;
+
+    for (const UndoCommand& dropped : redo_) {
+        bytes_ -= dropped.bytes;
+    }
+    redo_.clear();
+
+    bytes_ += command.bytes;
+    undo_.push_back(std::move(command));
+    trim();
+}
+
+// replays the most recent edit backwards; if it throws, e.g. because a pull removed what it edits, the edit is
+// dropped rather than left on top where every later undo would hit it again
+void UndoLog::undo(const Replay& replay) {
+    if (undo_.empty()) {
+        throw std::logic_error("Nothing to undo.");
+    }
+
+    replayTop(undo_, redo_, replay, UndoCommand::Direction::undo);
+}
+
+void UndoLog::redo(const Replay& replay) {
+    if (redo_.empty()) {
+        throw std::logic_error("Nothing to redo.");
+    }
+
+    replayTop(redo_, undo_, replay, UndoCommand::Direction::redo);
+}
+
+// takes the newest command off one stack and replays it; it goes onto the other stack only if the replay succeeds
+void UndoLog::replayTop(std::deque<UndoCommand>& from, std::deque<UndoCommand>& to, const Replay& replay,
+    UndoCommand::Direction direction) {
+    UndoCommand command = std::move(from.back());
+    from.pop_back();
+
+    try {
+        ReplayScope scope{replaying_};
+        replay(command.ownerId, command.action, direction);
+    } catch (...) {
+        bytes_ -= command.bytes;
+        throw;
+    }
+
+    to.push_back(std::move(command));
+}
+
+void UndoLog::clear() {
+    undo_.clear();
+    redo_.clear();
+    bytes_ = 0;
+}
+
+// drops the oldest edits, then the furthest redos, until the log fits its budget; a single edit larger than the
+// budget is not kept at all
+void UndoLog::trim() {
+    while (bytes_ > budget_ && !undo_.empty()) {
+        bytes_ -= undo_.front().bytes;
+        undo_.pop_front();
+    }
+
+    while (bytes_ > budget_ && !redo_.empty()) {
+        bytes_ -= redo_.front().bytes;
+        redo_.pop_front();
+    }
+}
@@ -0,0 +1,105 @@
+/**
+ * @file main.cpp
+ * @brief Headless daemon that serves the server's REST API from an in-memory TermController.
+ *
+ * Answers the same /terms, /courses and /assignments routes as the Python server (see ApiService.hpp),
+ * optionally starting from a term tree JSON document such as CourseCompanion_synth writes. Nothing is
+ * persisted; the model lives as long as the process. SIGINT and SIGTERM stop it cleanly.
+ *
+ *     CourseCompanion_daemon [--host HOST] [--port N] [--load FILE]
+ */
+
+#include <csignal>          // for stopping on SIGINT and SIGTERM
+#include <fstream>          // for ifstream
+#include <iostream>         // for cout and cerr
+#include <stdexcept>        // for exceptions
+#include <string>           // for arguments
+#include <string_view>      // for flag names
+#include "controller/TermController.hpp"
+#include "io/TermTreeJson.hpp"
+#include "net/ApiService.hpp"
+#include "net/HttpServer.hpp"
+
+namespace {
+    constexpr const char* usage =
+        "Usage: CourseCompanion_daemon [--host HOST] [--port N] [--load FILE]\n";
+
+    HttpServer* running = nullptr;
+
+    // stop() only writes to an eventfd, which is safe from a signal handler
+    void requestStop(int) {
+        if (running != nullptr) {
+            running->stop();
+        }
+    }
+
+    std::uint16_t parsePort(const std::string& value) {
+        std::size_t used = 0;
+        unsigned long port = 0;
+        try {
+            port = std::stoul(value, &used);
+        } catch (const std::exception&) {
+            used = 0;
+        }
+        if (used == 0 || used != value.size() || value.front() == '-' || port > 65535) {
+            throw std::invalid_argument("--port expects a number from 0 to 65535, got '" + value + "'.");
+        }
+        return static_cast<std::uint16_t>(port);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    std::string host = "127.0.0.1";
+    std::uint16_t port = 8000;
+    std::string loadPath;
+
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string_view flag{argv[i]};
+            if (flag == "--help" || flag == "-h") {
+                std::cout << usage;
+                return 0;
+            }
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("Missing value for " + std::string{flag} + ".");
+            }
+            std::string value{argv[++i]};
+
+            if (flag == "--host") {
+                host = value;
+            } else if (flag == "--port") {
+                port = parsePort(value);
+            } else if (flag == "--load") {
+                loadPath = value;
+            } else {
+                throw std::invalid_argument("Unknown option " + std::string{flag} + ".");
+            }
+        }
+
+        TermController controller;
+        if (!loadPath.empty()) {
+            std::ifstream file{loadPath, std::ios::binary};
+            if (!file) {
+                throw std::runtime_error("Could not open " + loadPath + " for reading.");
+            }
+            io::importTermTree(file, controller);
+        }
+
+        ApiService service{controller};
+        HttpServer server{host, port, [&service](const HttpRequest& request) { return service.handle(request); }};
+
+        running = &server;
+        std::signal(SIGINT, requestStop);
+        std::signal(SIGTERM, requestStop);
+
+        std::cerr << "Serving " << controller.getTermList().size() << " terms on http://" << host << ":"
+                  << server.getPort() << "\n";
+        server.run();
+        running = nullptr;
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n" << usage;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,563 @@
+#include "io/EntityJson.hpp"
+
+/**
+ * @file EntityJson.cpp
+ * @brief Implementation of the JSON encoding of single Term, Course and Assignment records.
+ *
+ * Reading is a JsonHandler state machine: it fills one record per nesting level and turns each finished
+ * record into a Term, Course or Assignment. Only the records currently open are kept, plus the model
+ * objects already built from earlier records.
+ *
+ * Provides implementations only; see EntityJson.hpp for definitions.
+ */
+
+#include <cmath>            // for trunc
+#include <optional>         // for the pending section
+#include <stdexcept>        // for exceptions
+#include <vector>           // for the frame stack
+#include "io/JsonReader.hpp"
+#include "utils/utils.hpp"
+
+namespace {
+    // writes a date as YYYY-MM-DD, the format Pydantic uses for date fields
+    void writeDate(JsonWriter& writer, const std::chrono::year_month_day& date) {
+        int y = static_cast<int>(date.year());
+        unsigned m = static_cast<unsigned>(date.month());
+        unsigned d = static_cast<unsigned>(date.day());
+
+        char buffer[10] = {
+            static_cast<char>('0' + (y / 1000) % 10), static_cast<char>('0' + (y / 100) % 10),
+            static_cast<char>('0' + (y / 10) % 10), static_cast<char>('0' + y % 10), '-',
+            static_cast<char>('0' + m / 10), static_cast<char>('0' + m % 10), '-',
+            static_cast<char>('0' + d / 10), static_cast<char>('0' + d % 10)
+        };
+        writer.stringValue(std::string_view{buffer, sizeof(buffer)});
+    }
+
+    // empty descriptions are stored as "" in the model and as null on the server
+    void writeDescription(JsonWriter& writer, const std::string& description) {
+        if (description.empty()) {
+            writer.nullValue();
+        } else {
+            writer.stringValue(description);
+        }
+    }
+
+    // the fields of each record, without the braces, so the tree writer can add its nested arrays
+    void writeTermFields(JsonWriter& writer, const Term& term) {
+        writer.key("id");
+        writer.stringValue(term.getId());
+        writer.key("title");
+        writer.stringValue(term.getTitle());
+        writer.key("start_date");
+        writeDate(writer, term.getStartDate());
+        writer.key("end_date");
+        writeDate(writer, term.getEndDate());
+        writer.key("active");
+        writer.boolValue(term.getActive());
+    }
+
+    void writeCourseFields(JsonWriter& writer, const std::string& termId, const Course& course) {
+        writer.key("id");
+        writer.stringValue(course.getId());
+        writer.key("term_id");
+        writer.stringValue(termId);
+        writer.key("title");
+        writer.stringValue(course.getTitle());
+        writer.key("description");
+        writeDescription(writer, course.getDescription());
+        writer.key("start_date");
+        writeDate(writer, course.getStartDate());
+        writer.key("end_date");
+        writeDate(writer, course.getEndDate());
+        writer.key("num_credits");
+        writer.numberValue(course.getNumCredits());
+        writer.key("active");
+        writer.boolValue(course.getActive());
+    }
+
+    void writeAssignmentFields(JsonWriter& writer, const std::string& courseId, const Assignment& assignment) {
+        writer.key("id");
+        writer.stringValue(assignment.getId());
+        writer.key("course_id");
+        writer.stringValue(courseId);
+        writer.key("title");
+        writer.stringValue(assignment.getTitle());
+        writer.key("description");
+        writeDescription(writer, assignment.getDescription());
+        writer.key("category");
+        writer.stringValue(assignment.getCategory());
+        writer.key("due_date");
+        writeDate(writer, assignment.getDueDate());
+        writer.key("completed");
+        writer.boolValue(assignment.getCompleted());
+        writer.key("grade");
+        writer.numberValue(assignment.getGrade());
+    }
+
+    // one bit per field across all three record types; unknown keys map to none and their values are skipped, as Pydantic does
+    enum Field : unsigned {
+        none        = 0,
+        id          = 1u << 0,
+        termId      = 1u << 1,
+        courseId    = 1u << 2,
+        title       = 1u << 3,
+        description = 1u << 4,
+        category    = 1u << 5,
+        startDate   = 1u << 6,
+        endDate     = 1u << 7,
+        dueDate     = 1u << 8,
+        numCredits  = 1u << 9,
+        active      = 1u << 10,
+        completed   = 1u << 11,
+        grade       = 1u << 12
+    };
+
+    struct FieldName {
+        std::string_view name;
+        Field field;
+    };
+
+    constexpr FieldName fieldNames[] = {
+        {"id", Field::id},
+        {"term_id", Field::termId},
+        {"course_id", Field::courseId},
+        {"title", Field::title},
+        {"description", Field::description},
+        {"category", Field::category},
+        {"start_date", Field::startDate},
+        {"end_date", Field::endDate},
+        {"due_date", Field::dueDate},
+        {"num_credits", Field::numCredits},
+        {"active", Field::active},
+        {"completed", Field::completed},
+        {"grade", Field::grade}
+    };
+
+    Field fieldFromKey(std::string_view key) {
+        for (const FieldName& entry : fieldNames) {
+            if (entry.name == key) {
+                return entry.field;
+            }
+        }
+
+        return Field::none;
+    }
+
+    std::string_view keyFromField(Field field) {
+        for (const FieldName& entry : fieldNames) {
+            if (entry.field == field) {
+                return entry.name;
+            }
+        }
+
+        return "";
+    }
+
+    // the fields of whichever record is currently being read; reused for every record
+    struct Record {
+        unsigned seen{0};
+        std::string id{};
+        std::string parentId{};
+        std::string title{};
+        std::string description{};
+        std::string category{};
+        std::chrono::year_month_day startDate{};
+        std::chrono::year_month_day endDate{};
+        std::chrono::year_month_day dueDate{};
+        int numCredits{3};
+        bool active{true};
+        bool completed{false};
+        float grade{0.0f};
+
+        void reset() {
+            seen = 0;
+            id.clear();
+            parentId.clear();
+            title.clear();
+            description.clear();
+            category.clear();
+            startDate = {};
+            endDate = {};
+            dueDate = {};
+            numCredits = 3;
+            active = true;
+            completed = false;
+            grade = 0.0f;
+        }
+    };
+
+    // reads either a term tree document ({"terms": [...], "courses": [...], "assignments": [...]}) or, when
+    // constructed with a kind, a single record object or an array of records of that kind; in both, a term
+    // record may nest its courses under "courses" and a course record its assignments under "assignments"
+    class EntityHandler : public JsonHandler {
+        public:
+            EntityHandler() = default;
+            explicit EntityHandler(EntityKind kind) : fixedKind_{kind} {}
+
+            void startObject() override {
+                if (ignoreDepth_ > 0 || ignoreNext_) {
+                    startIgnored();
+                    return;
+                }
+
+                if (frames_.empty() && !done_) {
+                    if (fixedKind_.has_value()) {
+                        beginRecord(*fixedKind_);
+                    } else {
+                        frames_.push_back(Frame{Level::root});
+                    }
+                } else if (!frames_.empty() && frames_.back().level == Level::section) {
+                    beginRecord(frames_.back().kind);
+                } else {
+                    unexpected("object");
+                }
+            }
+
+            void endObject() override {
+                if (ignoreDepth_ > 0) {
+                    --ignoreDepth_;
+                    return;
+                }
+
+                if (frames_.back().level == Level::record) {
+                    finishRecord();
+                }
+                frames_.pop_back();
+                done_ = frames_.empty();
+            }
+
+            void startArray() override {
+                if (ignoreDepth_ > 0 || ignoreNext_) {
+                    startIgnored();
+                    return;
+                }
+
+                if (pendingSection_.has_value()) {
+                    frames_.push_back(Frame{Level::section, *pendingSection_});
+                    pendingSection_.reset();
+                } else if (frames_.empty() && !done_ && fixedKind_.has_value()) {
+                    frames_.push_back(Frame{Level::section, *fixedKind_});
+                } else {
+                    unexpected("array");
+                }
+            }
+
+            void endArray() override {
+                if (ignoreDepth_ > 0) {
+                    --ignoreDepth_;
+                    return;
+                }
+
+                frames_.pop_back();
+                done_ = frames_.empty();
+            }
+
+            void key(std::string_view name) override {
+                if (ignoreDepth_ > 0) {
+                    return;
+                }
+
+                const Frame& frame = frames_.back();
+
+                if (frame.level == Level::root) {
+                    if (name == "terms") {
+                        pendingSection_ = EntityKind::term;
+                    } else if (name == "courses") {
+                        pendingSection_ = EntityKind::course;
+                    } else if (name == "assignments") {
+                        pendingSection_ = EntityKind::assignment;
+                    } else {
+                        ignoreNext_ = true;
+                    }
+                } else if (frame.kind == EntityKind::term && name == "courses") {
+                    pendingSection_ = EntityKind::course;
+                } else if (frame.kind == EntityKind::course && name == "assignments") {
+                    pendingSection_ = EntityKind::assignment;
+                } else {
+                    field_ = fieldFromKey(name);
+                    ignoreNext_ = (field_ == Field::none);
+                }
+            }
+
+            void stringValue(std::string_view value) override {
+                if (skipScalar()) {
+                    return;
+                }
+
+                Record& record = current();
+                switch (field_) {
+                    case Field::id:          record.id = value; break;
+                    case Field::termId:      assignParent(EntityKind::course, value); break;
+                    case Field::courseId:    assignParent(EntityKind::assignment, value); break;
+                    case Field::title:       record.title = value; break;
+                    case Field::description: record.description = value; break;
+                    case Field::category:    record.category = value; break;
+                    case Field::startDate:   record.startDate = parseDateField(value); break;
+                    case Field::endDate:     record.endDate = parseDateField(value); break;
+                    case Field::dueDate:     record.dueDate = parseDateField(value); break;
+                    case Field::none:        return;
+                    default:                 wrongType();
+                }
+                record.seen |= field_;
+            }
+
+            void numberValue(double value) override {
+                if (skipScalar()) {
+                    return;
+                }
+
+                Record& record = current();
+                switch (field_) {
+                    case Field::numCredits:
+                        if (value != std::trunc(value) || value < -2147483648.0 || value > 2147483647.0) {
+                            wrongType();
+                        }
+                        record.numCredits = static_cast<int>(value);
+                        break;
+                    case Field::grade:
+                        record.grade = static_cast<float>(value);
+                        break;
+                    case Field::none:
+                        return;
+                    default:
+                        wrongType();
+                }
+                record.seen |= field_;
+            }
+
+            void boolValue(bool value) override {
+                if (skipScalar()) {
+                    return;
+                }
+
+                Record& record = current();
+                switch (field_) {
+                    case Field::active:    record.active = value; break;
+                    case Field::completed: record.completed = value; break;
+                    case Field::none:      return;
+                    default:               wrongType();
+                }
+                record.seen |= field_;
+            }
+
+            void nullValue() override {
+                if (skipScalar()) {
+                    return;
+                }
+
+                // only the optional description may be null, which is the same as leaving it out
+                if (field_ != Field::description && field_ != Field::none) {
+                    wrongType();
+                }
+            }
+
+            io::EntityBatch release() {
+                if (!done_) {
+                    throw std::invalid_argument(fixedKind_.has_value()
+                        ? "JSON document must be an object or an array."
+                        : "JSON document must be an object.");
+                }
+
+                return std::move(batch_);
+            }
+
+        private:
+            enum class Level {
+                root,       // the top-level object of a term tree
+                section,    // an array of records
+                record      // a record object
+            };
+
+            struct Frame {
+                Level level;
+                EntityKind kind{EntityKind::term};
+                std::size_t record{0};          // index into records_ for record frames
+                bool nested{false};             // the record sits inside its parent's record
+                std::size_t firstChild{0};      // batch size of the child kind when the record began
+            };
+
+            std::optional<EntityKind> fixedKind_{};
+            std::optional<EntityKind> pendingSection_{};    // the next value must be an array of this kind
+            std::vector<Frame> frames_{};
+            std::vector<Record> records_{};     // one per open record, reused across records at the same depth
+            std::size_t openRecords_{0};
+            std::size_t ignoreDepth_{0};        // > 0 while skipping the value of an unknown key
+            bool ignoreNext_{false};            // the next value belongs to an unknown key and is skipped
+            bool done_{false};
+            Field field_{Field::none};
+            io::EntityBatch batch_{};
+
+            Record& current() {
+                return records_[frames_.back().record];
+            }
+
+            void beginRecord(EntityKind kind) {
+                if (records_.size() == openRecords_) {
+                    records_.emplace_back();
+                }
+                records_[openRecords_].reset();
+
+                std::size_t firstChild = (kind == EntityKind::term) ? batch_.courses.size() : batch_.assignments.size();
+                frames_.push_back(Frame{Level::record, kind, openRecords_, openRecords_ > 0, firstChild});
+                ++openRecords_;
+            }
+
+            void startIgnored() {
+                ignoreNext_ = false;
+                ++ignoreDepth_;
+            }
+
+            // true if this scalar is part of skipped content rather than a record field
+            bool skipScalar() {
+                if (ignoreDepth_ > 0) {
+                    return true;
+                }
+
+                if (ignoreNext_) {
+                    ignoreNext_ = false;
+                    return true;
+                }
+
+                if (pendingSection_.has_value() || frames_.empty() || frames_.back().level != Level::record) {
+                    unexpected("value");
+                }
+
+                return false;
+            }
+
+            void assignParent(EntityKind owner, std::string_view value) {
+                if (frames_.back().kind == owner) {
+                    current().parentId = value;
+                } else {
+                    field_ = Field::none;   // a foreign key that doesn't apply to this record type
+                }
+            }
+
+            std::chrono::year_month_day parseDateField(std::string_view value) const {
+                try {
+                    return utils::parseDate(value);
+                } catch (const utils::DateParseError& e) {
+                    throw utils::DateParseError{"Field '" + std::string{keyFromField(field_)} + "': " + e.what(), e.getPosition()};
+                }
+            }
+
+            [[noreturn]] void unexpected(const std::string& what) const {
+                throw std::invalid_argument("Unexpected " + what + " in " + (fixedKind_.has_value() ? "record" : "term tree") + " JSON.");
+            }
+
+            [[noreturn]] void wrongType() const {
+                throw std::invalid_argument("Field '" + std::string{keyFromField(field_)} + "' has the wrong type.");
+            }
+
+            void requireFields(const Record& record, unsigned required) const {
+                unsigned missing = required & ~record.seen;
+
+                if (missing != 0) {
+                    Field first = static_cast<Field>(missing & (~missing + 1));
+                    throw std::invalid_argument("Missing required field '" + std::string{keyFromField(first)} + "'.");
+                }
+            }
+
+            // points records nested inside a parent at it; a nested record may repeat the parent id, but not contradict it
+            template <typename Entity>
+            void adoptChildren(std::vector<std::pair<std::string, Entity>>& children, std::size_t first, const std::string& parentId) {
+                for (std::size_t i = first; i < children.size(); ++i) {
+                    if (children[i].first.empty()) {
+                        children[i].first = parentId;
+                    } else if (children[i].first != parentId) {
+                        throw std::invalid_argument("Record '" + children[i].second.getId() + "' is nested under a different parent.");
+                    }
+                }
+            }
+
+            void finishRecord() {
+                const Frame& frame = frames_.back();
+                const Record& record = records_[frame.record];
+                unsigned parentField = 0;
+
+                switch (frame.kind) {
+                    case EntityKind::term:
+                        requireFields(record, Field::id | Field::title | Field::startDate | Field::endDate);
+                        adoptChildren(batch_.courses, frame.firstChild, record.id);
+                        batch_.terms.push_back(Term::fromRow(record.id, record.title, record.startDate,
+                            record.endDate, record.active));
+                        break;
+                    case EntityKind::course:
+                        parentField = frame.nested ? 0u : unsigned{Field::termId};
+                        requireFields(record, Field::id | parentField | Field::title | Field::startDate | Field::endDate);
+                        adoptChildren(batch_.assignments, frame.firstChild, record.id);
+                        batch_.courses.emplace_back(record.parentId, Course::fromRow(record.id, record.title,
+                            record.description, record.startDate, record.endDate, record.numCredits, record.active));
+                        break;
+                    case EntityKind::assignment:
+                        parentField = frame.nested ? 0u : unsigned{Field::courseId};
+                        requireFields(record, Field::id | parentField | Field::title | Field::category | Field::dueDate);
+                        batch_.assignments.emplace_back(record.parentId, Assignment::fromRow(record.id, record.title,
+                            record.description, record.category, record.dueDate, record.completed, record.grade));
+                        break;
+                }
+
+                --openRecords_;
+            }
+    };
+
+    io::EntityBatch readWith(std::istream& is, EntityHandler& handler) {
+        JsonReader reader{is};
+        reader.parse(handler);
+        return handler.release();
+    }
+}
+
+namespace io {
+    void writeTerm(JsonWriter& writer, const Term& term) {
+        writer.startObject();
+        writeTermFields(writer, term);
+        writer.endObject();
+    }
+
+    void writeCourse(JsonWriter& writer, const std::string& termId, const Course& course) {
+        writer.startObject();
+        writeCourseFields(writer, termId, course);
+        writer.endObject();
+    }
+
+    void writeAssignment(JsonWriter& writer, const std::string& courseId, const Assignment& assignment) {
+        writer.startObject();
+        writeAssignmentFields(writer, courseId, assignment);
+        writer.endObject();
+    }
+
+    // one term with its courses nested under "courses" and their assignments under "assignments"
+    void writeTermTree(JsonWriter& writer, const Term& term) {
+        writer.startObject();
+        writeTermFields(writer, term);
+        writer.key("courses");
+        writer.startArray();
+        for (const auto& [courseId, course] : term.getCourseList()) {
+            writer.startObject();
+            writeCourseFields(writer, term.getId(), course);
+            writer.key("assignments");
+            writer.startArray();
+            for (const auto& [assignmentId, assignment] : course.getAssignmentList()) {
+                writeAssignment(writer, courseId, assignment);
+            }
+            writer.endArray();
+            writer.endObject();
+        }
+        writer.endArray();
+        writer.endObject();
+    }
+
+    // reads a term tree document; the three arrays may appear in any order
+    EntityBatch readTermTree(std::istream& is) {
+        EntityHandler handler;
+        return readWith(is, handler);
+    }
+
+    // reads one record object, or an array of records, of the given kind (e.g. a server response body)
+    EntityBatch readRecords(std::istream& is, EntityKind kind) {
+        EntityHandler handler{kind};
+        return readWith(is, handler);
+    }
+}
@@ -0,0 +1,349 @@
+#include "io/JsonReader.hpp"
+
+/**
+ * @file JsonReader.cpp
+ * @brief Implementation of the JsonReader class, an event-based (SAX-style) JSON parser over an input stream.
+ *
+ * Provides implementations only; see JsonReader.hpp for definitions.
+ */
+
+#include <charconv>         // for from_chars
+#include <stdexcept>        // for exceptions
+
+JsonReader::JsonReader(std::istream& is, std::size_t bufferSize)
+    : in_{is}, buffer_(bufferSize == 0 ? 1 : bufferSize) {}
+
+// reads the next chunk of the stream into the buffer; returns false at end of input
+bool JsonReader::fill() {
+    consumed_ += end_;
+    pos_ = 0;
+    end_ = 0;
+
+    if (!in_) {
+        return false;
+    }
+
+    in_.read(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    end_ = static_cast<std::size_t>(in_.gcount());
+    return end_ > 0;
+}
+
+// returns the next byte without consuming it, or -1 at end of input
+int JsonReader::peek() {
+    if (pos_ == end_ && !fill()) {
+        return -1;
+    }
+
+    return static_cast<unsigned char>(buffer_[pos_]);
+}
+
+// consumes and returns the next byte, or -1 at end of input
+int JsonReader::get() {
+    int c = peek();
+
+    if (c != -1) {
+        ++pos_;
+    }
+
+    return c;
+}
+
+void JsonReader::expect(char c) {
+    if (peek() != static_cast<unsigned char>(c)) {
+        fail(std::string{"Expected '"} + c + "'.");
+    }
+    ++pos_;
+}
+
+void JsonReader::skipWhitespace() {
+    for (int c = peek(); c == ' ' || c == '\t' || c == '\n' || c == '\r'; c = peek()) {
+        ++pos_;
+    }
+}
+
+// throws with the absolute byte offset of the current read position
+void JsonReader::fail(const std::string& reason) const {
+    throw std::invalid_argument("Invalid JSON at offset " + std::to_string(consumed_ + pos_) + ": " + reason);
+}
+
+// parses one complete JSON document and reports it to the handler
+void JsonReader::parse(JsonHandler& handler) {
+    skipWhitespace();
+    parseValue(handler, 0);
+    skipWhitespace();
+
+    if (peek() != -1) {
+        fail("Unexpected data after the top-level value.");
+    }
+}
+
+void JsonReader::parseValue(JsonHandler& handler, std::size_t depth) {
+    switch (peek()) {
+        case '{':
+            parseObject(handler, depth + 1);
+            break;
+        case '[':
+            parseArray(handler, depth + 1);
+            break;
+        case '"':
+            parseString();
+            handler.stringValue(scratch_);
+            break;
+        case 't':
+            parseLiteral("true");
+            handler.boolValue(true);
+            break;
+        case 'f':
+            parseLiteral("false");
+            handler.boolValue(false);
+            break;
+        case 'n':
+            parseLiteral("null");
+            handler.nullValue();
+            break;
+        case -1:
+            fail("Unexpected end of input.");
+        default:
+            parseNumber(handler);
+            break;
+    }
+}
+
+void JsonReader::parseObject(JsonHandler& handler, std::size_t depth) {
+    if (depth > maxDepth_) {
+        fail("Maximum nesting depth exceeded.");
+    }
+
+    expect('{');
+    handler.startObject();
+    skipWhitespace();
+
+    if (peek() == '}') {
+        ++pos_;
+        handler.endObject();
+        return;
+    }
+
+    while (true) {
+        if (peek() != '"') {
+            fail("Expected a string key.");
+        }
+
+        parseString();
+        handler.key(scratch_);
+
+        skipWhitespace();
+        expect(':');
+        skipWhitespace();
+        parseValue(handler, depth);
+        skipWhitespace();
+
+        int c = get();
+        if (c == '}') {
+            break;
+        }
+        if (c != ',') {
+            fail("Expected ',' or '}'.");
+        }
+        skipWhitespace();
+    }
+
+    handler.endObject();
+}
+
+void JsonReader::parseArray(JsonHandler& handler, std::size_t depth) {
+    if (depth > maxDepth_) {
+        fail("Maximum nesting depth exceeded.");
+    }
+
+    expect('[');
+    handler.startArray();
+    skipWhitespace();
+
+    if (peek() == ']') {
+        ++pos_;
+        handler.endArray();
+        return;
+    }
+
+    while (true) {
+        parseValue(handler, depth);
+        skipWhitespace();
+
+        int c = get();
+        if (c == ']') {
+            break;
+        }
+        if (c != ',') {
+            fail("Expected ',' or ']'.");
+        }
+        skipWhitespace();
+    }
+
+    handler.endArray();
+}
+
+unsigned JsonReader::parseHex4() {
+    unsigned value = 0;
+
+    for (int i = 0; i < 4; ++i) {
+        int c = get();
+        value <<= 4;
+
+        if (c >= '0' && c <= '9') {
+            value |= static_cast<unsigned>(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            value |= static_cast<unsigned>(c - 'a' + 10);
+        } else if (c >= 'A' && c <= 'F') {
+            value |= static_cast<unsigned>(c - 'A' + 10);
+        } else {
+            fail("Invalid \\u escape.");
+        }
+    }
+
+    return value;
+}
+
+// decodes a string token into scratch_, copying unescaped runs straight from the buffer
+void JsonReader::parseString() {
+    expect('"');
+    scratch_.clear();
+
+    while (true) {
+        if (pos_ == end_ && !fill()) {
+            fail("Unterminated string.");
+        }
+
+        std::size_t runStart = pos_;
+        while (pos_ < end_) {
+            unsigned char c = static_cast<unsigned char>(buffer_[pos_]);
+            if (c == '"' || c == '\\' || c < 0x20) {
+                break;
+            }
+            ++pos_;
+        }
+        scratch_.append(buffer_.data() + runStart, pos_ - runStart);
+
+        if (pos_ == end_) {
+            continue;
+        }
+
+        unsigned char c = static_cast<unsigned char>(buffer_[pos_++]);
+
+        if (c == '"') {
+            return;
+        }
+
+        if (c < 0x20) {
+            --pos_;
+            fail("Control character in string.");
+        }
+
+        // escape sequence
+        switch (get()) {
+            case '"':  scratch_.push_back('"'); break;
+            case '\\': scratch_.push_back('\\'); break;
+            case '/':  scratch_.push_back('/'); break;
+            case 'b':  scratch_.push_back('\b'); break;
+            case 'f':  scratch_.push_back('\f'); break;
+            case 'n':  scratch_.push_back('\n'); break;
+            case 'r':  scratch_.push_back('\r'); break;
+            case 't':  scratch_.push_back('\t'); break;
+            case 'u': {
+                unsigned codePoint = parseHex4();
+
+                // combine UTF-16 surrogate pairs into a single code point
+                if (codePoint >= 0xD800 && codePoint <= 0xDBFF) {
+                    if (get() != '\\' || get() != 'u') {
+                        fail("Unpaired surrogate in \\u escape.");
+                    }
+                    unsigned low = parseHex4();
+                    if (low < 0xDC00 || low > 0xDFFF) {
+                        fail("Unpaired surrogate in \\u escape.");
+                    }
+                    codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                } else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF) {
+                    fail("Unpaired surrogate in \\u escape.");
+                }
+
+                // encode as UTF-8
+                if (codePoint < 0x80) {
+                    scratch_.push_back(static_cast<char>(codePoint));
+                } else if (codePoint < 0x800) {
+                    scratch_.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+                    scratch_.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+                } else if (codePoint < 0x10000) {
+                    scratch_.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+                    scratch_.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                    scratch_.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+                } else {
+                    scratch_.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+                    scratch_.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+                    scratch_.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                    scratch_.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+                }
+                break;
+            }
+            default:
+                fail("Invalid escape sequence.");
+        }
+    }
+}
+
+// validates the JSON number grammar while collecting the token, then converts it with from_chars
+void JsonReader::parseNumber(JsonHandler& handler) {
+    auto isDigit = [](int c) { return c >= '0' && c <= '9'; };
+    auto takeDigits = [&]() {
+        if (!isDigit(peek())) {
+            fail("Expected a digit.");
+        }
+        while (isDigit(peek())) {
+            scratch_.push_back(static_cast<char>(get()));
+        }
+    };
+
+    scratch_.clear();
+
+    if (peek() == '-') {
+        scratch_.push_back(static_cast<char>(get()));
+    }
+
+    if (peek() == '0') {
+        scratch_.push_back(static_cast<char>(get()));
+    } else if (isDigit(peek())) {
+        takeDigits();
+    } else {
+        fail("Unexpected character.");
+    }
+
+    if (peek() == '.') {
+        scratch_.push_back(static_cast<char>(get()));
+        takeDigits();
+    }
+
+    if (peek() == 'e' || peek() == 'E') {
+        scratch_.push_back(static_cast<char>(get()));
+        if (peek() == '+' || peek() == '-') {
+            scratch_.push_back(static_cast<char>(get()));
+        }
+        takeDigits();
+    }
+
+    double value{0.0};
+    auto result = std::from_chars(scratch_.data(), scratch_.data() + scratch_.size(), value);
+
+    if (result.ec != std::errc{}) {
+        fail("Number out of range.");
+    }
+
+    handler.numberValue(value);
+}
+
+void JsonReader::parseLiteral(const char* literal) {
+    for (const char* c = literal; *c != '\0'; ++c) {
+        if (peek() != static_cast<unsigned char>(*c)) {
+            fail(std::string{"Expected '"} + literal + "'.");
+        }
+        ++pos_;
+    }
+}
@@ -0,0 +1,156 @@
+#include "io/JsonWriter.hpp"
+
+/**
+ * @file JsonWriter.cpp
+ * @brief Implementation of the JsonWriter class, which streams JSON text directly to an output stream.
+ *
+ * Provides implementations only; see JsonWriter.hpp for definitions.
+ */
+
+#include <charconv>         // for to_chars
+#include <cmath>            // for isfinite
+#include <stdexcept>        // for exceptions
+
+JsonWriter::JsonWriter(std::ostream& os) : out_{os} {}
+
+// writes the comma that separates this value from the previous one, if any
+void JsonWriter::prepareValue() {
+    if (afterKey_) {
+        afterKey_ = false;
+        return;
+    }
+
+    if (!firstInScope_.empty()) {
+        if (!firstInScope_.back()) {
+            out_.put(',');
+        }
+        firstInScope_.back() = false;
+    }
+}
+
+// writes a string with JSON escapes, copying unescaped runs in one call
+void JsonWriter::writeEscaped(std::string_view str) {
+    static constexpr char hexDigits[] = "0123456789abcdef";
+    std::size_t runStart = 0;
+
+    out_.put('"');
+
+    for (std::size_t i = 0; i < str.size(); ++i) {
+        unsigned char c = static_cast<unsigned char>(str[i]);
+
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+
+        out_.write(str.data() + runStart, static_cast<std::streamsize>(i - runStart));
+        runStart = i + 1;
+
+        switch (c) {
+            case '"':  out_.write("\\\"", 2); break;
+            case '\\': out_.write("\\\\", 2); break;
+            case '\n': out_.write("\\n", 2); break;
+            case '\r': out_.write("\\r", 2); break;
+            case '\t': out_.write("\\t", 2); break;
+            case '\b': out_.write("\\b", 2); break;
+            case '\f': out_.write("\\f", 2); break;
+            default: {
+                char escape[6] = {'\\', 'u', '0', '0', hexDigits[c >> 4], hexDigits[c & 0x0F]};
+                out_.write(escape, 6);
+                break;
+            }
+        }
+    }
+
+    out_.write(str.data() + runStart, static_cast<std::streamsize>(str.size() - runStart));
+    out_.put('"');
+}
+
+void JsonWriter::startObject() {
+    prepareValue();
+    out_.put('{');
+    firstInScope_.push_back(true);
+}
+
+void JsonWriter::endObject() {
+    if (firstInScope_.empty() || afterKey_) {
+        throw std::logic_error("No open object to close.");
+    }
+
+    firstInScope_.pop_back();
+    out_.put('}');
+}
+
+void JsonWriter::startArray() {
+    prepareValue();
+    out_.put('[');
+    firstInScope_.push_back(true);
+}
+
+void JsonWriter::endArray() {
+    if (firstInScope_.empty() || afterKey_) {
+        throw std::logic_error("No open array to close.");
+    }
+
+    firstInScope_.pop_back();
+    out_.put(']');
+}
+
+void JsonWriter::key(std::string_view name) {
+    prepareValue();
+    writeEscaped(name);
+    out_.put(':');
+    afterKey_ = true;
+}
+
+void JsonWriter::stringValue(std::string_view value) {
+    prepareValue();
+    writeEscaped(value);
+}
+
+void JsonWriter::numberValue(int value) {
+    char buffer[16];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+
+    prepareValue();
+    out_.write(buffer, result.ptr - buffer);
+}
+
+// writes the shortest representation that reads back as the same float
+void JsonWriter::numberValue(float value) {
+    if (!std::isfinite(value)) {
+        throw std::invalid_argument("JSON numbers must be finite.");
+    }
+
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+
+    prepareValue();
+    out_.write(buffer, result.ptr - buffer);
+}
+
+// writes the shortest representation that reads back as the same double
+void JsonWriter::numberValue(double value) {
+    if (!std::isfinite(value)) {
+        throw std::invalid_argument("JSON numbers must be finite.");
+    }
+
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+
+    prepareValue();
+    out_.write(buffer, result.ptr - buffer);
+}
+
+void JsonWriter::boolValue(bool value) {
+    prepareValue();
+    if (value) {
+        out_.write("true", 4);
+    } else {
+        out_.write("false", 5);
+    }
+}
+
+void JsonWriter::nullValue() {
+    prepareValue();
+    out_.write("null", 4);
+}
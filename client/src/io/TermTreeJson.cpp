@@ -0,0 +1,245 @@
+#include "io/TermTreeJson.hpp"
+
+/**
+ * @file TermTreeJson.cpp
+ * @brief Implementation of the JSON import and export of the whole TermController tree.
+ *
+ * Records are encoded and decoded by EntityJson. On import, children are attached to their parents
+ * once the document is complete, so the three arrays may appear in any order, and nothing reaches the
+ * controller unless the whole document is valid.
+ *
+ * Provides implementations only; see TermTreeJson.hpp for definitions.
+ */
+
+#include <algorithm>        // for max
+#include <array>            // for the progress buffer
+#include <stdexcept>        // for exceptions
+#include <streambuf>        // for counting bytes read
+#include <unordered_map>    // for id lookups while linking records
+#include <unordered_set>    // for duplicate title checks
+#include <utility>          // for pair and move
+#include <vector>           // for staged records
+#include "io/EntityJson.hpp"
+#include "io/JsonWriter.hpp"
+#include "utils/utils.hpp"
+
+namespace {
+    // how many records pass between progress reports while exporting
+    constexpr std::size_t progressInterval = 1024;
+
+    // passes reads through to another stream buffer, reporting the running byte count after each block
+    class CountingBuffer : public std::streambuf {
+        public:
+            CountingBuffer(std::streambuf* source, std::size_t total, const io::Progress& progress)
+                : source_{source}, total_{total}, progress_{progress} {}
+
+        protected:
+            int_type underflow() override {
+                std::streamsize count = source_->sgetn(block_.data(), static_cast<std::streamsize>(block_.size()));
+                if (count <= 0) {
+                    return traits_type::eof();
+                }
+
+                read_ += static_cast<std::size_t>(count);
+                progress_(read_, std::max(total_, read_));
+                setg(block_.data(), block_.data(), block_.data() + count);
+                return traits_type::to_int_type(block_[0]);
+            }
+
+        private:
+            std::streambuf* source_;
+            std::size_t total_;     // 0 when the stream can't tell its length
+            const io::Progress& progress_;
+            std::size_t read_{0};
+            std::array<char, 64 * 1024> block_{};
+    };
+
+    // the bytes left in a seekable stream, or 0
+    std::size_t remainingBytes(std::istream& is) {
+        std::istream::pos_type start = is.tellg();
+        if (start == std::istream::pos_type{-1}) {
+            return 0;
+        }
+
+        is.seekg(0, std::ios::end);
+        std::istream::pos_type end = is.tellg();
+        is.seekg(start);
+        return end == std::istream::pos_type{-1} ? 0 : static_cast<std::size_t>(end - start);
+    }
+
+    // links the staged records together into finished terms, with each course's grade final
+    std::vector<Term> link(io::EntityBatch& batch) {
+        std::vector<Term>& terms = batch.terms;
+        std::vector<std::pair<std::string, Course>>& courses = batch.courses;
+
+        std::unordered_map<std::string, std::size_t> termIndex;
+        for (std::size_t i = 0; i < terms.size(); ++i) {
+            if (!termIndex.emplace(terms[i].getId(), i).second) {
+                throw std::invalid_argument("Duplicate term id '" + terms[i].getId() + "'.");
+            }
+        }
+
+        std::unordered_map<std::string, std::size_t> courseIndex;
+        for (std::size_t i = 0; i < courses.size(); ++i) {
+            if (!courseIndex.emplace(courses[i].second.getId(), i).second) {
+                throw std::invalid_argument("Duplicate course id '" + courses[i].second.getId() + "'.");
+            }
+        }
+
+        // assignments first, so each course's grade is final before it is moved into its term; the staged records
+        // aren't read again once linked, so each one is moved into its parent rather than copied
+        std::unordered_map<std::string, std::unordered_set<std::string>> courseTitles;
+        for (auto& [courseId, assignment] : batch.assignments) {
+            auto it = courseIndex.find(courseId);
+            if (it == courseIndex.end()) {
+                throw std::invalid_argument("Assignment '" + assignment.getTitle() + "' references an unknown course_id.");
+            }
+            if (!courseTitles[courseId].insert(utils::stringLower(assignment.getTitle())).second) {
+                throw std::invalid_argument("Duplicate assignment title '" + assignment.getTitle() + "' in one course.");
+            }
+            courses[it->second].second.addAssignment(std::move(assignment));
+        }
+
+        std::unordered_map<std::string, std::unordered_set<std::string>> termTitles;
+        for (auto& [termId, course] : courses) {
+            auto it = termIndex.find(termId);
+            if (it == termIndex.end()) {
+                throw std::invalid_argument("Course '" + course.getTitle() + "' references an unknown term_id.");
+            }
+            if (!termTitles[termId].insert(utils::stringLower(course.getTitle())).second) {
+                throw std::invalid_argument("Duplicate course title '" + course.getTitle() + "' in one term.");
+            }
+            terms[it->second].addCourse(std::move(course));
+        }
+
+        return std::move(terms);
+    }
+
+    // writes the three arrays for the given terms; the controller and a snapshot both reduce to this
+    void writeTree(JsonWriter& writer, const std::vector<const Term*>& terms, const io::Progress& progress = {}) {
+        std::size_t total = 0;
+        std::size_t written = 0;
+        if (progress) {
+            for (const Term* term : terms) {
+                total += 1 + term->getCourseList().size();
+                for (const auto& [courseId, course] : term->getCourseList()) {
+                    total += course.getAssignmentList().size();
+                }
+            }
+        }
+        auto advance = [&progress, &written, total]() {
+            if (progress && ++written % progressInterval == 0) {
+                progress(written, total);
+            }
+        };
+
+        writer.startObject();
+
+        writer.key("terms");
+        writer.startArray();
+        for (const Term* term : terms) {
+            io::writeTerm(writer, *term);
+            advance();
+        }
+        writer.endArray();
+
+        writer.key("courses");
+        writer.startArray();
+        for (const Term* term : terms) {
+            for (const auto& [courseId, course] : term->getCourseList()) {
+                io::writeCourse(writer, term->getId(), course);
+                advance();
+            }
+        }
+        writer.endArray();
+
+        writer.key("assignments");
+        writer.startArray();
+        for (const Term* term : terms) {
+            for (const auto& [courseId, course] : term->getCourseList()) {
+                for (const auto& [assignmentId, assignment] : course.getAssignmentList()) {
+                    io::writeAssignment(writer, courseId, assignment);
+                    advance();
+                }
+            }
+        }
+        writer.endArray();
+
+        writer.endObject();
+
+        if (progress) {
+            progress(total, total);
+        }
+    }
+}
+
+namespace io {
+    // writes every term, course and assignment held by the controller; terms and courses keep the user's order
+    void exportTermTree(const TermController& controller, std::ostream& os) {
+        JsonWriter writer{os};
+        std::vector<const Term*> terms;
+        terms.reserve(controller.getTermList().size());
+        for (const auto& [termId, term] : controller.getTermList()) {
+            terms.push_back(&term);
+        }
+
+        writeTree(writer, terms);
+    }
+
+    // the same document, written from a snapshot so the controller's thread can keep editing meanwhile
+    void exportTermTree(const Snapshot& snapshot, std::ostream& os, const Progress& progress) {
+        JsonWriter writer{os};
+        std::vector<const Term*> terms;
+        terms.reserve(snapshot.terms.size());
+        for (const std::shared_ptr<const Term>& term : snapshot.terms) {
+            terms.push_back(term.get());
+        }
+
+        writeTree(writer, terms, progress);
+    }
+
+    // reads a document written by exportTermTree (or by the server) and adds its terms to the controller,
+    // keeping every id; throws without modifying the controller if the document is invalid
+    void importTermTree(std::istream& is, TermController& controller) {
+        importTerms(readTerms(is), controller);
+    }
+
+    // parses and links a document without touching a controller; progress counts bytes read
+    std::vector<Term> readTerms(std::istream& is, const Progress& progress) {
+        if (!progress) {
+            io::EntityBatch batch = readTermTree(is);
+            return link(batch);
+        }
+
+        CountingBuffer counter{is.rdbuf(), remainingBytes(is), progress};
+        std::istream counted{&counter};
+        counted.exceptions(std::ios::badbit);   // rethrows what progress throws, rather than reading it as the end
+        io::EntityBatch batch = readTermTree(counted);
+        return link(batch);
+    }
+
+    // throws if any of the terms would collide with the controller's, or with each other
+    void checkImport(const std::vector<Term>& terms, const TermController& controller) {
+        std::unordered_set<std::string> titles;
+        for (const auto& [id, term] : controller.getTermList()) {
+            titles.insert(utils::stringLower(term.getTitle()));
+        }
+        for (const Term& term : terms) {
+            if (controller.getTermList().contains(term.getId())) {
+                throw std::logic_error("Term with the same ID already exists.");
+            }
+            if (!titles.insert(utils::stringLower(term.getTitle())).second) {
+                throw std::logic_error("Term with the same title already exists.");
+            }
+        }
+    }
+
+    // rejects the whole import before touching the controller if any term would collide
+    void importTerms(std::vector<Term> terms, TermController& controller) {
+        checkImport(terms, controller);
+
+        for (Term& term : terms) {
+            controller.importTerm(std::move(term));
+        }
+    }
+}
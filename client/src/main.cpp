@@ -1,13 +1,49 @@
 #include <QApplication>
 #include <QStyleFactory>
+#include <fstream>
+#include <iostream>
+#include <optional>
 #include <string_view>
 #include "controller/TermController.hpp"
+#include "trace/Trace.hpp"
 #include "view/qt/MainWindow.hpp"
 #include "view/qt/StyleManager.hpp"
 #include "view/qt/PaletteWatcher.hpp"
 #include "view/cli/CliView.hpp"
 
+namespace {
+    // with --profile[=FILE], prints the trace summary to stderr and writes the Chrome trace on exit
+    class ProfileDump {
+        public:
+            explicit ProfileDump(std::string path) : path_{std::move(path)} {
+                trace::enable();
+            }
+
+            ~ProfileDump() {
+                trace::disable();
+                trace::writeSummary(std::cerr);
+
+                std::ofstream file{path_};
+                trace::writeChromeTrace(file);
+                std::cerr << (file ? "Chrome trace written to " : "Could not write the Chrome trace to ") << path_ << "\n";
+            }
+
+        private:
+            std::string path_;
+    };
+}
+
 int main(int argc, char *argv[]) {
+    std::optional<ProfileDump> profile;
+    for (int i = 1; i < argc; i++) {
+        std::string_view arg{argv[i]};
+        if (arg == "--profile") {
+            profile.emplace("course-companion-trace.json");
+        } else if (arg.starts_with("--profile=")) {
+            profile.emplace(std::string{arg.substr(10)});
+        }
+    }
+
     for (int i = 1; i < argc; i++) {
         if (std::string_view(argv[i]) == "--debug") {
             TermController controller;
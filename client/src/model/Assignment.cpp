@@ -22,7 +22,12 @@ void Assignment::validateGrade(float grade) {
 }
 
 Assignment::Assignment(std::string title, std::string description, std::string category, 
-    std::chrono::year_month_day dueDate, bool completed, float grade) : id_{utils::generateUuid()} {
+    std::chrono::year_month_day dueDate, bool completed, float grade) : Assignment{utils::generateUuid(),
+    std::move(title), std::move(description), std::move(category), dueDate, completed, grade} {}
+
+// takes the id rather than generating one, so fromRow doesn't pay for a UUID it throws away
+Assignment::Assignment(std::string id, std::string title, std::string description, std::string category,
+    std::chrono::year_month_day dueDate, bool completed, float grade) : id_{std::move(id)} {
     // internal defaulting for user input
     if (dueDate == std::chrono::year_month_day{}) {
         dueDate = utils::getTodayDate();
@@ -135,9 +140,8 @@ Assignment Assignment::fromRow(std::string id, std::string title, std::string de
         throw std::invalid_argument("Due date must not be empty.");
     }
 
-    Assignment a{title, description, category, dueDate, completed, grade};
-    a.id_ = std::move(id);
-    return a;
+    return Assignment{std::move(id), std::move(title), std::move(description), std::move(category), dueDate,
+        completed, grade};
 }
 
 // equality comparison based on unique identifier (UUID)
@@ -12,6 +12,8 @@
 
 #include <stdexcept>            // for exceptions
 #include <iomanip>              // for string formatting in print statement
+#include <utility>              // for move
+#include "trace/Trace.hpp"        // for recompute timing
 #include "utils/utils.hpp"        // for reused custom functions
 
 using namespace std::chrono_literals;
@@ -102,9 +104,10 @@ void Course::validateGradeScale(const std::map<float, std::string>& gradeScale)
 
 // iterates over all assignments in the Course, groups completed assignments by category, and computes
 // raw percentage grade for each category; the per-category averages will be weighted for the total 
-// grade calculation
+// grade calculation. Totals are summed in double, which is exact for any realistic number of float grades, so
+// neither the map's iteration order nor the server's SQL SUM (also double) can move the result
 void Course::calculateGradesByCategory() {
-    std::unordered_map<std::string, float> totals;
+    std::unordered_map<std::string, double> totals;
     std::unordered_map<std::string, unsigned int> counts;
 
     // add values from assignmentList to totals and counts
@@ -128,19 +131,24 @@ void Course::calculateGradesByCategory() {
             continue;
         }
 
-        float categoryGrade = totals[categoryName] / it->second;
+        float categoryGrade = static_cast<float>(totals[categoryName] / it->second);
         gradesByCategory_.emplace(categoryName, utils::floatRound(categoryGrade, 2));
     }
 }
 
 // calculate course grade percentage using grades from each category
 float Course::calculateGradePct() {
+    TRACE_SCOPE("Course::calculateGradePct");
+    TRACE_COUNT("Course::calculateGradePct assignments", assignmentList_.size());
+
     if (assignmentList_.size() == 0 || calculateCompletedAssignments() == 0) {
         return 0.0f;
     }
 
-    float total{0.0f};
-    float activeWeightTotal{0.0f};  // used to redistribute weights if 1+ categories are empty
+    // both sums are kept in double so they don't depend on the order of gradeWeights_ and gradesByCategory_;
+    // server/app/grades.py follows the same steps, and tests/golden/grades.json holds both to the same results
+    double total{0.0};
+    double activeWeightTotal{0.0};  // used to redistribute weights if 1+ categories are empty
 
     calculateGradesByCategory();    // call this to get category grades before weighing each piece
     // sum categories that have grades
@@ -151,7 +159,7 @@ float Course::calculateGradePct() {
     }
 
     // return early if no active categories
-    if (utils::floatEqual(activeWeightTotal, 0.0f)) {
+    if (utils::floatEqual(static_cast<float>(activeWeightTotal), 0.0f)) {
         return 0.0f;
     }
     
@@ -159,12 +167,12 @@ float Course::calculateGradePct() {
     for (const auto& [categoryName, grade] : gradesByCategory_) {
         auto it = gradeWeights_.find(categoryName);
         
-        float normalizedWeight = it->second / activeWeightTotal;
+        float normalizedWeight = static_cast<float>(it->second / activeWeightTotal);
         float weightedGrade = grade * normalizedWeight;
         total += weightedGrade;
     }
 
-    return utils::floatRound(total, 2);
+    return utils::floatRound(static_cast<float>(total), 2);
 }
 
 // calculate letter grade based on grade percentage and given grade scale; returns "N/A" when no assignments are completed
@@ -211,7 +219,12 @@ int Course::calculateCompletedAssignments() const {
 }
 
 Course::Course(std::string title, std::string description, std::chrono::year_month_day startDate, std::chrono::year_month_day endDate, 
-    int numCredits, bool active) : id_{utils::generateUuid()} {
+    int numCredits, bool active) : Course{utils::generateUuid(), std::move(title), std::move(description), startDate, endDate,
+    numCredits, active} {}
+
+// takes the id rather than generating one, so fromRow doesn't pay for a UUID it throws away
+Course::Course(std::string id, std::string title, std::string description, std::chrono::year_month_day startDate,
+    std::chrono::year_month_day endDate, int numCredits, bool active) : id_{std::move(id)} {
     // internal defaulting for user input
     if (startDate == std::chrono::year_month_day{}) {
         startDate = utils::defaultStartDate();
@@ -290,6 +303,19 @@ std::map<float, std::string> Course::getGradeScale() const {
     return gradeScale_;
 }
 
+// assignments due from `from` to `to` inclusive, in due-date order
+std::vector<const Assignment*> Course::getAssignmentsDue(std::chrono::year_month_day from, std::chrono::year_month_day to,
+    bool incompleteOnly) const {
+    std::vector<const Assignment*> due;
+
+    due::forEachDue(dueIndex_, std::chrono::sys_days{from}, std::chrono::sys_days{to}, incompleteOnly,
+        [this, &due](const DueKey& key) {
+            due.push_back(&assignmentList_.at(key.id));
+        });
+
+    return due;
+}
+
 void Course::setTitle(std::string newTitle) {
     utils::validateReqString(newTitle, "Title");
     title_ = newTitle;
@@ -350,6 +376,33 @@ void Course::setActive(bool newActive) {
     active_ = newActive;
 }
 
+// changes an assignment's due date and moves its due-date index entry to match
+void Course::setAssignmentDueDate(const std::string& id, std::chrono::year_month_day newDueDate) {
+    utils::validateDate(newDueDate);    // before the entry leaves the index, so a bad date can't strand it
+
+    Assignment& assignment = findAssignment(id);
+    auto node = dueIndex_.extract(DueKey::of(assignment));
+
+    assignment.setDueDate(newDueDate);
+    node.value().dueDate = std::chrono::sys_days{newDueDate};
+    dueIndex_.insert(std::move(node));
+}
+
+// marks an assignment complete or incomplete and moves its due-date index entry to match
+void Course::setAssignmentCompleted(const std::string& id, bool newCompleted) {
+    Assignment& assignment = findAssignment(id);
+
+    if (assignment.getCompleted() == newCompleted) {
+        return;
+    }
+
+    auto node = dueIndex_.extract(DueKey::of(assignment));
+
+    assignment.setCompleted(newCompleted);
+    node.value().completed = newCompleted;
+    dueIndex_.insert(std::move(node));
+}
+
 void Course::setGradeScale(const std::map<float, std::string>& newGradeScale) {
     validateGradeScale(newGradeScale);
     gradeScale_ = newGradeScale;
@@ -374,12 +427,19 @@ void Course::printCourseInfo(std::ostream &os) const {
 
 // adds an Assignment to the end of the list from the given input
 void Course::addAssignment(const Assignment &assignment) {
-    auto [_, inserted] = assignmentList_.emplace(assignment.getId(), assignment);
+    addAssignment(Assignment{assignment});
+}
+
+// takes the Assignment over rather than copying it, e.g. one just read from a file
+void Course::addAssignment(Assignment&& assignment) {
+    auto [it, inserted] = assignmentList_.try_emplace(assignment.getId(), std::move(assignment));
 
     if (!inserted) {
         throw std::logic_error("Assignment with the same ID already exists.");
     }
 
+    dueIndex_.insert(DueKey::of(it->second));
+
     // update grade information
     setGradePct();
     setLetterGrade();
@@ -388,10 +448,15 @@ void Course::addAssignment(const Assignment &assignment) {
 
 // removes an Assignment with the specified UUID
 void Course::removeAssignment(const std::string& id) {
-    if (assignmentList_.erase(id) == 0) {
+    auto it = assignmentList_.find(id);
+
+    if (it == assignmentList_.end()) {
         throw std::out_of_range("Assignment not found.");
     }
 
+    dueIndex_.erase(DueKey::of(it->second));
+    assignmentList_.erase(it);
+
     // update grade information
     setGradePct();
     setLetterGrade();
@@ -428,9 +493,7 @@ Course Course::fromRow(std::string id, std::string title, std::string descriptio
         throw std::invalid_argument("End date must not be empty.");
     }
 
-    Course c{title, description, startDate, endDate, numCredits, active};
-    c.id_ = std::move(id);
-    return c;
+    return Course{std::move(id), std::move(title), std::move(description), startDate, endDate, numCredits, active};
 }
 
 // equality comparison based on unique identifier (UUID)
@@ -0,0 +1,80 @@
+#include "model/DueIndex.hpp"
+
+/**
+ * @file DueIndex.cpp
+ * @brief Implementation of the due-date index, which keeps assignments ordered by due date for range queries.
+ *
+ * Provides implementations only; see DueIndex.hpp for definitions.
+ */
+
+#include <stdexcept>            // for exceptions
+#include "model/Term.hpp"         // for walking terms and courses
+
+DueKey DueKey::of(const Assignment& assignment) {
+    return DueKey{assignment.getCompleted(), std::chrono::sys_days{assignment.getDueDate()}, assignment.getId()};
+}
+
+std::size_t DueIndex::size() const {
+    return entries_.size();
+}
+
+bool DueIndex::contains(const DueKey& key) const {
+    return entries_.contains(key);
+}
+
+// indexes every course of a term and every assignment under them
+void DueIndex::addTerm(const Term& term) {
+    for (const auto& [courseId, course] : term.getCourseList()) {
+        addCourse(course, term.getId());
+    }
+}
+
+void DueIndex::removeTerm(const Term& term) {
+    for (const auto& [courseId, course] : term.getCourseList()) {
+        removeCourse(course);
+    }
+}
+
+// registers the course under its term, then indexes its assignments
+void DueIndex::addCourse(const Course& course, const std::string& termId) {
+    courseTerms_.insert_or_assign(course.getId(), termId);
+
+    for (const auto& [id, assignment] : course.getAssignmentList()) {
+        addAssignment(assignment, course.getId());
+    }
+}
+
+void DueIndex::removeCourse(const Course& course) {
+    for (const auto& [id, assignment] : course.getAssignmentList()) {
+        removeAssignment(assignment);
+    }
+
+    courseTerms_.erase(course.getId());
+}
+
+void DueIndex::addAssignment(const Assignment& assignment, const std::string& courseId) {
+    auto courseTerm = courseTerms_.find(courseId);
+
+    if (courseTerm == courseTerms_.end()) {
+        throw std::out_of_range("Course not indexed.");
+    }
+
+    entries_.insert_or_assign(DueKey::of(assignment), &*courseTerm);
+}
+
+void DueIndex::removeAssignment(const Assignment& assignment) {
+    entries_.erase(DueKey::of(assignment));
+}
+
+// re-keys an entry in place, reusing its node; `before` is the key the assignment had before it was edited
+void DueIndex::moveAssignment(const DueKey& before, const Assignment& assignment) {
+    auto node = entries_.extract(before);
+
+    if (node.empty()) {
+        throw std::out_of_range("Assignment not indexed.");
+    }
+
+    node.key().completed = assignment.getCompleted();
+    node.key().dueDate = std::chrono::sys_days{assignment.getDueDate()};
+    entries_.insert(std::move(node));
+}
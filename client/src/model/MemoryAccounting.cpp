@@ -0,0 +1,235 @@
+#include "model/MemoryAccounting.hpp"
+
+/**
+ * @file MemoryAccounting.cpp
+ * @brief Implementation of the MemoryAccounting class, which reports how much memory the model uses.
+ *
+ * Provides implementations only; see MemoryAccounting.hpp for definitions.
+ */
+
+#include <iomanip>          // for table formatting
+#include <functional>       // for ordered map key references
+#include <map>              // for grade scale nodes
+#include <set>              // for due-date index nodes
+#include <unordered_map>    // for hash nodes
+#include <utility>          // for pair
+
+namespace {
+    // a node of std::unordered_map: next pointer, value and (for string keys) the cached hash
+    template <typename Key, typename Value>
+    struct HashNode {
+        void* next;
+        alignas(std::pair<const Key, Value>) unsigned char value[sizeof(std::pair<const Key, Value>)];
+        std::size_t hash;
+    };
+
+    // a node of std::map: color, parent, left and right, then the value
+    template <typename Key, typename Value>
+    struct TreeNode {
+        int color;
+        void* parent;
+        void* left;
+        void* right;
+        alignas(std::pair<const Key, Value>) unsigned char value[sizeof(std::pair<const Key, Value>)];
+    };
+
+    // a node of std::set: the same links as a map node, then the key
+    template <typename Value>
+    struct SetNode {
+        int color;
+        void* parent;
+        void* left;
+        void* right;
+        alignas(Value) unsigned char value[sizeof(Value)];
+    };
+
+    // a node of std::list: next and previous pointers, then the value
+    template <typename Value>
+    struct ListNode {
+        void* next;
+        void* prev;
+        alignas(Value) unsigned char value[sizeof(Value)];
+    };
+
+    // one utils::OrderedMap entry: its list node, plus a hash node in the index holding a reference to the key
+    // and an iterator
+    template <typename Value>
+    Footprint orderedEntryHeap() {
+        return Footprint{sizeof(ListNode<std::pair<const std::string, Value>>) +
+            sizeof(HashNode<std::reference_wrapper<const std::string>, void*>), 2};
+    }
+
+    // a string only allocates once it outgrows its inline buffer, and then asks for capacity + 1 bytes
+    Footprint stringHeap(const std::string& str) {
+        static const std::size_t inlineCapacity = std::string{}.capacity();
+        if (str.capacity() <= inlineCapacity) {
+            return {};
+        }
+        return Footprint{str.capacity() + 1, 1};
+    }
+
+    // the bucket array; a single bucket is stored inside the container and needs no allocation
+    template <typename Map>
+    Footprint bucketHeap(const Map& map) {
+        if (map.bucket_count() <= 1) {
+            return {};
+        }
+        return Footprint{map.bucket_count() * sizeof(void*), 1};
+    }
+
+    // one node per element plus each key's string heap; mapped values are counted by the caller
+    template <typename Value>
+    Footprint nodeHeap(const std::unordered_map<std::string, Value>& map) {
+        Footprint heap{};
+        for (const auto& [key, value] : map) {
+            heap += Footprint{sizeof(HashNode<std::string, Value>), 1};
+            heap += stringHeap(key);
+        }
+        return heap;
+    }
+
+    // the same for an ordered map, whose key is stored once, in the list node
+    template <typename Value>
+    Footprint nodeHeap(const utils::OrderedMap<std::string, Value>& map) {
+        Footprint heap{};
+        for (const auto& [key, value] : map) {
+            heap += orderedEntryHeap<Value>();
+            heap += stringHeap(key);
+        }
+        return heap;
+    }
+
+    // a whole string -> float map: buckets, nodes and keys
+    Footprint mapHeap(const std::unordered_map<std::string, float>& map) {
+        return bucketHeap(map) + nodeHeap(map);
+    }
+}
+
+Footprint& Footprint::operator+=(const Footprint& other) {
+    bytes += other.bytes;
+    allocations += other.allocations;
+    return *this;
+}
+
+Footprint operator+(Footprint a, const Footprint& b) {
+    return a += b;
+}
+
+Footprint MemoryReport::total() const {
+    return terms + courses + assignments + container;
+}
+
+Footprint MemoryAccounting::heapOf(const Assignment& assignment) {
+    return stringHeap(assignment.id_) + stringHeap(assignment.title_) + stringHeap(assignment.description_) +
+        stringHeap(assignment.category_);
+}
+
+// strings, the three unordered maps, the grade scale and the due-date index; the assignment map's nodes belong
+// to the assignments
+Footprint MemoryAccounting::heapOf(const Course& course) {
+    Footprint heap = stringHeap(course.id_) + stringHeap(course.title_) + stringHeap(course.description_) +
+        stringHeap(course.letterGrade_);
+
+    heap += bucketHeap(course.assignmentList_);
+    heap += mapHeap(course.gradeWeights_);
+    heap += mapHeap(course.gradesByCategory_);
+
+    for (const auto& [threshold, letter] : course.gradeScale_) {
+        heap += Footprint{sizeof(TreeNode<float, std::string>), 1};
+        heap += stringHeap(letter);
+    }
+
+    for (const DueKey& key : course.dueIndex_) {
+        heap += Footprint{sizeof(SetNode<DueKey>), 1};
+        heap += stringHeap(key.id);
+    }
+
+    return heap;
+}
+
+// strings and the course list's index buckets; the course list's nodes belong to the courses
+Footprint MemoryAccounting::heapOf(const Term& term) {
+    return stringHeap(term.id_) + stringHeap(term.title_) + bucketHeap(term.courseList_);
+}
+
+Footprint MemoryAccounting::of(const Assignment& assignment) {
+    return Footprint{sizeof(Assignment), 0} + heapOf(assignment);
+}
+
+Footprint MemoryAccounting::of(const Course& course) {
+    Footprint footprint = Footprint{sizeof(Course), 0} + heapOf(course) + nodeHeap(course.assignmentList_);
+    for (const auto& [id, assignment] : course.assignmentList_) {
+        footprint += heapOf(assignment);
+    }
+    return footprint;
+}
+
+Footprint MemoryAccounting::of(const Term& term) {
+    Footprint footprint = Footprint{sizeof(Term), 0} + heapOf(term) + nodeHeap(term.courseList_);
+    for (const auto& [id, course] : term.courseList_) {
+        footprint += of(course);
+        footprint.bytes -= sizeof(Course);     // already counted as part of its node
+    }
+    return footprint;
+}
+
+// walks the tree once, charging each node and key to the entity stored in it
+MemoryReport MemoryAccounting::measure(const TermController& controller) {
+    MemoryReport report{};
+    const auto& termList = controller.getTermList();
+    report.container = bucketHeap(termList);
+
+    for (const auto& [termId, term] : termList) {
+        MemoryReport::TermUsage usage{term.getTitle(), term.courseList_.size(), 0, {}};
+
+        Footprint termShare = orderedEntryHeap<Term>() + stringHeap(termId) + heapOf(term);
+        report.terms += termShare;
+        usage.footprint += termShare;
+
+        for (const auto& [courseId, course] : term.courseList_) {
+            Footprint courseShare = orderedEntryHeap<Course>() + stringHeap(courseId) +
+                heapOf(course);
+            report.courses += courseShare;
+            usage.footprint += courseShare;
+
+            for (const auto& [assignmentId, assignment] : course.assignmentList_) {
+                Footprint assignmentShare = Footprint{sizeof(HashNode<std::string, Assignment>), 1} +
+                    stringHeap(assignmentId) + heapOf(assignment);
+                report.assignments += assignmentShare;
+                usage.footprint += assignmentShare;
+            }
+            usage.assignmentCount += course.assignmentList_.size();
+        }
+
+        report.termCount += 1;
+        report.courseCount += usage.courseCount;
+        report.assignmentCount += usage.assignmentCount;
+        report.perTerm.push_back(std::move(usage));
+    }
+
+    return report;
+}
+
+// a per-type table with bytes per entity, then one row per term
+void MemoryAccounting::writeReport(const MemoryReport& report, std::ostream& os) {
+    auto row = [&os](const std::string& label, std::size_t count, const Footprint& footprint) {
+        os << std::left << std::setw(16) << label << std::right << std::setw(10) << count
+           << std::setw(14) << footprint.bytes << std::setw(14) << footprint.allocations
+           << std::setw(12) << (count == 0 ? 0 : footprint.bytes / count) << "\n";
+    };
+
+    os << std::left << std::setw(16) << "Type" << std::right << std::setw(10) << "Count" << std::setw(14) << "Bytes"
+       << std::setw(14) << "Allocations" << std::setw(12) << "Bytes each" << "\n";
+    row("Terms", report.termCount, report.terms);
+    row("Courses", report.courseCount, report.courses);
+    row("Assignments", report.assignmentCount, report.assignments);
+    row("Total", report.termCount + report.courseCount + report.assignmentCount, report.total());
+
+    os << "\n" << std::left << std::setw(16) << "Term" << std::right << std::setw(10) << "Courses"
+       << std::setw(14) << "Assignments" << std::setw(14) << "Bytes" << std::setw(12) << "Allocations" << "\n";
+    for (const MemoryReport::TermUsage& usage : report.perTerm) {
+        os << std::left << std::setw(16) << usage.title << std::right << std::setw(10) << usage.courseCount
+           << std::setw(14) << usage.assignmentCount << std::setw(14) << usage.footprint.bytes
+           << std::setw(12) << usage.footprint.allocations << "\n";
+    }
+}
@@ -0,0 +1,452 @@
+#include "model/SearchIndex.hpp"
+
+/**
+ * @file SearchIndex.cpp
+ * @brief Implementation of the full-text search index over term, course and assignment titles, descriptions and categories.
+ *
+ * Provides implementations only; see SearchIndex.hpp for definitions.
+ */
+
+#include <algorithm>            // for sorting and searching postings
+#include <stdexcept>            // for exceptions
+#include "model/Term.hpp"         // for walking terms and courses
+
+namespace {
+    // title, category, description
+    constexpr std::array<float, 3> fieldWeights{3.0f, 2.0f, 1.0f};
+
+    // letters, digits and any non-ASCII byte, so UTF-8 words stay whole
+    bool isTokenChar(unsigned char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c >= 0x80;
+    }
+
+    std::string fold(std::string_view text) {
+        std::string folded{text};
+        for (char& c : folded) {
+            if (c >= 'A' && c <= 'Z') {
+                c = static_cast<char>(c - 'A' + 'a');
+            }
+        }
+        return folded;
+    }
+
+    template <typename Visit>
+    void forEachToken(std::string_view text, Visit visit) {
+        std::size_t i = 0;
+        while (i < text.size()) {
+            while (i < text.size() && !isTokenChar(static_cast<unsigned char>(text[i]))) {
+                ++i;
+            }
+            std::size_t start = i;
+            while (i < text.size() && isTokenChar(static_cast<unsigned char>(text[i]))) {
+                ++i;
+            }
+            if (i > start) {
+                visit(text.substr(start, i - start));
+            }
+        }
+    }
+
+    std::uint32_t trigramAt(std::string_view token, std::size_t i) {
+        return static_cast<std::uint32_t>(static_cast<unsigned char>(token[i])) << 16 |
+            static_cast<std::uint32_t>(static_cast<unsigned char>(token[i + 1])) << 8 |
+            static_cast<std::uint32_t>(static_cast<unsigned char>(token[i + 2]));
+    }
+
+    // the first one or two characters of a token, flagged in the top bit so it never equals a trigram
+    std::uint32_t prefixOf(std::string_view token, std::size_t length) {
+        std::uint32_t second = length > 1 ? static_cast<unsigned char>(token[1]) : 0;
+        return 0x80000000u | static_cast<std::uint32_t>(length) << 16 |
+            static_cast<std::uint32_t>(static_cast<unsigned char>(token[0])) << 8 | second;
+    }
+
+    // calls visit with each gram a token is indexed under
+    template <typename Visit>
+    void forEachGram(std::string_view token, Visit visit) {
+        visit(prefixOf(token, 1));
+        if (token.size() >= 2) {
+            visit(prefixOf(token, 2));
+        }
+        for (std::size_t i = 0; i + 3 <= token.size(); ++i) {
+            visit(trigramAt(token, i));
+        }
+    }
+
+    // new slots usually come last, so that case skips the search; false if the slot was already there
+    bool insertSorted(std::vector<std::uint32_t>& postings, std::uint32_t slot) {
+        if (postings.empty() || postings.back() < slot) {
+            postings.push_back(slot);
+            return true;
+        }
+
+        auto it = std::lower_bound(postings.begin(), postings.end(), slot);
+        if (it != postings.end() && *it == slot) {
+            return false;
+        }
+
+        postings.insert(it, slot);
+        return true;
+    }
+
+    template <typename Container>
+    void sortUnique(Container& values) {
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+    }
+
+    // 1 for a whole word, 0.75 for the start of one, 0.5 for the inside of one (three or more characters only), else 0
+    float matchQuality(std::string_view field, std::string_view term) {
+        float best = 0.0f;
+
+        for (std::size_t pos = field.find(term); pos != std::string_view::npos; pos = field.find(term, pos + 1)) {
+            std::size_t end = pos + term.size();
+            bool startsWord = pos == 0 || !isTokenChar(static_cast<unsigned char>(field[pos - 1]));
+            bool endsWord = end == field.size() || !isTokenChar(static_cast<unsigned char>(field[end]));
+
+            if (startsWord && endsWord) {
+                return 1.0f;
+            } else if (startsWord) {
+                best = std::max(best, 0.75f);
+            } else if (term.size() >= 3) {
+                best = std::max(best, 0.5f);
+            }
+        }
+
+        return best;
+    }
+}
+
+std::size_t SearchIndex::size() const {
+    return slots_.size();
+}
+
+bool SearchIndex::contains(const std::string& id) const {
+    return slots_.contains(id);
+}
+
+void SearchIndex::reserve(std::size_t count) {
+    docs_.reserve(docs_.size() + count);
+    slots_.reserve(slots_.size() + count);
+}
+
+void SearchIndex::addTerm(const Term& term) {
+    insert(EntityKind::term, term.getId(), noParent, term.getTitle(), {}, {});
+
+    for (const auto& [courseId, course] : term.getCourseList()) {
+        addCourse(course, term.getId());
+    }
+}
+
+void SearchIndex::removeTerm(const Term& term) {
+    for (const auto& [courseId, course] : term.getCourseList()) {
+        removeCourse(course);
+    }
+
+    erase(term.getId());
+}
+
+void SearchIndex::addCourse(const Course& course, const std::string& termId) {
+    insert(EntityKind::course, course.getId(), slotOf(termId, "Term not indexed."), course.getTitle(), {},
+        course.getDescription());
+
+    for (const auto& [id, assignment] : course.getAssignmentList()) {
+        addAssignment(assignment, course.getId());
+    }
+}
+
+void SearchIndex::removeCourse(const Course& course) {
+    for (const auto& [id, assignment] : course.getAssignmentList()) {
+        removeAssignment(assignment);
+    }
+
+    erase(course.getId());
+}
+
+void SearchIndex::addAssignment(const Assignment& assignment, const std::string& courseId) {
+    insert(EntityKind::assignment, assignment.getId(), slotOf(courseId, "Course not indexed."),
+        assignment.getTitle(), assignment.getCategory(), assignment.getDescription());
+}
+
+void SearchIndex::removeAssignment(const Assignment& assignment) {
+    erase(assignment.getId());
+}
+
+void SearchIndex::updateTerm(const Term& term) {
+    update(term.getId(), term.getTitle(), {}, {});
+}
+
+void SearchIndex::updateCourse(const Course& course) {
+    update(course.getId(), course.getTitle(), {}, course.getDescription());
+}
+
+void SearchIndex::updateAssignment(const Assignment& assignment) {
+    update(assignment.getId(), assignment.getTitle(), assignment.getCategory(), assignment.getDescription());
+}
+
+// entities matching every term of the query, best first; ties go to the lower slot
+std::vector<SearchHit> SearchIndex::search(std::string_view query, std::size_t limit) const {
+    const std::string folded = fold(query);
+    std::vector<std::string_view> terms;
+    forEachToken(folded, [&terms](std::string_view term) { terms.push_back(term); });
+    sortUnique(terms);
+
+    if (terms.empty() || limit == 0) {
+        return {};
+    }
+
+    // every match appears in the postings of each gram of each term: its trigrams, or for a term under three
+    // characters, its prefix. Along the way, the fields each gram appears in bound the best score a match can reach.
+    std::vector<const Postings*> required;
+    float bestPossible = 0.0f;
+
+    for (std::string_view term : terms) {
+        std::array<bool, 3> inField{true, true, true};
+        auto require = [this, &required, &inField](std::uint32_t gram) {
+            auto it = grams_.find(gram);
+            if (it == grams_.end()) {
+                return false;
+            }
+            required.push_back(&it->second.postings);
+            for (std::size_t f = 0; f < inField.size(); ++f) {
+                inField[f] = inField[f] && it->second.fieldCounts[f] > 0;
+            }
+            return true;
+        };
+
+        if (term.size() < 3 && !require(prefixOf(term, term.size()))) {
+            return {};
+        }
+        for (std::size_t i = 0; i + 3 <= term.size(); ++i) {
+            if (!require(trigramAt(term, i))) {
+                return {};
+            }
+        }
+
+        float termBest = 0.0f;
+        for (std::size_t f = 0; f < inField.size(); ++f) {
+            termBest = inField[f] ? std::max(termBest, fieldWeights[f]) : termBest;
+        }
+        if (termBest == 0.0f) {
+            return {};
+        }
+        bestPossible += termBest;
+    }
+
+    std::sort(required.begin(), required.end(),
+        [](const Postings* a, const Postings* b) { return a->size() < b->size(); });
+
+    // the other lists are walked forward alongside the shortest, since candidates come in ascending order
+    std::vector<Postings::const_iterator> cursors;
+    for (std::size_t i = 1; i < required.size(); ++i) {
+        cursors.push_back(required[i]->begin());
+    }
+
+    // a heap of the best matches so far with the worst on top, scored first and then by lower slot
+    using Match = std::pair<float, std::uint32_t>;
+    auto better = [](const Match& a, const Match& b) {
+        return a.first != b.first ? a.first > b.first : a.second < b.second;
+    };
+    std::vector<Match> best;
+    best.reserve(std::min(limit, required.front()->size()));
+
+    for (std::uint32_t slot : *required.front()) {
+        if (best.size() == limit && best.front().first >= bestPossible) {
+            break;      // every later candidate could at most tie, and ties go to the lower slot
+        }
+
+        bool inAll = true;
+        for (std::size_t i = 0; i < cursors.size() && inAll; ++i) {
+            cursors[i] = std::lower_bound(cursors[i], required[i + 1]->end(), slot);
+            inAll = cursors[i] != required[i + 1]->end() && *cursors[i] == slot;
+        }
+        if (!inAll) {
+            continue;
+        }
+
+        // trigrams can all be present without the term itself, so each candidate is checked against its fields
+        Match match{score(docs_[slot], terms), slot};
+        if (match.first == 0.0f) {
+            continue;
+        }
+
+        if (best.size() < limit) {
+            best.push_back(match);
+            std::push_heap(best.begin(), best.end(), better);
+        } else if (better(match, best.front())) {
+            std::pop_heap(best.begin(), best.end(), better);
+            best.back() = match;
+            std::push_heap(best.begin(), best.end(), better);
+        }
+    }
+
+    std::sort_heap(best.begin(), best.end(), better);
+
+    std::vector<SearchHit> hits;
+    hits.reserve(best.size());
+
+    for (const auto& [matchScore, slot] : best) {
+        const Document& document = docs_[slot];
+        SearchHit hit{document.kind, document.id, {}, {}, matchScore};
+
+        if (document.kind == EntityKind::course) {
+            hit.termId = docs_[document.parent].id;
+        } else if (document.kind == EntityKind::assignment) {
+            const Document& course = docs_[document.parent];
+            hit.courseId = course.id;
+            hit.termId = docs_[course.parent].id;
+        }
+
+        hits.push_back(std::move(hit));
+    }
+
+    return hits;
+}
+
+std::uint32_t SearchIndex::slotOf(const std::string& id, const char* missing) const {
+    auto it = slots_.find(id);
+
+    if (it == slots_.end()) {
+        throw std::out_of_range(missing);
+    }
+
+    return it->second;
+}
+
+// indexes an entity in a free slot, or re-indexes it in place if it is already there
+void SearchIndex::insert(EntityKind kind, const std::string& id, std::uint32_t parent, std::string_view title,
+    std::string_view category, std::string_view description) {
+    auto existing = slots_.find(id);
+
+    if (existing != slots_.end()) {
+        docs_[existing->second].parent = parent;
+        update(id, title, category, description);
+        return;
+    }
+
+    std::uint32_t slot;
+    if (freeSlots_.empty()) {
+        slot = static_cast<std::uint32_t>(docs_.size());
+        docs_.emplace_back();
+    } else {
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+    }
+
+    Document& document = docs_[slot];
+    document.kind = kind;
+    document.id = id;
+    document.parent = parent;
+    document.fields = {fold(title), fold(category), fold(description)};
+
+    slots_.emplace(id, slot);
+    indexFields(slot, true);
+}
+
+void SearchIndex::update(const std::string& id, std::string_view title, std::string_view category,
+    std::string_view description) {
+    std::uint32_t slot = slotOf(id, "Entity not indexed.");
+    Document& document = docs_[slot];
+
+    indexFields(slot, false);
+    document.fields = {fold(title), fold(category), fold(description)};
+    indexFields(slot, true);
+    compactIfStale();
+}
+
+// removes an entity if it is indexed; its slot is reused by the next insert
+void SearchIndex::erase(const std::string& id) {
+    auto it = slots_.find(id);
+
+    if (it == slots_.end()) {
+        return;
+    }
+
+    std::uint32_t slot = it->second;
+    indexFields(slot, false);
+    docs_[slot] = Document{};
+    freeSlots_.push_back(slot);
+    slots_.erase(it);
+    compactIfStale();
+}
+
+// adds the slot to the postings of every gram in its fields, or marks it stale there
+void SearchIndex::indexFields(std::uint32_t slot, bool add) {
+    scratchGrams_.clear();
+
+    const std::array<std::string, 3>& fields = docs_[slot].fields;
+    for (std::size_t f = 0; f < fields.size(); ++f) {
+        forEachToken(fields[f], [this, f](std::string_view token) {
+            forEachGram(token, [this, f](std::uint32_t gram) { scratchGrams_.emplace_back(gram, f); });
+        });
+    }
+    sortUnique(scratchGrams_);
+
+    // a gram in two fields is seen twice: once per field count, while the slot goes in (or stale) once. A slot
+    // already in the postings on the way in can only be a stale one coming back to life.
+    for (std::size_t i = 0; i < scratchGrams_.size(); ++i) {
+        const auto& [gram, field] = scratchGrams_[i];
+        bool firstOfGram = i == 0 || scratchGrams_[i - 1].first != gram;
+
+        if (add) {
+            Entry& entry = grams_[gram];
+            ++entry.fieldCounts[field];
+            if (firstOfGram) {
+                if (!insertSorted(entry.postings, slot)) {
+                    --stalePostings_;
+                }
+                ++entry.live;
+                ++livePostings_;
+            }
+        } else if (auto it = grams_.find(gram); it != grams_.end()) {
+            --it->second.fieldCounts[field];
+            if (firstOfGram) {
+                --it->second.live;
+                --livePostings_;
+                ++stalePostings_;
+            }
+            if (it->second.live == 0) {
+                stalePostings_ -= it->second.postings.size();
+                grams_.erase(it);
+            }
+        }
+    }
+}
+
+// rebuilds every postings list from the live slots once stale slots outnumber them, so the cost is spread over
+// the removals that left them behind
+void SearchIndex::compactIfStale() {
+    constexpr std::size_t minimumStale = 1024;
+
+    if (stalePostings_ < minimumStale || stalePostings_ <= livePostings_) {
+        return;
+    }
+
+    grams_.clear();
+    livePostings_ = 0;
+    stalePostings_ = 0;
+
+    for (std::uint32_t slot = 0; slot < docs_.size(); ++slot) {
+        if (!docs_[slot].id.empty()) {
+            indexFields(slot, true);
+        }
+    }
+}
+
+// the sum over query terms of each term's best field match, or 0 if any term matches nowhere
+float SearchIndex::score(const Document& document, const std::vector<std::string_view>& terms) const {
+    float total = 0.0f;
+
+    for (std::string_view term : terms) {
+        float best = 0.0f;
+        for (std::size_t f = 0; f < document.fields.size(); ++f) {
+            best = std::max(best, fieldWeights[f] * matchQuality(document.fields[f], term));
+        }
+
+        if (best == 0.0f) {
+            return 0.0f;
+        }
+        total += best;
+    }
+
+    return total;
+}
@@ -12,12 +12,14 @@
 
 #include <stdexcept>            // for exceptions
 #include <iomanip>              // for string formatting in print statement
+#include <utility>              // for move
+#include "trace/Trace.hpp"        // for recompute timing
 #include "utils/utils.hpp"        // for reused custom functions
 
 using namespace std::chrono_literals;
 
 // calculates total credits based on courseList
-int Term::calculateTotalCredits() {
+int Term::calculateTotalCredits() const {
     int result = 0;
 
     for (const auto& [id, course] : courseList_) {
@@ -27,9 +29,13 @@ int Term::calculateTotalCredits() {
     return result;
 }
 
-// calculates overall GPA based on courseList
-float Term::calculateOvrGpa() {
-    float totalGpa = 0.0f;
+// calculates overall GPA based on courseList; the weighted sum is kept in double, as in Course::calculateGradePct,
+// so the user's course order doesn't change the result
+float Term::calculateOvrGpa() const {
+    TRACE_SCOPE("Term::calculateOvrGpa");
+    TRACE_COUNT("Term::calculateOvrGpa courses", courseList_.size());
+
+    double totalGpa = 0.0;
     int credits = calculateTotalCredits();  // ensure that totalCredits is set
 
     // default case to avoid division by zero
@@ -42,11 +48,15 @@ float Term::calculateOvrGpa() {
         totalGpa += course.getGpaVal() * course.getNumCredits();
     }
 
-    return utils::floatRound(totalGpa / static_cast<float>(credits), 2);
+    return utils::floatRound(static_cast<float>(totalGpa / credits), 2);
 }
 
 Term::Term(std::string title, std::chrono::year_month_day startDate, std::chrono::year_month_day 
-    endDate, bool active) : id_{utils::generateUuid()} {
+    endDate, bool active) : Term{utils::generateUuid(), std::move(title), startDate, endDate, active} {}
+
+// takes the id rather than generating one, so fromRow doesn't pay for a UUID it throws away
+Term::Term(std::string id, std::string title, std::chrono::year_month_day startDate,
+    std::chrono::year_month_day endDate, bool active) : id_{std::move(id)} {
     // internal defaulting for user input
     if (startDate == std::chrono::year_month_day{}) {
         startDate = utils::defaultStartDate();
@@ -84,7 +94,7 @@ std::chrono::year_month_day Term::getEndDate() const {
     return endDate_;
 }
 
-const std::unordered_map<std::string, Course>& Term::getCourseList() const {
+const CourseList& Term::getCourseList() const {
     return courseList_;
 }
 
@@ -130,7 +140,12 @@ void Term::printTermInfo(std::ostream &os) const {
 
 // adds a Course to the end of the list from the given input
 void Term::addCourse(const Course& course) {
-    auto [_, inserted] = courseList_.emplace(course.getId(), course);
+    addCourse(Course{course});
+}
+
+// takes the Course over rather than copying it, e.g. one just read from a file
+void Term::addCourse(Course&& course) {
+    auto [_, inserted] = courseList_.emplace(course.getId(), std::move(course));
 
     if (!inserted) {
         throw std::logic_error("Course with the same ID already exists.");
@@ -152,6 +167,30 @@ void Term::removeCourse(const std::string& id) {
     ovrGpa_ = calculateOvrGpa();
 }
 
+// updates total credits and overall GPA from the courses' current grades
+void Term::recalculateGpa() {
+    totalCredits_ = calculateTotalCredits();
+    ovrGpa_ = calculateOvrGpa();
+}
+
+// moves a Course to the given zero-based position in the list, or to the end if position is past it
+void Term::moveCourse(const std::string& id, std::size_t position) {
+    if (!courseList_.contains(id)) {
+        throw std::out_of_range("Course not found.");
+    }
+
+    courseList_.move(id, position);
+}
+
+// moves a Course in front of the one with nextId, or to the end if there is no such course
+void Term::moveCourseBefore(const std::string& id, const std::string& nextId) {
+    if (!courseList_.contains(id)) {
+        throw std::out_of_range("Course not found.");
+    }
+
+    courseList_.moveBefore(id, nextId);
+}
+
 // finds a Course in courseList based on ID; non-mutable (read-only)
 const Course& Term::findCourse(const std::string& id) const {
     auto it = courseList_.find(id);
@@ -185,7 +224,5 @@ Term Term::fromRow(std::string id, std::string title, std::chrono::year_month_da
         throw std::invalid_argument("End date must not be empty.");
     }
     
-    Term t{title, startDate, endDate, active};
-    t.id_ = std::move(id);
-    return t;
+    return Term{std::move(id), std::move(title), startDate, endDate, active};
 }
\ No newline at end of file
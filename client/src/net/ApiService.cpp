@@ -0,0 +1,789 @@
+#include "net/ApiService.hpp"
+
+/**
+ * @file ApiService.cpp
+ * @brief Implementation of the ApiService class, which answers the server's REST routes from a TermController.
+ *
+ * Request bodies are read in place through a stream buffer over the request's bytes, and responses are
+ * written through one that appends to the response body, so a request costs no copies beyond the records
+ * it creates. The controllers report a title that is already taken with std::logic_error; their validation
+ * errors are std::invalid_argument, a subclass, so those are let through to become 422s.
+ *
+ * Provides implementations only; see ApiService.hpp for definitions.
+ */
+
+#include <algorithm>        // for min
+#include <array>            // for path segments
+#include <charconv>         // for the limit parameter
+#include <cstdint>          // for entity tag hashes
+#include <istream>          // for request bodies
+#include <ostream>          // for response bodies
+#include <stdexcept>        // for exceptions
+#include <streambuf>        // for in-place streams
+#include <vector>           // for list entries
+#include "io/EntityJson.hpp"
+#include "io/JsonWriter.hpp"
+#include "utils/utils.hpp"
+
+namespace {
+    // reads straight from the request's bytes
+    class ViewBuffer : public std::streambuf {
+        public:
+            explicit ViewBuffer(std::string_view data) {
+                char* begin = const_cast<char*>(data.data());
+                setg(begin, begin, begin + data.size());
+            }
+    };
+
+    // appends to a string, so a body is written once and then moved into its response
+    class StringBuffer : public std::streambuf {
+        public:
+            explicit StringBuffer(std::string& out) : out_{out} {}
+
+        protected:
+            int_type overflow(int_type c) override {
+                if (!traits_type::eq_int_type(c, traits_type::eof())) {
+                    out_.push_back(traits_type::to_char_type(c));
+                }
+                return traits_type::not_eof(c);
+            }
+
+            std::streamsize xsputn(const char* s, std::streamsize count) override {
+                out_.append(s, static_cast<std::size_t>(count));
+                return count;
+            }
+
+        private:
+            std::string& out_;
+    };
+
+    template <typename Write>
+    HttpResponse json(int status, Write&& write) {
+        HttpResponse response{status, {}, {}};
+        StringBuffer buffer{response.body};
+        std::ostream os{&buffer};
+        JsonWriter writer{os};
+        write(writer);
+        return response;
+    }
+
+    // the error body FastAPI's HTTPException produces
+    HttpResponse detail(int status, std::string_view message) {
+        return json(status, [message](JsonWriter& writer) {
+            writer.startObject();
+            writer.key("detail");
+            writer.stringValue(message);
+            writer.endObject();
+        });
+    }
+
+    HttpResponse noContent() {
+        return HttpResponse{204, {}, {}};
+    }
+
+    io::EntityBatch readBody(std::string_view body, EntityKind kind) {
+        ViewBuffer buffer{body};
+        std::istream is{&buffer};
+        return io::readRecords(is, kind);
+    }
+
+    template <typename Records>
+    void requireOne(const Records& records) {
+        if (records.size() != 1) {
+            throw std::invalid_argument("Request body must be a single JSON object.");
+        }
+    }
+
+    // a strong entity tag for a response body: FNV-1a over its bytes, so equal bodies get equal tags
+    std::string entityTag(std::string_view body) {
+        std::uint64_t hash = 0xcbf29ce484222325ull;
+        for (unsigned char c : body) {
+            hash ^= c;
+            hash *= 0x100000001b3ull;
+        }
+
+        static constexpr char digits[] = "0123456789abcdef";
+        std::string tag(18, '"');
+        for (std::size_t i = 16; i > 0; --i, hash >>= 4) {
+            tag[i] = digits[hash & 0xf];
+        }
+        return tag;
+    }
+
+    // looked up here rather than through HttpRequest::header, which is built with HttpServer on Linux only
+    std::string_view ifNoneMatchOf(const HttpRequest& request) {
+        for (const auto& [name, value] : request.headers) {
+            if (utils::CaseInsensitiveEqual{}(name, "if-none-match")) {
+                return value;
+            }
+        }
+        return {};
+    }
+
+    // whether an If-None-Match list names the tag; the comparison is the weak one RFC 9110 asks for here
+    bool matchesTag(std::string_view ifNoneMatch, std::string_view tag) {
+        while (!ifNoneMatch.empty()) {
+            std::size_t comma = ifNoneMatch.find(',');
+            std::string_view candidate = ifNoneMatch.substr(0, comma);
+            ifNoneMatch = comma == std::string_view::npos ? std::string_view{} : ifNoneMatch.substr(comma + 1);
+
+            while (!candidate.empty() && (candidate.front() == ' ' || candidate.front() == '\t')) {
+                candidate.remove_prefix(1);
+            }
+            while (!candidate.empty() && (candidate.back() == ' ' || candidate.back() == '\t')) {
+                candidate.remove_suffix(1);
+            }
+            if (candidate.starts_with("W/")) {
+                candidate.remove_prefix(2);
+            }
+            if (candidate == "*" || candidate == tag) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // decodes %XX escapes and '+' in a query parameter
+    std::string decodeParameter(std::string_view value) {
+        std::string decoded;
+        decoded.reserve(value.size());
+
+        for (std::size_t i = 0; i < value.size(); ++i) {
+            unsigned int byte = 0;
+            if (value[i] == '%' && i + 2 < value.size()
+                && std::from_chars(value.data() + i + 1, value.data() + i + 3, byte, 16).ptr == value.data() + i + 3) {
+                decoded.push_back(static_cast<char>(byte));
+                i += 2;
+            } else {
+                decoded.push_back(value[i] == '+' ? ' ' : value[i]);
+            }
+        }
+        return decoded;
+    }
+
+    // one record of a list route, with the parent id its record shape carries
+    template <typename Record>
+    struct Listed {
+        std::string_view id;
+        const std::string* parentId;
+        const Record* record;
+    };
+
+    // one keyset page of an id-ordered index: the ids after the query's after id, at most its limit of them, each
+    // resolved to its record; ids is null for a parent that holds nothing
+    template <typename Query, typename Ids, typename Resolve>
+    auto pageOf(const Query& query, const Ids* ids, Resolve&& resolve) {
+        std::vector<decltype(resolve(std::string{}))> items;
+        if (ids == nullptr) {
+            return items;
+        }
+
+        auto it = query.after ? ids->upper_bound(*query.after) : ids->begin();
+        std::size_t limit = query.limit != 0 ? query.limit : ApiService::defaultPageSize;
+        items.reserve(std::min(limit, ids->size()));
+        for (; it != ids->end() && items.size() < limit; ++it) {
+            items.push_back(resolve(*it));
+        }
+        return items;
+    }
+
+    // writes a list route's records as a JSON array or as NDJSON
+    template <typename Query, typename Record, typename Write>
+    HttpResponse listOf(const Query& query, const std::vector<Listed<Record>>& items, Write&& write) {
+        HttpResponse response{200, {}, {}};
+        StringBuffer buffer{response.body};
+        std::ostream os{&buffer};
+        JsonWriter writer{os};
+
+        if (query.ndjson) {
+            response.headers.emplace_back("content-type", "application/x-ndjson");
+            for (const Listed<Record>& item : items) {
+                write(writer, item);
+                os.put('\n');
+            }
+        } else {
+            writer.startArray();
+            for (const Listed<Record>& item : items) {
+                write(writer, item);
+            }
+            writer.endArray();
+        }
+
+        return response;
+    }
+
+    // runs apply, and returns false if it failed because the record's title is already taken
+    template <typename Apply>
+    bool applyUnlessTitleTaken(Apply&& apply) {
+        try {
+            apply();
+            return true;
+        } catch (const std::invalid_argument&) {
+            throw;
+        } catch (const std::out_of_range&) {
+            throw;
+        } catch (const std::logic_error&) {
+            return false;
+        }
+    }
+}
+
+ApiService::ApiService(TermController& controller) : controller_{controller} {
+    for (const auto& [termId, term] : controller_.getTermList()) {
+        termPages_.insert(termId);
+        for (const auto& [courseId, course] : term.getCourseList()) {
+            courseTerms_.emplace(courseId, termId);
+            coursePages_.insert(termId, courseId);
+            for (const auto& [assignmentId, assignment] : course.getAssignmentList()) {
+                assignmentCourses_.emplace(assignmentId, courseId);
+                assignmentPages_.insert(courseId, assignmentId);
+            }
+        }
+    }
+}
+
+void ApiService::PageIndex::insert(const std::string& parentId, const std::string& id) {
+    all.insert(id);
+    byParent[parentId].insert(id);
+}
+
+void ApiService::PageIndex::erase(const std::string& parentId, const std::string& id) {
+    all.erase(id);
+    auto it = byParent.find(parentId);
+    if (it != byParent.end()) {
+        it->second.erase(id);
+        if (it->second.empty()) {
+            byParent.erase(it);
+        }
+    }
+}
+
+// drops every id the parent holds
+void ApiService::PageIndex::eraseParent(const std::string& parentId) {
+    auto it = byParent.find(parentId);
+    if (it == byParent.end()) {
+        return;
+    }
+
+    for (const std::string& id : it->second) {
+        all.erase(id);
+    }
+    byParent.erase(it);
+}
+
+const ApiService::IdSet* ApiService::PageIndex::find(const std::string& parentId) const {
+    auto it = byParent.find(parentId);
+    return it == byParent.end() ? nullptr : &it->second;
+}
+
+// routes by path segment; a trailing slash and any query string are ignored
+// tags every successful GET by its body and answers 304 with no body when the client already holds it; the body
+// is still built, but a client polling for changes is not sent it
+HttpResponse ApiService::handle(const HttpRequest& request) {
+    HttpResponse response = route(request);
+
+    if (request.method == "GET" && response.status == 200) {
+        std::string tag = entityTag(response.body);
+        if (matchesTag(ifNoneMatchOf(request), tag)) {
+            return HttpResponse{304, {{"etag", std::move(tag)}}, {}};
+        }
+        response.headers.emplace_back("etag", std::move(tag));
+    }
+
+    return response;
+}
+
+HttpResponse ApiService::route(const HttpRequest& request) {
+    std::string_view path = request.target.substr(0, request.target.find('?'));
+    std::array<std::string_view, 3> segments{};
+    std::size_t count = 0;
+
+    while (!path.empty()) {
+        path.remove_prefix(path.front() == '/' ? 1 : 0);
+        std::size_t end = path.find('/');
+        std::string_view segment = path.substr(0, end);
+        path = end == std::string_view::npos ? std::string_view{} : path.substr(end);
+
+        if (segment.empty()) {
+            continue;
+        }
+        if (count == segments.size()) {
+            return detail(404, "Not Found");
+        }
+        segments[count++] = segment;
+    }
+
+    std::string_view method = request.method;
+    std::string_view resource = segments[0];
+    bool isGet = method == "GET";
+
+    try {
+        if (count == 1) {
+            if (isGet) {
+                ListQuery query = parseListQuery(request.target);
+                return resource == "terms" ? listTerms(query) : resource == "courses" ? listCourses(query)
+                    : resource == "assignments" ? listAssignments(query) : detail(404, "Not Found");
+            }
+            if (method == "POST") {
+                return resource == "terms" ? createTerm(request.body) : resource == "courses" ? createCourse(request.body)
+                    : resource == "assignments" ? createAssignment(request.body) : detail(404, "Not Found");
+            }
+        } else if (count == 2) {
+            std::string id{segments[1]};
+
+            if (resource == "terms") {
+                return isGet ? getTerm(id) : method == "PUT" ? updateTerm(id, request.body)
+                    : method == "DELETE" ? deleteTerm(id) : detail(405, "Method Not Allowed");
+            }
+            if (resource == "courses") {
+                return isGet ? getCourse(id) : method == "PUT" ? updateCourse(id, request.body)
+                    : method == "DELETE" ? deleteCourse(id) : detail(405, "Method Not Allowed");
+            }
+            if (resource == "assignments") {
+                return isGet ? getAssignment(id) : method == "PUT" ? updateAssignment(id, request.body)
+                    : method == "DELETE" ? deleteAssignment(id) : detail(405, "Method Not Allowed");
+            }
+            return detail(404, "Not Found");
+        } else if (count == 3) {
+            bool known = (resource == "terms" && (segments[2] == "tree" || segments[2] == "gpa"))
+                || (resource == "courses" && (segments[1] == "by-term" || segments[2] == "grade"))
+                || (resource == "assignments" && segments[1] == "by-course");
+
+            if (!known) {
+                return detail(404, "Not Found");
+            }
+            if (isGet) {
+                if (resource == "terms") {
+                    std::string id{segments[1]};
+                    return segments[2] == "tree" ? getTermTree(id) : getTermGpa(id);
+                }
+                if (resource == "courses" && segments[1] != "by-term") {
+                    return getCourseGrade(std::string{segments[1]});
+                }
+                return resource == "courses" ? listCoursesByTerm(std::string{segments[2]}, parseListQuery(request.target))
+                    : listAssignmentsByCourse(std::string{segments[2]}, parseListQuery(request.target));
+            }
+            return detail(405, "Method Not Allowed");
+        }
+    } catch (const std::invalid_argument& e) {
+        return detail(422, e.what());
+    }
+
+    bool known = count == 1 && (resource == "terms" || resource == "courses" || resource == "assignments");
+    return known ? detail(405, "Method Not Allowed") : detail(404, "Not Found");
+}
+
+
+// reads after, limit and format from the query string; a bad value is a 422, as FastAPI's validation makes it
+ApiService::ListQuery ApiService::parseListQuery(std::string_view target) {
+    ListQuery query;
+    std::size_t mark = target.find('?');
+    std::string_view rest = mark == std::string_view::npos ? std::string_view{} : target.substr(mark + 1);
+
+    while (!rest.empty()) {
+        std::size_t amp = rest.find('&');
+        std::string_view pair = rest.substr(0, amp);
+        rest = amp == std::string_view::npos ? std::string_view{} : rest.substr(amp + 1);
+
+        std::size_t equals = pair.find('=');
+        std::string_view name = pair.substr(0, equals);
+        std::string value = equals == std::string_view::npos ? std::string{} : decodeParameter(pair.substr(equals + 1));
+
+        if (name == "after") {
+            query.after = std::move(value);
+        } else if (name == "limit") {
+            auto result = std::from_chars(value.data(), value.data() + value.size(), query.limit);
+            if (result.ec != std::errc{} || result.ptr != value.data() + value.size() || query.limit < 1
+                || query.limit > maxPageSize) {
+                throw std::invalid_argument("limit must be a number from 1 to " + std::to_string(maxPageSize) + ".");
+            }
+        } else if (name == "format") {
+            if (value != "json" && value != "ndjson") {
+                throw std::invalid_argument("format must be 'json' or 'ndjson'.");
+            }
+            query.ndjson = value == "ndjson";
+        }
+    }
+
+    return query;
+}
+
+
+// ====================================
+// TERMS
+// ====================================
+
+HttpResponse ApiService::listTerms(const ListQuery& query) const {
+    std::vector<Listed<Term>> items;
+    if (query.paged()) {
+        items = pageOf(query, &termPages_, [this](const std::string& id) {
+            return Listed<Term>{id, nullptr, &controller_.getTermList().at(id)};
+        });
+    } else {
+        items.reserve(controller_.getTermList().size());
+        for (const auto& [id, term] : controller_.getTermList()) {
+            items.push_back({id, nullptr, &term});
+        }
+    }
+
+    return listOf(query, items, [](JsonWriter& writer, const Listed<Term>& item) {
+        io::writeTerm(writer, *item.record);
+    });
+}
+
+HttpResponse ApiService::getTerm(const std::string& id) const {
+    auto it = controller_.getTermList().find(id);
+    if (it == controller_.getTermList().end()) {
+        return detail(404, "Term not found");
+    }
+
+    return json(200, [&term = it->second](JsonWriter& writer) { io::writeTerm(writer, term); });
+}
+
+HttpResponse ApiService::getTermTree(const std::string& id) const {
+    auto it = controller_.getTermList().find(id);
+    if (it == controller_.getTermList().end()) {
+        return detail(404, "Term not found");
+    }
+
+    return json(200, [&term = it->second](JsonWriter& writer) { io::writeTermTree(writer, term); });
+}
+
+// computed from the courses rather than read from the term, whose GPA only catches up when a course is added or
+// removed; a remote assignment or credit change moves it too
+HttpResponse ApiService::getTermGpa(const std::string& id) const {
+    auto it = controller_.getTermList().find(id);
+    if (it == controller_.getTermList().end()) {
+        return detail(404, "Term not found");
+    }
+
+    return json(200, [&term = it->second](JsonWriter& writer) {
+        writer.startObject();
+        writer.key("term_id");
+        writer.stringValue(term.getId());
+        writer.key("total_credits");
+        writer.numberValue(term.calculateTotalCredits());
+        writer.key("ovr_gpa");
+        writer.numberValue(term.calculateOvrGpa());
+        writer.endObject();
+    });
+}
+
+HttpResponse ApiService::createTerm(std::string_view body) {
+    io::EntityBatch batch = readBody(body, EntityKind::term);
+    requireOne(batch.terms);
+    const Term& term = batch.terms.front();
+
+    if (controller_.getTermList().contains(term.getId())) {
+        return detail(409, "A term with this ID already exists");
+    }
+    if (!applyUnlessTitleTaken([this, &term]() { controller_.applyRemoteTerm(term); })) {
+        return detail(409, "A term with this title already exists");
+    }
+
+    termPages_.insert(term.getId());
+    return json(201, [&term](JsonWriter& writer) { io::writeTerm(writer, term); });
+}
+
+// the term at id takes the body's fields; like the server, it answers with the body as sent
+HttpResponse ApiService::updateTerm(const std::string& id, std::string_view body) {
+    io::EntityBatch batch = readBody(body, EntityKind::term);
+    requireOne(batch.terms);
+    const Term& sent = batch.terms.front();
+
+    if (!controller_.getTermList().contains(id)) {
+        return detail(404, "Term not found");
+    }
+
+    Term term = Term::fromRow(id, sent.getTitle(), sent.getStartDate(), sent.getEndDate(), sent.getActive());
+    if (!applyUnlessTitleTaken([this, &term]() { controller_.applyRemoteTerm(term); })) {
+        return detail(409, "A term with this title already exists");
+    }
+
+    return json(200, [&sent](JsonWriter& writer) { io::writeTerm(writer, sent); });
+}
+
+HttpResponse ApiService::deleteTerm(const std::string& id) {
+    auto it = controller_.getTermList().find(id);
+    if (it == controller_.getTermList().end()) {
+        return detail(404, "Term not found");
+    }
+
+    for (const auto& [courseId, course] : it->second.getCourseList()) {
+        for (const auto& [assignmentId, assignment] : course.getAssignmentList()) {
+            assignmentCourses_.erase(assignmentId);
+        }
+        assignmentPages_.eraseParent(courseId);
+        courseTerms_.erase(courseId);
+    }
+    coursePages_.eraseParent(id);
+    termPages_.erase(id);
+
+    controller_.removeRemoteTerm(id);
+    return noContent();
+}
+
+
+// ====================================
+// COURSES
+// ====================================
+
+HttpResponse ApiService::listCourses(const ListQuery& query) const {
+    std::vector<Listed<Course>> items;
+    if (query.paged()) {
+        items = pageOf(query, &coursePages_.all, [this](const std::string& id) {
+            const std::string& termId = courseTerms_.at(id);
+            return Listed<Course>{id, &termId, &controller_.getTermList().at(termId).getCourseList().at(id)};
+        });
+    } else {
+        items.reserve(courseTerms_.size());
+        for (const auto& [termId, term] : controller_.getTermList()) {
+            for (const auto& [id, course] : term.getCourseList()) {
+                items.push_back({id, &termId, &course});
+            }
+        }
+    }
+
+    return listOf(query, items, [](JsonWriter& writer, const Listed<Course>& item) {
+        io::writeCourse(writer, *item.parentId, *item.record);
+    });
+}
+
+// an unknown term has no courses, rather than being an error
+HttpResponse ApiService::listCoursesByTerm(const std::string& termId, const ListQuery& query) const {
+    std::vector<Listed<Course>> items;
+    auto it = controller_.getTermList().find(termId);
+    if (it != controller_.getTermList().end() && query.paged()) {
+        const CourseList& courses = it->second.getCourseList();
+        items = pageOf(query, coursePages_.find(termId), [&termId, &courses](const std::string& id) {
+            return Listed<Course>{id, &termId, &courses.at(id)};
+        });
+    } else if (it != controller_.getTermList().end()) {
+        items.reserve(it->second.getCourseList().size());
+        for (const auto& [id, course] : it->second.getCourseList()) {
+            items.push_back({id, &termId, &course});
+        }
+    }
+
+    return listOf(query, items, [](JsonWriter& writer, const Listed<Course>& item) {
+        io::writeCourse(writer, *item.parentId, *item.record);
+    });
+}
+
+HttpResponse ApiService::getCourse(const std::string& id) const {
+    const Course* course = findCourse(id);
+    if (course == nullptr) {
+        return detail(404, "Course not found");
+    }
+
+    return json(200, [this, course](JsonWriter& writer) { io::writeCourse(writer, courseTerms_.at(course->getId()), *course); });
+}
+
+// every write to a course's assignments recalculates its grade, so the stored one is current
+HttpResponse ApiService::getCourseGrade(const std::string& id) const {
+    const Course* course = findCourse(id);
+    if (course == nullptr) {
+        return detail(404, "Course not found");
+    }
+
+    return json(200, [course](JsonWriter& writer) {
+        writer.startObject();
+        writer.key("course_id");
+        writer.stringValue(course->getId());
+        writer.key("grade_pct");
+        writer.numberValue(course->getGradePct());
+        writer.key("letter_grade");
+        writer.stringValue(course->getLetterGrade());
+        writer.key("gpa_val");
+        writer.numberValue(course->getGpaVal());
+        writer.endObject();
+    });
+}
+
+HttpResponse ApiService::createCourse(std::string_view body) {
+    io::EntityBatch batch = readBody(body, EntityKind::course);
+    requireOne(batch.courses);
+    const auto& [termId, course] = batch.courses.front();
+
+    if (courseTerms_.contains(course.getId())) {
+        return detail(409, "A course with this ID already exists");
+    }
+    if (!controller_.getTermList().contains(termId)) {
+        return detail(400, "Invalid term_id");
+    }
+    if (!applyUnlessTitleTaken([this, &termId, &course]() { controller_.applyRemoteCourse(termId, course); })) {
+        return detail(409, "A course with this title already exists in this term");
+    }
+
+    courseTerms_.emplace(course.getId(), termId);
+    coursePages_.insert(termId, course.getId());
+    return json(201, [&termId, &course](JsonWriter& writer) { io::writeCourse(writer, termId, course); });
+}
+
+// a course stays in its term; the body's term_id is echoed back but not applied, as on the server
+HttpResponse ApiService::updateCourse(const std::string& id, std::string_view body) {
+    io::EntityBatch batch = readBody(body, EntityKind::course);
+    requireOne(batch.courses);
+    const auto& [sentTermId, sent] = batch.courses.front();
+
+    auto owner = courseTerms_.find(id);
+    if (owner == courseTerms_.end()) {
+        return detail(404, "Course not found");
+    }
+
+    Course course = Course::fromRow(id, sent.getTitle(), sent.getDescription(), sent.getStartDate(), sent.getEndDate(),
+        sent.getNumCredits(), sent.getActive());
+    const std::string& termId = owner->second;
+    if (!applyUnlessTitleTaken([this, &termId, &course]() { controller_.applyRemoteCourse(termId, course); })) {
+        return detail(409, "A course with this title already exists in this term");
+    }
+
+    return json(200, [&sentTermId, &sent](JsonWriter& writer) { io::writeCourse(writer, sentTermId, sent); });
+}
+
+HttpResponse ApiService::deleteCourse(const std::string& id) {
+    auto owner = courseTerms_.find(id);
+    if (owner == courseTerms_.end()) {
+        return detail(404, "Course not found");
+    }
+
+    const Course& course = controller_.getTermList().at(owner->second).getCourseList().at(id);
+    for (const auto& [assignmentId, assignment] : course.getAssignmentList()) {
+        assignmentCourses_.erase(assignmentId);
+    }
+    assignmentPages_.eraseParent(id);
+    coursePages_.erase(owner->second, id);
+
+    controller_.removeRemoteCourse(owner->second, id);
+    courseTerms_.erase(owner);
+    return noContent();
+}
+
+
+// ====================================
+// ASSIGNMENTS
+// ====================================
+
+HttpResponse ApiService::listAssignments(const ListQuery& query) const {
+    std::vector<Listed<Assignment>> items;
+    if (query.paged()) {
+        items = pageOf(query, &assignmentPages_.all, [this](const std::string& id) {
+            const std::string& courseId = assignmentCourses_.at(id);
+            return Listed<Assignment>{id, &courseId, &findCourse(courseId)->getAssignmentList().at(id)};
+        });
+    } else {
+        items.reserve(assignmentCourses_.size());
+        for (const auto& [termId, term] : controller_.getTermList()) {
+            for (const auto& [courseId, course] : term.getCourseList()) {
+                for (const auto& [id, assignment] : course.getAssignmentList()) {
+                    items.push_back({id, &courseId, &assignment});
+                }
+            }
+        }
+    }
+
+    return listOf(query, items, [](JsonWriter& writer, const Listed<Assignment>& item) {
+        io::writeAssignment(writer, *item.parentId, *item.record);
+    });
+}
+
+HttpResponse ApiService::listAssignmentsByCourse(const std::string& courseId, const ListQuery& query) const {
+    std::vector<Listed<Assignment>> items;
+    const Course* course = findCourse(courseId);
+    if (course != nullptr && query.paged()) {
+        items = pageOf(query, assignmentPages_.find(courseId), [&courseId, course](const std::string& id) {
+            return Listed<Assignment>{id, &courseId, &course->getAssignmentList().at(id)};
+        });
+    } else if (course != nullptr) {
+        items.reserve(course->getAssignmentList().size());
+        for (const auto& [id, assignment] : course->getAssignmentList()) {
+            items.push_back({id, &courseId, &assignment});
+        }
+    }
+
+    return listOf(query, items, [](JsonWriter& writer, const Listed<Assignment>& item) {
+        io::writeAssignment(writer, *item.parentId, *item.record);
+    });
+}
+
+HttpResponse ApiService::getAssignment(const std::string& id) const {
+    auto owner = assignmentCourses_.find(id);
+    if (owner == assignmentCourses_.end()) {
+        return detail(404, "Assignment not found");
+    }
+
+    const Assignment& assignment = findCourse(owner->second)->getAssignmentList().at(id);
+    return json(200, [&courseId = owner->second, &assignment](JsonWriter& writer) {
+        io::writeAssignment(writer, courseId, assignment);
+    });
+}
+
+HttpResponse ApiService::createAssignment(std::string_view body) {
+    io::EntityBatch batch = readBody(body, EntityKind::assignment);
+    requireOne(batch.assignments);
+    const auto& [courseId, assignment] = batch.assignments.front();
+
+    if (assignmentCourses_.contains(assignment.getId())) {
+        return detail(409, "An assignment with this ID already exists");
+    }
+    auto courseTerm = courseTerms_.find(courseId);
+    if (courseTerm == courseTerms_.end()) {
+        return detail(400, "Invalid course_id");
+    }
+    const std::string& termId = courseTerm->second;
+    if (!applyUnlessTitleTaken([this, &termId, &courseId, &assignment]() {
+        controller_.applyRemoteAssignment(termId, courseId, assignment);
+    })) {
+        return detail(409, "An assignment with this title already exists in this course");
+    }
+
+    assignmentCourses_.emplace(assignment.getId(), courseId);
+    assignmentPages_.insert(courseId, assignment.getId());
+    return json(201, [&courseId, &assignment](JsonWriter& writer) { io::writeAssignment(writer, courseId, assignment); });
+}
+
+// an assignment stays in its course; the body's course_id is echoed back but not applied, as on the server
+HttpResponse ApiService::updateAssignment(const std::string& id, std::string_view body) {
+    io::EntityBatch batch = readBody(body, EntityKind::assignment);
+    requireOne(batch.assignments);
+    const auto& [sentCourseId, sent] = batch.assignments.front();
+
+    auto owner = assignmentCourses_.find(id);
+    if (owner == assignmentCourses_.end()) {
+        return detail(404, "Assignment not found");
+    }
+
+    Assignment assignment = Assignment::fromRow(id, sent.getTitle(), sent.getDescription(), sent.getCategory(),
+        sent.getDueDate(), sent.getCompleted(), sent.getGrade());
+    const std::string& courseId = owner->second;
+    const std::string& termId = courseTerms_.at(courseId);
+    if (!applyUnlessTitleTaken([this, &termId, &courseId, &assignment]() {
+        controller_.applyRemoteAssignment(termId, courseId, assignment);
+    })) {
+        return detail(409, "An assignment with this title already exists in this course");
+    }
+
+    return json(200, [&sentCourseId, &sent](JsonWriter& writer) { io::writeAssignment(writer, sentCourseId, sent); });
+}
+
+HttpResponse ApiService::deleteAssignment(const std::string& id) {
+    auto owner = assignmentCourses_.find(id);
+    if (owner == assignmentCourses_.end()) {
+        return detail(404, "Assignment not found");
+    }
+
+    const std::string& courseId = owner->second;
+    controller_.removeRemoteAssignment(courseTerms_.at(courseId), courseId, id);
+    assignmentPages_.erase(courseId, id);
+    assignmentCourses_.erase(owner);
+    return noContent();
+}
+
+const Course* ApiService::findCourse(const std::string& id) const {
+    auto owner = courseTerms_.find(id);
+    if (owner == courseTerms_.end()) {
+        return nullptr;
+    }
+
+    return &controller_.getTermList().at(owner->second).getCourseList().at(id);
+}
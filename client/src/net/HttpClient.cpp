@@ -0,0 +1,348 @@
+#include "net/HttpClient.hpp"
+
+/**
+ * @file HttpClient.cpp
+ * @brief Implementation of the HttpClient class, a small blocking HTTP/1.1 client for talking to the server.
+ *
+ * Provides implementations only; see HttpClient.hpp for definitions.
+ */
+
+#include <algorithm>        // for search
+#include <cctype>           // for tolower
+#include <cerrno>           // for errno
+#include <charconv>         // for from_chars
+#include <stdexcept>        // for exceptions
+#include <netdb.h>          // for getaddrinfo
+#include <netinet/in.h>     // for IPPROTO_TCP
+#include <netinet/tcp.h>    // for TCP_NODELAY
+#include <sys/socket.h>     // for sockets
+#include <sys/time.h>       // for timeval
+#include <unistd.h>         // for close
+
+namespace {
+    constexpr std::size_t maxLineLength = 64 * 1024;
+
+#ifdef MSG_NOSIGNAL
+    constexpr int sendFlags = MSG_NOSIGNAL;
+#else
+    constexpr int sendFlags = 0;
+#endif
+
+    std::string lower(std::string_view str) {
+        std::string result{str};
+        for (char& c : result) {
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+        return result;
+    }
+
+    std::string_view trim(std::string_view str) {
+        while (!str.empty() && (str.front() == ' ' || str.front() == '\t')) {
+            str.remove_prefix(1);
+        }
+        while (!str.empty() && (str.back() == ' ' || str.back() == '\t')) {
+            str.remove_suffix(1);
+        }
+        return str;
+    }
+
+    // a failure on a reused connection before any response byte arrived, which is worth one retry
+    struct StaleConnection {};
+}
+
+std::string HttpResponse::header(std::string_view name) const {
+    std::string key = lower(name);
+
+    for (const auto& [headerName, value] : headers) {
+        if (headerName == key) {
+            return value;
+        }
+    }
+
+    return "";
+}
+
+HttpClient::HttpClient(std::string host, std::uint16_t port) : host_{std::move(host)}, port_{port} {}
+
+HttpClient::~HttpClient() {
+    disconnect();
+}
+
+void HttpClient::setTimeout(std::chrono::milliseconds timeout) {
+    timeout_ = timeout;
+}
+
+// number of TCP connections opened so far; stays at 1 while keep-alive holds
+std::size_t HttpClient::getConnectionCount() const {
+    return connectionCount_;
+}
+
+void HttpClient::disconnect() {
+    if (socket_ != -1) {
+        ::close(socket_);
+        socket_ = -1;
+    }
+    readBuffer_.clear();
+    readPos_ = 0;
+}
+
+void HttpClient::connect() {
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    addrinfo* addresses = nullptr;
+    std::string port = std::to_string(port_);
+
+    if (::getaddrinfo(host_.c_str(), port.c_str(), &hints, &addresses) != 0) {
+        throw std::runtime_error("Could not resolve host '" + host_ + "'.");
+    }
+
+    for (addrinfo* address = addresses; address != nullptr; address = address->ai_next) {
+        int fd = ::socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+        if (fd == -1) {
+            continue;
+        }
+
+        if (::connect(fd, address->ai_addr, address->ai_addrlen) == 0) {
+            socket_ = fd;
+            break;
+        }
+        ::close(fd);
+    }
+    ::freeaddrinfo(addresses);
+
+    if (socket_ == -1) {
+        throw std::runtime_error("Could not connect to " + host_ + ":" + port + ".");
+    }
+
+    // requests are small and latency-bound, so don't let Nagle hold them back
+    int noDelay = 1;
+    ::setsockopt(socket_, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+#ifdef SO_NOSIGPIPE
+    int noSigPipe = 1;
+    ::setsockopt(socket_, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+
+    auto ms = timeout_.count();
+    timeval tv{};
+    tv.tv_sec = static_cast<decltype(tv.tv_sec)>(ms / 1000);
+    tv.tv_usec = static_cast<decltype(tv.tv_usec)>((ms % 1000) * 1000);
+    ::setsockopt(socket_, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    ::setsockopt(socket_, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+
+    ++connectionCount_;
+}
+
+void HttpClient::sendAll(std::string_view data) {
+    while (!data.empty()) {
+        ssize_t sent = ::send(socket_, data.data(), data.size(), sendFlags);
+        if (sent <= 0) {
+            throw std::runtime_error("Failed to send HTTP request.");
+        }
+        data.remove_prefix(static_cast<std::size_t>(sent));
+    }
+}
+
+// appends whatever the socket has to the read buffer; returns false once the peer has closed
+bool HttpClient::receiveMore() {
+    // drop consumed bytes before growing the buffer
+    if (readPos_ > 0 && readPos_ == readBuffer_.size()) {
+        readBuffer_.clear();
+        readPos_ = 0;
+    } else if (readPos_ > 16 * 1024) {
+        readBuffer_.erase(0, readPos_);
+        readPos_ = 0;
+    }
+
+    char chunk[16 * 1024];
+    ssize_t received = ::recv(socket_, chunk, sizeof(chunk), 0);
+
+    // a reset is reported like an orderly close, so a stale keep-alive connection can be retried
+    if (received < 0 && errno != ECONNRESET) {
+        throw std::runtime_error("Timed out or failed while reading the HTTP response.");
+    }
+    if (received <= 0) {
+        return false;
+    }
+
+    readBuffer_.append(chunk, static_cast<std::size_t>(received));
+    return true;
+}
+
+std::string HttpClient::readLine() {
+    static constexpr std::string_view crlf{"\r\n"};
+
+    while (true) {
+        auto begin = readBuffer_.begin() + static_cast<std::ptrdiff_t>(readPos_);
+        auto found = std::search(begin, readBuffer_.end(), crlf.begin(), crlf.end());
+
+        if (found != readBuffer_.end()) {
+            std::string line{begin, found};
+            readPos_ = static_cast<std::size_t>(found - readBuffer_.begin()) + crlf.size();
+            return line;
+        }
+
+        if (readBuffer_.size() - readPos_ > maxLineLength) {
+            throw std::runtime_error("Malformed HTTP response: line too long.");
+        }
+
+        if (!receiveMore()) {
+            throw std::runtime_error("Connection closed in the middle of the HTTP response.");
+        }
+    }
+}
+
+void HttpClient::readExact(std::string& out, std::size_t count) {
+    while (readBuffer_.size() - readPos_ < count) {
+        if (!receiveMore()) {
+            throw std::runtime_error("Connection closed in the middle of the HTTP response body.");
+        }
+    }
+
+    out.append(readBuffer_, readPos_, count);
+    readPos_ += count;
+}
+
+void HttpClient::readChunkedBody(HttpResponse& response) {
+    while (true) {
+        std::string sizeLine = readLine();
+        std::size_t size = 0;
+        auto result = std::from_chars(sizeLine.data(), sizeLine.data() + sizeLine.size(), size, 16);
+
+        if (result.ec != std::errc{} || result.ptr == sizeLine.data()) {
+            throw std::runtime_error("Malformed HTTP response: bad chunk size.");
+        }
+
+        if (size == 0) {
+            // skip trailers up to the blank line that ends the message
+            while (!readLine().empty()) {}
+            return;
+        }
+
+        readExact(response.body, size);
+        if (!readLine().empty()) {
+            throw std::runtime_error("Malformed HTTP response: missing chunk terminator.");
+        }
+    }
+}
+
+HttpResponse HttpClient::readResponse(std::string_view method) {
+    HttpResponse response;
+
+    // skip interim 1xx responses
+    do {
+        std::string statusLine = readLine();
+
+        if (statusLine.size() < 12 || statusLine.compare(0, 5, "HTTP/") != 0) {
+            throw std::runtime_error("Malformed HTTP response: bad status line.");
+        }
+
+        auto result = std::from_chars(statusLine.data() + 9, statusLine.data() + 12, response.status);
+        if (result.ec != std::errc{} || result.ptr != statusLine.data() + 12) {
+            throw std::runtime_error("Malformed HTTP response: bad status code.");
+        }
+
+        response.headers.clear();
+        for (std::string line = readLine(); !line.empty(); line = readLine()) {
+            std::size_t colon = line.find(':');
+            if (colon == std::string::npos) {
+                throw std::runtime_error("Malformed HTTP response: bad header line.");
+            }
+            response.headers.emplace_back(lower(std::string_view{line}.substr(0, colon)),
+                std::string{trim(std::string_view{line}.substr(colon + 1))});
+        }
+    } while (response.status >= 100 && response.status < 200);
+
+    bool noBody = method == "HEAD" || response.status == 204 || response.status == 304;
+    std::string transferEncoding = lower(response.header("transfer-encoding"));
+    std::string contentLength = response.header("content-length");
+    bool closeAfter = lower(response.header("connection")) == "close";
+
+    if (noBody) {
+        // nothing to read
+    } else if (transferEncoding.find("chunked") != std::string::npos) {
+        readChunkedBody(response);
+    } else if (!contentLength.empty()) {
+        std::size_t length = 0;
+        auto result = std::from_chars(contentLength.data(), contentLength.data() + contentLength.size(), length);
+        if (result.ec != std::errc{} || result.ptr != contentLength.data() + contentLength.size()) {
+            throw std::runtime_error("Malformed HTTP response: bad Content-Length.");
+        }
+        response.body.reserve(length);
+        readExact(response.body, length);
+    } else {
+        // no framing, so the body runs until the server closes the connection
+        while (receiveMore()) {}
+        response.body.append(readBuffer_, readPos_);
+        readPos_ = readBuffer_.size();
+        closeAfter = true;
+    }
+
+    if (closeAfter) {
+        disconnect();
+    }
+
+    return response;
+}
+
+// sends one request and waits for its response; a request on a connection the server already closed
+// is retried once on a fresh connection
+HttpResponse HttpClient::request(std::string_view method, std::string_view target, std::string_view body,
+    const std::vector<std::pair<std::string, std::string>>& headers) {
+    std::string message;
+    message.reserve(128 + target.size() + body.size());
+    message.append(method).append(" ").append(target).append(" HTTP/1.1\r\n");
+    message.append("Host: ").append(host_).append(":").append(std::to_string(port_)).append("\r\n");
+
+    bool hasContentType = false;
+    for (const auto& [name, value] : headers) {
+        hasContentType = hasContentType || lower(name) == "content-type";
+        message.append(name).append(": ").append(value).append("\r\n");
+    }
+
+    if (!body.empty() || method == "POST" || method == "PUT") {
+        if (!hasContentType) {
+            message.append("Content-Type: application/json\r\n");
+        }
+        message.append("Content-Length: ").append(std::to_string(body.size())).append("\r\n");
+    }
+    message.append("\r\n").append(body);
+
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        bool reused = (socket_ != -1);
+
+        if (!reused) {
+            connect();
+        }
+
+        try {
+            try {
+                sendAll(message);
+            } catch (const std::runtime_error&) {
+                if (!reused) {
+                    throw;
+                }
+                throw StaleConnection{};
+            }
+
+            // the server closed an idle connection without reading the request
+            if (readBuffer_.size() == readPos_ && !receiveMore()) {
+                throw StaleConnection{};
+            }
+
+            return readResponse(method);
+        } catch (const StaleConnection&) {
+            disconnect();
+            if (!reused) {
+                throw std::runtime_error("Connection closed before the HTTP response.");
+            }
+        } catch (...) {
+            disconnect();
+            throw;
+        }
+    }
+
+    throw std::runtime_error("Connection closed before the HTTP response.");
+}
@@ -0,0 +1,563 @@
+#include "net/HttpServer.hpp"
+
+/**
+ * @file HttpServer.cpp
+ * @brief Implementation of the HttpServer class, a single-threaded HTTP/1.1 server built on epoll.
+ *
+ * Connections are registered level-triggered. A readable connection is drained into its read buffer,
+ * then every complete request in the buffer is answered before anything is sent, so pipelined requests
+ * go back in one write. Output the socket won't take yet stays in the connection's write buffer and the
+ * connection waits for EPOLLOUT; past maxPendingOutput, or once the peer has closed its side, it stops waiting
+ * for EPOLLIN as well until the backlog has drained. stop() writes to an eventfd the loop also waits on.
+ *
+ * The listening socket is level-triggered too, so a backlog the server can't accept from for want of a file
+ * descriptor would wake the loop again at once. A descriptor on /dev/null is kept in reserve for that: it is
+ * closed to accept the oldest pending connection, which is closed straight away, and then reopened. If there
+ * is no spare to give up, the listening socket leaves the epoll set until a connection closes.
+ *
+ * Provides implementations only; see HttpServer.hpp for definitions.
+ */
+
+#include <array>            // for event lists
+#include <cctype>           // for tolower
+#include <cerrno>           // for errno
+#include <charconv>         // for from_chars and to_chars
+#include <cstring>          // for strerror
+#include <fcntl.h>          // for open
+#include <stdexcept>        // for exceptions
+#include <netdb.h>          // for getaddrinfo
+#include <netinet/in.h>     // for sockaddr_in and IPPROTO_TCP
+#include <netinet/tcp.h>    // for TCP_NODELAY
+#include <sys/epoll.h>      // for epoll
+#include <sys/eventfd.h>    // for the wake-up descriptor
+#include <sys/socket.h>     // for sockets
+#include <unistd.h>         // for close
+
+namespace {
+    constexpr std::size_t readChunk = 16 * 1024;
+    constexpr int maxEvents = 256;
+
+    bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+        if (a.size() != b.size()) {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            if (std::tolower(static_cast<unsigned char>(a[i])) != std::tolower(static_cast<unsigned char>(b[i]))) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::string_view trim(std::string_view str) {
+        while (!str.empty() && (str.front() == ' ' || str.front() == '\t')) {
+            str.remove_prefix(1);
+        }
+        while (!str.empty() && (str.back() == ' ' || str.back() == '\t')) {
+            str.remove_suffix(1);
+        }
+        return str;
+    }
+
+    std::string_view reasonPhrase(int status) {
+        switch (status) {
+            case 100: return "Continue";
+            case 200: return "OK";
+            case 201: return "Created";
+            case 204: return "No Content";
+            case 304: return "Not Modified";
+            case 400: return "Bad Request";
+            case 404: return "Not Found";
+            case 405: return "Method Not Allowed";
+            case 409: return "Conflict";
+            case 412: return "Precondition Failed";
+            case 413: return "Content Too Large";
+            case 422: return "Unprocessable Content";
+            case 431: return "Request Header Fields Too Large";
+            case 500: return "Internal Server Error";
+            case 501: return "Not Implemented";
+            default:  return "Unknown";
+        }
+    }
+
+    void appendNumber(std::string& out, std::size_t value) {
+        char digits[20];
+        auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        out.append(digits, result.ptr);
+    }
+
+    [[noreturn]] void throwSystemError(const std::string& what) {
+        throw std::runtime_error(what + ": " + std::strerror(errno));
+    }
+}
+
+std::string_view HttpRequest::header(std::string_view name) const {
+    for (const auto& [headerName, value] : headers) {
+        if (equalsIgnoreCase(headerName, name)) {
+            return value;
+        }
+    }
+
+    return {};
+}
+
+HttpServer::HttpServer(const std::string& host, std::uint16_t port, Handler handler) : handler_{std::move(handler)} {
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE;
+
+    addrinfo* addresses = nullptr;
+    std::string service = std::to_string(port);
+
+    if (::getaddrinfo(host.empty() ? nullptr : host.c_str(), service.c_str(), &hints, &addresses) != 0) {
+        throw std::runtime_error("Could not resolve host '" + host + "'.");
+    }
+
+    for (addrinfo* address = addresses; address != nullptr && listenFd_ == -1; address = address->ai_next) {
+        int fd = ::socket(address->ai_family, address->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, address->ai_protocol);
+        if (fd == -1) {
+            continue;
+        }
+
+        int reuse = 1;
+        ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        if (::bind(fd, address->ai_addr, address->ai_addrlen) == 0 && ::listen(fd, SOMAXCONN) == 0) {
+            listenFd_ = fd;
+        } else {
+            ::close(fd);
+        }
+    }
+    ::freeaddrinfo(addresses);
+
+    if (listenFd_ == -1) {
+        throwSystemError("Could not listen on " + host + ":" + service);
+    }
+
+    sockaddr_storage bound{};
+    socklen_t length = sizeof(bound);
+    ::getsockname(listenFd_, reinterpret_cast<sockaddr*>(&bound), &length);
+    port_ = ntohs(bound.ss_family == AF_INET6 ? reinterpret_cast<sockaddr_in6*>(&bound)->sin6_port
+        : reinterpret_cast<sockaddr_in*>(&bound)->sin_port);
+
+    epollFd_ = ::epoll_create1(EPOLL_CLOEXEC);
+    wakeFd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if (epollFd_ == -1 || wakeFd_ == -1) {
+        int error = errno;
+        ::close(listenFd_);
+        if (epollFd_ != -1) {
+            ::close(epollFd_);
+        }
+        if (wakeFd_ != -1) {
+            ::close(wakeFd_);
+        }
+        errno = error;
+        throwSystemError("Could not start the event loop");
+    }
+
+    for (int fd : {listenFd_, wakeFd_}) {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        ::epoll_ctl(epollFd_, EPOLL_CTL_ADD, fd, &event);
+    }
+
+    spareFd_ = ::open("/dev/null", O_RDONLY | O_CLOEXEC);     // without one, refuse() just stops listening
+}
+
+HttpServer::~HttpServer() {
+    for (std::unique_ptr<Connection>& connection : connections_) {
+        if (connection != nullptr) {
+            ::close(connection->fd);
+        }
+    }
+
+    if (spareFd_ != -1) {
+        ::close(spareFd_);
+    }
+    ::close(wakeFd_);
+    ::close(epollFd_);
+    ::close(listenFd_);
+}
+
+std::uint16_t HttpServer::getPort() const {
+    return port_;
+}
+
+std::size_t HttpServer::getConnectionCount() const {
+    return connectionCount_.load();
+}
+
+void HttpServer::run() {
+    std::array<epoll_event, maxEvents> events{};
+
+    while (true) {
+        int ready = ::epoll_wait(epollFd_, events.data(), maxEvents, -1);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throwSystemError("Event loop failed");
+        }
+
+        for (int i = 0; i < ready; ++i) {
+            int fd = events[i].data.fd;
+            std::uint32_t happened = events[i].events;
+
+            if (fd == wakeFd_) {
+                std::uint64_t count = 0;
+                [[maybe_unused]] ssize_t ignored = ::read(wakeFd_, &count, sizeof(count));
+                return;
+            }
+            if (fd == listenFd_) {
+                accept();
+                continue;
+            }
+
+            // closed earlier in this batch
+            if (static_cast<std::size_t>(fd) >= connections_.size() || connections_[fd] == nullptr) {
+                continue;
+            }
+
+            Connection& connection = *connections_[fd];
+            if (happened & (EPOLLERR | EPOLLHUP)) {
+                close(connection);
+            } else if (happened & EPOLLIN) {
+                read(connection);
+            } else if (happened & EPOLLOUT) {
+                flush(connection);
+            }
+        }
+    }
+}
+
+void HttpServer::stop() {
+    std::uint64_t one = 1;
+    [[maybe_unused]] ssize_t ignored = ::write(wakeFd_, &one, sizeof(one));
+}
+
+void HttpServer::accept() {
+    while (true) {
+        int fd = ::accept4(listenFd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd == -1) {
+            if (errno == EINTR || errno == ECONNABORTED || ((errno == EMFILE || errno == ENFILE) && refuse())) {
+                continue;
+            }
+            return;     // EAGAIN once the backlog is empty
+        }
+
+        // responses are small and latency-bound, so don't let Nagle hold them back
+        int noDelay = 1;
+        ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+        if (static_cast<std::size_t>(fd) >= connections_.size()) {
+            connections_.resize(static_cast<std::size_t>(fd) + 1);
+        }
+        connections_[fd] = std::make_unique<Connection>();
+        connections_[fd]->fd = fd;
+        connections_[fd]->events = EPOLLIN;
+
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        ::epoll_ctl(epollFd_, EPOLL_CTL_ADD, fd, &event);
+        ++connectionCount_;
+    }
+}
+
+// turns away the oldest pending connection when there is no descriptor to accept it with; false once the backlog is
+// empty, or if there was no spare to do it with, in which case the listening socket waits for a connection to close
+bool HttpServer::refuse() {
+    if (spareFd_ != -1) {
+        ::close(spareFd_);
+        int fd = ::accept4(listenFd_, nullptr, nullptr, SOCK_CLOEXEC);
+        int error = errno;
+        if (fd != -1) {
+            ::close(fd);
+        }
+        spareFd_ = ::open("/dev/null", O_RDONLY | O_CLOEXEC);
+
+        if (fd != -1) {
+            return true;
+        }
+        if (error != EMFILE && error != ENFILE) {
+            return false;
+        }
+    }
+
+    ::epoll_ctl(epollFd_, EPOLL_CTL_DEL, listenFd_, nullptr);
+    listening_ = false;
+    return false;
+}
+
+// takes what the socket has, up to one largest request's worth of unparsed input, then answers whatever requests
+// it completed; anything left is read once those are parsed, or once parse has failed an oversized one
+void HttpServer::read(Connection& connection) {
+    if (connection.inPos == connection.in.size()) {
+        connection.in.clear();
+        connection.inPos = 0;
+    } else if (connection.inPos > readChunk) {
+        connection.in.erase(0, connection.inPos);
+        connection.inPos = 0;
+    }
+
+    char chunk[readChunk];
+    while (true) {
+        ssize_t received = ::recv(connection.fd, chunk, sizeof(chunk), 0);
+
+        if (received > 0) {
+            connection.in.append(chunk, static_cast<std::size_t>(received));
+            if (static_cast<std::size_t>(received) < sizeof(chunk)
+                || connection.in.size() - connection.inPos > maxHeaderSize + maxBodySize) {
+                break;
+            }
+        } else if (received == 0) {
+            connection.peerClosed = true;
+            break;
+        } else if (errno == EINTR) {
+            continue;
+        } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            break;
+        } else {
+            close(connection);
+            return;
+        }
+    }
+
+    flush(connection);
+}
+
+// answers buffered requests and sends, until the input runs out, the socket is full or the connection is done
+void HttpServer::flush(Connection& connection) {
+    while (true) {
+        bool paused = !connection.closing && parse(connection);
+
+        while (connection.outPos < connection.out.size()) {
+            ssize_t sent = ::send(connection.fd, connection.out.data() + connection.outPos,
+                connection.out.size() - connection.outPos, MSG_NOSIGNAL);
+
+            if (sent > 0) {
+                connection.outPos += static_cast<std::size_t>(sent);
+            } else if (sent < 0 && errno == EINTR) {
+                continue;
+            } else if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                // a peer that has shut down its side stays readable at EOF, so waiting for EPOLLIN would spin
+                watch(connection, paused || connection.peerClosed ? EPOLLOUT : EPOLLIN | EPOLLOUT);
+                return;
+            } else {
+                close(connection);
+                return;
+            }
+        }
+
+        connection.out.clear();
+        connection.outPos = 0;
+
+        if (connection.closing) {
+            close(connection);
+            return;
+        }
+        if (paused) {
+            continue;
+        }
+        if (connection.peerClosed) {
+            close(connection);      // whatever is left is a request that can never be completed
+            return;
+        }
+        break;
+    }
+
+    watch(connection, EPOLLIN);
+}
+
+// answers every complete request in the read buffer; true if it stopped because too much output is waiting
+bool HttpServer::parse(Connection& connection) {
+    static constexpr std::string_view crlf{"\r\n"};
+
+    while (!connection.closing) {
+        if (connection.out.size() - connection.outPos > maxPendingOutput) {
+            return true;
+        }
+
+        std::string_view data{connection.in};
+        data.remove_prefix(connection.inPos);
+
+        std::size_t headerEnd = data.find("\r\n\r\n");
+        if (headerEnd == std::string_view::npos) {
+            if (data.size() > maxHeaderSize) {
+                fail(connection, 431, "Request header fields too large");
+            }
+            return false;
+        }
+        if (headerEnd > maxHeaderSize) {
+            fail(connection, 431, "Request header fields too large");
+            return false;
+        }
+
+        std::string_view head = data.substr(0, headerEnd);
+        std::size_t lineEnd = head.find(crlf);
+        std::string_view requestLine = head.substr(0, lineEnd);
+        std::size_t firstSpace = requestLine.find(' ');
+        std::size_t lastSpace = requestLine.rfind(' ');
+
+        if (firstSpace == std::string_view::npos || firstSpace == lastSpace || firstSpace == 0) {
+            fail(connection, 400, "Malformed request line");
+            return false;
+        }
+
+        std::string_view version = requestLine.substr(lastSpace + 1);
+        if (version != "HTTP/1.1" && version != "HTTP/1.0") {
+            fail(connection, 400, "Unsupported HTTP version");
+            return false;
+        }
+
+        request_.method = requestLine.substr(0, firstSpace);
+        request_.target = requestLine.substr(firstSpace + 1, lastSpace - firstSpace - 1);
+        request_.headers.clear();
+        request_.body = {};
+
+        bool malformed = request_.target.empty() || request_.target.front() != '/';
+        std::string_view rest = lineEnd == std::string_view::npos ? std::string_view{} : head.substr(lineEnd + crlf.size());
+        while (!rest.empty() && !malformed) {
+            std::size_t end = rest.find(crlf);
+            std::string_view line = rest.substr(0, end);
+            rest = end == std::string_view::npos ? std::string_view{} : rest.substr(end + crlf.size());
+
+            std::size_t colon = line.find(':');
+            if (colon == std::string_view::npos || colon == 0 || line.substr(0, colon).find_first_of(" \t") != std::string_view::npos) {
+                malformed = true;
+                break;
+            }
+            request_.headers.emplace_back(line.substr(0, colon), trim(line.substr(colon + 1)));
+        }
+        if (malformed) {
+            fail(connection, 400, "Malformed request");
+            return false;
+        }
+
+        if (!request_.header("transfer-encoding").empty()) {
+            fail(connection, 501, "Transfer-Encoding is not supported; send Content-Length");
+            return false;
+        }
+
+        std::size_t contentLength = 0;
+        std::string_view lengthHeader = request_.header("content-length");
+        if (!lengthHeader.empty()) {
+            auto result = std::from_chars(lengthHeader.data(), lengthHeader.data() + lengthHeader.size(), contentLength);
+            if (result.ec != std::errc{} || result.ptr != lengthHeader.data() + lengthHeader.size()) {
+                fail(connection, 400, "Malformed Content-Length");
+                return false;
+            }
+        }
+        if (contentLength > maxBodySize) {
+            fail(connection, 413, "Request body too large");
+            return false;
+        }
+
+        std::size_t total = headerEnd + 4 + contentLength;
+        if (data.size() < total) {
+            if (!connection.continueSent && equalsIgnoreCase(request_.header("expect"), "100-continue")) {
+                connection.out.append("HTTP/1.1 100 Continue\r\n\r\n");
+                connection.continueSent = true;
+            }
+            return false;
+        }
+        request_.body = data.substr(headerEnd + 4, contentLength);
+
+        std::string_view connectionHeader = request_.header("connection");
+        bool closeAfter = version == "HTTP/1.1" ? equalsIgnoreCase(connectionHeader, "close")
+            : !equalsIgnoreCase(connectionHeader, "keep-alive");
+
+        HttpResponse response;
+        try {
+            response = handler_(request_);
+        } catch (const std::exception&) {
+            response = HttpResponse{500, {}, "{\"detail\":\"Internal Server Error\"}"};
+        }
+
+        connection.inPos += total;
+        connection.continueSent = false;
+        respond(connection, response, closeAfter);
+    }
+
+    return false;
+}
+
+void HttpServer::watch(Connection& connection, std::uint32_t events) {
+    if (connection.events == events) {
+        return;
+    }
+
+    epoll_event event{};
+    event.events = events;
+    event.data.fd = connection.fd;
+    ::epoll_ctl(epollFd_, EPOLL_CTL_MOD, connection.fd, &event);
+    connection.events = events;
+}
+
+// appends a response to the connection's write buffer; bodies are JSON unless the handler says otherwise
+void HttpServer::respond(Connection& connection, const HttpResponse& response, bool close) {
+    std::string& out = connection.out;
+    bool hasBody = response.status != 204 && response.status != 304;
+
+    out.append("HTTP/1.1 ");
+    appendNumber(out, static_cast<std::size_t>(response.status));
+    out.append(" ").append(reasonPhrase(response.status)).append("\r\n");
+
+    bool hasContentType = false;
+    for (const auto& [name, value] : response.headers) {
+        hasContentType = hasContentType || equalsIgnoreCase(name, "content-type");
+        out.append(name).append(": ").append(value).append("\r\n");
+    }
+
+    if (hasBody) {
+        if (!hasContentType) {
+            out.append("Content-Type: application/json\r\n");
+        }
+        out.append("Content-Length: ");
+        appendNumber(out, response.body.size());
+        out.append("\r\n");
+    }
+    if (close) {
+        out.append("Connection: close\r\n");
+        connection.closing = true;
+    }
+    out.append("\r\n");
+
+    if (hasBody) {
+        out.append(response.body);
+    }
+}
+
+// answers a request that can't be served and closes the connection after it, since where the next request
+// starts is no longer known
+void HttpServer::fail(Connection& connection, int status, std::string_view detail) {
+    HttpResponse response{status, {}, {}};
+    response.body.append("{\"detail\":\"").append(detail).append("\"}");
+    respond(connection, response, true);
+}
+
+void HttpServer::close(Connection& connection) {
+    int fd = connection.fd;
+
+    ::epoll_ctl(epollFd_, EPOLL_CTL_DEL, fd, nullptr);
+    ::close(fd);
+    connections_[fd].reset();
+    --connectionCount_;
+
+    // a descriptor has come free, so connections can be taken again
+    if (spareFd_ == -1) {
+        spareFd_ = ::open("/dev/null", O_RDONLY | O_CLOEXEC);
+    }
+    if (!listening_) {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = listenFd_;
+        ::epoll_ctl(epollFd_, EPOLL_CTL_ADD, listenFd_, &event);
+        listening_ = true;
+    }
+}
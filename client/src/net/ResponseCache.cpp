@@ -0,0 +1,55 @@
+#include "net/ResponseCache.hpp"
+
+/**
+ * @file ResponseCache.cpp
+ * @brief Implementation of the ResponseCache class, which revalidates stored GET responses by their ETag.
+ *
+ * Provides implementations only; see ResponseCache.hpp for definitions.
+ */
+
+#include <utility>          // for move
+
+HttpResponse ResponseCache::get(HttpClient& client, const std::string& target) {
+    auto it = entries_.find(target);
+    if (it == entries_.end()) {
+        HttpResponse response = client.request("GET", target);
+        if (response.status == 200 && !response.header("etag").empty()) {
+            entries_.emplace(target, response);
+        }
+        return response;
+    }
+
+    HttpResponse response = client.request("GET", target, {}, {{"If-None-Match", it->second.header("etag")}});
+
+    if (response.status == 304) {
+        ++hitCount_;
+        response.headers = it->second.headers;
+        response.body = it->second.body;
+    } else if (response.status == 200 && !response.header("etag").empty()) {
+        it->second = response;
+    } else {
+        entries_.erase(it);
+    }
+
+    return response;
+}
+
+bool ResponseCache::contains(const std::string& target) const {
+    return entries_.contains(target);
+}
+
+void ResponseCache::erase(const std::string& target) {
+    entries_.erase(target);
+}
+
+void ResponseCache::clear() {
+    entries_.clear();
+}
+
+std::size_t ResponseCache::size() const {
+    return entries_.size();
+}
+
+std::size_t ResponseCache::getHitCount() const {
+    return hitCount_;
+}
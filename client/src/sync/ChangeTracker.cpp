@@ -0,0 +1,253 @@
+#include "sync/ChangeTracker.hpp"
+
+/**
+ * @file ChangeTracker.cpp
+ * @brief Implementation of the ChangeTracker class, which records which entities changed since the last sync.
+ *
+ * Provides implementations only; see ChangeTracker.hpp for definitions.
+ */
+
+#include <algorithm>        // for sort
+#include <tuple>            // for tie
+
+namespace {
+    // parents are created before their children, and children are removed before their parents
+    int kindRank(EntityKind kind, bool removed) {
+        int rank = static_cast<int>(kind);
+        return removed ? -rank : rank;
+    }
+}
+
+// bumps the version of an entity, creating its entry on first use
+ChangeTracker::Entry& ChangeTracker::touch(EntityKind kind, const std::string& id, const std::string& parentId) {
+    Node& node = *entries_.try_emplace(id).first;
+    Entry& entry = node.second;
+    bool wasPending = entry.version != entry.syncedVersion;
+
+    entry.kind = kind;
+    link(node, parentId);
+    entry.sequence = nextSequence_++;
+    ++entry.version;
+
+    if (!wasPending) {
+        ++pendingCount_;
+    }
+
+    return entry;
+}
+
+// files an entity under its parent, moving it if it was filed under another
+void ChangeTracker::link(Node& node, const std::string& parentId) {
+    Entry& entry = node.second;
+
+    if (entry.parentId == parentId) {
+        return;
+    }
+
+    unlink(node);
+    entry.parentId = parentId;
+
+    if (!parentId.empty()) {
+        std::vector<Node*>& siblings = children_[parentId];
+        entry.childSlot = siblings.size();
+        siblings.push_back(&node);
+    }
+}
+
+// takes an entity out of its parent's children by moving the last sibling into its slot
+void ChangeTracker::unlink(Node& node) {
+    Entry& entry = node.second;
+
+    if (entry.parentId.empty()) {
+        return;
+    }
+
+    auto it = children_.find(entry.parentId);
+    std::vector<Node*>& siblings = it->second;
+    Node* last = siblings.back();
+    siblings[entry.childSlot] = last;
+    last->second.childSlot = entry.childSlot;
+    siblings.pop_back();
+
+    if (siblings.empty()) {
+        children_.erase(it);
+    }
+    entry.parentId.clear();
+}
+
+// drops one entity, keeping the pending count and its parent's children in step
+void ChangeTracker::erase(std::unordered_map<std::string, Entry>::iterator it) {
+    if (it->second.version != it->second.syncedVersion) {
+        --pendingCount_;
+    }
+    unlink(*it);
+    entries_.erase(it);
+}
+
+// drops the entries of every descendant; the server deletes them along with their parent
+void ChangeTracker::forgetChildren(const std::string& parentId) {
+    auto it = children_.find(parentId);
+
+    if (it == children_.end()) {
+        return;
+    }
+
+    std::vector<Node*> children = std::move(it->second);
+    children_.erase(it);
+
+    for (Node* child : children) {
+        if (child->second.kind != EntityKind::assignment) {
+            forgetChildren(child->first);
+        }
+        if (child->second.version != child->second.syncedVersion) {
+            --pendingCount_;
+        }
+        entries_.erase(entries_.find(child->first));
+    }
+}
+
+void ChangeTracker::recordUpsert(EntityKind kind, const std::string& id, const std::string& parentId) {
+    Entry& entry = touch(kind, id, parentId);
+    entry.removed = false;
+}
+
+void ChangeTracker::recordRemoval(EntityKind kind, const std::string& id, const std::string& parentId) {
+    // assignments have nothing under them
+    if (kind != EntityKind::assignment) {
+        forgetChildren(id);
+    }
+
+    auto it = entries_.find(id);
+
+    // created and removed between syncs, so the server never needs to hear about it
+    if (it != entries_.end() && !it->second.onServer) {
+        erase(it);
+        return;
+    }
+
+    // entities that were never tracked may already be on the server, so they are deleted there too
+    bool known = (it != entries_.end());
+    Entry& entry = touch(kind, id, parentId);
+    entry.removed = true;
+    if (!known) {
+        entry.onServer = true;
+    }
+}
+
+// notes an entity that came from the server, so it is known there and has nothing to send
+void ChangeTracker::recordRemote(EntityKind kind, const std::string& id, const std::string& parentId) {
+    Node& node = *entries_.try_emplace(id).first;
+    Entry& entry = node.second;
+
+    if (entry.version != entry.syncedVersion) {
+        --pendingCount_;
+    }
+
+    entry.kind = kind;
+    link(node, parentId);
+    entry.syncedVersion = entry.version;
+    entry.removed = false;
+    entry.onServer = true;
+}
+
+// drops an entity the server no longer has, along with everything under it; nothing is left to send
+void ChangeTracker::forget(EntityKind kind, const std::string& id) {
+    if (kind != EntityKind::assignment) {
+        forgetChildren(id);
+    }
+
+    auto it = entries_.find(id);
+    if (it != entries_.end()) {
+        erase(it);
+    }
+}
+
+// clears the dirty flag if the entity has not changed again since the synced version was read
+void ChangeTracker::markSynced(const std::string& id, std::uint64_t version) {
+    auto it = entries_.find(id);
+
+    if (it == entries_.end()) {
+        return;
+    }
+
+    Entry& entry = it->second;
+
+    if (entry.version != version) {
+        entry.onServer = true;
+        return;
+    }
+
+    if (entry.removed) {
+        erase(it);
+        return;
+    }
+
+    if (entry.version != entry.syncedVersion) {
+        --pendingCount_;
+    }
+
+    entry.syncedVersion = version;
+    entry.onServer = true;
+}
+
+void ChangeTracker::clear() {
+    entries_.clear();
+    children_.clear();
+    pendingCount_ = 0;
+}
+
+void ChangeTracker::reserve(std::size_t count) {
+    entries_.reserve(entries_.size() + count);
+}
+
+bool ChangeTracker::isDirty(const std::string& id) const {
+    auto it = entries_.find(id);
+    return it != entries_.end() && it->second.version != it->second.syncedVersion;
+}
+
+bool ChangeTracker::isOnServer(const std::string& id) const {
+    auto it = entries_.find(id);
+    return it != entries_.end() && it->second.onServer;
+}
+
+std::uint64_t ChangeTracker::getVersion(const std::string& id) const {
+    auto it = entries_.find(id);
+    return it == entries_.end() ? 0 : it->second.version;
+}
+
+std::size_t ChangeTracker::getPendingCount() const {
+    return pendingCount_;
+}
+
+// returns one change per dirty entity: removals first (children before parents), then creates and
+// updates (parents before children), each group in the order the edits were made
+std::vector<EntityChange> ChangeTracker::getPendingChanges() const {
+    std::vector<std::pair<std::uint64_t, EntityChange>> pending;
+    pending.reserve(pendingCount_);
+
+    for (const auto& [id, entry] : entries_) {
+        if (entry.version == entry.syncedVersion) {
+            continue;
+        }
+        pending.emplace_back(entry.sequence,
+            EntityChange{entry.kind, id, entry.parentId, entry.version, entry.removed, entry.onServer});
+    }
+
+    std::sort(pending.begin(), pending.end(), [](const auto& a, const auto& b) {
+        if (a.second.removed != b.second.removed) {
+            return a.second.removed;
+        }
+
+        int rankA = kindRank(a.second.kind, a.second.removed);
+        int rankB = kindRank(b.second.kind, b.second.removed);
+        return std::tie(rankA, a.first) < std::tie(rankB, b.first);
+    });
+
+    std::vector<EntityChange> changes;
+    changes.reserve(pending.size());
+    for (auto& [sequence, change] : pending) {
+        changes.push_back(std::move(change));
+    }
+
+    return changes;
+}
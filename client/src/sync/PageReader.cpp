@@ -0,0 +1,99 @@
+#include "sync/PageReader.hpp"
+
+/**
+ * @file PageReader.cpp
+ * @brief Implementation of the PageReader class, which reads one of the server's list routes a page at a time.
+ *
+ * Provides implementations only; see PageReader.hpp for definitions.
+ */
+
+#include <sstream>          // for page bodies
+#include <stdexcept>        // for exceptions
+#include <utility>          // for move
+
+namespace {
+    // percent-encodes everything but RFC 3986's unreserved characters, for an id in a query string
+    std::string encodeParameter(std::string_view value) {
+        static constexpr char digits[] = "0123456789ABCDEF";
+        std::string encoded;
+        encoded.reserve(value.size());
+
+        for (unsigned char c : value) {
+            bool unreserved = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9')
+                || c == '-' || c == '.' || c == '_' || c == '~';
+            if (unreserved) {
+                encoded.push_back(static_cast<char>(c));
+            } else {
+                encoded.push_back('%');
+                encoded.push_back(digits[c >> 4]);
+                encoded.push_back(digits[c & 0xf]);
+            }
+        }
+        return encoded;
+    }
+
+    std::size_t countOf(const io::EntityBatch& page, EntityKind kind) {
+        switch (kind) {
+            case EntityKind::term:       return page.terms.size();
+            case EntityKind::course:     return page.courses.size();
+            case EntityKind::assignment: return page.assignments.size();
+        }
+        return 0;
+    }
+
+    // pages are in id order, so the last record read is where the next page starts
+    std::string lastIdOf(const io::EntityBatch& page, EntityKind kind) {
+        switch (kind) {
+            case EntityKind::term:       return page.terms.back().getId();
+            case EntityKind::course:     return page.courses.back().second.getId();
+            case EntityKind::assignment: return page.assignments.back().second.getId();
+        }
+        return "";
+    }
+}
+
+PageReader::PageReader(HttpClient& client, std::string target, EntityKind kind, std::size_t limit)
+    : client_{client}, target_{std::move(target)}, kind_{kind}, limit_{limit} {
+    if (limit_ < 1 || limit_ > 1000) {
+        throw std::invalid_argument("Page limit must be from 1 to 1000.");
+    }
+}
+
+bool PageReader::next(io::EntityBatch& page) {
+    page = io::EntityBatch{};
+    if (done_) {
+        return false;
+    }
+
+    std::string target = pageTarget();
+    ++requestCount_;
+    HttpResponse response = client_.request("GET", target);
+    if (response.status < 200 || response.status >= 300) {
+        throw std::runtime_error("GET " + target + ": HTTP " + std::to_string(response.status) + " " + response.body);
+    }
+
+    std::istringstream is{response.body};
+    page = io::readRecords(is, kind_);
+
+    std::size_t count = countOf(page, kind_);
+    done_ = count < limit_;
+    if (count == 0) {
+        return false;
+    }
+
+    after_ = lastIdOf(page, kind_);
+    return true;
+}
+
+std::size_t PageReader::getRequestCount() const {
+    return requestCount_;
+}
+
+std::string PageReader::pageTarget() const {
+    std::string target = target_;
+    target.append(target.find('?') == std::string::npos ? "?" : "&").append("limit=").append(std::to_string(limit_));
+    if (!after_.empty()) {
+        target.append("&after=").append(encodeParameter(after_));
+    }
+    return target;
+}
@@ -0,0 +1,444 @@
+#include "sync/SyncEngine.hpp"
+
+/**
+ * @file SyncEngine.cpp
+ * @brief Implementation of the SyncEngine class, which pushes local changes to the server as deltas.
+ *
+ * Provides implementations only; see SyncEngine.hpp for definitions.
+ */
+
+#include <sstream>          // for request and response bodies
+#include <stdexcept>        // for exceptions
+#include <unordered_set>    // for failed parents, dropped entities and pulled ids
+#include <utility>          // for pairs of ids
+#include <vector>           // for entities to remove
+#include "io/EntityJson.hpp"
+#include "io/JsonWriter.hpp"
+#include "sync/PageReader.hpp"
+
+namespace {
+    std::string collection(EntityKind kind) {
+        switch (kind) {
+            case EntityKind::term:       return "/terms";
+            case EntityKind::course:     return "/courses";
+            case EntityKind::assignment: return "/assignments";
+        }
+        return "";
+    }
+
+    bool isSuccess(int status) {
+        return status >= 200 && status < 300;
+    }
+
+    std::string describe(std::string_view method, const std::string& target, const HttpResponse& response) {
+        std::string message = std::string{method} + " " + target + ": HTTP " + std::to_string(response.status);
+        if (!response.body.empty()) {
+            message += " " + response.body;
+        }
+        return message;
+    }
+
+    // known to the server, with nothing waiting to be pushed
+    bool isClean(const ChangeTracker& tracker, const std::string& id) {
+        return tracker.isOnServer(id) && !tracker.isDirty(id);
+    }
+
+    bool isClean(const ChangeTracker& tracker, const Course& course) {
+        if (!isClean(tracker, course.getId())) {
+            return false;
+        }
+        for (const auto& [id, assignment] : course.getAssignmentList()) {
+            if (!isClean(tracker, id)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool isClean(const ChangeTracker& tracker, const Term& term) {
+        if (!isClean(tracker, term.getId())) {
+            return false;
+        }
+        for (const auto& [id, course] : term.getCourseList()) {
+            if (!isClean(tracker, course)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void merge(SyncReport& into, SyncReport&& from) {
+        into.requestCount += from.requestCount;
+        into.syncedCount += from.syncedCount;
+        into.unchangedCount += from.unchangedCount;
+        into.removedCount += from.removedCount;
+        for (std::string& error : from.errors) {
+            into.errors.push_back(std::move(error));
+        }
+    }
+
+    const Term* findCourseTerm(const TermController& controller, const std::string& courseId) {
+        for (const auto& [termId, term] : controller.getTermList()) {
+            if (term.getCourseList().contains(courseId)) {
+                return &term;
+            }
+        }
+        return nullptr;
+    }
+}
+
+SyncEngine::SyncEngine(TermController& controller, HttpClient& client) : controller_{controller}, client_{client} {}
+
+// sends every pending change; changes whose parent could not be created are skipped, and a transport
+// failure stops the push, leaving the rest pending for the next one
+SyncReport SyncEngine::push() {
+    SyncReport report;
+    std::unordered_set<std::string> failed;
+
+    for (const EntityChange& change : controller_.getChangeTracker().getPendingChanges()) {
+        if (!change.removed && failed.contains(change.parentId)) {
+            report.errors.push_back("Skipped " + change.id + ": its parent was not synced.");
+            failed.insert(change.id);
+            continue;
+        }
+
+        bool synced = false;
+
+        try {
+            synced = change.removed ? pushRemoval(change, report) : pushUpsert(change, report);
+        } catch (const std::runtime_error& e) {
+            report.errors.push_back(e.what());
+            return report;
+        }
+
+        if (synced) {
+            ++report.syncedCount;
+        } else {
+            failed.insert(change.id);
+        }
+    }
+
+    return report;
+}
+
+// fetches one term with its courses and assignments in a single request and applies it by id; entities with
+// unpushed local changes keep them, entities removed locally (with their children) are not brought back, and clean
+// entities the server no longer has are removed; a term unchanged since it was last pulled is left alone, since
+// what the server holds was applied then, so a pull that could not apply all of it forgets the cached copy
+SyncReport SyncEngine::pullTerm(const std::string& termId) {
+    SyncReport report;
+    std::string target = "/terms/" + termId + "/tree";
+    io::EntityBatch batch;
+
+    try {
+        ++report.requestCount;
+        HttpResponse response = cache_.get(client_, target);
+        if (response.status == 304) {
+            ++report.unchangedCount;
+            return report;
+        }
+        // the server no longer has the term; a local copy with nothing left to push goes too
+        auto local = controller_.getTermList().find(termId);
+        if (response.status == 404 && local != controller_.getTermList().end()
+            && isClean(controller_.getChangeTracker(), local->second)) {
+            controller_.removeRemoteTerm(termId);
+            ++report.removedCount;
+            return report;
+        }
+        if (!isSuccess(response.status)) {
+            report.errors.push_back(describe("GET", target, response));
+            return report;
+        }
+
+        std::istringstream is{response.body};
+        batch = io::readRecords(is, EntityKind::term);
+    } catch (const std::exception& e) {
+        report.errors.push_back(e.what());
+        cache_.erase(target);
+        return report;
+    }
+
+    if (batch.terms.size() != 1 || batch.terms[0].getId() != termId) {
+        report.errors.push_back("GET " + target + ": response does not describe the requested term.");
+        cache_.erase(target);
+        return report;
+    }
+
+    std::unordered_set<std::string> dropped;
+    for (const EntityChange& change : controller_.getChangeTracker().getPendingChanges()) {
+        if (change.removed) {
+            dropped.insert(change.id);
+        }
+    }
+
+    // applying the term, then the courses, then the assignments finds each parent already in the model
+    applyPulled(termId, "", dropped, report, [&]() { controller_.applyRemoteTerm(batch.terms[0]); });
+    for (const auto& [courseTermId, course] : batch.courses) {
+        applyPulled(course.getId(), courseTermId, dropped, report,
+            [&]() { controller_.applyRemoteCourse(courseTermId, course); });
+    }
+    for (const auto& [courseId, assignment] : batch.assignments) {
+        applyPulled(assignment.getId(), courseId, dropped, report,
+            [&]() { controller_.applyRemoteAssignment(termId, courseId, assignment); });
+    }
+
+    removeAbsent(termId, batch, report);
+
+    // a tree that was not fully applied must be fetched whole next time rather than skipped as unchanged
+    if (!report.errors.empty()) {
+        cache_.erase(target);
+    }
+    return report;
+}
+
+// reads the server's term list a page at a time and pulls each listed term as its page arrives, so only one
+// page of the list is held at once; once the whole list has been read, clean local terms it did not hold were
+// deleted on the server and are removed here too
+SyncReport SyncEngine::pullAll(std::size_t pageSize) {
+    SyncReport report;
+    PageReader reader{client_, "/terms/", EntityKind::term, pageSize};
+    std::unordered_set<std::string> listed;
+    io::EntityBatch page;
+
+    try {
+        while (reader.next(page)) {
+            for (const Term& term : page.terms) {
+                listed.insert(term.getId());
+                merge(report, pullTerm(term.getId()));
+            }
+        }
+    } catch (const std::exception& e) {
+        report.requestCount += reader.getRequestCount();
+        report.errors.push_back(e.what());
+        return report;
+    }
+    report.requestCount += reader.getRequestCount();
+
+    std::vector<std::string> absent;
+    for (const auto& [termId, term] : controller_.getTermList()) {
+        if (!listed.contains(termId) && isClean(controller_.getChangeTracker(), term)) {
+            absent.push_back(termId);
+        }
+    }
+    for (const std::string& termId : absent) {
+        controller_.removeRemoteTerm(termId);
+        ++report.removedCount;
+    }
+    return report;
+}
+
+// removes the term's clean courses and assignments that the pulled tree does not hold; a course with unpushed
+// changes anywhere under it is kept whole
+void SyncEngine::removeAbsent(const std::string& termId, const io::EntityBatch& batch, SyncReport& report) {
+    auto local = controller_.getTermList().find(termId);
+    if (local == controller_.getTermList().end()) {
+        return;
+    }
+
+    std::unordered_set<std::string> pulled;
+    for (const auto& [courseTermId, course] : batch.courses) {
+        pulled.insert(course.getId());
+    }
+    for (const auto& [courseId, assignment] : batch.assignments) {
+        pulled.insert(assignment.getId());
+    }
+
+    const ChangeTracker& tracker = controller_.getChangeTracker();
+    std::vector<std::string> courses;
+    std::vector<std::pair<std::string, std::string>> assignments;     // course id, assignment id
+
+    for (const auto& [courseId, course] : local->second.getCourseList()) {
+        if (!pulled.contains(courseId)) {
+            if (isClean(tracker, course)) {
+                courses.push_back(courseId);
+            }
+            continue;
+        }
+        for (const auto& [assignmentId, assignment] : course.getAssignmentList()) {
+            if (!pulled.contains(assignmentId) && isClean(tracker, assignmentId)) {
+                assignments.emplace_back(courseId, assignmentId);
+            }
+        }
+    }
+
+    for (const auto& [courseId, assignmentId] : assignments) {
+        controller_.removeRemoteAssignment(termId, courseId, assignmentId);
+        ++report.removedCount;
+    }
+    for (const std::string& courseId : courses) {
+        controller_.removeRemoteCourse(termId, courseId);
+        ++report.removedCount;
+    }
+}
+
+// applies one pulled entity unless it, or its parent, is being removed locally, or it has unpushed edits
+template <typename Apply>
+void SyncEngine::applyPulled(const std::string& id, const std::string& parentId, std::unordered_set<std::string>& dropped,
+    SyncReport& report, Apply apply) {
+    if (dropped.contains(id) || dropped.contains(parentId)) {
+        dropped.insert(id);
+        return;
+    }
+
+    if (controller_.getChangeTracker().isDirty(id)) {
+        return;
+    }
+
+    try {
+        apply();
+        ++report.syncedCount;
+    } catch (const std::exception& e) {
+        report.errors.push_back("Could not apply the server's copy of " + id + ": " + e.what());
+        dropped.insert(id);
+    }
+}
+
+HttpResponse SyncEngine::send(std::string_view method, const std::string& target, const std::string& body,
+    SyncReport& report) {
+    ++report.requestCount;
+    return client_.request(method, target, body);
+}
+
+bool SyncEngine::pushRemoval(const EntityChange& change, SyncReport& report) {
+    std::string target = collection(change.kind) + "/" + change.id;
+    HttpResponse response = send("DELETE", target, "", report);
+
+    // already gone on the server counts as done
+    if (!isSuccess(response.status) && response.status != 404) {
+        report.errors.push_back(describe("DELETE", target, response));
+        return false;
+    }
+
+    controller_.getChangeTracker().markSynced(change.id, change.version);
+    return true;
+}
+
+// creates or updates one entity, falling back to the other verb if the server disagrees about whether it exists
+bool SyncEngine::pushUpsert(const EntityChange& change, SyncReport& report) {
+    std::string body;
+
+    try {
+        body = encode(change);
+    } catch (const std::out_of_range&) {
+        report.errors.push_back("Skipped " + change.id + ": it is no longer in the model.");
+        return false;
+    }
+
+    std::string createTarget = collection(change.kind) + "/";
+    std::string updateTarget = collection(change.kind) + "/" + change.id;
+    std::string_view method = change.onServer ? "PUT" : "POST";
+    std::string target = change.onServer ? updateTarget : createTarget;
+    HttpResponse response = send(method, target, body, report);
+
+    if (change.onServer && response.status == 404) {
+        HttpResponse retry = send("POST", createTarget, body, report);
+        if (isSuccess(retry.status)) {
+            response = std::move(retry);
+        }
+    } else if (!change.onServer && response.status == 409) {
+        // the row may exist from an earlier push whose response was lost; a title clash still fails with 404
+        HttpResponse retry = send("PUT", updateTarget, body, report);
+        if (isSuccess(retry.status)) {
+            response = std::move(retry);
+        }
+    }
+
+    if (!isSuccess(response.status)) {
+        report.errors.push_back(describe(method, target, response));
+        return false;
+    }
+
+    try {
+        reconcile(change, body, response);
+    } catch (const std::exception& e) {
+        report.errors.push_back("Could not apply the server's copy of " + change.id + ": " + e.what());
+    }
+
+    controller_.getChangeTracker().markSynced(change.id, change.version);
+    return true;
+}
+
+// builds the request body for an entity from the current model
+std::string SyncEngine::encode(const EntityChange& change) const {
+    std::ostringstream os;
+    JsonWriter writer{os};
+    const TermList& termList = controller_.getTermList();
+
+    switch (change.kind) {
+        case EntityKind::term: {
+            auto it = termList.find(change.id);
+            if (it == termList.end()) {
+                throw std::out_of_range("Term not found.");
+            }
+            io::writeTerm(writer, it->second);
+            break;
+        }
+        case EntityKind::course: {
+            auto it = termList.find(change.parentId);
+            if (it == termList.end()) {
+                throw std::out_of_range("Term not found.");
+            }
+            io::writeCourse(writer, change.parentId, it->second.findCourse(change.id));
+            break;
+        }
+        case EntityKind::assignment: {
+            const Term* term = findCourseTerm(controller_, change.parentId);
+            if (term == nullptr) {
+                throw std::out_of_range("Course not found.");
+            }
+            io::writeAssignment(writer, change.parentId, term->findCourse(change.parentId).findAssignment(change.id));
+            break;
+        }
+    }
+
+    return os.str();
+}
+
+// reads the server's copy of the entity through fromRow and applies it by id if it differs from what was sent,
+// unless the entity was edited locally again in the meantime
+void SyncEngine::reconcile(const EntityChange& change, const std::string& sentBody, const HttpResponse& response) {
+    if (response.body.empty() || controller_.getChangeTracker().getVersion(change.id) != change.version) {
+        return;
+    }
+
+    std::istringstream is{response.body};
+    io::EntityBatch batch = io::readRecords(is, change.kind);
+
+    // re-encoding the server's record makes the comparison independent of its key order and spacing
+    std::ostringstream os;
+    JsonWriter writer{os};
+
+    switch (change.kind) {
+        case EntityKind::term:
+            if (batch.terms.size() != 1 || batch.terms[0].getId() != change.id) {
+                throw std::invalid_argument("Response does not describe the entity that was sent.");
+            }
+            io::writeTerm(writer, batch.terms[0]);
+            if (os.str() != sentBody) {
+                controller_.applyRemoteTerm(batch.terms[0]);
+            }
+            break;
+        case EntityKind::course:
+            if (batch.courses.size() != 1 || batch.courses[0].second.getId() != change.id) {
+                throw std::invalid_argument("Response does not describe the entity that was sent.");
+            }
+            io::writeCourse(writer, batch.courses[0].first, batch.courses[0].second);
+            if (os.str() != sentBody) {
+                controller_.applyRemoteCourse(change.parentId, batch.courses[0].second);
+            }
+            break;
+        case EntityKind::assignment:
+            if (batch.assignments.size() != 1 || batch.assignments[0].second.getId() != change.id) {
+                throw std::invalid_argument("Response does not describe the entity that was sent.");
+            }
+            io::writeAssignment(writer, batch.assignments[0].first, batch.assignments[0].second);
+            if (os.str() != sentBody) {
+                const Term* term = findCourseTerm(controller_, change.parentId);
+                if (term == nullptr) {
+                    throw std::out_of_range("Course not found.");
+                }
+                controller_.applyRemoteAssignment(term->getId(), change.parentId, batch.assignments[0].second);
+            }
+            break;
+    }
+}
@@ -0,0 +1,382 @@
+#include "synth/HistoryGenerator.hpp"
+
+/**
+ * @file HistoryGenerator.cpp
+ * @brief Implementation of the HistoryGenerator class, which builds seeded synthetic academic histories.
+ *
+ * The random streams are splitmix64, and the distributions are written out here rather than taken
+ * from <random>, whose distributions are allowed to differ between standard libraries.
+ *
+ * Provides implementations only; see HistoryGenerator.hpp for definitions.
+ */
+
+#include <algorithm>        // for clamp and max
+#include <array>            // for name tables
+#include <charconv>         // for to_chars
+#include <cmath>            // for round
+#include <cstdio>           // for snprintf
+#include <stdexcept>        // for exceptions
+#include <string>           // for ids and titles
+#include "io/EntityJson.hpp"
+#include "io/JsonWriter.hpp"
+
+namespace {
+    constexpr std::array<const char*, 12> departments = {
+        "CMPE", "CS", "MATH", "PHYS", "CHEM", "BIOL", "ENGL", "HIST", "ECON", "PSYC", "PHIL", "STAT"
+    };
+
+    constexpr std::array<const char*, 3> seasons = {"Fall", "Spring", "Summer"};
+
+    class Random {
+        public:
+            // one independent stream per (seed, term, course, assignment) position
+            Random(std::uint64_t seed, std::uint64_t term, std::uint64_t course = 0, std::uint64_t assignment = 0)
+                : state_{mix(mix(mix(mix(seed) ^ term) ^ course) ^ assignment)} {}
+
+            std::uint64_t next() {
+                state_ += 0x9E3779B97F4A7C15ull;
+                return mix(state_);
+            }
+
+            // a value in [0, n); the modulo bias is far below anything the output could show
+            std::uint64_t below(std::uint64_t n) {
+                return next() % n;
+            }
+
+            double unit() {
+                return static_cast<double>(next() >> 11) * 0x1.0p-53;
+            }
+
+            bool chance(double p) {
+                return unit() < p;
+            }
+
+            // approximately standard normal: the Irwin-Hall sum of four uniforms, rescaled
+            double normal() {
+                return (unit() + unit() + unit() + unit() - 2.0) * 1.7320508075688772;
+            }
+
+            std::string uuid() {
+                static constexpr char hex[] = "0123456789abcdef";
+                std::uint64_t high = next();
+                std::uint64_t low = next();
+                high = (high & 0xFFFFFFFFFFFF0FFFull) | 0x0000000000004000ull;    // version 4
+                low = (low & 0x3FFFFFFFFFFFFFFFull) | 0x8000000000000000ull;      // RFC 4122 variant
+
+                std::string id(36, '-');
+                std::size_t pos = 0;
+                for (int nibble = 0; nibble < 32; ++nibble) {
+                    if (pos == 8 || pos == 13 || pos == 18 || pos == 23) {
+                        ++pos;
+                    }
+                    std::uint64_t word = nibble < 16 ? high : low;
+                    id[pos++] = hex[(word >> (60 - 4 * (nibble % 16))) & 0xF];
+                }
+                return id;
+            }
+
+        private:
+            std::uint64_t state_;
+
+            static std::uint64_t mix(std::uint64_t z) {
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+                return z ^ (z >> 31);
+            }
+    };
+
+    // a course's ability is drawn from the course stream, so assignments can be generated without the course
+    double courseAbility(std::uint64_t seed, std::size_t termIndex, std::size_t courseIndex) {
+        Random random{seed, termIndex + 1, courseIndex + 1};
+        random.next();      // the two draws behind the course id
+        random.next();
+        return std::clamp(80.0 + 7.0 * random.normal(), 55.0, 98.0);
+    }
+
+    std::chrono::sys_days addDays(std::chrono::year_month_day date, long days) {
+        return std::chrono::sys_days{date} + std::chrono::days{days};
+    }
+
+    std::string formatDate(const std::chrono::year_month_day& date) {
+        char buffer[32];    // room for any int year, so -Wformat-truncation has nothing to report
+        std::snprintf(buffer, sizeof(buffer), "%04d-%02u-%02u", static_cast<int>(date.year()),
+            static_cast<unsigned>(date.month()), static_cast<unsigned>(date.day()));
+        return buffer;
+    }
+
+    std::string formatGrade(float grade) {
+        char buffer[32];
+        auto [end, error] = std::to_chars(buffer, buffer + sizeof(buffer), grade);
+        return std::string{buffer, end};
+    }
+
+    // single-quoted SQL string; generated text never needs more than quote and backslash escaping
+    std::string sqlString(const std::string& value) {
+        std::string quoted = "'";
+        for (char c : value) {
+            if (c == '\'' || c == '\\') {
+                quoted += '\\';
+            }
+            quoted += c;
+        }
+        return quoted + "'";
+    }
+
+    // writes rows as multi-row INSERT statements of up to batchSize rows each
+    class SqlInserter {
+        public:
+            SqlInserter(std::ostream& os, std::string head) : os_{os}, head_{std::move(head)} {}
+
+            void row(const std::string& values) {
+                os_ << (rows_ % batchSize == 0 ? head_ + " VALUES\n" : ",\n") << "(" << values << ")";
+                if (++rows_ % batchSize == 0) {
+                    os_ << ";\n";
+                }
+            }
+
+            void finish() {
+                if (rows_ % batchSize != 0) {
+                    os_ << ";\n";
+                }
+            }
+
+        private:
+            static constexpr std::size_t batchSize = 1000;
+            std::ostream& os_;
+            std::string head_;
+            std::size_t rows_{0};
+    };
+}
+
+namespace synth {
+    HistoryGenerator::HistoryGenerator(HistoryConfig config) : config_{config} {
+        // the last term starts in the year after firstYear + (terms - 1) / 3, and dates are written with four digits
+        if (config_.firstYear < 1000 || static_cast<long long>(config_.firstYear) +
+            static_cast<long long>(config_.terms / 3) + 1 > 9999) {
+            throw std::invalid_argument("Terms must fall between the years 1000 and 9999.");
+        }
+    }
+
+    const HistoryConfig& HistoryGenerator::getConfig() const {
+        return config_;
+    }
+
+    std::size_t HistoryGenerator::getAssignmentCount() const {
+        return config_.terms * config_.coursesPerTerm * config_.assignmentsPerCourse;
+    }
+
+    // terms cycle through fall, spring and summer, starting with the fall of firstYear; only the last is active
+    Term HistoryGenerator::makeTerm(std::size_t termIndex) const {
+        using namespace std::chrono;
+
+        Random random{config_.seed, termIndex + 1};
+        std::string id = random.uuid();
+        std::size_t season = termIndex % 3;
+        int year = config_.firstYear + static_cast<int>(termIndex / 3) + (season == 0 ? 0 : 1);
+
+        year_month_day start;
+        year_month_day end;
+        switch (season) {
+            case 0:  start = std::chrono::year{year}/August/20;  end = std::chrono::year{year}/December/13; break;
+            case 1:  start = std::chrono::year{year}/January/21; end = std::chrono::year{year}/May/16;      break;
+            default: start = std::chrono::year{year}/June/2;     end = std::chrono::year{year}/August/8;    break;
+        }
+
+        long shift = static_cast<long>(random.below(7)) - 3;    // calendars move a few days from year to year
+        start = year_month_day{addDays(start, shift)};
+        end = year_month_day{addDays(end, shift)};
+
+        return Term::fromRow(std::move(id), std::string{seasons[season]} + " " + std::to_string(year), start, end,
+            termIndex + 1 == config_.terms);
+    }
+
+    Term HistoryGenerator::buildTerm(std::size_t termIndex) const {
+        Term term = makeTerm(termIndex);
+
+        forEachCourse(term, termIndex, [&](Course& course, std::size_t courseIndex) {
+            forEachAssignment(term, termIndex, course, courseIndex, [&](const Assignment& assignment) {
+                course.addAssignment(assignment);
+            });
+            term.addCourse(course);
+        });
+
+        return term;
+    }
+
+    // adds every term to the controller as new local data
+    void HistoryGenerator::fill(TermController& controller) const {
+        for (std::size_t t = 0; t < config_.terms; ++t) {
+            controller.importTerm(buildTerm(t));
+        }
+    }
+
+    // writes the same flat term tree document as io::exportTermTree, without building the model; each array
+    // regenerates the levels above it, which costs far less than the assignments themselves
+    void HistoryGenerator::writeJson(std::ostream& os) const {
+        JsonWriter writer{os};
+        writer.startObject();
+
+        writer.key("terms");
+        writer.startArray();
+        for (std::size_t t = 0; t < config_.terms; ++t) {
+            io::writeTerm(writer, makeTerm(t));
+        }
+        writer.endArray();
+
+        writer.key("courses");
+        writer.startArray();
+        for (std::size_t t = 0; t < config_.terms; ++t) {
+            Term term = makeTerm(t);
+            forEachCourse(term, t, [&](const Course& course, std::size_t) {
+                io::writeCourse(writer, term.getId(), course);
+            });
+        }
+        writer.endArray();
+
+        writer.key("assignments");
+        writer.startArray();
+        for (std::size_t t = 0; t < config_.terms; ++t) {
+            Term term = makeTerm(t);
+            forEachCourse(term, t, [&](const Course& course, std::size_t c) {
+                forEachAssignment(term, t, course, c, [&](const Assignment& assignment) {
+                    io::writeAssignment(writer, course.getId(), assignment);
+                });
+            });
+        }
+        writer.endArray();
+
+        writer.endObject();
+    }
+
+    // writes INSERT statements for the server schema (scripts/init-db.py), parents before children
+    void HistoryGenerator::writeSql(std::ostream& os) const {
+        auto nullable = [](const std::string& value) {
+            return value.empty() ? std::string{"NULL"} : sqlString(value);
+        };
+        auto boolean = [](bool value) {
+            return std::string{value ? "TRUE" : "FALSE"};
+        };
+
+        SqlInserter terms{os, "INSERT INTO terms (id, title, start_date, end_date, active)"};
+        for (std::size_t t = 0; t < config_.terms; ++t) {
+            Term term = makeTerm(t);
+            terms.row(sqlString(term.getId()) + ", " + sqlString(term.getTitle()) + ", '" +
+                formatDate(term.getStartDate()) + "', '" + formatDate(term.getEndDate()) + "', " +
+                boolean(term.getActive()));
+        }
+        terms.finish();
+
+        SqlInserter courses{os, "INSERT INTO courses (id, term_id, title, description, start_date, end_date, "
+            "num_credits, active)"};
+        for (std::size_t t = 0; t < config_.terms; ++t) {
+            Term term = makeTerm(t);
+            forEachCourse(term, t, [&](const Course& course, std::size_t) {
+                courses.row(sqlString(course.getId()) + ", " + sqlString(term.getId()) + ", " +
+                    sqlString(course.getTitle()) + ", " + nullable(course.getDescription()) + ", '" +
+                    formatDate(course.getStartDate()) + "', '" + formatDate(course.getEndDate()) + "', " +
+                    std::to_string(course.getNumCredits()) + ", " + boolean(course.getActive()));
+            });
+        }
+        courses.finish();
+
+        SqlInserter assignments{os, "INSERT INTO assignments (id, course_id, title, description, category, "
+            "due_date, completed, grade)"};
+        for (std::size_t t = 0; t < config_.terms; ++t) {
+            Term term = makeTerm(t);
+            forEachCourse(term, t, [&](const Course& course, std::size_t c) {
+                forEachAssignment(term, t, course, c, [&](const Assignment& assignment) {
+                    assignments.row(sqlString(assignment.getId()) + ", " + sqlString(course.getId()) + ", " +
+                        sqlString(assignment.getTitle()) + ", " + nullable(assignment.getDescription()) + ", " +
+                        sqlString(assignment.getCategory()) + ", '" + formatDate(assignment.getDueDate()) + "', " +
+                        boolean(assignment.getCompleted()) + ", " + formatGrade(assignment.getGrade()));
+                });
+            });
+        }
+        assignments.finish();
+    }
+
+    // course titles are a department and a number; numbers are distinct within a term for up to 900 courses,
+    // and larger terms add a suffix
+    template <typename Visit>
+    void HistoryGenerator::forEachCourse(const Term& term, std::size_t termIndex, Visit visit) const {
+        for (std::size_t c = 0; c < config_.coursesPerTerm; ++c) {
+            Random random{config_.seed, termIndex + 1, c + 1};
+            std::string id = random.uuid();
+            random.normal();    // the ability, see courseAbility
+
+            std::string title = std::string{departments[random.below(departments.size())]} + " " +
+                std::to_string(100 + (c * 7 + termIndex * 131) % 900);
+            if (c >= 900) {
+                title += " (" + std::to_string(c / 900 + 1) + ")";
+            }
+
+            double roll = random.unit();
+            int numCredits = roll < 0.70 ? 3 : roll < 0.90 ? 4 : roll < 0.95 ? 2 : 1;
+            std::string description = random.chance(0.3) ? "Lecture and lab" : "";
+
+            Course course = Course::fromRow(std::move(id), std::move(title), std::move(description),
+                term.getStartDate(), term.getEndDate(), numCredits, term.getActive());
+            visit(course, c);
+        }
+    }
+
+    // assignments are homework spread evenly through the term, then midterms, then a final exam on the last day
+    template <typename Visit>
+    void HistoryGenerator::forEachAssignment(const Term& term, std::size_t termIndex, const Course&,
+        std::size_t courseIndex, Visit visit) const {
+        std::size_t count = config_.assignmentsPerCourse;
+        std::size_t finals = count >= 1 ? 1 : 0;
+        std::size_t midterms = count >= 3 ? std::max<std::size_t>(1, count / 10) : 0;
+        std::size_t homework = count - finals - midterms;
+
+        double ability = courseAbility(config_.seed, termIndex, courseIndex);
+        std::chrono::sys_days start{term.getStartDate()};
+        std::chrono::sys_days end{term.getEndDate()};
+        long span = (end - start).count();
+        std::chrono::sys_days asOf = start + std::chrono::days{span / 2};   // "today" in the active term
+
+        for (std::size_t a = 0; a < count; ++a) {
+            Random random{config_.seed, termIndex + 1, courseIndex + 1, a + 1};
+            std::string id = random.uuid();
+
+            std::string title;
+            const char* category;
+            std::chrono::sys_days due;
+            double mean;
+            double spread;
+
+            if (a < homework) {
+                title = "Homework " + std::to_string(a + 1);
+                category = "Homework";
+                due = start + std::chrono::days{static_cast<long>((a + 1) * span / (homework + 1)) +
+                    static_cast<long>(random.below(3))};
+                mean = ability + 4.0;
+                spread = 7.0;
+            } else if (a < homework + midterms) {
+                std::size_t m = a - homework;
+                title = "Midterm " + std::to_string(m + 1);
+                category = "Midterm";
+                due = start + std::chrono::days{static_cast<long>((m + 1) * span / (midterms + 1))};
+                mean = ability - 3.0;
+                spread = 9.0;
+            } else {
+                title = "Final Exam";
+                category = "Final Exam";
+                due = end;
+                mean = ability - 5.0;
+                spread = 10.0;
+            }
+            due = std::min(due, end);
+
+            bool completed = term.getActive() ? (due <= asOf && !random.chance(0.05)) : !random.chance(0.02);
+            float grade = 0.0f;
+            if (completed && !(a < homework && random.chance(0.03))) {
+                double raw = std::clamp(mean + spread * random.normal(), 0.0, 100.0);
+                grade = static_cast<float>(std::round(raw * 2.0) / 2.0);
+            }
+
+            visit(Assignment::fromRow(std::move(id), std::move(title), "", category,
+                std::chrono::year_month_day{due}, completed, grade));
+        }
+    }
+}
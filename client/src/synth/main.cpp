@@ -0,0 +1,114 @@
+/**
+ * @file main.cpp
+ * @brief Command-line front end for HistoryGenerator.
+ *
+ * Writes a seeded synthetic history as a term tree JSON document (the format read by
+ * io::importTermTree) or as SQL INSERT statements for the server schema.
+ *
+ *     CourseCompanion_synth [--seed N] [--terms N] [--courses N] [--assignments N]
+ *                           [--first-year YEAR] [--format json|sql] [--out FILE]
+ */
+
+#include <chrono>           // for timing
+#include <fstream>          // for ofstream
+#include <iostream>         // for cout and cerr
+#include <stdexcept>        // for exceptions
+#include <string>           // for arguments
+#include <string_view>      // for flag names
+#include "synth/HistoryGenerator.hpp"
+
+namespace {
+    constexpr const char* usage =
+        "Usage: CourseCompanion_synth [--seed N] [--terms N] [--courses N] [--assignments N]\n"
+        "                             [--first-year YEAR] [--format json|sql] [--out FILE]\n";
+
+    unsigned long long parseCount(std::string_view flag, const std::string& value) {
+        std::size_t used = 0;
+        unsigned long long count = 0;
+        try {
+            count = std::stoull(value, &used);
+        } catch (const std::exception&) {
+            used = 0;
+        }
+        if (used == 0 || used != value.size() || value.front() == '-') {
+            throw std::invalid_argument(std::string{flag} + " expects a non-negative integer, got '" + value + "'.");
+        }
+        return count;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    std::ios::sync_with_stdio(false);
+
+    synth::HistoryConfig config;
+    std::string format = "json";
+    std::string outPath;
+
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string_view flag{argv[i]};
+            if (flag == "--help" || flag == "-h") {
+                std::cout << usage;
+                return 0;
+            }
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("Missing value for " + std::string{flag} + ".");
+            }
+            std::string value{argv[++i]};
+
+            if (flag == "--seed") {
+                config.seed = parseCount(flag, value);
+            } else if (flag == "--terms") {
+                config.terms = parseCount(flag, value);
+            } else if (flag == "--courses") {
+                config.coursesPerTerm = parseCount(flag, value);
+            } else if (flag == "--assignments") {
+                config.assignmentsPerCourse = parseCount(flag, value);
+            } else if (flag == "--first-year") {
+                config.firstYear = static_cast<int>(parseCount(flag, value));
+            } else if (flag == "--format") {
+                if (value != "json" && value != "sql") {
+                    throw std::invalid_argument("Format must be 'json' or 'sql'.");
+                }
+                format = value;
+            } else if (flag == "--out") {
+                outPath = value;
+            } else {
+                throw std::invalid_argument("Unknown option " + std::string{flag} + ".");
+            }
+        }
+
+        synth::HistoryGenerator generator{config};
+
+        std::ofstream file;
+        if (!outPath.empty()) {
+            file.open(outPath, std::ios::binary);
+            if (!file) {
+                throw std::runtime_error("Could not open " + outPath + " for writing.");
+            }
+        }
+        std::ostream& os = outPath.empty() ? std::cout : file;
+
+        auto start = std::chrono::steady_clock::now();
+        if (format == "json") {
+            generator.writeJson(os);
+            os << '\n';
+        } else {
+            generator.writeSql(os);
+        }
+        os.flush();
+        if (!os) {
+            throw std::runtime_error("Failed to write the generated history.");
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        std::cerr << "Generated " << config.terms << " terms, " << config.terms * config.coursesPerTerm
+                  << " courses and " << generator.getAssignmentCount() << " assignments in " << elapsed.count()
+                  << " ms.\n";
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n" << usage;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,116 @@
+#include "trace/Histogram.hpp"
+
+/**
+ * @file Histogram.cpp
+ * @brief Implementation of the Histogram class, a fixed-size log-linear latency histogram.
+ *
+ * Provides implementations only; see Histogram.hpp for definitions.
+ */
+
+#include <algorithm>        // for min and max
+#include <bit>              // for bit_width
+#include <cmath>            // for ceil
+
+namespace trace {
+    // single-writer increment: a plain load and store, which the owning thread never races with itself on
+    void Histogram::add(std::atomic<std::uint64_t>& target, std::uint64_t value) {
+        target.store(target.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    // values below 2^subBucketBits get their own bucket; above that, each power of two is split into
+    // subBuckets equal ranges, and the index runs on continuously from the exact buckets
+    std::size_t Histogram::bucketIndex(std::uint64_t value) {
+        if (value < subBuckets) {
+            return static_cast<std::size_t>(value);
+        }
+
+        int shift = std::bit_width(value) - (subBucketBits + 1);
+        std::uint64_t sub = value >> shift;     // in [subBuckets, 2 * subBuckets)
+        return static_cast<std::size_t>(shift + 1) * subBuckets + static_cast<std::size_t>(sub - subBuckets);
+    }
+
+    // highest value that falls into the bucket, which is what percentiles report
+    std::uint64_t Histogram::bucketUpperBound(std::size_t index) {
+        if (index < subBuckets) {
+            return index;
+        }
+
+        int shift = static_cast<int>(index / subBuckets) - 1;
+        std::uint64_t sub = index % subBuckets + subBuckets;
+        if (shift + subBucketBits + 1 >= 64 && sub == 2 * subBuckets - 1) {
+            return UINT64_MAX;
+        }
+        return ((sub + 1) << shift) - 1;
+    }
+
+    void Histogram::record(std::uint64_t value) {
+        add(buckets_[bucketIndex(value)], 1);
+        add(count_, 1);
+        add(total_, value);
+        if (value < min_.load(std::memory_order_relaxed)) {
+            min_.store(value, std::memory_order_relaxed);
+        }
+        if (value > max_.load(std::memory_order_relaxed)) {
+            max_.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    // not single-writer safe on this histogram; used to aggregate per-thread histograms into a local one
+    void Histogram::merge(const Histogram& other) {
+        for (std::size_t i = 0; i < bucketCount; ++i) {
+            std::uint64_t n = other.buckets_[i].load(std::memory_order_relaxed);
+            if (n != 0) {
+                add(buckets_[i], n);
+            }
+        }
+        add(count_, other.count_.load(std::memory_order_relaxed));
+        add(total_, other.total_.load(std::memory_order_relaxed));
+        min_.store(std::min(getMin(), other.getMin()), std::memory_order_relaxed);
+        max_.store(std::max(getMax(), other.getMax()), std::memory_order_relaxed);
+    }
+
+    void Histogram::reset() {
+        for (auto& bucket : buckets_) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        count_.store(0, std::memory_order_relaxed);
+        total_.store(0, std::memory_order_relaxed);
+        min_.store(UINT64_MAX, std::memory_order_relaxed);
+        max_.store(0, std::memory_order_relaxed);
+    }
+
+    std::uint64_t Histogram::getCount() const {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t Histogram::getTotal() const {
+        return total_.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t Histogram::getMin() const {
+        return getCount() == 0 ? 0 : min_.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t Histogram::getMax() const {
+        return max_.load(std::memory_order_relaxed);
+    }
+
+    // smallest bucket bound that covers the given share of values, clamped to the recorded range
+    std::uint64_t Histogram::getPercentile(double percentile) const {
+        std::uint64_t count = getCount();
+        if (count == 0) {
+            return 0;
+        }
+
+        double share = std::clamp(percentile, 0.0, 100.0) / 100.0;
+        std::uint64_t rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(share * count)));
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < bucketCount; ++i) {
+            seen += buckets_[i].load(std::memory_order_relaxed);
+            if (seen >= rank) {
+                return std::clamp(bucketUpperBound(i), getMin(), getMax());
+            }
+        }
+        return getMax();
+    }
+}
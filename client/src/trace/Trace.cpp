@@ -0,0 +1,389 @@
+#include "trace/Trace.hpp"
+
+/**
+ * @file Trace.cpp
+ * @brief Implementation of the hot-path tracing layer.
+ *
+ * Each thread owns a ThreadState with one lazily allocated histogram and one counter per site, plus
+ * a chain of fixed-size event chunks. The owning thread is the only writer; it publishes new
+ * histograms, chunks and event counts with release stores, and the reporting functions read them
+ * with acquire loads. The registry keeps every ThreadState alive after its thread exits.
+ *
+ * Provides implementations only; see Trace.hpp for definitions.
+ */
+
+#include <algorithm>        // for sort
+#include <array>            // for per-site slots
+#include <chrono>           // for steady_clock
+#include <iomanip>          // for table formatting
+#include <memory>           // for shared_ptr
+#include <mutex>            // for registration
+#include <stdexcept>        // for exceptions
+#include "io/JsonWriter.hpp"
+#include "trace/Histogram.hpp"
+
+namespace trace {
+    namespace detail {
+        std::atomic<bool> enabled{false};
+    }
+}
+
+namespace {
+    constexpr std::size_t maxSites = 512;
+    constexpr std::size_t chunkSize = 4096;
+    constexpr std::size_t maxEventsPerThread = std::size_t{1} << 20;   // about 24 MB of events per thread
+
+    struct Event {
+        std::uint32_t site;
+        std::uint64_t start;
+        std::uint64_t duration;
+    };
+
+    struct EventChunk {
+        std::array<Event, chunkSize> events;
+        std::atomic<std::size_t> size{0};
+        std::atomic<EventChunk*> next{nullptr};
+    };
+
+    struct ThreadState {
+        std::uint32_t id;
+        std::array<std::atomic<trace::Histogram*>, maxSites> timers{};
+        std::array<std::atomic<std::int64_t>, maxSites> counters{};
+        std::atomic<EventChunk*> head{nullptr};
+        EventChunk* tail = nullptr;     // only touched by the owning thread
+        std::size_t eventCount{0};      // only touched by the owning thread
+        std::atomic<std::uint64_t> dropped{0};
+
+        explicit ThreadState(std::uint32_t id) : id{id} {}
+        ThreadState(const ThreadState&) = delete;
+        ThreadState& operator=(const ThreadState&) = delete;
+
+        ~ThreadState() {
+            for (auto& timer : timers) {
+                delete timer.load(std::memory_order_relaxed);
+            }
+            for (EventChunk* chunk = head.load(std::memory_order_relaxed); chunk != nullptr;) {
+                EventChunk* next = chunk->next.load(std::memory_order_relaxed);
+                delete chunk;
+                chunk = next;
+            }
+        }
+    };
+
+    struct Registry {
+        std::mutex mutex;
+        std::vector<std::string> names;
+        std::vector<trace::SiteKind> kinds;
+        std::vector<std::shared_ptr<ThreadState>> threads;
+        std::atomic<bool> recordEvents{false};
+        std::atomic<std::uint64_t> eventFloor{0};     // events that started before the last reset are skipped
+        const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+    };
+
+    Registry& registry() {
+        static Registry instance;
+        return instance;
+    }
+
+    ThreadState& localState() {
+        thread_local std::shared_ptr<ThreadState> state = [] {
+            Registry& r = registry();
+            std::lock_guard lock{r.mutex};
+            auto created = std::make_shared<ThreadState>(static_cast<std::uint32_t>(r.threads.size() + 1));
+            r.threads.push_back(created);
+            return created;
+        }();
+        return *state;
+    }
+
+    // copies of the registry's lists, so reports don't hold the lock while they walk thread data
+    struct Snapshot {
+        std::vector<std::string> names;
+        std::vector<trace::SiteKind> kinds;
+        std::vector<std::shared_ptr<ThreadState>> threads;
+    };
+
+    Snapshot snapshot() {
+        Registry& r = registry();
+        std::lock_guard lock{r.mutex};
+        return Snapshot{r.names, r.kinds, r.threads};
+    }
+
+    double toMicroseconds(std::uint64_t nanoseconds) {
+        return static_cast<double>(nanoseconds) / 1000.0;
+    }
+}
+
+namespace trace {
+    // sites are deduplicated by name, so one name used in several places reports as one row
+    Site::Site(const char* name, SiteKind kind) {
+        Registry& r = registry();
+        std::lock_guard lock{r.mutex};
+
+        for (std::size_t i = 0; i < r.names.size(); ++i) {
+            if (r.names[i] == name) {
+                if (r.kinds[i] != kind) {
+                    throw std::invalid_argument(std::string{"Trace site '"} + name + "' is both a timer and a counter.");
+                }
+                index_ = i;
+                return;
+            }
+        }
+
+        if (r.names.size() == maxSites) {
+            throw std::length_error("Too many trace sites.");
+        }
+        index_ = r.names.size();
+        r.names.emplace_back(name);
+        r.kinds.push_back(kind);
+    }
+
+    std::size_t Site::getIndex() const {
+        return index_;
+    }
+
+    void enable(bool recordEvents) {
+        registry().recordEvents.store(recordEvents, std::memory_order_relaxed);
+        detail::enabled.store(true, std::memory_order_relaxed);
+    }
+
+    void disable() {
+        detail::enabled.store(false, std::memory_order_relaxed);
+    }
+
+    // clears histograms and counters in place; events are kept in memory but hidden from the trace
+    void reset() {
+        Snapshot s = snapshot();
+        for (const auto& state : s.threads) {
+            for (auto& timer : state->timers) {
+                if (Histogram* histogram = timer.load(std::memory_order_acquire)) {
+                    histogram->reset();
+                }
+            }
+            for (auto& counter : state->counters) {
+                counter.store(0, std::memory_order_relaxed);
+            }
+            state->dropped.store(0, std::memory_order_relaxed);
+        }
+        registry().eventFloor.store(now(), std::memory_order_relaxed);
+    }
+
+    std::uint64_t now() {
+        auto elapsed = std::chrono::steady_clock::now() - registry().epoch;
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    void recordTime(const Site& site, std::uint64_t start, std::uint64_t duration) {
+        ThreadState& state = localState();
+        std::size_t index = site.getIndex();
+
+        Histogram* histogram = state.timers[index].load(std::memory_order_relaxed);
+        if (histogram == nullptr) {
+            histogram = new Histogram{};
+            state.timers[index].store(histogram, std::memory_order_release);
+        }
+        histogram->record(duration);
+
+        if (!registry().recordEvents.load(std::memory_order_relaxed)) {
+            return;
+        }
+        if (state.eventCount == maxEventsPerThread) {
+            state.dropped.store(state.dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return;
+        }
+
+        std::size_t size = state.tail == nullptr ? chunkSize : state.tail->size.load(std::memory_order_relaxed);
+        if (size == chunkSize) {
+            auto* chunk = new EventChunk{};
+            if (state.tail == nullptr) {
+                state.head.store(chunk, std::memory_order_release);
+            } else {
+                state.tail->next.store(chunk, std::memory_order_release);
+            }
+            state.tail = chunk;
+            size = 0;
+        }
+        state.tail->events[size] = Event{static_cast<std::uint32_t>(index), start, duration};
+        state.tail->size.store(size + 1, std::memory_order_release);
+        ++state.eventCount;
+    }
+
+    void recordCount(const Site& site, std::int64_t amount) {
+        auto& counter = localState().counters[site.getIndex()];
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    std::vector<TimerStats> collectTimers() {
+        Snapshot s = snapshot();
+        std::vector<TimerStats> stats;
+
+        for (std::size_t i = 0; i < s.names.size(); ++i) {
+            if (s.kinds[i] != SiteKind::timer) {
+                continue;
+            }
+
+            auto merged = std::make_unique<Histogram>();
+            for (const auto& state : s.threads) {
+                if (const Histogram* histogram = state->timers[i].load(std::memory_order_acquire)) {
+                    merged->merge(*histogram);
+                }
+            }
+            if (merged->getCount() == 0) {
+                continue;
+            }
+
+            stats.push_back(TimerStats{s.names[i], merged->getCount(), merged->getTotal(), merged->getMin(),
+                merged->getPercentile(50), merged->getPercentile(90), merged->getPercentile(99), merged->getMax()});
+        }
+
+        std::sort(stats.begin(), stats.end(), [](const TimerStats& a, const TimerStats& b) {
+            return a.total != b.total ? a.total > b.total : a.name < b.name;
+        });
+        return stats;
+    }
+
+    std::vector<CounterStats> collectCounters() {
+        Snapshot s = snapshot();
+        std::vector<CounterStats> stats;
+
+        for (std::size_t i = 0; i < s.names.size(); ++i) {
+            if (s.kinds[i] != SiteKind::counter) {
+                continue;
+            }
+
+            std::int64_t value = 0;
+            for (const auto& state : s.threads) {
+                value += state->counters[i].load(std::memory_order_relaxed);
+            }
+            stats.push_back(CounterStats{s.names[i], value});
+        }
+
+        std::sort(stats.begin(), stats.end(), [](const CounterStats& a, const CounterStats& b) {
+            return a.name < b.name;
+        });
+        return stats;
+    }
+
+    // one row per timer with latencies in microseconds, then one row per counter
+    void writeSummary(std::ostream& os) {
+        std::vector<TimerStats> timers = collectTimers();
+        std::vector<CounterStats> counters = collectCounters();
+
+        std::size_t width = 5;
+        for (const TimerStats& timer : timers) {
+            width = std::max(width, timer.name.size());
+        }
+        for (const CounterStats& counter : counters) {
+            width = std::max(width, counter.name.size());
+        }
+
+        auto flags = os.flags();
+        auto precision = os.precision();
+        os << std::fixed << std::setprecision(2);
+
+        os << std::left << std::setw(static_cast<int>(width)) << "Timer" << std::right
+           << std::setw(10) << "Count" << std::setw(12) << "Total ms" << std::setw(11) << "Mean us"
+           << std::setw(11) << "p50 us" << std::setw(11) << "p90 us" << std::setw(11) << "p99 us"
+           << std::setw(11) << "Max us" << "\n";
+        for (const TimerStats& timer : timers) {
+            os << std::left << std::setw(static_cast<int>(width)) << timer.name << std::right
+               << std::setw(10) << timer.count
+               << std::setw(12) << static_cast<double>(timer.total) / 1e6
+               << std::setw(11) << toMicroseconds(timer.total) / static_cast<double>(timer.count)
+               << std::setw(11) << toMicroseconds(timer.p50)
+               << std::setw(11) << toMicroseconds(timer.p90)
+               << std::setw(11) << toMicroseconds(timer.p99)
+               << std::setw(11) << toMicroseconds(timer.max) << "\n";
+        }
+
+        if (!counters.empty()) {
+            os << "\n" << std::left << std::setw(static_cast<int>(width)) << "Counter" << std::right
+               << std::setw(10) << "Value" << "\n";
+            for (const CounterStats& counter : counters) {
+                os << std::left << std::setw(static_cast<int>(width)) << counter.name << std::right
+                   << std::setw(10) << counter.value << "\n";
+            }
+        }
+
+        std::uint64_t dropped = 0;
+        for (const auto& state : snapshot().threads) {
+            dropped += state->dropped.load(std::memory_order_relaxed);
+        }
+        if (dropped != 0) {
+            os << "\n" << dropped << " trace events were dropped after the per-thread limit.\n";
+        }
+
+        os.flags(flags);
+        os.precision(precision);
+    }
+
+    // complete ("X") events with microsecond timestamps, one track per thread; counter totals go in otherData
+    void writeChromeTrace(std::ostream& os) {
+        Snapshot s = snapshot();
+        std::uint64_t floor = registry().eventFloor.load(std::memory_order_relaxed);
+
+        JsonWriter writer{os};
+        writer.startObject();
+        writer.key("displayTimeUnit");
+        writer.stringValue("ns");
+
+        writer.key("traceEvents");
+        writer.startArray();
+        for (const auto& state : s.threads) {
+            int tid = static_cast<int>(state->id);
+
+            writer.startObject();
+            writer.key("name");
+            writer.stringValue("thread_name");
+            writer.key("ph");
+            writer.stringValue("M");
+            writer.key("pid");
+            writer.numberValue(1);
+            writer.key("tid");
+            writer.numberValue(tid);
+            writer.key("args");
+            writer.startObject();
+            writer.key("name");
+            writer.stringValue("thread " + std::to_string(tid));
+            writer.endObject();
+            writer.endObject();
+
+            for (EventChunk* chunk = state->head.load(std::memory_order_acquire); chunk != nullptr;
+                chunk = chunk->next.load(std::memory_order_acquire)) {
+                std::size_t size = chunk->size.load(std::memory_order_acquire);
+                for (std::size_t i = 0; i < size; ++i) {
+                    const Event& event = chunk->events[i];
+                    if (event.start < floor) {
+                        continue;
+                    }
+
+                    writer.startObject();
+                    writer.key("name");
+                    writer.stringValue(s.names[event.site]);
+                    writer.key("ph");
+                    writer.stringValue("X");
+                    writer.key("ts");
+                    writer.numberValue(toMicroseconds(event.start));
+                    writer.key("dur");
+                    writer.numberValue(toMicroseconds(event.duration));
+                    writer.key("pid");
+                    writer.numberValue(1);
+                    writer.key("tid");
+                    writer.numberValue(tid);
+                    writer.endObject();
+                }
+            }
+        }
+        writer.endArray();
+
+        writer.key("otherData");
+        writer.startObject();
+        for (const CounterStats& counter : collectCounters()) {
+            writer.key(counter.name);
+            writer.numberValue(static_cast<double>(counter.value));
+        }
+        writer.endObject();
+
+        writer.endObject();
+    }
+}
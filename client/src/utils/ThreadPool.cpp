@@ -0,0 +1,268 @@
+#include "utils/ThreadPool.hpp"
+
+/**
+ * @file ThreadPool.cpp
+ * @brief Implementation of utils::ThreadPool and utils::TaskGroup.
+ *
+ * Each queue has its own lock, held only long enough to push or take one task, so an owner and a thief
+ * only contend when they reach for the same queue at once. Sleeping threads, whether idle workers or
+ * threads waiting on a group, block on one condition variable. Pushing a task and finishing a group's
+ * last task each wake them, but only when some are asleep: the counter of sleepers and the counter each
+ * side changes are both sequentially consistent, so either the sleeper sees the change before it blocks
+ * or the other side sees the sleeper and takes the lock to wake it.
+ *
+ * Provides implementations only; see ThreadPool.hpp for definitions.
+ */
+
+#include <algorithm>        // for max and find_if
+#include <iterator>         // for next
+#include <utility>          // for move and exchange
+
+namespace utils {
+    namespace {
+        // the pool and queue index of the worker running on this thread, if any
+        struct CurrentWorker {
+            const ThreadPool* pool{nullptr};
+            std::size_t index{0};
+        };
+
+        thread_local CurrentWorker current{};
+
+        // halves [begin, end) until it is no bigger than grain, queueing the upper halves so idle workers can take them
+        void split(TaskGroup& group, std::size_t begin, std::size_t end, std::size_t grain,
+            const std::function<void(std::size_t)>& body) {
+            while (end - begin > grain) {
+                std::size_t middle = begin + (end - begin) / 2;
+                group.run([&group, middle, end, grain, &body]() { split(group, middle, end, grain, body); });
+                end = middle;
+            }
+
+            for (std::size_t i = begin; i < end && !group.isCancelled(); ++i) {
+                body(i);
+            }
+        }
+    }
+
+
+    // ====================================
+    // THREADPOOL
+    // ====================================
+
+    ThreadPool::ThreadPool(std::size_t threads) {
+        std::size_t workers = threads > 1 ? threads - 1 : 0;
+
+        for (std::size_t i = 0; i < std::max<std::size_t>(workers, 1); ++i) {
+            queues_.push_back(std::make_unique<Queue>());
+        }
+        for (std::size_t i = 0; i < workers; ++i) {
+            workers_.emplace_back([this, i]() { work(i); });
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard lock{sleepMutex_};
+            stopping_ = true;
+        }
+        wake_.notify_all();
+
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    // at least one worker even on one core, so work handed off by the UI thread still runs while it waits on events
+    ThreadPool& ThreadPool::shared() {
+        static ThreadPool pool{std::max<std::size_t>(std::thread::hardware_concurrency(), 2)};
+        return pool;
+    }
+
+    std::size_t ThreadPool::getThreadCount() const {
+        return workers_.size() + 1;
+    }
+
+    // runs body(i) for every i below count, split across the pool; rethrows the first exception body throws
+    void ThreadPool::parallelFor(std::size_t count, const std::function<void(std::size_t)>& body) {
+        if (workers_.empty()) {
+            for (std::size_t i = 0; i < count; ++i) {
+                body(i);
+            }
+            return;
+        }
+        if (count == 0) {
+            return;
+        }
+
+        // about eight pieces per thread: enough to even out the tail without spending the time on queueing
+        std::size_t grain = std::max<std::size_t>(count / (getThreadCount() * 8), 1);
+        TaskGroup group{*this};
+        group.run([&group, count, grain, &body]() { split(group, 0, count, grain, body); });
+        group.wait();
+    }
+
+    // a worker pushes onto its own queue; any other thread spreads its tasks across the workers' queues
+    void ThreadPool::push(Task task) {
+        std::size_t index = current.pool == this ? current.index
+            : nextQueue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+
+        {
+            std::lock_guard lock{queues_[index]->mutex};
+            queues_[index]->tasks.push_back(std::move(task));
+        }
+        ++queued_;
+
+        // every sleeper, since a thread waiting on another group won't take this task and go back to sleep
+        if (sleeping_.load() > 0) {
+            std::lock_guard lock{sleepMutex_};
+            wake_.notify_all();
+        }
+    }
+
+    // the newest task on this worker's own queue, or else the oldest on anyone's; only those of only, if given
+    bool ThreadPool::runOne(const TaskGroup* only) {
+        bool isWorker = current.pool == this;
+        std::size_t home = isWorker ? current.index : 0;
+        auto matches = [only](const Task& task) { return only == nullptr || task.group == only; };
+        Task task{};
+        bool found = false;
+
+        if (isWorker) {
+            Queue& own = *queues_[home];
+            std::lock_guard lock{own.mutex};
+            auto it = std::find_if(own.tasks.rbegin(), own.tasks.rend(), matches);
+            if (it != own.tasks.rend()) {
+                task = std::move(*it);
+                own.tasks.erase(std::next(it).base());
+                found = true;
+            }
+        }
+
+        for (std::size_t offset = isWorker ? 1 : 0; !found && offset < queues_.size(); ++offset) {
+            Queue& victim = *queues_[(home + offset) % queues_.size()];
+            std::lock_guard lock{victim.mutex};
+            auto it = std::find_if(victim.tasks.begin(), victim.tasks.end(), matches);
+            if (it != victim.tasks.end()) {
+                task = std::move(*it);
+                victim.tasks.erase(it);
+                found = true;
+            }
+        }
+
+        if (!found) {
+            return false;
+        }
+
+        --queued_;
+        --task.group->queued_;
+        execute(task);
+        return true;
+    }
+
+    void ThreadPool::execute(Task& task) {
+        TaskGroup* group = task.group;
+
+        if (!group->isCancelled()) {
+            try {
+                task.work();
+            } catch (...) {
+                group->fail(std::current_exception());
+            }
+        }
+        task.work = nullptr;    // drop what the task captured before its group can finish
+
+        // the group may be destroyed as soon as pending_ reaches zero, so it isn't touched after this
+        if (group->pending_.fetch_sub(1) == 1) {
+            wakeAll();
+        }
+    }
+
+    // blocks until ready() holds or the pool is stopping
+    void ThreadPool::sleepUntil(const std::function<bool()>& ready) {
+        std::unique_lock lock{sleepMutex_};
+        ++sleeping_;
+        wake_.wait(lock, [this, &ready]() { return stopping_ || ready(); });
+        --sleeping_;
+    }
+
+    void ThreadPool::wakeAll() {
+        if (sleeping_.load() > 0) {
+            std::lock_guard lock{sleepMutex_};
+            wake_.notify_all();
+        }
+    }
+
+    void ThreadPool::work(std::size_t index) {
+        current = CurrentWorker{this, index};
+
+        while (true) {
+            if (runOne()) {
+                continue;
+            }
+
+            sleepUntil([this]() { return queued_.load() > 0; });
+
+            std::lock_guard lock{sleepMutex_};
+            if (stopping_ && queued_.load() == 0) {
+                return;
+            }
+        }
+    }
+
+
+    // ====================================
+    // TASKGROUP
+    // ====================================
+
+    TaskGroup::TaskGroup(ThreadPool& pool) : pool_{pool} {}
+
+    TaskGroup::~TaskGroup() {
+        try {
+            wait();
+        } catch (...) {
+            // the owner didn't wait, so nobody is left to hand the exception to
+        }
+    }
+
+    void TaskGroup::run(std::function<void()> task) {
+        ++pending_;
+        ++queued_;
+        pool_.push(ThreadPool::Task{std::move(task), this});
+    }
+
+    // runs this group's queued tasks until every one of them is done, and sleeps while the rest are running elsewhere
+    void TaskGroup::wait() {
+        while (pending_.load() > 0) {
+            if (!pool_.runOne(this)) {
+                pool_.sleepUntil([this]() { return pending_.load() == 0 || queued_.load() > 0; });
+            }
+        }
+
+        std::exception_ptr error;
+        {
+            std::lock_guard lock{errorMutex_};
+            error = std::exchange(error_, nullptr);
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // tasks that haven't started are skipped; a cancelled group stays cancelled
+    void TaskGroup::cancel() {
+        cancelled_ = true;
+    }
+
+    bool TaskGroup::isCancelled() const {
+        return cancelled_.load(std::memory_order_relaxed);
+    }
+
+    void TaskGroup::fail(std::exception_ptr error) {
+        {
+            std::lock_guard lock{errorMutex_};
+            if (!error_) {
+                error_ = std::move(error);
+            }
+        }
+        cancel();
+    }
+}
@@ -12,6 +12,7 @@
 #include <algorithm>        // for all_of
 #include <cctype>           // for isspace
 #include <cmath>            // for fabs, min, max, and round
+#include <cstdint>          // for fixed-width hash state
 #include <limits>           // for numeric limits
 #include <QDate>
 #include <uuid/uuid.h>      // for UUID
@@ -24,15 +25,98 @@ namespace utils {
         return std::chrono::year_month_day{floor<std::chrono::days>(std::chrono::system_clock::now())};
     } 
 
-    // takes date as string input and converts to year_month_day format
-    std::chrono::year_month_day parseDate(const std::string& input) {
-        int y, m, d;
+    DateParseError::DateParseError(const std::string& message, std::size_t position)
+        : std::invalid_argument{message}, position_{position} {}
 
-        if (sscanf(input.c_str(), "%d-%d-%d", &y, &m, &d) == 3) {
-            return std::chrono::year{y}/std::chrono::month{static_cast<unsigned>(m)}/std::chrono::day{static_cast<unsigned>(d)};
+    std::size_t DateParseError::getPosition() const {
+        return position_;
+    }
+
+    // takes date as string input in the form YYYY-M-D (month and day may be zero-padded) and converts to
+    // year_month_day format; surrounding whitespace is ignored, anything else is rejected with its position
+    std::chrono::year_month_day parseDate(std::string_view input) {
+        std::size_t pos = 0;
+
+        auto isDigit = [](char c) { return c >= '0' && c <= '9'; };
+        auto fail = [&pos](const std::string& reason) -> DateParseError {
+            return DateParseError{"Invalid date format at position " + std::to_string(pos) + ". " + reason, pos};
+        };
+
+        // reads a run of minDigits to maxDigits decimal digits without allocating
+        auto readNumber = [&](std::size_t minDigits, std::size_t maxDigits, const char* field) {
+            unsigned value = 0;
+            std::size_t start = pos;
+
+            while (pos < input.size() && pos - start < maxDigits && isDigit(input[pos])) {
+                value = value * 10 + static_cast<unsigned>(input[pos] - '0');
+                ++pos;
+            }
+
+            if (pos - start < minDigits) {
+                throw fail(std::string{"Expected "} + field + ".");
+            }
+
+            return value;
+        };
+
+        auto expectSeparator = [&]() {
+            if (pos >= input.size() || input[pos] != '-') {
+                throw fail("Expected '-' separator.");
+            }
+            ++pos;
+        };
+
+        while (pos < input.size() && std::isspace(static_cast<unsigned char>(input[pos]))) {
+            ++pos;
+        }
+
+        unsigned y = readNumber(4, 4, "4-digit year");
+        expectSeparator();
+        std::size_t monthPos = pos;
+        unsigned m = readNumber(1, 2, "1- or 2-digit month");
+        expectSeparator();
+        std::size_t dayPos = pos;
+        unsigned d = readNumber(1, 2, "1- or 2-digit day");
+
+        while (pos < input.size() && std::isspace(static_cast<unsigned char>(input[pos]))) {
+            ++pos;
+        }
+
+        if (pos != input.size()) {
+            throw fail("Unexpected trailing characters.");
+        }
+
+        // calendar validation, reported at the start of the offending field
+        if (m < 1 || m > 12) {
+            pos = monthPos;
+            throw fail("Month must be from 1 to 12.");
+        }
+
+        std::chrono::year year{static_cast<int>(y)};
+        std::chrono::month month{m};
+        std::chrono::day lastDay = std::chrono::year_month_day_last{year, std::chrono::month_day_last{month}}.day();
+
+        if (d < 1 || std::chrono::day{d} > lastDay) {
+            pos = dayPos;
+            throw fail("Day must be from 1 to " + std::to_string(static_cast<unsigned>(lastDay)) + ".");
         }
 
-        throw std::invalid_argument("Invalid date format. Expected YYYY-MM-DD.");
+        return year/month/std::chrono::day{d};
+    }
+
+    // parses each input into the matching output slot; stops at the first malformed date and reports its index
+    void parseDates(std::span<const std::string_view> inputs, std::span<std::chrono::year_month_day> outputs) {
+        if (outputs.size() < inputs.size()) {
+            throw std::out_of_range("Output span is smaller than input span.");
+        }
+
+        for (std::size_t i = 0; i < inputs.size(); ++i) {
+            try {
+                outputs[i] = parseDate(inputs[i]);
+            } catch (const DateParseError& e) {
+                throw DateParseError{"Date " + std::to_string(i) + ": " + e.what(), e.getPosition()};
+            }
+        }
     }
 
     // takes a date in QtDate format and returns it in std::chrono format
@@ -134,6 +218,48 @@ namespace utils {
         return startDate + std::chrono::months{numMonths};
     }
 
+    namespace {
+        // matches stringLower for ASCII, without depending on the locale
+        constexpr unsigned char foldCase(unsigned char c) {
+            return (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c + ('a' - 'A')) : c;
+        }
+    }
+
+    // FNV-1a over the case-folded bytes
+    std::size_t CaseInsensitiveHash::operator()(std::string_view str) const noexcept {
+        std::uint64_t hash = 0xcbf29ce484222325ull;
+        for (unsigned char c : str) {
+            hash ^= foldCase(c);
+            hash *= 0x100000001b3ull;
+        }
+        return static_cast<std::size_t>(hash);
+    }
+
+    bool CaseInsensitiveEqual::operator()(std::string_view a, std::string_view b) const noexcept {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](unsigned char x, unsigned char y) {
+            return foldCase(x) == foldCase(y);
+        });
+    }
+
+    // the stored form of a title in a TitleIndex, folded the same way the hash and equality fold
+    std::string titleKey(std::string_view title) {
+        std::string key(title.size(), '\0');
+        std::transform(title.begin(), title.end(), key.begin(), [](unsigned char c) {
+            return static_cast<char>(foldCase(c));
+        });
+        return key;
+    }
+
+    // erases a title by lookup, since unordered_map only gains a heterogeneous erase in C++23; returns whether it was there
+    bool eraseTitle(TitleIndex& index, std::string_view title) {
+        auto it = index.find(title);
+        if (it == index.end()) {
+            return false;
+        }
+        index.erase(it);
+        return true;
+    }
+
     // transform string to all lowercase
     std::string stringLower(std::string input) {
         std::transform(input.begin(), input.end(), input.begin(),
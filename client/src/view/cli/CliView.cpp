@@ -10,7 +10,6 @@
  * Provides implementations only; see CliView.hpp for definitions.
  */
 
-#include <cstdio>       // for sscanf
 #include <algorithm>    // for transform
 #include <cctype>       // for tolower
 #include <sstream>      // for stringstream variables
@@ -144,13 +143,29 @@ void CliView::displayTermMenu() const {
         out_ << "[E] Edit term" << "\n";
         out_ << "[S] Select term" << "\n";
         out_ << "[R] Remove term" << "\n";
+        out_ << "[D] View due dates" << "\n";
+        out_ << "[F] Find (search everything)" << "\n";
+        displayUndoChoices();
         out_ << "[X] Exit program" << "\n";
     } else {
         out_ << "[A] Add term" << "\n";
+        displayUndoChoices();
         out_ << "[X] Exit program" << "\n";
     }
 }
 
+// prints undo and redo choices, naming the edit each would revert or make again, when there is one
+void CliView::displayUndoChoices() const {
+    const UndoLog& undoLog = controller_.getUndoLog();
+
+    if (undoLog.canUndo()) {
+        out_ << "[U] Undo " << undoLog.getUndoLabel() << "\n";
+    }
+    if (undoLog.canRedo()) {
+        out_ << "[Y] Redo " << undoLog.getRedoLabel() << "\n";
+    }
+}
+
 // prints a menu of choices for the user to select a Course
 void CliView::displayCourseMenu() const {
     displayDelim();
@@ -204,12 +219,13 @@ void CliView::displayViewAssignmentMenu() const {
     out_ << "[A] All assignments" << "\n";
     out_ << "[C] Completed assignments" << "\n";
     out_ << "[I] Incomplete assignments" << "\n";
+    out_ << "[D] Assignments due soon" << "\n";
     out_ << "[X] Exit to assignment menu" << "\n";
 }
 
 // displays information about all terms from TermController
 void CliView::displayTermListInfo() const {
-    const std::unordered_map<std::string, Term>& terms = controller_.getTermList();
+    const TermList& terms = controller_.getTermList();
 
     for (const auto& [id, term] : terms) {
         displaySecondaryDelim();
@@ -220,7 +236,7 @@ void CliView::displayTermListInfo() const {
 
 // displays information about all courses from the selected term
 void CliView::displayCourseListInfo() const {
-    const std::unordered_map<std::string, Course>& courses = selectedTerm_->get().getCourseList();
+    const CourseList& courses = selectedTerm_->get().getCourseList();
 
     for (const auto& [id, course] : courses) {
         displaySecondaryDelim();
@@ -288,6 +304,34 @@ void CliView::displayIncompleteAssignmentInfo() const {
     }
 }
 
+// prints one line of a due-date listing; term and course are left out when listing a single course
+void CliView::displayDueAssignment(const Assignment& assignment, const Term* term, const Course* course) const {
+    displaySecondaryDelim();
+    out_ << assignment.getDueDate() << "  ";
+    if (term != nullptr && course != nullptr) {
+        out_ << term->getTitle() << " / " << course->getTitle() << " / ";
+    }
+    out_ << assignment.getTitle();
+    if (assignment.getCompleted()) {
+        out_ << " (completed)";
+    }
+    out_ << "\n";
+}
+
+// prints one search result as its path from the term down, tagged with what kind of entry it is
+void CliView::displaySearchResult(const SearchResult& result) const {
+    displaySecondaryDelim();
+    if (result.assignment != nullptr) {
+        out_ << "[Assignment] " << result.term->getTitle() << " / " << result.course->getTitle() << " / "
+             << result.assignment->getTitle();
+    } else if (result.course != nullptr) {
+        out_ << "[Course] " << result.term->getTitle() << " / " << result.course->getTitle();
+    } else {
+        out_ << "[Term] " << result.term->getTitle();
+    }
+    out_ << "\n";
+}
+
 // displays invalid selection output
 void CliView::displayInvalidSelection() const {
     out_ << "Invalid selection. Please try again." << "\n";
@@ -1217,6 +1261,9 @@ void CliView::promptViewAssignment() {
         case 'I':
             displayIncompleteAssignmentInfo();
             break;
+        case 'D':
+            promptViewDueDates(true);
+            break;
         case 'X':
             break;
         default:
@@ -1225,6 +1272,93 @@ void CliView::promptViewAssignment() {
     }
 }
 
+// prompt the user for a window of days and list what falls due in it, either across every term or in the selected course
+void CliView::promptViewDueDates(bool selectedCourseOnly) {
+    bool invalidBool{true};
+
+    out_ << "Enter the following information for the due dates you'd like to view: " << "\n";
+    int days = getIntInput("Days ahead", 7);
+
+    if (days < 0) {
+        out_ << "Days ahead must not be negative. Using default." << "\n";
+        days = 7;
+    }
+
+    bool incompleteOnly{true};
+    while (invalidBool) {
+        try {
+            incompleteOnly = getBoolInput("Incomplete assignments only? (yes/no)", true);
+            invalidBool = false;
+        } catch (const std::exception& e) {
+            out_ << "Invalid response. Please try again." << "\n";
+        }
+    }
+
+    std::chrono::year_month_day from = utils::getTodayDate();
+    std::chrono::year_month_day to{std::chrono::sys_days{from} + std::chrono::days{days}};
+    bool anyDue{false};
+
+    if (selectedCourseOnly) {
+        for (const Assignment* assignment : selectedCourse_->get().getAssignmentsDue(from, to, incompleteOnly)) {
+            displayDueAssignment(*assignment, nullptr, nullptr);
+            anyDue = true;
+        }
+    } else {
+        for (const DueAssignment& due : controller_.getAssignmentsDue(from, to, incompleteOnly)) {
+            displayDueAssignment(*due.assignment, due.term, due.course);
+            anyDue = true;
+        }
+    }
+
+    displaySecondaryDelim();
+    if (!anyDue) {
+        out_ << "No assignments due from " << from << " to " << to << "." << "\n";
+        displaySecondaryDelim();
+    }
+}
+
+// prompt the user for words to look for and list the best matches across every term
+void CliView::promptSearch() {
+    out_ << "Enter the words you'd like to search for in titles, descriptions, and categories: " << "\n";
+    std::string query = getStringInput("Search", "");
+
+    if (utils::isOnlyWhitespace(query)) {
+        out_ << "Search must be non-empty. Operation cancelled." << "\n";
+        return;
+    }
+
+    std::vector<SearchResult> results = controller_.search(query);
+
+    for (const SearchResult& result : results) {
+        displaySearchResult(result);
+    }
+
+    displaySecondaryDelim();
+    if (results.empty()) {
+        out_ << "No matches for '" << query << "'." << "\n";
+        displaySecondaryDelim();
+    }
+}
+
+// reverts the last edit, or makes the last undone edit again; offered from the term menu only, where no term or
+// course is selected that it could remove
+void CliView::undoOrRedo(bool redo) {
+    const UndoLog& undoLog = controller_.getUndoLog();
+    const std::string label = redo ? undoLog.getRedoLabel() : undoLog.getUndoLabel();
+
+    try {
+        if (redo) {
+            controller_.redo();
+        } else {
+            controller_.undo();
+        }
+        out_ << (redo ? "Redid: " : "Undid: ") << label << "\n";
+    } catch (const std::exception& e) {
+        out_ << "Could not " << (redo ? "redo " : "undo ") << label << ": " << e.what()
+            << " It was removed from the history." << "\n";
+    }
+}
+
 // ask the user for a char input, using the default value in the case of an invalid input 
 char CliView::getCharInput(const std::string &label, const char defaultVal) const {
     out_ << label << " [default: " << defaultVal << "]: ";
@@ -1477,6 +1611,42 @@ void CliView::run() {
                         displayInvalidSelection();
                     }
 
+                    break;
+                case 'D':
+                    // view due dates across all terms
+                    if (controller_.getTermList().size() > 0) {
+                        promptViewDueDates(false);
+                    } else {
+                        displayInvalidSelection();
+                    }
+
+                    break;
+                case 'F':
+                    // search every term
+                    if (controller_.getTermList().size() > 0) {
+                        promptSearch();
+                    } else {
+                        displayInvalidSelection();
+                    }
+
+                    break;
+                case 'U':
+                    // undo the last edit anywhere
+                    if (controller_.getUndoLog().canUndo()) {
+                        undoOrRedo(false);
+                    } else {
+                        displayInvalidSelection();
+                    }
+
+                    break;
+                case 'Y':
+                    // redo the last undone edit
+                    if (controller_.getUndoLog().canRedo()) {
+                        undoOrRedo(true);
+                    } else {
+                        displayInvalidSelection();
+                    }
+
                     break;
                 case 'X':
                     // exit
@@ -20,6 +20,7 @@
 #include <QMessageBox>
 #include <QPushButton>
 #include <QStackedLayout>
+#include "trace/Trace.hpp"
 #include "view/qt/FormDialog.hpp"
 
 static const QString kBtnActive =
@@ -435,8 +436,8 @@ QString CourseView::formatDueDate(const std::chrono::year_month_day& date) const
 }
 
 // reconnects the assignment-level dataChanged signal to the currently active
-// AssignmentController, since CourseController re-emplaces it on every course
-// selection and a fresh QObject means a fresh set of connections
+// AssignmentController, since each course has its own cached controller and the
+// previous course's must stop refreshing this view
 void CourseView::onCourseSelected() {
     disconnect(assignmentDataChangedConn_);
 
@@ -450,6 +451,7 @@ void CourseView::onCourseSelected() {
 }
 
 void CourseView::refreshAssignmentList() {
+    TRACE_SCOPE("CourseView::refreshAssignmentList");
     clearAssignmentRows();
     assignmentListLayout_->addStretch();
 
@@ -9,10 +9,29 @@
  */
 
 #include <QDebug>
+#include <QApplication>
+#include <QDrag>
+#include <QDragEnterEvent>
+#include <QDropEvent>
+#include <QAction>
+#include <QFileDialog>
 #include <QFrame>
+#include <QMenuBar>
+#include <QMimeData>
+#include <QMouseEvent>
 #include <QStackedLayout>
+#include <QStatusBar>
 #include <QMessageBox>
+#include <QShortcut>
+#include <QKeySequence>
 #include <sstream>
+#include "trace/Trace.hpp"
+#include "utils/utils.hpp"
+
+namespace {
+    // carries the dragged term's ID between a sidebar row and the term list
+    const QString termMimeType = QStringLiteral("application/x-course-companion-term");
+}
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent) {
@@ -37,11 +56,43 @@ void MainWindow::setupUi() {
     auto* sidebarLabel = new QLabel("Course Companion", sidebar_);
     sidebarLabel->setStyleSheet("font-size: 13px; font-weight: 600; color: #333;");
 
-    auto* termListWidget = new QWidget(sidebar_);
-    termListLayout_ = new QVBoxLayout(termListWidget);
+    // searches every term as the user types; matches are listed just below it, above the term list
+    searchBox_ = new QLineEdit(sidebar_);
+    searchBox_->setPlaceholderText("Search everything");
+    searchBox_->setClearButtonEnabled(true);
+    searchBox_->setStyleSheet(
+        "QLineEdit {"
+        "  font-size: 12px;"
+        "  background: #ffffff;"
+        "  border: 1px solid #ddd;"
+        "  border-radius: 4px;"
+        "  padding: 4px 6px;"
+        "}"
+    );
+
+    searchListWidget_ = new QWidget(sidebar_);
+    searchListLayout_ = new QVBoxLayout(searchListWidget_);
+    searchListLayout_->setContentsMargins(0, 0, 0, 0);
+    searchListLayout_->setSpacing(2);
+    searchListWidget_->hide();
+
+    // rows can be dragged to reorder the terms; see eventFilter
+    termListWidget_ = new QWidget(sidebar_);
+    termListWidget_->setAcceptDrops(true);
+    termListWidget_->installEventFilter(this);
+    termListLayout_ = new QVBoxLayout(termListWidget_);
     termListLayout_->setContentsMargins(0, 0, 0, 0);
     termListLayout_->setSpacing(6);
 
+    // incomplete assignments from every term that fall due this week, read from the controller's due-date index
+    auto* dueLabel = new QLabel("Due in the next 7 days", sidebar_);
+    dueLabel->setStyleSheet("font-size: 12px; font-weight: 600; color: #333;");
+
+    auto* dueListWidget = new QWidget(sidebar_);
+    dueListLayout_ = new QVBoxLayout(dueListWidget);
+    dueListLayout_->setContentsMargins(0, 0, 0, 0);
+    dueListLayout_->setSpacing(2);
+
     auto* addTermButton = new QPushButton("+ Add Term", sidebar_);
     addTermButton->setStyleSheet(
         "QPushButton {"
@@ -57,8 +108,14 @@ void MainWindow::setupUi() {
 
     sidebarLayout->addWidget(sidebarLabel);
     sidebarLayout->addSpacing(8);
-    sidebarLayout->addWidget(termListWidget);
+    sidebarLayout->addWidget(searchBox_);
+    sidebarLayout->addWidget(searchListWidget_);
+    sidebarLayout->addSpacing(8);
+    sidebarLayout->addWidget(termListWidget_);
     sidebarLayout->addStretch();
+    sidebarLayout->addWidget(dueLabel);
+    sidebarLayout->addWidget(dueListWidget);
+    sidebarLayout->addSpacing(8);
     sidebarLayout->addWidget(addTermButton);
 
     auto* termPage       = new TermView(controller_);
@@ -91,6 +148,16 @@ void MainWindow::setupUi() {
     connect(addTermButton, &QPushButton::clicked, termPage, &TermView::onAddTerm);
     connect(&controller_, &TermController::dataChanged, this, &MainWindow::refreshTermList);
     connect(&controller_, &TermController::dataChanged, this, &MainWindow::updateTermPageVisibility);
+    connect(&controller_, &TermController::dataChanged, this, &MainWindow::refreshDueList);
+    connect(&controller_, &TermController::termSelected, this, &MainWindow::refreshDueList);
+    connect(&controller_, &TermController::dataChanged, this, &MainWindow::refreshSearchResults);
+    connect(searchBox_, &QLineEdit::textChanged, this, &MainWindow::refreshSearchResults);
+
+    // Ctrl+Z and Ctrl+Shift+Z (or the platform's equivalents) reach edits made on any page
+    auto* undoShortcut = new QShortcut(QKeySequence::Undo, this);
+    auto* redoShortcut = new QShortcut(QKeySequence::Redo, this);
+    connect(undoShortcut, &QShortcut::activated, this, [this]() { undoOrRedo(false); });
+    connect(redoShortcut, &QShortcut::activated, this, [this]() { undoOrRedo(true); });
 
     connect(termPage, &TermView::courseSelected, this,
         [this, coursePage](const QString& title) {
@@ -106,7 +173,10 @@ void MainWindow::setupUi() {
     );
 
     connect(coursePage, &CourseView::backRequested, this,
-        [this]() { stack_->setCurrentIndex(0); }
+        [this]() {
+            refreshDueList();   // assignment edits only signal the course page
+            stack_->setCurrentIndex(0);
+        }
     );
 
     connect(coursePage, &CourseView::assignmentSelected, this,
@@ -127,29 +197,201 @@ void MainWindow::setupUi() {
         [this]() { stack_->setCurrentIndex(1); }
     );
 
+    setupFileMenu();
     refreshTermList();
+    refreshDueList();
+}
+
+// import, export and recompute run as controller operations; while one runs, the status bar shows its progress
+// and a Cancel button, and the menu is disabled
+void MainWindow::setupFileMenu() {
+    fileMenu_ = menuBar()->addMenu("&File");
+    QAction* importAction = fileMenu_->addAction("&Import...");
+    QAction* exportAction = fileMenu_->addAction("&Export...");
+    fileMenu_->addSeparator();
+    QAction* recomputeAction = fileMenu_->addAction("&Recompute Grades");
+
+    progressBar_ = new QProgressBar(this);
+    progressBar_->setRange(0, 1000);
+    progressBar_->setMaximumWidth(200);
+    progressBar_->hide();
+    cancelButton_ = new QPushButton("Cancel", this);
+    cancelButton_->hide();
+    statusBar()->addPermanentWidget(progressBar_);
+    statusBar()->addPermanentWidget(cancelButton_);
+
+    connect(importAction, &QAction::triggered, this, [this]() {
+        QString path = QFileDialog::getOpenFileName(this, "Import Terms", QString(), "JSON files (*.json)");
+        if (!path.isEmpty()) {
+            watchOperation(controller_.importAsync(path.toStdString()), "Import Failed");
+        }
+    });
+    connect(exportAction, &QAction::triggered, this, [this]() {
+        QString path = QFileDialog::getSaveFileName(this, "Export Terms", QString(), "JSON files (*.json)");
+        if (!path.isEmpty()) {
+            watchOperation(controller_.exportAsync(path.toStdString()), "Export Failed");
+        }
+    });
+    connect(recomputeAction, &QAction::triggered, this, [this]() {
+        watchOperation(controller_.recomputeAllAsync(), "Recompute Failed");
+    });
+    connect(cancelButton_, &QPushButton::clicked, this, [this]() {
+        if (operation_ != nullptr) {
+            operation_->cancel();
+        }
+    });
+}
+
+void MainWindow::watchOperation(AsyncOperation* operation, const QString& failureTitle) {
+    operation_ = operation;
+    fileMenu_->setEnabled(false);
+    progressBar_->setValue(0);
+    progressBar_->show();
+    cancelButton_->show();
+
+    auto end = [this, operation]() {
+        operation_ = nullptr;
+        fileMenu_->setEnabled(true);
+        progressBar_->hide();
+        cancelButton_->hide();
+        operation->deleteLater();
+    };
+
+    connect(operation, &AsyncOperation::progressChanged, this, [this](double progress) {
+        progressBar_->setValue(static_cast<int>(progress * 1000));
+    });
+    connect(operation, &AsyncOperation::finished, this, end);
+    connect(operation, &AsyncOperation::cancelled, this, end);
+    connect(operation, &AsyncOperation::failed, this, [this, end, failureTitle](const QString& message) {
+        end();
+        QMessageBox::warning(this, failureTitle, message);
+    });
 }
 
 void MainWindow::refreshTermList() {
+    TRACE_SCOPE("MainWindow::refreshTermList");
     QLayoutItem* item;
     while ((item = termListLayout_->takeAt(0)) != nullptr) {
         delete item->widget();
         delete item;
     }
 
-    for (const std::string& id : controller_.getTermOrder()) {
-        addTermRow(controller_.getTermList().at(id));
+    for (const auto& [id, term] : controller_.getTermList()) {
+        addTermRow(term);
     }
 
     termListLayout_->addStretch();
 }
 
+// lists up to eight assignments due from today through the next week, soonest first
+void MainWindow::refreshDueList() {
+    TRACE_SCOPE("MainWindow::refreshDueList");
+    constexpr std::size_t maxRows = 8;
+
+    QLayoutItem* item;
+    while ((item = dueListLayout_->takeAt(0)) != nullptr) {
+        delete item->widget();
+        delete item;
+    }
+
+    std::chrono::year_month_day today = utils::getTodayDate();
+    std::chrono::year_month_day nextWeek{std::chrono::sys_days{today} + std::chrono::days{7}};
+    std::vector<DueAssignment> due = controller_.getAssignmentsDue(today, nextWeek, true);
+
+    if (due.empty()) {
+        auto* emptyLabel = new QLabel("Nothing due", sidebar_);
+        emptyLabel->setStyleSheet("font-size: 11px; color: #999;");
+        dueListLayout_->addWidget(emptyLabel);
+        return;
+    }
+
+    for (std::size_t i = 0; i < due.size() && i < maxRows; ++i) {
+        const DueAssignment& entry = due[i];
+        auto* row = new QLabel(QString("%1  %2: %3").arg(
+            utils::parseDateToQt(entry.assignment->getDueDate()).toString("MMM d"),
+            QString::fromStdString(entry.course->getTitle()),
+            QString::fromStdString(entry.assignment->getTitle())), sidebar_);
+        row->setStyleSheet("font-size: 11px; color: #555;");
+        row->setWordWrap(true);
+        dueListLayout_->addWidget(row);
+    }
+
+    if (due.size() > maxRows) {
+        auto* moreLabel = new QLabel(QString("+%1 more").arg(due.size() - maxRows), sidebar_);
+        moreLabel->setStyleSheet("font-size: 11px; color: #999;");
+        dueListLayout_->addWidget(moreLabel);
+    }
+}
+
+// lists the best matches for the search box across every term, refreshed on each keystroke and each edit;
+// clicking one opens its term
+void MainWindow::refreshSearchResults() {
+    TRACE_SCOPE("MainWindow::refreshSearchResults");
+    constexpr std::size_t maxRows = 8;
+
+    QLayoutItem* item;
+    while ((item = searchListLayout_->takeAt(0)) != nullptr) {
+        delete item->widget();
+        delete item;
+    }
+
+    const QString query = searchBox_->text().trimmed();
+    searchListWidget_->setVisible(!query.isEmpty());
+
+    if (query.isEmpty()) {
+        return;
+    }
+
+    std::vector<SearchResult> results = controller_.search(query.toStdString(), maxRows);
+
+    if (results.empty()) {
+        auto* emptyLabel = new QLabel("No matches", searchListWidget_);
+        emptyLabel->setStyleSheet("font-size: 11px; color: #999;");
+        searchListLayout_->addWidget(emptyLabel);
+        return;
+    }
+
+    for (const SearchResult& result : results) {
+        QString title;
+        QString path = QString::fromStdString(result.term->getTitle());
+
+        if (result.assignment != nullptr) {
+            title = QString::fromStdString(result.assignment->getTitle());
+            path += " / " + QString::fromStdString(result.course->getTitle());
+        } else if (result.course != nullptr) {
+            title = QString::fromStdString(result.course->getTitle());
+        } else {
+            title = path;
+            path = "Term";
+        }
+
+        auto* row = new QPushButton(QString("%1\n%2").arg(title, path), searchListWidget_);
+        row->setFlat(true);
+        row->setCursor(Qt::PointingHandCursor);
+        row->setStyleSheet(
+            "QPushButton {"
+            "  font-size: 11px;"
+            "  color: #555;"
+            "  text-align: left;"
+            "  border: none;"
+            "  padding: 2px 4px;"
+            "}"
+            "QPushButton:hover { background: rgba(55, 138, 221, 0.06); }"
+        );
+
+        const QString termTitle = QString::fromStdString(result.term->getTitle());
+        connect(row, &QPushButton::clicked, this, [this, termTitle]() { onTermRowClicked(termTitle); });
+        searchListLayout_->addWidget(row);
+    }
+}
+
 void MainWindow::addTermRow(const Term& term) {
     QString title = QString::fromStdString(term.getTitle());
     bool isSelected = (title == selectedTermTitle_);
 
     auto* card = new QFrame(sidebar_);
     card->setFixedHeight(52);
+    card->setProperty("termId", QString::fromStdString(term.getId()));
     auto* cardStack = new QStackedLayout(card);
     cardStack->setStackingMode(QStackedLayout::StackAll);
     card->setStyleSheet(isSelected
@@ -183,6 +425,8 @@ void MainWindow::addTermRow(const Term& term) {
         "QPushButton:hover { background: rgba(55, 138, 221, 0.06); }"
     );
     connect(overlay, &QPushButton::clicked, this, [this, title]() { onTermRowClicked(title); });
+    overlay->setProperty("termId", QString::fromStdString(term.getId()));
+    overlay->installEventFilter(this);
 
     cardStack->addWidget(content);
     cardStack->addWidget(overlay);
@@ -191,6 +435,98 @@ void MainWindow::addTermRow(const Term& term) {
     termListLayout_->addWidget(card);
 }
 
+// a press and a long enough move on a row's overlay starts a drag; the term list accepts the drop and moves
+// the term to the row it landed on
+bool MainWindow::eventFilter(QObject* watched, QEvent* event) {
+    if (watched == termListWidget_) {
+        switch (event->type()) {
+            case QEvent::DragEnter:
+            case QEvent::DragMove: {
+                auto* dragEvent = static_cast<QDragMoveEvent*>(event);
+                if (dragEvent->mimeData()->hasFormat(termMimeType)) {
+                    dragEvent->acceptProposedAction();
+                    return true;
+                }
+                break;
+            }
+            case QEvent::Drop: {
+                auto* dropEvent = static_cast<QDropEvent*>(event);
+                if (!dropEvent->mimeData()->hasFormat(termMimeType)) {
+                    break;
+                }
+
+                QString termId = QString::fromUtf8(dropEvent->mimeData()->data(termMimeType));
+                std::size_t position = termDropPosition(dropEvent->position().toPoint(), termId);
+                dropEvent->acceptProposedAction();
+
+                // queued, since the refresh it triggers deletes the row that is still running the drag
+                QMetaObject::invokeMethod(this, [this, termId, position]() {
+                    try {
+                        controller_.moveTerm(termId.toStdString(), position);
+                    } catch (const std::out_of_range& e) {
+                        QMessageBox::warning(this, "Move Term Failed", QString::fromStdString(e.what()));
+                    }
+                }, Qt::QueuedConnection);
+                return true;
+            }
+            default:
+                break;
+        }
+        return QMainWindow::eventFilter(watched, event);
+    }
+
+    auto* overlay = qobject_cast<QPushButton*>(watched);
+    if (overlay != nullptr && overlay->property("termId").isValid()) {
+        if (event->type() == QEvent::MouseButtonPress) {
+            auto* mouseEvent = static_cast<QMouseEvent*>(event);
+            if (mouseEvent->button() == Qt::LeftButton) {
+                dragStartPos_ = mouseEvent->position().toPoint();
+            }
+        } else if (event->type() == QEvent::MouseMove) {
+            auto* mouseEvent = static_cast<QMouseEvent*>(event);
+            bool dragged = (mouseEvent->position().toPoint() - dragStartPos_).manhattanLength() >=
+                QApplication::startDragDistance();
+            if ((mouseEvent->buttons() & Qt::LeftButton) && dragged) {
+                startTermDrag(overlay);
+                return true;
+            }
+        }
+    }
+
+    return QMainWindow::eventFilter(watched, event);
+}
+
+void MainWindow::startTermDrag(QPushButton* overlay) {
+    auto* mimeData = new QMimeData();
+    mimeData->setData(termMimeType, overlay->property("termId").toString().toUtf8());
+
+    auto* drag = new QDrag(overlay);
+    drag->setMimeData(mimeData);
+    drag->setPixmap(overlay->parentWidget()->grab());
+    drag->setHotSpot(dragStartPos_);
+    drag->exec(Qt::MoveAction);
+
+    // the release went to the drag, so the button never saw it and would stay pressed
+    overlay->setDown(false);
+}
+
+// the zero-based position among the other rows for a drop at pos: one past every row whose middle is above it
+std::size_t MainWindow::termDropPosition(const QPoint& pos, const QString& termId) const {
+    std::size_t position = 0;
+
+    for (int i = 0; i < termListLayout_->count(); ++i) {
+        QWidget* row = termListLayout_->itemAt(i)->widget();
+        if (row == nullptr || row->property("termId").toString() == termId) {
+            continue;
+        }
+        if (row->geometry().center().y() < pos.y()) {
+            ++position;
+        }
+    }
+
+    return position;
+}
+
 void MainWindow::onTermRowClicked(const QString& title) {
     try {
         controller_.selectTerm(title.toStdString());
@@ -202,6 +538,32 @@ void MainWindow::onTermRowClicked(const QString& title) {
     }
 }
 
+// reverts the last edit, or makes the last undone edit again; the course and assignment pages may be showing
+// an entity it removes, so the window goes back to the term page first
+void MainWindow::undoOrRedo(bool redo) {
+    TRACE_SCOPE("MainWindow::undoOrRedo");
+    const UndoLog& undoLog = controller_.getUndoLog();
+
+    if (redo ? !undoLog.canRedo() : !undoLog.canUndo()) {
+        return;
+    }
+
+    if (stack_->currentIndex() == 1 || stack_->currentIndex() == 2) {
+        stack_->setCurrentIndex(0);
+    }
+
+    try {
+        if (redo) {
+            controller_.redo();
+        } else {
+            controller_.undo();
+        }
+    } catch (const std::exception& e) {
+        QMessageBox::warning(this, redo ? "Redo Failed" : "Undo Failed",
+            QString::fromStdString(e.what()) + " It was removed from the history.");
+    }
+}
+
 // clears the highlighted sidebar row and switches away from the term page whenever there is no
 // active term, e.g. it was just removed; runs regardless of which page is currently showing so a
 // stale highlight can't survive into a later term reusing the same title
@@ -18,6 +18,7 @@
 #include <QPushButton>
 #include <QStackedLayout>
 #include <sstream>
+#include "trace/Trace.hpp"
 #include "utils/utils.hpp"
 #include "view/qt/FormDialog.hpp"
 
@@ -351,6 +352,7 @@ void TermView::setupFooter() {
 
 // pulls the currently active term from the controller and updates the header; falls back to a placeholder if nothing is selected
 void TermView::refreshTerm() {
+    TRACE_SCOPE("TermView::refreshTerm");
     try {
         const Term& term = controller_.getActiveTerm();
         termTitle_->setText(QString::fromStdString(term.getTitle()));
@@ -373,8 +375,8 @@ CourseController* TermView::activeCourseController() {
 }
 
 // reconnects the CourseController::dataChanged signal to whichever CourseController is
-// currently active, since TermController re-emplaces it on every selectTerm call and a fresh
-// QObject means a fresh set of connections
+// currently active, since each term has its own cached controller and the previous term's
+// must stop refreshing this view
 void TermView::onTermCourseControllerChanged() {
     disconnect(courseDataChangedConn_);
 
@@ -388,6 +390,7 @@ void TermView::onTermCourseControllerChanged() {
 }
 
 void TermView::refreshCourseList() {
+    TRACE_SCOPE("TermView::refreshCourseList");
     clearCourseRows();
     courseListLayout_->addStretch();
 
@@ -397,13 +400,10 @@ void TermView::refreshCourseList() {
         return;
     }
 
-    const auto& courseList = courseController->getCourseList();
-    const auto& courseOrder = courseController->getCourseOrder();
-    noCoursesLabel_->setVisible(courseOrder.empty());
-
-    for (const std::string& id : courseOrder) {
-        const Course& course = courseList.at(id);
+    const CourseList& courseList = courseController->getCourseList();
+    noCoursesLabel_->setVisible(courseList.empty());
 
+    for (const auto& [id, course] : courseList) {
         QString name = QString::fromStdString(course.getTitle());
 
         QString description = QString::fromStdString(course.getDescription());
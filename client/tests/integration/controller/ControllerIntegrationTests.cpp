@@ -42,13 +42,21 @@ TEST_F(ControllerIntegrationTests, RemovingTermRemovesCourses) {
     CourseController& courseController = termController.getCourseController();
     courseController.addCourse("ENGR 195A", "", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/12}, 3, false);
 
+    courseController.selectCourse("ENGR 195A");
+    courseController.getAssignmentController().addAssignment("Homework 1", "", "Homework",
+        std::chrono::year_month_day{2026y/1/12}, false, 0.0f);
+
     // check size before deletion
     ASSERT_EQ(courseController.getCourseList().size(), 1);
+    ASSERT_EQ(termController.getDueIndex().size(), 1);
 
     termController.removeTerm("Fall 2025");
 
-    // verify that objects were deleted
-    ASSERT_EQ(courseController.getCourseList().size(), 0);
+    // verify that objects were deleted; the term's course controller goes with it
+    ASSERT_TRUE(termController.getTermList().empty());
+    ASSERT_EQ(termController.getDueIndex().size(), 0);
+    ASSERT_EQ(termController.getCourseControllerCache().size(), 0);
+    ASSERT_THROW(termController.getCourseController(), std::logic_error);
 }
 
 
@@ -90,8 +98,11 @@ TEST_F(ControllerIntegrationTests, RemovingCourseRemovesAssignments) {
 
     courseController.removeCourse("ENGR 195A");
 
-    // verify that objects were deleted
-    ASSERT_EQ(assignmentController.getAssignmentList().size(), 0);
+    // verify that objects were deleted; the course's assignment controller goes with it
+    ASSERT_TRUE(courseController.getCourseList().empty());
+    ASSERT_EQ(termController.getDueIndex().size(), 0);
+    ASSERT_EQ(courseController.getAssignmentControllerCache().size(), 0);
+    ASSERT_THROW(courseController.getAssignmentController(), std::logic_error);
 }
 
 
@@ -126,9 +137,10 @@ TEST_F(ControllerIntegrationTests, DeleteTermRemovesAllChildren) {
 
     termController.removeTerm("Fall 2025");
 
-    // verify that objects were deleted
-    ASSERT_EQ(courseController.getCourseList().size(), 0);
-    ASSERT_EQ(assignmentController.getAssignmentList().size(), 0);
+    // verify that objects were deleted, along with the controllers that held them
+    ASSERT_TRUE(termController.getTermList().empty());
+    ASSERT_EQ(termController.getDueIndex().size(), 0);
+    ASSERT_EQ(termController.getCourseControllerCache().size(), 0);
 }
 
 
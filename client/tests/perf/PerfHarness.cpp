@@ -0,0 +1,210 @@
+#include "PerfHarness.hpp"
+
+/**
+ * @file PerfHarness.cpp
+ * @brief Timing and baseline comparison for the perf regression tier.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#include "io/JsonReader.hpp"
+#include "io/JsonWriter.hpp"
+
+#ifndef PERF_BASELINE_FILE
+#error "PERF_BASELINE_FILE must name the baseline JSON file for this test binary"
+#endif
+
+namespace {
+    constexpr double defaultTolerance = 0.5;
+
+    struct Entry {
+        double cost{0.0};
+        double tolerance{defaultTolerance};
+    };
+
+    // reads {"workloads": {name: {"cost": x, "tolerance": y}}}; other keys are ignored
+    class BaselineHandler : public JsonHandler {
+        public:
+            std::map<std::string, Entry> entries;
+
+            void startObject() override {
+                ++depth_;
+                if (depth_ == 3 && inWorkloads_) {
+                    current_ = &entries[key_];
+                }
+            }
+            void endObject() override {
+                if (depth_ == 3) {
+                    current_ = nullptr;
+                }
+                if (depth_ == 2) {
+                    inWorkloads_ = false;
+                }
+                --depth_;
+            }
+            void startArray() override {}
+            void endArray() override {}
+            void key(std::string_view name) override {
+                key_ = name;
+                if (depth_ == 1 && name == "workloads") {
+                    inWorkloads_ = true;
+                }
+            }
+            void stringValue(std::string_view) override {}
+            void numberValue(double value) override {
+                if (current_ != nullptr && key_ == "cost") {
+                    current_->cost = value;
+                } else if (current_ != nullptr && key_ == "tolerance") {
+                    current_->tolerance = value;
+                }
+            }
+            void boolValue(bool) override {}
+            void nullValue() override {}
+
+        private:
+            int depth_{0};
+            bool inWorkloads_{false};
+            std::string key_{};
+            Entry* current_{nullptr};
+    };
+
+    std::map<std::string, Entry> loadBaseline() {
+        std::ifstream file{PERF_BASELINE_FILE};
+        if (!file) {
+            return {};
+        }
+        BaselineHandler handler;
+        JsonReader{file}.parse(handler);
+        return handler.entries;
+    }
+
+    double roundSignificant(double value, int digits) {
+        if (value <= 0.0) {
+            return value;
+        }
+        double scale = std::pow(10.0, digits - 1 - static_cast<int>(std::floor(std::log10(value))));
+        return std::round(value * scale) / scale;
+    }
+
+    void saveBaseline(const std::map<std::string, Entry>& entries) {
+        std::ofstream file{PERF_BASELINE_FILE};
+        JsonWriter writer{file};
+        writer.startObject();
+        writer.key("workloads");
+        writer.startObject();
+        for (const auto& [name, entry] : entries) {
+            writer.key(name);
+            writer.startObject();
+            writer.key("cost");
+            writer.numberValue(roundSignificant(entry.cost, 4));
+            writer.key("tolerance");
+            writer.numberValue(entry.tolerance);
+            writer.endObject();
+        }
+        writer.endObject();
+        writer.endObject();
+        file << "\n";
+    }
+
+    bool envFlag(const char* name) {
+        const char* value = std::getenv(name);
+        return value != nullptr && *value != '\0' && std::string{value} != "0";
+    }
+
+    double envNumber(const char* name, double fallback) {
+        const char* value = std::getenv(name);
+        return value != nullptr && *value != '\0' ? std::atof(value) : fallback;
+    }
+
+    // sorting and hashing a fixed pseudo-random data set: the same kinds of work as the app's hot paths; returns
+    // a value that depends on both, for the caller to check
+    std::size_t calibrationWorkload() {
+        std::uint64_t state = 0x9E3779B97F4A7C15ull;
+        auto next = [&state] {
+            state += 0x9E3779B97F4A7C15ull;
+            std::uint64_t z = state;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        };
+
+        std::vector<std::uint64_t> values(1 << 17);
+        for (auto& value : values) {
+            value = next();
+        }
+        std::sort(values.begin(), values.end());
+
+        std::unordered_map<std::string, std::uint64_t> map;
+        for (int i = 0; i < 20000; ++i) {
+            map.emplace("calibration key " + std::to_string(next()), values[static_cast<std::size_t>(i)]);
+        }
+        return map.size() + static_cast<std::size_t>(values.front());
+    }
+}
+
+namespace perf {
+    double medianNanoseconds(const std::function<void()>& run, int runs) {
+        run();  // warm-up: caches, allocator pools, lazy statics
+
+        std::vector<double> samples;
+        for (int i = 0; i < runs; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            run();
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            samples.push_back(std::chrono::duration<double, std::nano>(elapsed).count());
+        }
+
+        std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+        return samples[samples.size() / 2];
+    }
+
+    double calibrationNanoseconds() {
+        static const double calibration = []() {
+            std::size_t checksum = 0;   // read back below, which keeps the work from being optimised away
+            double median = medianNanoseconds([&checksum]() { checksum += calibrationWorkload(); }, 9);
+            if (checksum == 0) {
+                throw std::logic_error("The calibration workload did no work.");
+            }
+            return median;
+        }();
+        return calibration;
+    }
+
+    void checkAgainstBaseline(const std::string& workload, const std::function<void()>& run, int runs) {
+        double nanoseconds = medianNanoseconds(run, runs);
+        double cost = nanoseconds / calibrationNanoseconds();
+
+        testing::Test::RecordProperty(workload + "_ms", std::to_string(nanoseconds / 1e6));
+        testing::Test::RecordProperty(workload + "_cost", std::to_string(cost));
+
+        std::map<std::string, Entry> baseline = loadBaseline();
+
+        if (envFlag("PERF_UPDATE_BASELINE")) {
+            baseline[workload].cost = cost;
+            saveBaseline(baseline);
+            std::cout << "[ RECORDED ] " << workload << ": cost " << cost << " (" << nanoseconds / 1e6 << " ms)\n";
+            return;
+        }
+
+        auto it = baseline.find(workload);
+        if (it == baseline.end()) {
+            FAIL() << "No baseline for '" << workload << "'; record one with PERF_UPDATE_BASELINE=1 (cost "
+                   << cost << ", " << nanoseconds / 1e6 << " ms).";
+        }
+
+        double limit = it->second.cost * (1.0 + it->second.tolerance * envNumber("PERF_TOLERANCE_SCALE", 1.0));
+        std::cout << "[   PERF   ] " << workload << ": cost " << cost << " vs baseline " << it->second.cost
+                  << " (limit " << limit << ", " << nanoseconds / 1e6 << " ms)\n";
+        EXPECT_LE(cost, limit) << workload << " regressed: " << cost / it->second.cost << "x its baseline cost.";
+    }
+}
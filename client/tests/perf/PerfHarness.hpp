@@ -0,0 +1,35 @@
+#ifndef PERFHARNESS_HPP
+#define PERFHARNESS_HPP
+
+/**
+ * @file PerfHarness.hpp
+ * @brief Timing and baseline comparison for the perf regression tier.
+ *
+ * Each workload is timed as the median of several runs after a warm-up, then divided by the median
+ * of a fixed calibration workload (sorting and hashing, timed the same way) so the recorded cost is
+ * a ratio that travels between machines far better than raw milliseconds. The ratio is compared to
+ * the workload's entry in the baseline file (PERF_BASELINE_FILE, one per test binary):
+ *
+ *     {"workloads": {"bulk_load": {"cost": 41.7, "tolerance": 0.5}}}
+ *
+ * and the test fails when cost exceeds baseline * (1 + tolerance). Environment variables:
+ *
+ *     PERF_UPDATE_BASELINE=1      record the measured costs instead of comparing (keeps tolerances)
+ *     PERF_TOLERANCE_SCALE=2      multiply every tolerance, for noisy machines
+ *
+ * A workload with no baseline entry fails, naming its measured cost, so a workload can't go unchecked
+ * because nobody recorded it; run the tier once with PERF_UPDATE_BASELINE=1 to add the entry.
+ */
+
+#include <functional>
+#include <string>
+
+namespace perf {
+    double medianNanoseconds(const std::function<void()>& run, int runs = 7);
+    double calibrationNanoseconds();    // measured once per process
+
+    // times the workload and compares it to the baseline (or records it); reports through gtest
+    void checkAgainstBaseline(const std::string& workload, const std::function<void()>& run, int runs = 7);
+}
+
+#endif  // PERFHARNESS_HPP
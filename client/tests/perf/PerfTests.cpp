@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <sstream>      // diverts output from terminal to separate stream
+#include <vector>       // for the search query mix
+#include "PerfHarness.hpp"
+#include "controller/TermController.hpp"
+#include "io/TermTreeJson.hpp"
+#include "synth/HistoryGenerator.hpp"
+#include "view/cli/CliView.hpp"
+
+// test fixture for the core (non-Qt-widget) perf workloads; data comes from the seeded generator,
+// so every run and every machine times the same tree
+class PerfTest : public testing::Test {
+    protected:
+        static synth::HistoryConfig config(std::size_t terms, std::size_t courses, std::size_t assignments) {
+            return synth::HistoryConfig{7, terms, courses, assignments, 2022};
+        }
+};
+
+
+// ====================================
+// LOAD WORKLOADS
+// ====================================
+
+// builds 4 terms x 10 courses x 40 assignments straight into a fresh controller
+TEST_F(PerfTest, BulkLoad) {
+    synth::HistoryGenerator generator{config(4, 10, 40)};
+
+    perf::checkAgainstBaseline("bulk_load", [&] {
+        TermController controller;
+        generator.fill(controller);
+    });
+}
+
+// imports the same history from its term tree JSON
+TEST_F(PerfTest, JsonImport) {
+    std::ostringstream os;
+    synth::HistoryGenerator{config(4, 10, 40)}.writeJson(os);
+    const std::string json = os.str();
+
+    perf::checkAgainstBaseline("json_import", [&] {
+        std::istringstream is{json};
+        TermController controller;
+        io::importTermTree(is, controller);
+    });
+}
+
+
+// ====================================
+// RECOMPUTE WORKLOADS
+// ====================================
+
+// regrades 400 assignments in a 500-assignment course, recomputing the course grade and term GPA each time
+TEST_F(PerfTest, GradeRecompute) {
+    TermController controller;
+    synth::HistoryGenerator generator{config(1, 1, 500)};
+    generator.fill(controller);
+
+    controller.selectTerm(generator.makeTerm(0).getTitle());
+    CourseController& courseController = controller.getCourseController();
+    const Course& course = courseController.getCourseList().begin()->second;
+    courseController.selectCourse(course.getTitle());
+    AssignmentController& assignmentController = courseController.getAssignmentController();
+
+    perf::checkAgainstBaseline("grade_recompute", [&] {
+        for (int i = 1; i <= 400; ++i) {
+            assignmentController.addGrade("Homework " + std::to_string(i), static_cast<float>(60 + i % 40));
+        }
+    });
+}
+
+
+// ====================================
+// SEARCH WORKLOADS
+// ====================================
+
+// runs a mix of whole-word, prefix and multi-word queries over 10 terms x 20 courses x 500 assignments
+TEST_F(PerfTest, Search) {
+    TermController controller;
+    synth::HistoryGenerator{config(10, 20, 500)}.fill(controller);
+    const std::vector<std::string> queries{"final exam", "midterm 2", "homework 42", "lab", "4", "exam"};
+
+    perf::checkAgainstBaseline("search", [&] {
+        for (int i = 0; i < 10; ++i) {
+            for (const std::string& query : queries) {
+                controller.search(query);
+            }
+        }
+    });
+}
+
+
+// ====================================
+// CLI WORKLOADS
+// ====================================
+
+// replays a menu script that opens a 400-assignment course and lists its assignments
+TEST_F(PerfTest, CliScriptReplay) {
+    TermController controller;
+    synth::HistoryGenerator generator{config(1, 3, 400)};
+    generator.fill(controller);
+
+    const Term& term = controller.findTerm(generator.makeTerm(0).getTitle());
+    const std::string courseTitle = term.getCourseList().begin()->second.getTitle();
+    const std::string script = "S\n" + term.getTitle() + "\nS\n" + courseTitle + "\nV\nA\nX\nX\nX\n";
+
+    perf::checkAgainstBaseline("cli_replay", [&] {
+        std::istringstream is{script};
+        std::ostringstream os;
+        CliView view{controller, is, os};
+        view.run();
+    });
+}
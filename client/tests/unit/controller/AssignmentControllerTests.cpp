@@ -11,7 +11,8 @@ using namespace std::chrono_literals;
 class AssignmentControllerTest : public testing::Test {
     protected:
         Course course {"ENGR 195A", "", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/12}, 3, false};
-        AssignmentController controller{course};
+        ControllerContext context{};
+        AssignmentController controller{course, context};
 };
 
 
@@ -185,6 +186,41 @@ TEST_F(AssignmentControllerTest, FindAssignmentNonConst) {
 }
 
 
+TEST_F(AssignmentControllerTest, ApplyRemoteAssignmentReplacesById) {
+    controller.addAssignment("Homework 1", "", "Homework", std::chrono::year_month_day{2026y/1/12}, false, 0.0f);
+    std::string id = controller.getAssignmentId("Homework 1");
+
+    controller.applyRemoteAssignment(Assignment::fromRow(id, "Homework One", "", "Homework",
+        std::chrono::year_month_day{2026y/1/14}, true, 88.0f));
+
+    ASSERT_EQ(controller.getAssignmentList().size(), 1);
+    ASSERT_EQ(controller.getAssignmentId("Homework One"), id);
+    ASSERT_THROW(controller.getAssignmentId("Homework 1"), std::out_of_range);
+    ASSERT_FLOAT_EQ(controller.findAssignment("Homework One").getGrade(), 88.0f);
+    ASSERT_FLOAT_EQ(course.getGradePct(), 88.0f);
+}
+
+TEST_F(AssignmentControllerTest, ApplyRemoteAssignmentAddsNew) {
+    controller.applyRemoteAssignment(Assignment::fromRow("remote-id", "Quiz 1", "", "Quiz",
+        std::chrono::year_month_day{2026y/2/1}, false, 0.0f));
+
+    ASSERT_EQ(controller.getAssignmentId("quiz 1"), "remote-id");
+}
+
+TEST_F(AssignmentControllerTest, EditsAreRecordedInTracker) {
+    ChangeTracker tracker;
+    ControllerContext trackedContext{.tracker = &tracker};
+    AssignmentController tracked{course, trackedContext};
+    tracked.addAssignment("Homework 1", "", "Homework", std::chrono::year_month_day{2026y/1/12}, false, 0.0f);
+    std::string id = tracked.getAssignmentId("Homework 1");
+    tracked.addGrade("Homework 1", 90.0f);
+
+    ASSERT_TRUE(tracker.isDirty(id));
+    ASSERT_EQ(tracker.getVersion(id), 2);
+    ASSERT_EQ(tracker.getPendingChanges().at(0).parentId, course.getId());
+}
+
+
 // ====================================
 // GETTER EDGE CASES
 // ====================================
@@ -242,6 +278,17 @@ TEST_F(AssignmentControllerTest, EditTitleEmpty) {
     ASSERT_THROW(controller.editTitle(id, ""), std::invalid_argument);
 }
 
+TEST_F(AssignmentControllerTest, EditTitleBlankKeepsTitleIndexed) {
+    controller.addAssignment("Homework 1", "", "Homework", std::chrono::year_month_day{2026y/1/12}, true, 90.0f);
+    std::string id = controller.getAssignmentId("Homework 1");
+
+    // a rejected title leaves the assignment findable and removable under its old one
+    ASSERT_THROW(controller.editTitle(id, "   "), std::invalid_argument);
+    ASSERT_EQ(controller.getAssignmentId("Homework 1"), id);
+    controller.removeAssignment("Homework 1");
+    ASSERT_TRUE(controller.getAssignmentList().empty());
+}
+
 TEST_F(AssignmentControllerTest, EditCategoryEmpty) {
     controller.addAssignment("Homework 1", "", "Homework", std::chrono::year_month_day{2026y/1/12}, true, 90.0f);
     std::string id = controller.getAssignmentId("Homework 1");
@@ -378,6 +425,28 @@ TEST_F(AssignmentControllerTest, FindAssignmentNonConstNotFound) {
 }
 
 
+TEST_F(AssignmentControllerTest, ApplyRemoteAssignmentTitleTaken) {
+    controller.addAssignment("Homework 1", "", "Homework", std::chrono::year_month_day{2026y/1/12}, false, 0.0f);
+
+    ASSERT_THROW(controller.applyRemoteAssignment(Assignment::fromRow("other-id", "HOMEWORK 1", "", "Homework",
+        std::chrono::year_month_day{2026y/1/12}, false, 0.0f)), std::logic_error);
+    ASSERT_EQ(controller.getAssignmentList().size(), 1);
+}
+
+TEST_F(AssignmentControllerTest, RemoteChangesAreNotRecorded) {
+    ChangeTracker tracker;
+    UndoLog undoLog;
+    ControllerContext trackedContext{.tracker = &tracker, .undoLog = &undoLog};
+    AssignmentController tracked{course, trackedContext};
+    tracked.applyRemoteAssignment(Assignment::fromRow("remote-id", "Quiz 1", "", "Quiz",
+        std::chrono::year_month_day{2026y/2/1}, false, 0.0f));
+    tracked.removeRemoteAssignment("remote-id");
+
+    ASSERT_EQ(tracker.getPendingCount(), 0);
+    ASSERT_FALSE(undoLog.canUndo());
+}
+
+
 // ====================================
 // SIGNAL TESTS
 // ====================================
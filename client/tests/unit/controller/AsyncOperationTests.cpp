@@ -0,0 +1,314 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <QCoreApplication>
+#include <QSignalSpy>
+#include "controller/AsyncOperation.hpp"
+#include "controller/TermController.hpp"
+#include "io/TermTreeJson.hpp"
+#include "synth/HistoryGenerator.hpp"
+
+using namespace std::chrono_literals;
+
+// test fixture for AsyncOperation and the controller operations built on it, with an event loop to pump
+class AsyncOperationTest : public testing::Test {
+    protected:
+        static inline int argc = 1;
+        static inline char name[] = "AsyncOperationTests";
+        static inline char* argv[] = {name, nullptr};
+        QCoreApplication app{argc, argv};
+        TermController controller{};
+        std::filesystem::path path{std::filesystem::temp_directory_path() / "AsyncOperationTests.json"};
+
+        void SetUp() override {
+            controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
+            controller.addTerm("Spring 2026", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/24}, true);
+            controller.selectTerm("Spring 2026");
+
+            CourseController& courseController = controller.getCourseController();
+            courseController.addCourse("CMPE 142", "", std::chrono::year_month_day{2026y/1/2},
+                std::chrono::year_month_day{2026y/5/12}, 3, true);
+            courseController.addCourse("ENGR 195A", "", std::chrono::year_month_day{2026y/1/2},
+                std::chrono::year_month_day{2026y/5/12}, 1, true);
+            courseController.selectCourse("CMPE 142");
+
+            AssignmentController& assignmentController = courseController.getAssignmentController();
+            assignmentController.addAssignment("Homework 1", "", "Homework", std::chrono::year_month_day{2026y/1/20}, true, 91.37f);
+            assignmentController.addAssignment("Midterm", "", "Midterm", std::chrono::year_month_day{2026y/3/5}, true, 84.5f);
+        }
+
+        void TearDown() override {
+            std::filesystem::remove(path);
+        }
+
+        // runs the event loop until the operation has ended; false if it is still running after ten seconds
+        static bool waitFor(const AsyncOperation& operation) {
+            auto deadline = std::chrono::steady_clock::now() + 10s;
+            while (operation.isRunning() && std::chrono::steady_clock::now() < deadline) {
+                QCoreApplication::processEvents();
+                std::this_thread::sleep_for(1ms);
+            }
+            return !operation.isRunning();
+        }
+
+        static std::string exportToString(const TermController& source) {
+            std::ostringstream os;
+            io::exportTermTree(source, os);
+            return os.str();
+        }
+};
+
+
+// ====================================
+// OPERATION TESTS
+// ====================================
+
+TEST_F(AsyncOperationTest, BackgroundThenStepsThenFinished) {
+    AsyncOperation operation;
+    QSignalSpy finished(&operation, &AsyncOperation::finished);
+    std::atomic<bool> backgroundRan{false};
+    std::thread::id caller = std::this_thread::get_id();
+    int steps = 0;
+    bool stepsOnCaller = true;
+
+    operation.start([&backgroundRan](AsyncOperation&) { backgroundRan = true; },
+        [&steps, &stepsOnCaller, caller, &backgroundRan]() {
+            stepsOnCaller = stepsOnCaller && std::this_thread::get_id() == caller && backgroundRan;
+            return ++steps == 3;
+        });
+
+    ASSERT_TRUE(operation.isRunning());
+    ASSERT_TRUE(waitFor(operation));
+    ASSERT_EQ(steps, 3);
+    ASSERT_TRUE(stepsOnCaller);
+    ASSERT_EQ(finished.count(), 1);
+    ASSERT_DOUBLE_EQ(operation.getProgress(), 1.0);
+}
+
+TEST_F(AsyncOperationTest, SignalsWaitForTheEventLoop) {
+    AsyncOperation operation;
+    operation.start({}, []() { return true; });
+
+    // connected after starting, and still nothing is missed
+    QSignalSpy finished(&operation, &AsyncOperation::finished);
+    ASSERT_EQ(finished.count(), 0);
+    ASSERT_TRUE(waitFor(operation));
+    ASSERT_EQ(finished.count(), 1);
+}
+
+TEST_F(AsyncOperationTest, ProgressIsCoalesced) {
+    AsyncOperation operation;
+    QSignalSpy progressChanged(&operation, &AsyncOperation::progressChanged);
+
+    operation.start([](AsyncOperation& self) {
+        for (std::size_t i = 1; i <= 1000; ++i) {
+            self.reportProgress(i, 1000);
+        }
+    });
+
+    ASSERT_TRUE(waitFor(operation));
+    ASSERT_GE(progressChanged.count(), 2);      // at least one update, then the one finish sends
+    ASSERT_LT(progressChanged.count(), 1000);
+    ASSERT_DOUBLE_EQ(operation.getProgress(), 1.0);
+}
+
+TEST_F(AsyncOperationTest, CancelStopsAtNextReport) {
+    AsyncOperation operation;
+    QSignalSpy cancelled(&operation, &AsyncOperation::cancelled);
+    QSignalSpy finished(&operation, &AsyncOperation::finished);
+    std::atomic<bool> started{false};
+
+    operation.start([&started](AsyncOperation& self) {
+        started = true;
+        while (true) {
+            self.reportProgress(0, 1);
+            std::this_thread::sleep_for(1ms);
+        }
+    });
+    while (!started) {
+        std::this_thread::sleep_for(1ms);
+    }
+    operation.cancel();
+
+    ASSERT_TRUE(waitFor(operation));
+    ASSERT_TRUE(operation.isCancelled());
+    ASSERT_EQ(cancelled.count(), 1);
+    ASSERT_EQ(finished.count(), 0);
+}
+
+TEST_F(AsyncOperationTest, CancelSkipsRemainingSteps) {
+    AsyncOperation operation;
+    QSignalSpy cancelled(&operation, &AsyncOperation::cancelled);
+    int steps = 0;
+
+    operation.start({}, [&operation, &steps]() {
+        if (++steps == 2) {
+            operation.cancel();
+        }
+        return false;
+    });
+
+    ASSERT_TRUE(waitFor(operation));
+    ASSERT_EQ(steps, 2);
+    ASSERT_EQ(cancelled.count(), 1);
+}
+
+TEST_F(AsyncOperationTest, ExceptionFails) {
+    AsyncOperation background;
+    AsyncOperation step;
+    QSignalSpy backgroundFailed(&background, &AsyncOperation::failed);
+    QSignalSpy stepFailed(&step, &AsyncOperation::failed);
+
+    background.start([](AsyncOperation&) { throw std::runtime_error("failed"); }, []() { return true; });
+    step.start({}, []() -> bool { throw std::logic_error("failed"); });
+
+    ASSERT_TRUE(waitFor(background));
+    ASSERT_TRUE(waitFor(step));
+    ASSERT_EQ(backgroundFailed.count(), 1);
+    ASSERT_EQ(stepFailed.count(), 1);
+}
+
+TEST_F(AsyncOperationTest, DestroyingWaitsForBackground) {
+    std::atomic<bool> started{false};
+    std::atomic<bool> done{false};
+    {
+        AsyncOperation operation;
+        operation.start([&started, &done](AsyncOperation&) {
+            started = true;
+            std::this_thread::sleep_for(20ms);
+            done = true;
+        });
+        while (!started) {
+            std::this_thread::sleep_for(1ms);
+        }
+    }
+
+    ASSERT_TRUE(done.load());
+    QCoreApplication::processEvents();  // what it queued went with it
+}
+
+
+// ====================================
+// CONTROLLER OPERATION TESTS
+// ====================================
+
+TEST_F(AsyncOperationTest, ExportWritesTheTreeAsPublished) {
+    AsyncOperation* operation = controller.exportAsync(path.string());
+    QSignalSpy finished(operation, &AsyncOperation::finished);
+
+    // edits made while it runs don't reach the file
+    std::string expected = exportToString(controller);
+    controller.addTerm("Fall 2026", std::chrono::year_month_day{2026y/8/15}, std::chrono::year_month_day{2026y/12/17}, false);
+
+    ASSERT_TRUE(waitFor(*operation));
+    ASSERT_EQ(finished.count(), 1);
+
+    std::ifstream file{path};
+    std::stringstream contents;
+    contents << file.rdbuf();
+    ASSERT_EQ(contents.str(), expected);
+}
+
+TEST_F(AsyncOperationTest, ExportToBadPathFails) {
+    AsyncOperation* operation = controller.exportAsync((path / "missing" / "out.json").string());
+    QSignalSpy failed(operation, &AsyncOperation::failed);
+
+    ASSERT_TRUE(waitFor(*operation));
+    ASSERT_EQ(failed.count(), 1);
+}
+
+TEST_F(AsyncOperationTest, CancelledExportKeepsExistingFile) {
+    std::ofstream{path} << "backup";
+    TermController large;
+    synth::HistoryGenerator{synth::HistoryConfig{.terms = 6, .coursesPerTerm = 20, .assignmentsPerCourse = 100}}
+        .fill(large);
+
+    AsyncOperation* operation = large.exportAsync(path.string());
+    QSignalSpy cancelled(operation, &AsyncOperation::cancelled);
+    operation->cancel();
+
+    ASSERT_TRUE(waitFor(*operation));
+    ASSERT_EQ(cancelled.count(), 1);
+
+    std::ifstream file{path};
+    std::stringstream contents;
+    contents << file.rdbuf();
+    ASSERT_EQ(contents.str(), "backup");
+    ASSERT_FALSE(std::filesystem::exists(path.string() + ".part"));
+}
+
+TEST_F(AsyncOperationTest, ImportMatchesSynchronousImport) {
+    std::string document = exportToString(controller);
+    std::ofstream{path} << document;
+    TermController imported;
+    QSignalSpy dataChanged(&imported, &TermController::dataChanged);
+
+    AsyncOperation* operation = imported.importAsync(path.string());
+    QSignalSpy finished(operation, &AsyncOperation::finished);
+
+    ASSERT_TRUE(waitFor(*operation));
+    ASSERT_EQ(finished.count(), 1);
+    ASSERT_GE(dataChanged.count(), 1);
+
+    // the same tree, with every imported entity queued for sync
+    TermController reference;
+    std::istringstream is{document};
+    io::importTermTree(is, reference);
+    ASSERT_EQ(exportToString(imported), exportToString(reference));
+    ASSERT_EQ(imported.getChangeTracker().getPendingCount(), reference.getChangeTracker().getPendingCount());
+    ASSERT_FLOAT_EQ(imported.findTerm("Spring 2026").getOvrGpa(), reference.findTerm("Spring 2026").getOvrGpa());
+}
+
+TEST_F(AsyncOperationTest, ImportCollisionLeavesControllerUntouched) {
+    std::ofstream{path} << exportToString(controller);
+
+    AsyncOperation* operation = controller.importAsync(path.string());
+    QSignalSpy failed(operation, &AsyncOperation::failed);
+
+    ASSERT_TRUE(waitFor(*operation));
+    ASSERT_EQ(failed.count(), 1);
+    ASSERT_EQ(controller.getTermList().size(), 2);
+}
+
+TEST_F(AsyncOperationTest, CancelledImportAddsNothing) {
+    {
+        std::ofstream file{path};
+        synth::HistoryGenerator{synth::HistoryConfig{.terms = 10, .coursesPerTerm = 20, .assignmentsPerCourse = 100}}
+            .writeJson(file);
+    }
+    TermController imported;
+
+    AsyncOperation* operation = imported.importAsync(path.string());
+    QSignalSpy cancelled(operation, &AsyncOperation::cancelled);
+
+    // cancelled after the first step, which adds part of the history but not all of it
+    QObject::connect(&imported, &TermController::dataChanged, operation, [operation]() { operation->cancel(); });
+
+    ASSERT_TRUE(waitFor(*operation));
+    ASSERT_EQ(cancelled.count(), 1);
+    ASSERT_TRUE(imported.getTermList().empty());
+    ASSERT_EQ(imported.getChangeTracker().getPendingCount(), 0);
+}
+
+TEST_F(AsyncOperationTest, RecomputeMatchesSynchronousRecompute) {
+    AsyncOperation* operation = controller.recomputeAllAsync();
+    QSignalSpy finished(operation, &AsyncOperation::finished);
+
+    ASSERT_TRUE(waitFor(*operation));
+    ASSERT_EQ(finished.count(), 1);
+
+    const Term& term = controller.findTerm("Spring 2026");
+    const Course& course = term.findCourse(controller.getCourseController().getCourseId("CMPE 142"));
+    float gpa = term.getOvrGpa();
+    float gradePct = course.getGradePct();
+
+    controller.recomputeAll();
+    ASSERT_FLOAT_EQ(term.getOvrGpa(), gpa);
+    ASSERT_FLOAT_EQ(course.getGradePct(), gradePct);
+}
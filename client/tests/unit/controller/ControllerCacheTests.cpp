@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "controller/ControllerCache.hpp"
+
+// stands in for a controller: not movable, and counts how many have been built
+struct FakeController {
+    static inline int built = 0;
+
+    explicit FakeController(int value) : value{value} {
+        ++built;
+    }
+    FakeController(const FakeController&) = delete;
+    FakeController& operator=(const FakeController&) = delete;
+
+    int value;
+};
+
+// test fixture for ControllerCache
+class ControllerCacheTest : public testing::Test {
+    protected:
+        ControllerCache<FakeController> cache{3};
+
+        void SetUp() override {
+            FakeController::built = 0;
+        }
+};
+
+
+// ====================================
+// FUNCTION SMOKE TESTS
+// ====================================
+
+TEST_F(ControllerCacheTest, ObtainBuildsOnMiss) {
+    FakeController& controller = cache.obtain("a", 1);
+
+    ASSERT_EQ(controller.value, 1);
+    ASSERT_EQ(cache.size(), 1);
+    ASSERT_EQ(FakeController::built, 1);
+}
+
+TEST_F(ControllerCacheTest, ObtainReusesOnHit) {
+    FakeController& first = cache.obtain("a", 1);
+    FakeController& second = cache.obtain("a", 2);
+
+    ASSERT_EQ(&first, &second);
+    ASSERT_EQ(second.value, 1);
+    ASSERT_EQ(FakeController::built, 1);
+}
+
+TEST_F(ControllerCacheTest, FindDoesNotBuild) {
+    ASSERT_EQ(cache.find("a"), nullptr);
+
+    FakeController& controller = cache.obtain("a", 1);
+
+    ASSERT_EQ(cache.find("a"), &controller);
+    ASSERT_EQ(FakeController::built, 1);
+}
+
+TEST_F(ControllerCacheTest, EraseDropsController) {
+    cache.obtain("a", 1);
+    cache.erase("a");
+    cache.erase("missing");
+
+    ASSERT_FALSE(cache.contains("a"));
+    ASSERT_EQ(cache.size(), 0);
+}
+
+
+// ====================================
+// EVICTION TESTS
+// ====================================
+
+TEST_F(ControllerCacheTest, EvictsLeastRecentlyObtained) {
+    cache.obtain("a", 1);
+    cache.obtain("b", 2);
+    cache.obtain("c", 3);
+    cache.obtain("a", 1);       // a is now the most recent, so b goes next
+    cache.obtain("d", 4);
+
+    ASSERT_EQ(cache.size(), 3);
+    ASSERT_TRUE(cache.contains("a"));
+    ASSERT_FALSE(cache.contains("b"));
+    ASSERT_TRUE(cache.contains("c"));
+    ASSERT_TRUE(cache.contains("d"));
+}
+
+TEST_F(ControllerCacheTest, FindDoesNotRefreshRecency) {
+    cache.obtain("a", 1);
+    cache.obtain("b", 2);
+    cache.obtain("c", 3);
+    cache.find("a");
+    cache.obtain("d", 4);
+
+    ASSERT_FALSE(cache.contains("a"));
+}
+
+TEST_F(ControllerCacheTest, PinnedControllerIsNotEvicted) {
+    FakeController& pinned = cache.obtain("a", 1);
+    cache.pin("a");
+    cache.obtain("b", 2);
+    cache.obtain("c", 3);
+    cache.obtain("d", 4);       // a is the least recently obtained, so b goes instead
+
+    ASSERT_EQ(cache.find("a"), &pinned);
+    ASSERT_FALSE(cache.contains("b"));
+    ASSERT_EQ(cache.size(), 3);
+}
+
+TEST_F(ControllerCacheTest, PinnedAndNewestBothStayAtCapacityOne) {
+    cache.obtain("a", 1);
+    cache.pin("a");
+    cache.setCapacity(1);
+    cache.obtain("b", 2);
+    cache.obtain("c", 3);
+
+    ASSERT_TRUE(cache.contains("a"));
+    ASSERT_TRUE(cache.contains("c"));
+    ASSERT_EQ(cache.size(), 2);
+
+    cache.erase("a");           // unpins it
+    cache.obtain("d", 4);
+    ASSERT_EQ(cache.size(), 1);
+}
+
+TEST_F(ControllerCacheTest, ShrinkingCapacityEvicts) {
+    cache.obtain("a", 1);
+    cache.obtain("b", 2);
+    cache.obtain("c", 3);
+    cache.setCapacity(1);
+
+    ASSERT_EQ(cache.size(), 1);
+    ASSERT_TRUE(cache.contains("c"));
+}
+
+TEST_F(ControllerCacheTest, CapacityIsAtLeastOne) {
+    cache.setCapacity(0);
+    FakeController& controller = cache.obtain("a", 1);
+
+    ASSERT_EQ(cache.getCapacity(), 1);
+    ASSERT_EQ(cache.find("a"), &controller);
+}
+
+TEST_F(ControllerCacheTest, EvictedControllerIsRebuilt) {
+    ControllerCache<FakeController> single{1};
+    single.obtain("a", 1);
+    single.obtain("b", 2);
+    single.obtain("a", 1);
+
+    ASSERT_EQ(FakeController::built, 3);
+}
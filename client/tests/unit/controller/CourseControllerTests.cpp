@@ -11,7 +11,8 @@ using namespace std::chrono_literals;
 class CourseControllerTest : public testing::Test {
     protected:
         Term term{"Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false};
-        CourseController controller{term};
+        ControllerContext context{};
+        CourseController controller{term, context};
 };
 
 
@@ -23,7 +24,7 @@ TEST_F(CourseControllerTest, CourseListGetter) {
     controller.addCourse("ENGR 195A", "", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/12}, 3, false);
     controller.addCourse("CMPE 142", "Operating Systems", {}, {}, 3, true);
 
-    const std::unordered_map<std::string, Course> &listOfCourses = controller.getCourseList();
+    const CourseList &listOfCourses = controller.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 2);
 
     // check if both added courses are in the list
@@ -55,6 +56,15 @@ TEST_F(CourseControllerTest, CourseIdGetter) {
 // FUNCTION SMOKE TESTS
 // ====================================
 
+TEST_F(CourseControllerTest, IndexesExistingCourses) {
+    term.addCourse(Course{"CMPE 142", "Operating Systems", {}, {}, 3, true});
+    CourseController fresh{term, context};
+
+    // courses already in the term are resolvable by title
+    ASSERT_EQ(fresh.getCourseList().size(), 1);
+    ASSERT_EQ(fresh.findCourse("cmpe 142").getTitle(), "CMPE 142");
+}
+
 TEST_F(CourseControllerTest, AddCourse) {
     controller.addCourse("ENGR 195A", "", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/12}, 3, false);
 
@@ -135,7 +145,7 @@ TEST_F(CourseControllerTest, RemoveCourse) {
 
     controller.removeCourse("ENGR 195A");
 
-    const std::unordered_map<std::string, Course>& listOfCourses = controller.getCourseList();
+    const CourseList &listOfCourses = controller.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // throw out of range since the course is not in the list
@@ -180,13 +190,105 @@ TEST_F(CourseControllerTest, SelectCourse) {
     ASSERT_NO_THROW(controller.selectCourse("ENGR 195A"));
 }
 
+TEST_F(CourseControllerTest, MoveCourse) {
+    controller.addCourse("ENGR 195A", "", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/12}, 3, false);
+    controller.addCourse("CMPE 142", "Operating Systems", {}, {}, 3, true);
+    std::string id = controller.getCourseId("CMPE 142");
+
+    QSignalSpy spy(&controller, &CourseController::dataChanged);
+    controller.moveCourse(id, 0);
+
+    ASSERT_EQ(controller.getCourseList().front().first, id);
+    ASSERT_EQ(term.getCourseList().front().first, id);
+    ASSERT_EQ(spy.count(), 1);
+    ASSERT_THROW(controller.moveCourse("missing", 0), std::out_of_range);
+}
+
+TEST_F(CourseControllerTest, ReselectCourseReusesAssignmentController) {
+    controller.addCourse("ENGR 195A", "", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/12}, 3, false);
+    controller.addCourse("CMPE 142", "Operating Systems", {}, {}, 3, true);
+    controller.selectCourse("ENGR 195A");
+    AssignmentController* first = &controller.getAssignmentController();
+    first->addAssignment("Homework 1", "", "Homework", std::chrono::year_month_day{2026y/1/12}, true, 90.0f);
+
+    controller.selectCourse("CMPE 142");
+    controller.selectCourse("engr 195a");
+
+    ASSERT_EQ(&controller.getAssignmentController(), first);
+    ASSERT_NO_THROW(controller.getAssignmentController().getAssignmentId("Homework 1"));
+    ASSERT_EQ(controller.getAssignmentControllerCache().size(), 2);
+}
+
+TEST_F(CourseControllerTest, RemoveCourseDropsCachedController) {
+    controller.addCourse("ENGR 195A", "", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/12}, 3, false);
+    controller.addCourse("CMPE 142", "Operating Systems", {}, {}, 3, true);
+    controller.selectCourse("ENGR 195A");
+    controller.selectCourse("CMPE 142");
+
+    controller.removeCourse("ENGR 195A");
+
+    ASSERT_EQ(controller.getAssignmentControllerCache().size(), 1);
+    ASSERT_NO_THROW(controller.getAssignmentController());
+}
+
+
+TEST_F(CourseControllerTest, ApplyRemoteCourseKeepsAssignments) {
+    controller.addCourse("CMPE 142", "", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/12}, 3, true);
+    controller.selectCourse("CMPE 142");
+    controller.getAssignmentController().addAssignment("Homework 1", "", "Homework", std::chrono::year_month_day{2026y/1/12}, true, 90.0f);
+    std::string id = controller.getCourseId("CMPE 142");
+
+    controller.applyRemoteCourse(Course::fromRow(id, "CMPE 142L", "Lab", std::chrono::year_month_day{2026y/1/5},
+        std::chrono::year_month_day{2026y/5/12}, 1, true));
+
+    const Course& course = controller.findCourse("CMPE 142L");
+    ASSERT_EQ(course.getId(), id);
+    ASSERT_EQ(course.getDescription(), "Lab");
+    ASSERT_EQ(course.getNumCredits(), 1);
+    ASSERT_EQ(course.getAssignmentList().size(), 1);
+    ASSERT_THROW(controller.getCourseId("CMPE 142"), std::out_of_range);
+    ASSERT_NO_THROW(controller.getAssignmentController().getAssignmentId("Homework 1"));
+}
+
+TEST_F(CourseControllerTest, ApplyRemoteCourseAddsNew) {
+    controller.applyRemoteCourse(Course::fromRow("remote-id", "CMPE 148", "", std::chrono::year_month_day{2026y/1/2},
+        std::chrono::year_month_day{2026y/5/12}, 3, true));
+
+    ASSERT_EQ(controller.getCourseId("cmpe 148"), "remote-id");
+    ASSERT_EQ(controller.getCourseList().back().first, "remote-id");
+}
+
+TEST_F(CourseControllerTest, ApplyRemoteAssignmentToUnselectedCourse) {
+    controller.addCourse("CMPE 142", "", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/12}, 3, true);
+    std::string id = controller.getCourseId("CMPE 142");
+
+    controller.applyRemoteAssignment(id, Assignment::fromRow("remote-id", "Homework 1", "", "Homework",
+        std::chrono::year_month_day{2026y/1/12}, true, 80.0f));
+
+    ASSERT_EQ(controller.findCourse("CMPE 142").getAssignmentList().size(), 1);
+    ASSERT_FLOAT_EQ(controller.findCourse("CMPE 142").getGradePct(), 80.0f);
+}
+
+TEST_F(CourseControllerTest, ApplyRemoteAssignmentUpdatesCachedController) {
+    controller.addCourse("CMPE 142", "", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/12}, 3, true);
+    controller.addCourse("ENGR 195A", "", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/12}, 3, false);
+    controller.selectCourse("CMPE 142");
+    controller.selectCourse("ENGR 195A");
+
+    controller.applyRemoteAssignment(controller.getCourseId("CMPE 142"), Assignment::fromRow("remote-id", "Homework 1", "",
+        "Homework", std::chrono::year_month_day{2026y/1/12}, true, 80.0f));
+    controller.selectCourse("CMPE 142");
+
+    ASSERT_EQ(controller.getAssignmentController().getAssignmentId("Homework 1"), "remote-id");
+}
+
 
 // ====================================
 // GETTER EDGE CASES
 // ====================================
 
 TEST_F(CourseControllerTest, CourseListGetterEmpty) {
-    const std::unordered_map<std::string, Course>& listOfCourses = controller.getCourseList();
+    const CourseList &listOfCourses = controller.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 0);
 }
 
@@ -233,6 +335,17 @@ TEST_F(CourseControllerTest, EditTitleEmpty) {
     ASSERT_THROW(controller.editTitle(id, ""), std::invalid_argument);
 }
 
+TEST_F(CourseControllerTest, EditTitleBlankKeepsTitleIndexed) {
+    controller.addCourse("ENGR 195A", "", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/12}, 3, false);
+    std::string id = controller.getCourseId("ENGR 195A");
+
+    // a rejected title leaves the course findable and removable under its old one
+    ASSERT_THROW(controller.editTitle(id, "   "), std::invalid_argument);
+    ASSERT_EQ(controller.getCourseId("ENGR 195A"), id);
+    controller.removeCourse("ENGR 195A");
+    ASSERT_TRUE(controller.getCourseList().empty());
+}
+
 TEST_F(CourseControllerTest, EditStartDateInvalid) {
     controller.addCourse("ENGR 195A", "", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/12}, 3, false);
     std::string id = controller.getCourseId("ENGR 195A");
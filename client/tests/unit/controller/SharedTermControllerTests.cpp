@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "controller/SharedTermController.hpp"
+
+using namespace std::chrono_literals;
+
+// test fixture for SharedTermController, with one term holding one course
+class SharedTermControllerTest : public testing::Test {
+    protected:
+        SharedTermController shared{};
+        std::string termId{};
+        std::string courseId{};
+
+        void SetUp() override {
+            termId = addTerm("Fall 2025");
+            courseId = addCourse(termId, "CMPE 142");
+        }
+
+        std::string addTerm(const std::string& title) {
+            return shared.write([&title](TermController& controller) {
+                controller.addTerm(title, std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17},
+                    true);
+                return controller.getTermId(title);
+            });
+        }
+
+        std::string addCourse(const std::string& term, const std::string& title) {
+            return shared.writeTerm(term, [&title](CourseController& courses) {
+                courses.addCourse(title, "", std::chrono::year_month_day{2025y/8/15},
+                    std::chrono::year_month_day{2025y/12/10}, 3, true);
+                return courses.getCourseId(title);
+            });
+        }
+
+        void addAssignment(const std::string& term, const std::string& course, const std::string& title) {
+            shared.writeCourse(term, course, [&title](AssignmentController& assignments) {
+                assignments.addAssignment(title, "", "Homework", std::chrono::year_month_day{2025y/9/10}, false, 0.0f);
+            });
+        }
+
+        std::size_t assignmentCount(const std::string& term, const std::string& course) const {
+            return shared.read([&term, &course](const TermController& controller) {
+                return controller.getTermList().at(term).findCourse(course).getAssignmentList().size();
+            });
+        }
+};
+
+
+// ====================================
+// FUNCTION SMOKE TESTS
+// ====================================
+
+TEST_F(SharedTermControllerTest, WritesAreReadBack) {
+    addAssignment(termId, courseId, "Homework 1");
+
+    ASSERT_EQ(assignmentCount(termId, courseId), 1);
+    ASSERT_EQ(shared.read([](const TermController& controller) { return controller.search("homework").size(); }), 1);
+}
+
+TEST_F(SharedTermControllerTest, WritesPublishSnapshots) {
+    std::uint64_t before = shared.getSnapshot()->version;
+
+    addAssignment(termId, courseId, "Homework 1");
+
+    std::shared_ptr<const Snapshot> snapshot = shared.getSnapshot();
+    ASSERT_EQ(snapshot->version, before + 1);
+    ASSERT_EQ(snapshot->findTerm(termId)->findCourse(courseId).getAssignmentList().size(), 1);
+}
+
+TEST_F(SharedTermControllerTest, EditsAddressTermsById) {
+    std::string springId = addTerm("Spring 2026");
+    std::string springCourseId = addCourse(springId, "CMPE 152");
+
+    addAssignment(termId, courseId, "Homework 1");
+    addAssignment(springId, springCourseId, "Lab 1");
+
+    ASSERT_EQ(assignmentCount(termId, courseId), 1);
+    ASSERT_EQ(assignmentCount(springId, springCourseId), 1);
+}
+
+
+// ====================================
+// FUNCTION EDGE CASES
+// ====================================
+
+TEST_F(SharedTermControllerTest, UnknownIdsThrow) {
+    ASSERT_THROW(addCourse("missing", "CMPE 152"), std::out_of_range);
+    ASSERT_THROW(addAssignment(termId, "missing", "Homework 1"), std::out_of_range);
+}
+
+TEST_F(SharedTermControllerTest, FailedWriteReleasesLockAndPublishes) {
+    ASSERT_THROW(shared.writeCourse(termId, courseId, [](AssignmentController& assignments) {
+        assignments.addAssignment("Homework 1", "", "Homework", std::chrono::year_month_day{2025y/9/10}, false, 0.0f);
+        assignments.addAssignment("Homework 1", "", "Homework", std::chrono::year_month_day{2025y/9/10}, false, 0.0f);
+    }), std::logic_error);
+
+    // the first addition went through, and the snapshot shows it
+    ASSERT_EQ(assignmentCount(termId, courseId), 1);
+    ASSERT_EQ(shared.getSnapshot()->findTerm(termId)->findCourse(courseId).getAssignmentList().size(), 1);
+}
+
+TEST_F(SharedTermControllerTest, ConcurrentWritersAndReaders) {
+    constexpr int writers = 4;
+    constexpr int perWriter = 50;
+    std::vector<std::pair<std::string, std::string>> targets;
+    for (int w = 0; w < writers; ++w) {
+        std::string term = addTerm("Term " + std::to_string(w));
+        targets.emplace_back(term, addCourse(term, "Course " + std::to_string(w)));
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<bool> consistent{true};
+    std::vector<std::thread> threads;
+
+    for (int w = 0; w < writers; ++w) {
+        threads.emplace_back([this, &targets, w]() {
+            for (int i = 0; i < perWriter; ++i) {
+                addAssignment(targets[w].first, targets[w].second, "Homework " + std::to_string(i));
+            }
+        });
+    }
+    for (int r = 0; r < 4; ++r) {
+        threads.emplace_back([this, &done, &consistent]() {
+            while (!done.load()) {
+                // the search index and the model are updated under one lock, so a reader always sees them agree
+                bool agree = shared.read([](const TermController& controller) {
+                    std::size_t held = 0;
+                    for (const auto& [id, term] : controller.getTermList()) {
+                        for (const auto& [courseId, course] : term.getCourseList()) {
+                            held += course.getAssignmentList().size();
+                        }
+                    }
+                    return controller.search("homework", 1000).size() == held;
+                });
+                if (!agree) {
+                    consistent = false;
+                }
+            }
+        });
+    }
+
+    for (int w = 0; w < writers; ++w) {
+        threads[w].join();
+    }
+    done = true;
+    for (std::size_t t = writers; t < threads.size(); ++t) {
+        threads[t].join();
+    }
+
+    ASSERT_TRUE(consistent.load());
+    for (const auto& [term, course] : targets) {
+        ASSERT_EQ(assignmentCount(term, course), perWriter);
+    }
+}
@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include "controller/SnapshotPublisher.hpp"
+#include "controller/TermController.hpp"
+#include "io/TermTreeJson.hpp"
+
+using namespace std::chrono_literals;
+
+// test fixture for snapshots published by a TermController, with two terms of one course each
+class SnapshotPublisherTest : public testing::Test {
+    protected:
+        TermController controller{};
+
+        void SetUp() override {
+            addTermWithCourse("Fall 2025", "CMPE 142");
+            addTermWithCourse("Spring 2026", "CMPE 152");
+            controller.publishSnapshot();
+        }
+
+        void addTermWithCourse(const std::string& term, const std::string& course) {
+            controller.addTerm(term, std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, true);
+            controller.selectTerm(term);
+            controller.getCourseController().addCourse(course, "", std::chrono::year_month_day{2025y/8/15},
+                std::chrono::year_month_day{2025y/12/10}, 3, true);
+        }
+
+        AssignmentController& selectCourse(const std::string& term, const std::string& course) {
+            controller.selectTerm(term);
+            controller.getCourseController().selectCourse(course);
+            return controller.getCourseController().getAssignmentController();
+        }
+
+        const Term& termIn(const Snapshot& snapshot, const std::string& title) const {
+            const Term* term = snapshot.findTerm(controller.getTermId(title));
+            if (term == nullptr) {
+                throw std::out_of_range("Term not found.");
+            }
+            return *term;
+        }
+};
+
+
+// ====================================
+// FUNCTION SMOKE TESTS
+// ====================================
+
+TEST_F(SnapshotPublisherTest, StartsEmpty) {
+    TermController empty;
+
+    ASSERT_EQ(empty.getSnapshot()->version, 0);
+    ASSERT_TRUE(empty.getSnapshot()->terms.empty());
+}
+
+TEST_F(SnapshotPublisherTest, PublishCopiesTheTree) {
+    std::shared_ptr<const Snapshot> snapshot = controller.getSnapshot();
+
+    ASSERT_EQ(snapshot->version, 1);
+    ASSERT_EQ(snapshot->terms.size(), 2);
+    ASSERT_EQ(snapshot->terms[0]->getTitle(), "Fall 2025");
+    ASSERT_EQ(snapshot->terms[1]->getTitle(), "Spring 2026");
+    ASSERT_EQ(termIn(*snapshot, "Fall 2025").getCourseList().size(), 1);
+    ASSERT_NE(snapshot->terms[0].get(), &controller.findTerm("Fall 2025"));
+}
+
+TEST_F(SnapshotPublisherTest, EditsWaitForPublish) {
+    controller.editTitle(controller.getTermId("Fall 2025"), "Fall 2025 Session A");
+
+    ASSERT_EQ(controller.getSnapshot()->terms[0]->getTitle(), "Fall 2025");
+    controller.publishSnapshot();
+    ASSERT_EQ(controller.getSnapshot()->terms[0]->getTitle(), "Fall 2025 Session A");
+}
+
+TEST_F(SnapshotPublisherTest, UnchangedTermsAreShared) {
+    std::shared_ptr<const Snapshot> before = controller.getSnapshot();
+    AssignmentController& assignments = selectCourse("Fall 2025", "CMPE 142");
+    assignments.addAssignment("Homework 1", "", "Homework", std::chrono::year_month_day{2025y/9/10}, false, 0.0f);
+
+    std::shared_ptr<const Snapshot> after = controller.publishSnapshot();
+
+    ASSERT_EQ(after->version, 2);
+    ASSERT_NE(after->terms[0], before->terms[0]);
+    ASSERT_EQ(after->terms[1], before->terms[1]);
+    ASSERT_EQ(termIn(*after, "Fall 2025").findCourse(controller.getCourseController().getCourseId("CMPE 142"))
+        .getAssignmentList().size(), 1);
+}
+
+TEST_F(SnapshotPublisherTest, OldSnapshotsNeverChange) {
+    std::shared_ptr<const Snapshot> before = controller.getSnapshot();
+    AssignmentController& assignments = selectCourse("Spring 2026", "CMPE 152");
+    assignments.addAssignment("Lab 1", "", "Homework", std::chrono::year_month_day{2025y/9/5}, false, 0.0f);
+    controller.publishSnapshot();
+
+    const Course& course = termIn(*before, "Spring 2026").getCourseList().begin()->second;
+    ASSERT_TRUE(course.getAssignmentList().empty());
+    ASSERT_EQ(before->version, 1);
+}
+
+TEST_F(SnapshotPublisherTest, RemovesAndMovesArePublished) {
+    controller.moveTerm(controller.getTermId("Spring 2026"), 0);
+    controller.publishSnapshot();
+    ASSERT_EQ(controller.getSnapshot()->terms[0]->getTitle(), "Spring 2026");
+
+    std::string id = controller.getTermId("Fall 2025");
+    controller.removeTerm("Fall 2025");
+    controller.publishSnapshot();
+    ASSERT_EQ(controller.getSnapshot()->terms.size(), 1);
+    ASSERT_EQ(controller.getSnapshot()->findTerm(id), nullptr);
+}
+
+TEST_F(SnapshotPublisherTest, UndoIsPublished) {
+    controller.removeTerm("Spring 2026");
+    controller.publishSnapshot();
+    controller.undo();
+
+    ASSERT_EQ(controller.publishSnapshot()->terms.size(), 2);
+}
+
+TEST_F(SnapshotPublisherTest, ExportFromSnapshotMatchesController) {
+    AssignmentController& assignments = selectCourse("Fall 2025", "CMPE 142");
+    assignments.addAssignment("Homework 1", "", "Homework", std::chrono::year_month_day{2025y/9/10}, true, 90.0f);
+    std::ostringstream fromController;
+    std::ostringstream fromSnapshot;
+
+    io::exportTermTree(controller, fromController);
+    io::exportTermTree(*controller.publishSnapshot(), fromSnapshot);
+
+    ASSERT_EQ(fromSnapshot.str(), fromController.str());
+}
+
+
+// ====================================
+// FUNCTION EDGE CASES
+// ====================================
+
+TEST_F(SnapshotPublisherTest, PublishWithoutChangesKeepsSnapshot) {
+    std::shared_ptr<const Snapshot> before = controller.getSnapshot();
+
+    ASSERT_EQ(controller.publishSnapshot(), before);
+    ASSERT_EQ(controller.getSnapshot()->version, 1);
+}
+
+TEST_F(SnapshotPublisherTest, RemoteEditsArePublished) {
+    Term remote = controller.findTerm("Fall 2025");
+    remote.setTitle("Fall 2025 (server)");
+
+    controller.applyRemoteTerm(remote);
+
+    ASSERT_EQ(controller.publishSnapshot()->terms[0]->getTitle(), "Fall 2025 (server)");
+}
+
+TEST_F(SnapshotPublisherTest, ReadersSeeWholeSnapshotsWhileEditsContinue) {
+    AssignmentController& assignments = selectCourse("Fall 2025", "CMPE 142");
+    const std::string termId = controller.getTermId("Fall 2025");
+    std::atomic<bool> done{false};
+    std::atomic<bool> consistent{true};
+
+    // each publish adds one assignment, so the version always says how many a snapshot must hold
+    std::thread reader([&]() {
+        while (!done.load()) {
+            std::shared_ptr<const Snapshot> snapshot = controller.getSnapshot();
+            const Term* term = snapshot->findTerm(termId);
+            std::size_t count = term->getCourseList().begin()->second.getAssignmentList().size();
+            if (count != snapshot->version - 1) {
+                consistent = false;
+            }
+        }
+    });
+
+    for (int i = 0; i < 200; ++i) {
+        assignments.addAssignment("Homework " + std::to_string(i), "", "Homework",
+            std::chrono::year_month_day{2025y/9/10}, false, 0.0f);
+        controller.publishSnapshot();
+    }
+    done = true;
+    reader.join();
+
+    ASSERT_TRUE(consistent.load());
+    ASSERT_EQ(controller.getSnapshot()->version, 201);
+}
@@ -22,7 +22,7 @@ TEST_F(TermControllerTest, TermListGetter) {
     controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
     controller.addTerm("Spring 2026", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/24}, true);
 
-    const std::unordered_map<std::string, Term> &listOfTerms = controller.getTermList();
+    const TermList &listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 2);
 
     // check if both added terms are in the list
@@ -64,6 +64,14 @@ TEST_F(TermControllerTest, AddTerm) {
     ASSERT_FALSE(selectedTerm.getActive());
 }
 
+TEST_F(TermControllerTest, ImportTermKeepsId) {
+    Term term = Term::fromRow("persisted-id", "Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
+    controller.importTerm(term);
+
+    ASSERT_EQ(controller.getTermId("fall 2025"), "persisted-id");
+    ASSERT_EQ(controller.getTermList().back().first, "persisted-id");
+}
+
 TEST_F(TermControllerTest, EditTitle) {
     controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
 
@@ -112,7 +120,7 @@ TEST_F(TermControllerTest, RemoveTerm) {
 
     controller.removeTerm("Fall 2025");
 
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList &listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // throw out of range since the term is not in the list
@@ -147,12 +155,134 @@ TEST_F(TermControllerTest, FindTermNonConst) {
 }
 
 
+TEST_F(TermControllerTest, EditsAreRecordedInTracker) {
+    controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
+    std::string id = controller.getTermId("Fall 2025");
+    controller.editActive(id, true);
+
+    ASSERT_TRUE(controller.getChangeTracker().isDirty(id));
+    ASSERT_EQ(controller.getChangeTracker().getVersion(id), 2);
+
+    controller.selectTerm("Fall 2025");
+    controller.getCourseController().addCourse("CMPE 142", "", std::chrono::year_month_day{2025y/8/20},
+        std::chrono::year_month_day{2025y/12/10}, 3, true);
+    std::string courseId = controller.getCourseController().getCourseId("CMPE 142");
+
+    ASSERT_TRUE(controller.getChangeTracker().isDirty(courseId));
+    ASSERT_EQ(controller.getChangeTracker().getPendingCount(), 2);
+}
+
+TEST_F(TermControllerTest, MoveTerm) {
+    controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
+    controller.addTerm("Spring 2026", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/24}, true);
+    controller.addTerm("Fall 2026", std::chrono::year_month_day{2026y/8/15}, std::chrono::year_month_day{2026y/12/17}, false);
+    std::string id = controller.getTermId("Fall 2026");
+
+    controller.moveTerm(id, 0);
+
+    ASSERT_EQ(controller.getTermList().front().first, id);
+    ASSERT_EQ(controller.getTermList().back().second.getTitle(), "Spring 2026");
+    ASSERT_EQ(controller.findTerm("Fall 2026").getId(), id);
+}
+
+TEST_F(TermControllerTest, ReselectTermKeepsCourseSelection) {
+    controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
+    controller.addTerm("Spring 2026", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/24}, true);
+    controller.selectTerm("Fall 2025");
+    CourseController* first = &controller.getCourseController();
+    first->addCourse("CMPE 142", "", std::chrono::year_month_day{2025y/8/20}, std::chrono::year_month_day{2025y/12/10}, 3, true);
+    first->selectCourse("CMPE 142");
+
+    controller.selectTerm("Spring 2026");
+    controller.selectTerm("Fall 2025");
+
+    ASSERT_EQ(&controller.getCourseController(), first);
+    ASSERT_EQ(controller.getCourseController().getCourseList().size(), 1);
+    ASSERT_NO_THROW(controller.getCourseController().getAssignmentController());
+}
+
+TEST_F(TermControllerTest, RemoveTermDropsCachedController) {
+    controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
+    controller.addTerm("Spring 2026", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/24}, true);
+    controller.selectTerm("Fall 2025");
+    controller.selectTerm("Spring 2026");
+
+    controller.removeTerm("Fall 2025");
+
+    ASSERT_EQ(controller.getCourseControllerCache().size(), 1);
+    ASSERT_EQ(controller.getActiveTerm().getTitle(), "Spring 2026");
+}
+
+TEST_F(TermControllerTest, ApplyRemoteTermUpdatesInPlace) {
+    controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
+    std::string id = controller.getTermId("Fall 2025");
+    controller.selectTerm("Fall 2025");
+
+    controller.applyRemoteTerm(Term::fromRow(id, "Autumn 2025", std::chrono::year_month_day{2025y/8/16},
+        std::chrono::year_month_day{2025y/12/17}, true));
+
+    ASSERT_EQ(controller.getTermId("Autumn 2025"), id);
+    ASSERT_THROW(controller.getTermId("Fall 2025"), std::out_of_range);
+    ASSERT_EQ(controller.getActiveTerm().getTitle(), "Autumn 2025");
+    ASSERT_FALSE(controller.getChangeTracker().isDirty(id));
+}
+
+TEST_F(TermControllerTest, ApplyRemoteTermAddsNew) {
+    controller.applyRemoteTerm(Term::fromRow("remote-id", "Spring 2026", std::chrono::year_month_day{2026y/1/2},
+        std::chrono::year_month_day{2026y/5/24}, true));
+
+    ASSERT_EQ(controller.getTermId("Spring 2026"), "remote-id");
+    ASSERT_TRUE(controller.getChangeTracker().isOnServer("remote-id"));
+    ASSERT_EQ(controller.getChangeTracker().getPendingCount(), 0);
+}
+
+TEST_F(TermControllerTest, ApplyRemoteAssignmentFindsCourse) {
+    controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
+    controller.addTerm("Spring 2026", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/24}, true);
+    std::string termId = controller.getTermId("Fall 2025");
+    controller.applyRemoteCourse(termId, Course::fromRow("course-id", "CMPE 142", "", std::chrono::year_month_day{2025y/8/20},
+        std::chrono::year_month_day{2025y/12/10}, 3, true));
+    controller.selectTerm("Spring 2026");
+
+    controller.applyRemoteAssignment(termId, "course-id", Assignment::fromRow("assignment-id", "Homework 1", "",
+        "Homework", std::chrono::year_month_day{2025y/9/1}, false, 0.0f));
+
+    ASSERT_EQ(controller.findTerm("Fall 2025").findCourse("course-id").getAssignmentList().size(), 1);
+    controller.selectTerm("Fall 2025");
+    ASSERT_EQ(controller.getCourseController().getCourseId("CMPE 142"), "course-id");
+    ASSERT_THROW(controller.applyRemoteAssignment(termId, "missing", Assignment::fromRow("x", "Homework 2", "",
+        "Homework", std::chrono::year_month_day{2025y/9/1}, false, 0.0f)), std::out_of_range);
+    ASSERT_THROW(controller.applyRemoteAssignment("missing", "course-id", Assignment::fromRow("y", "Homework 3", "",
+        "Homework", std::chrono::year_month_day{2025y/9/1}, false, 0.0f)), std::out_of_range);
+}
+
+TEST_F(TermControllerTest, RemoteChangesKeepActiveController) {
+    controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
+    controller.addTerm("Spring 2026", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/24}, true);
+    controller.addTerm("Summer 2026", std::chrono::year_month_day{2026y/6/1}, std::chrono::year_month_day{2026y/8/7}, false);
+    controller.selectTerm("Fall 2025");
+    CourseController* active = &controller.getCourseController();
+    controller.getCourseControllerCache().setCapacity(1);
+
+    // each term's changes go through its own cached controller, which evicts the last one but not the active one
+    for (const std::string title : {"Spring 2026", "Summer 2026"}) {
+        controller.applyRemoteCourse(controller.getTermId(title), Course::fromRow("course-" + title, "CMPE 142", "",
+            std::chrono::year_month_day{2026y/1/5}, std::chrono::year_month_day{2026y/5/12}, 3, true));
+    }
+
+    ASSERT_EQ(controller.getCourseControllerCache().find(controller.getTermId("Fall 2025")), active);
+    ASSERT_TRUE(controller.getCourseControllerCache().contains(controller.getTermId("Summer 2026")));
+    ASSERT_FALSE(controller.getCourseControllerCache().contains(controller.getTermId("Spring 2026")));
+    ASSERT_EQ(&controller.getCourseController(), active);
+}
+
+
 // ====================================
 // GETTER EDGE CASES
 // ====================================
 
 TEST_F(TermControllerTest, TermListGetterEmpty) {
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList &listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 0);
 }
 
@@ -175,6 +305,15 @@ TEST_F(TermControllerTest, AddTermAlreadyExists) {
     ASSERT_THROW(controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false), std::logic_error);
 }
 
+TEST_F(TermControllerTest, ImportTermTitleAlreadyExists) {
+    controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
+    Term term{"FALL 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false};
+
+    // logic error since titles are case-insensitive
+    ASSERT_THROW(controller.importTerm(term), std::logic_error);
+    ASSERT_EQ(controller.getTermList().size(), 1);
+}
+
 TEST_F(TermControllerTest, EditTitleAlreadyExists) {
     controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
     std::string id = controller.getTermId("Fall 2025");
@@ -199,6 +338,17 @@ TEST_F(TermControllerTest, EditTitleEmpty) {
     ASSERT_THROW(controller.editTitle(id, ""), std::invalid_argument);
 }
 
+TEST_F(TermControllerTest, EditTitleBlankKeepsTitleIndexed) {
+    controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
+    std::string id = controller.getTermId("Fall 2025");
+
+    // a rejected title leaves the term findable and removable under its old one
+    ASSERT_THROW(controller.editTitle(id, "   "), std::invalid_argument);
+    ASSERT_EQ(controller.getTermId("Fall 2025"), id);
+    controller.removeTerm("Fall 2025");
+    ASSERT_TRUE(controller.getTermList().empty());
+}
+
 TEST_F(TermControllerTest, EditStartDateInvalid) {
     controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
     std::string id = controller.getTermId("Fall 2025");
@@ -240,6 +390,10 @@ TEST_F(TermControllerTest, FindTermNonConstNotFound) {
     ASSERT_THROW(controller.findTerm("Fall 2026"), std::out_of_range);
 }
 
+TEST_F(TermControllerTest, MoveTermNotFound) {
+    ASSERT_THROW(controller.moveTerm("missing", 0), std::out_of_range);
+}
+
 
 // ====================================
 // SIGNAL TESTS
@@ -311,6 +465,15 @@ TEST_F(TermControllerTest, RemoveTermEmitsDataChanged) {
     ASSERT_EQ(spy.count(), 1);
 }
 
+TEST_F(TermControllerTest, MoveTermEmitsDataChanged) {
+    controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
+
+    QSignalSpy spy(&controller, &TermController::dataChanged);
+    controller.moveTerm(controller.getTermId("Fall 2025"), 0);
+
+    ASSERT_EQ(spy.count(), 1);
+}
+
 TEST_F(TermControllerTest, SelectTermEmitsTermSelected) {
     controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
 
@@ -327,4 +490,409 @@ TEST_F(TermControllerTest, SelectTermNotFoundDoesNotEmitTermSelected) {
     ASSERT_THROW(controller.selectTerm("Fall 2026"), std::out_of_range);
 
     ASSERT_EQ(spy.count(), 0);
-}
\ No newline at end of file
+}
+
+// ====================================
+// DUE-DATE INDEX TESTS
+// ====================================
+
+// test fixture with two terms, each holding one course with assignments due across September
+class TermControllerDueTest : public TermControllerTest {
+    protected:
+        void SetUp() override {
+            addTermWithCourse("Fall 2025", "CMPE 142");
+            addTermWithCourse("Fall 2025 Session B", "CMPE 152");
+
+            controller.selectTerm("Fall 2025");
+            AssignmentController& first = selectCourse("CMPE 142");
+            first.addAssignment("Homework 1", "", "Homework", std::chrono::year_month_day{2025y/9/10}, false, 0.0f);
+            first.addAssignment("Homework 2", "", "Homework", std::chrono::year_month_day{2025y/9/3}, true, 95.0f);
+
+            controller.selectTerm("Fall 2025 Session B");
+            AssignmentController& second = selectCourse("CMPE 152");
+            second.addAssignment("Lab 1", "", "Homework", std::chrono::year_month_day{2025y/9/5}, false, 0.0f);
+        }
+
+        void addTermWithCourse(const std::string& term, const std::string& course) {
+            controller.addTerm(term, std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, true);
+            controller.selectTerm(term);
+            controller.getCourseController().addCourse(course, "", std::chrono::year_month_day{2025y/8/15},
+                std::chrono::year_month_day{2025y/12/10}, 3, true);
+        }
+
+        AssignmentController& selectCourse(const std::string& course) {
+            controller.getCourseController().selectCourse(course);
+            return controller.getCourseController().getAssignmentController();
+        }
+
+        std::vector<std::string> dueTitles(bool incompleteOnly = false) const {
+            std::vector<std::string> titles;
+            for (const DueAssignment& due : controller.getAssignmentsDue(std::chrono::year_month_day{2025y/9/1},
+                std::chrono::year_month_day{2025y/9/30}, incompleteOnly)) {
+                titles.push_back(due.assignment->getTitle());
+            }
+            return titles;
+        }
+};
+
+TEST_F(TermControllerDueTest, AssignmentsDueAcrossTerms) {
+    ASSERT_EQ(dueTitles(), (std::vector<std::string>{"Homework 2", "Lab 1", "Homework 1"}));
+    ASSERT_EQ(dueTitles(true), (std::vector<std::string>{"Lab 1", "Homework 1"}));
+}
+
+TEST_F(TermControllerDueTest, AssignmentsDueReportTermAndCourse) {
+    std::vector<DueAssignment> due = controller.getAssignmentsDue(std::chrono::year_month_day{2025y/9/5},
+        std::chrono::year_month_day{2025y/9/5});
+
+    ASSERT_EQ(due.size(), 1);
+    ASSERT_EQ(due[0].term->getTitle(), "Fall 2025 Session B");
+    ASSERT_EQ(due[0].course->getTitle(), "CMPE 152");
+}
+
+TEST_F(TermControllerDueTest, EditDueDateUpdatesIndex) {
+    AssignmentController& assignments = controller.getCourseController().getAssignmentController();
+    assignments.editDueDate(assignments.getAssignmentId("Lab 1"), std::chrono::year_month_day{2025y/10/1});
+
+    ASSERT_EQ(dueTitles(), (std::vector<std::string>{"Homework 2", "Homework 1"}));
+}
+
+TEST_F(TermControllerDueTest, GradeChangesUpdateIndex) {
+    AssignmentController& assignments = controller.getCourseController().getAssignmentController();
+
+    assignments.addGrade("Lab 1", 88.0f);
+    ASSERT_EQ(dueTitles(true), (std::vector<std::string>{"Homework 1"}));
+
+    assignments.removeGrade("Lab 1");
+    ASSERT_EQ(dueTitles(true), (std::vector<std::string>{"Lab 1", "Homework 1"}));
+}
+
+TEST_F(TermControllerDueTest, RemoveAssignmentUpdatesIndex) {
+    controller.getCourseController().getAssignmentController().removeAssignment("Lab 1");
+
+    ASSERT_EQ(dueTitles(), (std::vector<std::string>{"Homework 2", "Homework 1"}));
+}
+
+TEST_F(TermControllerDueTest, RemoveCourseUpdatesIndex) {
+    controller.selectTerm("Fall 2025");
+    controller.getCourseController().removeCourse("CMPE 142");
+
+    ASSERT_EQ(dueTitles(), (std::vector<std::string>{"Lab 1"}));
+}
+
+TEST_F(TermControllerDueTest, RemoveTermUpdatesIndex) {
+    controller.removeTerm("Fall 2025 Session B");
+
+    ASSERT_EQ(dueTitles(), (std::vector<std::string>{"Homework 2", "Homework 1"}));
+    ASSERT_EQ(controller.getDueIndex().size(), 2);
+}
+
+TEST_F(TermControllerDueTest, ImportTermIndexesAssignments) {
+    Term term{"Spring 2026", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/24}, false};
+    Course course{"CMPE 187", "", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/12}};
+    course.addAssignment(Assignment{"Quiz 1", "", "Homework", std::chrono::year_month_day{2025y/9/20}});
+    term.addCourse(course);
+
+    controller.importTerm(term);
+
+    ASSERT_EQ(dueTitles(), (std::vector<std::string>{"Homework 2", "Lab 1", "Homework 1", "Quiz 1"}));
+}
+
+TEST_F(TermControllerDueTest, RemoteAssignmentInUnselectedTermUpdatesIndex) {
+    std::string courseId = controller.findTerm("Fall 2025").getCourseList().begin()->first;
+
+    controller.applyRemoteAssignment(controller.getTermId("Fall 2025"), courseId, Assignment{"Homework 3", "",
+        "Homework", std::chrono::year_month_day{2025y/9/1}});
+
+    ASSERT_EQ(dueTitles().front(), "Homework 3");
+}
+
+// ====================================
+// SEARCH INDEX TESTS
+// ====================================
+
+// the same two terms, searched by the words in their titles, descriptions and categories
+class TermControllerSearchTest : public TermControllerDueTest {
+    protected:
+        std::vector<std::string> searchTitles(const std::string& query) const {
+            std::vector<std::string> titles;
+            for (const SearchResult& result : controller.search(query)) {
+                if (result.assignment != nullptr) {
+                    titles.push_back(result.assignment->getTitle());
+                } else if (result.course != nullptr) {
+                    titles.push_back(result.course->getTitle());
+                } else {
+                    titles.push_back(result.term->getTitle());
+                }
+            }
+            return titles;
+        }
+};
+
+TEST_F(TermControllerSearchTest, SearchAcrossTerms) {
+    // titles outrank the category match on Lab 1
+    ASSERT_EQ(searchTitles("homework"), (std::vector<std::string>{"Homework 1", "Homework 2", "Lab 1"}));
+    ASSERT_EQ(controller.getSearchIndex().size(), 7);
+}
+
+TEST_F(TermControllerSearchTest, SearchReportsTermAndCourse) {
+    std::vector<SearchResult> results = controller.search("lab");
+
+    ASSERT_EQ(results.size(), 1);
+    ASSERT_EQ(results[0].term->getTitle(), "Fall 2025 Session B");
+    ASSERT_EQ(results[0].course->getTitle(), "CMPE 152");
+    ASSERT_EQ(results[0].assignment->getTitle(), "Lab 1");
+}
+
+TEST_F(TermControllerSearchTest, SearchFindsTermsAndCourses) {
+    ASSERT_EQ(searchTitles("session"), (std::vector<std::string>{"Fall 2025 Session B"}));
+    ASSERT_EQ(searchTitles("cmpe 15"), (std::vector<std::string>{"CMPE 152"}));
+}
+
+TEST_F(TermControllerSearchTest, EditsUpdateSearch) {
+    AssignmentController& assignments = controller.getCourseController().getAssignmentController();
+    const std::string id = assignments.getAssignmentId("Lab 1");
+    assignments.editTitle(id, "Project 1");
+    assignments.editDescription(id, "Write the lab report");
+
+    ASSERT_EQ(searchTitles("project"), (std::vector<std::string>{"Project 1"}));
+    ASSERT_EQ(searchTitles("lab report"), (std::vector<std::string>{"Project 1"}));
+
+    CourseController& courses = controller.getCourseController();
+    courses.editDescription(courses.getCourseId("CMPE 152"), "Compilers");
+    controller.editTitle(controller.getTermId("Fall 2025 Session B"), "Winter 2025");
+
+    ASSERT_EQ(searchTitles("compilers"), (std::vector<std::string>{"CMPE 152"}));
+    ASSERT_EQ(searchTitles("winter"), (std::vector<std::string>{"Winter 2025"}));
+    ASSERT_TRUE(searchTitles("session").empty());
+}
+
+TEST_F(TermControllerSearchTest, RemovalsUpdateSearch) {
+    controller.getCourseController().getAssignmentController().removeAssignment("Lab 1");
+    ASSERT_TRUE(searchTitles("lab").empty());
+
+    controller.removeTerm("Fall 2025");
+    ASSERT_TRUE(searchTitles("homework").empty());
+    ASSERT_EQ(controller.getSearchIndex().size(), 2);
+}
+
+TEST_F(TermControllerSearchTest, ImportAndRemoteChangesUpdateSearch) {
+    Term term{"Spring 2026", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/24}, false};
+    Course course{"CMPE 187", "Software Testing", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/12}};
+    course.addAssignment(Assignment{"Quiz 1", "", "Homework", std::chrono::year_month_day{2025y/9/20}});
+    term.addCourse(course);
+    controller.importTerm(term);
+
+    std::string courseId = controller.findTerm("Fall 2025").getCourseList().begin()->first;
+    controller.applyRemoteAssignment(controller.getTermId("Fall 2025"), courseId, Assignment{"Essay 1", "",
+        "Homework", std::chrono::year_month_day{2025y/9/1}});
+
+    ASSERT_EQ(searchTitles("testing"), (std::vector<std::string>{"CMPE 187"}));
+    ASSERT_EQ(searchTitles("quiz"), (std::vector<std::string>{"Quiz 1"}));
+    ASSERT_EQ(searchTitles("essay"), (std::vector<std::string>{"Essay 1"}));
+}
+
+
+// ====================================
+// UNDO TESTS
+// ====================================
+
+// the same two terms, with the edits that built them cleared from the undo log
+class TermControllerUndoTest : public TermControllerSearchTest {
+    protected:
+        void SetUp() override {
+            TermControllerSearchTest::SetUp();
+            controller.getUndoLog().clear();
+        }
+
+        std::vector<std::string> termTitles() const {
+            std::vector<std::string> titles;
+            for (const auto& [id, term] : controller.getTermList()) {
+                titles.push_back(term.getTitle());
+            }
+            return titles;
+        }
+};
+
+TEST_F(TermControllerUndoTest, UndoAndRedoAddTerm) {
+    controller.addTerm("Spring 2026", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/24}, true);
+    const std::string id = controller.getTermId("Spring 2026");
+    ASSERT_STREQ(controller.getUndoLog().getUndoLabel(), "add term");
+
+    controller.undo();
+    ASSERT_THROW(controller.findTerm("Spring 2026"), std::out_of_range);
+    ASSERT_TRUE(controller.getUndoLog().canRedo());
+
+    controller.redo();
+    ASSERT_EQ(controller.getTermId("Spring 2026"), id);
+    ASSERT_EQ(searchTitles("spring"), (std::vector<std::string>{"Spring 2026"}));
+}
+
+TEST_F(TermControllerUndoTest, UndoRemoveTermRestoresTreeInPlace) {
+    const std::string id = controller.getTermId("Fall 2025");
+    controller.removeTerm("Fall 2025");
+
+    controller.undo();
+
+    ASSERT_EQ(termTitles(), (std::vector<std::string>{"Fall 2025", "Fall 2025 Session B"}));
+    ASSERT_EQ(controller.getTermId("Fall 2025"), id);
+    ASSERT_EQ(controller.findTerm("Fall 2025").getCourseList().size(), 1);
+    ASSERT_EQ(dueTitles(), (std::vector<std::string>{"Homework 2", "Lab 1", "Homework 1"}));
+    ASSERT_EQ(searchTitles("homework 2"), (std::vector<std::string>{"Homework 2"}));
+    ASSERT_TRUE(controller.getChangeTracker().isDirty(id));
+}
+
+TEST_F(TermControllerUndoTest, UndoTermEdits) {
+    const std::string id = controller.getTermId("Fall 2025");
+    controller.editTitle(id, "Autumn 2025");
+    controller.editActive(id, false);
+    controller.moveTerm(id, 1);
+
+    controller.undo();
+    ASSERT_EQ(termTitles(), (std::vector<std::string>{"Autumn 2025", "Fall 2025 Session B"}));
+    controller.undo();
+    ASSERT_TRUE(controller.findTerm("Autumn 2025").getActive());
+    controller.undo();
+    ASSERT_EQ(controller.getTermId("fall 2025"), id);
+    ASSERT_FALSE(controller.getUndoLog().canUndo());
+}
+
+TEST_F(TermControllerUndoTest, UndoMoveReturnsTermInFrontOfItsNeighbour) {
+    const std::string id = controller.getTermId("Fall 2025");
+    controller.moveTerm(id, 1);
+    controller.importTerm(Term{"Spring 2026", std::chrono::year_month_day{2026y/1/2},
+        std::chrono::year_month_day{2026y/5/24}, false});
+
+    controller.undo();
+    ASSERT_EQ(termTitles(), (std::vector<std::string>{"Fall 2025", "Fall 2025 Session B", "Spring 2026"}));
+
+    // the move took it to the end, so redoing it does again
+    controller.redo();
+    ASSERT_EQ(termTitles(), (std::vector<std::string>{"Fall 2025 Session B", "Spring 2026", "Fall 2025"}));
+}
+
+TEST_F(TermControllerUndoTest, UndoRemoveCourseRestoresItsPlace) {
+    CourseController& courses = controller.getCourseController();
+    courses.addCourse("CMPE 187", "", std::chrono::year_month_day{2025y/8/20}, std::chrono::year_month_day{2025y/12/10}, 3, true);
+    courses.addCourse("CMPE 189", "", std::chrono::year_month_day{2025y/8/20}, std::chrono::year_month_day{2025y/12/10}, 3, true);
+    courses.removeCourse("CMPE 187");
+
+    controller.undo();
+
+    std::vector<std::string> titles;
+    for (const auto& [id, course] : controller.findTerm("Fall 2025 Session B").getCourseList()) {
+        titles.push_back(course.getTitle());
+    }
+    ASSERT_EQ(titles, (std::vector<std::string>{"CMPE 152", "CMPE 187", "CMPE 189"}));
+}
+
+TEST_F(TermControllerUndoTest, UndoReachesEditsInOtherTerms) {
+    // the last edits were made in the second term, and are undone through its cached controllers
+    AssignmentController& assignments = controller.getCourseController().getAssignmentController();
+    assignments.editTitle(assignments.getAssignmentId("Lab 1"), "Lab 2");
+    assignments.addGrade("Lab 2", 88.0f);
+    controller.selectTerm("Fall 2025");
+
+    controller.undo();
+    const Assignment& lab = controller.findTerm("Fall 2025 Session B").getCourseList().begin()->second
+        .findAssignment(assignments.getAssignmentId("Lab 2"));
+    ASSERT_FALSE(lab.getCompleted());
+    ASSERT_FLOAT_EQ(lab.getGrade(), 0.0f);
+    ASSERT_EQ(dueTitles(true), (std::vector<std::string>{"Lab 2", "Homework 1"}));
+
+    controller.undo();
+    ASSERT_EQ(lab.getTitle(), "Lab 1");
+    ASSERT_NO_THROW(assignments.getAssignmentId("Lab 1"));
+}
+
+TEST_F(TermControllerUndoTest, UndoWithoutCachedControllers) {
+    CourseController& courses = controller.getCourseController();
+    const std::string courseId = courses.getCourseId("CMPE 152");
+    courses.getAssignmentController().removeAssignment("Lab 1");
+    courses.editNumCredits(courseId, 4);
+
+    controller.getCourseControllerCache().clear();
+    controller.undo();
+    controller.undo();
+
+    const Course& course = controller.findTerm("Fall 2025 Session B").findCourse(courseId);
+    ASSERT_EQ(course.getNumCredits(), 3);
+    ASSERT_EQ(course.getAssignmentList().size(), 1);
+    ASSERT_EQ(searchTitles("lab"), (std::vector<std::string>{"Lab 1"}));
+}
+
+TEST_F(TermControllerUndoTest, UndoRemoveCourseRestoresAssignments) {
+    CourseController& courses = controller.getCourseController();
+    const std::string courseId = courses.getCourseId("CMPE 152");
+    courses.removeCourse("CMPE 152");
+
+    controller.undo();
+
+    ASSERT_EQ(courses.getCourseId("CMPE 152"), courseId);
+    ASSERT_EQ(dueTitles(), (std::vector<std::string>{"Homework 2", "Lab 1", "Homework 1"}));
+
+    // the course and its assignment are back in the tracker, so the restore reaches the server
+    const std::string labId = courses.findCourse("CMPE 152").getAssignmentList().begin()->first;
+    ASSERT_TRUE(controller.getChangeTracker().isDirty(courseId));
+    ASSERT_TRUE(controller.getChangeTracker().isDirty(labId));
+
+    controller.redo();
+    ASSERT_THROW(courses.getCourseId("CMPE 152"), std::out_of_range);
+}
+
+TEST_F(TermControllerUndoTest, NewEditClearsRedo) {
+    const std::string id = controller.getTermId("Fall 2025");
+    controller.editActive(id, false);
+    controller.undo();
+
+    controller.editEndDate(id, std::chrono::year_month_day{2025y/12/20});
+
+    ASSERT_FALSE(controller.getUndoLog().canRedo());
+    ASSERT_EQ(controller.getUndoLog().getUndoCount(), 1);
+}
+
+TEST_F(TermControllerUndoTest, ReplayIsNotRecorded) {
+    controller.editActive(controller.getTermId("Fall 2025"), false);
+
+    controller.undo();
+    controller.redo();
+
+    ASSERT_EQ(controller.getUndoLog().getUndoCount(), 1);
+    ASSERT_EQ(controller.getUndoLog().getRedoCount(), 0);
+}
+
+TEST_F(TermControllerUndoTest, ImportsAndRemoteChangesAreNotRecorded) {
+    Term term{"Spring 2026", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/24}, false};
+    controller.importTerm(term);
+    controller.applyRemoteTerm(Term{"Winter 2026", std::chrono::year_month_day{2026y/1/2},
+        std::chrono::year_month_day{2026y/3/24}, false});
+
+    ASSERT_FALSE(controller.getUndoLog().canUndo());
+    ASSERT_THROW(controller.undo(), std::logic_error);
+    ASSERT_THROW(controller.redo(), std::logic_error);
+}
+
+// ====================================
+// RECOMPUTE TESTS
+// ====================================
+
+TEST_F(TermControllerDueTest, RecomputeAllAppliesChangedGradeScales) {
+    Term& fall = controller.findTerm("Fall 2025");
+    Course& course = fall.findCourse(fall.getCourseList().begin()->first);
+    ASSERT_EQ(course.getLetterGrade(), "A");
+
+    course.setGradeScale({{0.0f, "F"}, {99.0f, "A+"}});
+    utils::ThreadPool pool{4};
+    controller.recomputeAll(pool);
+
+    ASSERT_EQ(course.getLetterGrade(), "F");
+    ASSERT_FLOAT_EQ(course.getGpaVal(), 0.0f);
+    ASSERT_FLOAT_EQ(fall.getOvrGpa(), 0.0f);
+}
+
+TEST_F(TermControllerDueTest, RecomputeAllBringsTermGpasInLineWithCourses) {
+    controller.recomputeAll();
+
+    // Fall 2025's one course has a 95 (an A); Session B's has nothing graded yet
+    ASSERT_FLOAT_EQ(controller.findTerm("Fall 2025").getOvrGpa(), 4.0f);
+    ASSERT_FLOAT_EQ(controller.findTerm("Fall 2025 Session B").getOvrGpa(), 0.0f);
+}
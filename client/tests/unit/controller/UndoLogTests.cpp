@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "controller/TermController.hpp"
+#include "controller/UndoLog.hpp"
+
+// test fixture for UndoLog, with steps that note what they were asked to do instead of editing anything
+class UndoLogTest : public testing::Test {
+    protected:
+        UndoLog log{};
+        TermController controller{};
+        std::vector<std::string> calls{};
+
+        UndoCommand::Step<TermController> note(const std::string& label) {
+            return [this, label](TermController&, UndoCommand::Direction direction) {
+                calls.push_back((direction == UndoCommand::Direction::undo ? "undo " : "redo ") + label);
+            };
+        }
+
+        void record(const char* label, std::size_t payloadBytes = 0) {
+            log.record(label, "", note(label), payloadBytes);
+        }
+
+        UndoLog::Replay replay() {
+            return [this](const std::string&, const UndoCommand::Action& action, UndoCommand::Direction direction) {
+                std::get<UndoCommand::Step<TermController>>(action)(controller, direction);
+            };
+        }
+};
+
+
+// ====================================
+// FUNCTION SMOKE TESTS
+// ====================================
+
+TEST_F(UndoLogTest, UndoRunsLatestUndoStep) {
+    record("a");
+    record("b");
+
+    log.undo(replay());
+
+    ASSERT_EQ(calls, (std::vector<std::string>{"undo b"}));
+    ASSERT_STREQ(log.getUndoLabel(), "a");
+    ASSERT_STREQ(log.getRedoLabel(), "b");
+}
+
+TEST_F(UndoLogTest, RedoRunsLatestUndone) {
+    record("a");
+    record("b");
+    log.undo(replay());
+    log.undo(replay());
+
+    log.redo(replay());
+
+    ASSERT_EQ(calls, (std::vector<std::string>{"undo b", "undo a", "redo a"}));
+    ASSERT_EQ(log.getUndoCount(), 1);
+    ASSERT_EQ(log.getRedoCount(), 1);
+}
+
+TEST_F(UndoLogTest, RecordClearsRedo) {
+    record("a");
+    log.undo(replay());
+
+    record("b");
+
+    ASSERT_FALSE(log.canRedo());
+    ASSERT_STREQ(log.getUndoLabel(), "b");
+}
+
+TEST_F(UndoLogTest, ReplayedStepsAreNotRecorded) {
+    log.record("a", "", UndoCommand::Step<TermController>{[this](TermController&, UndoCommand::Direction) {
+        record("nested");
+    }}, 0);
+
+    log.undo(replay());
+
+    ASSERT_FALSE(log.canUndo());
+    ASSERT_STREQ(log.getRedoLabel(), "a");
+    ASSERT_FALSE(log.isReplaying());
+}
+
+TEST_F(UndoLogTest, ReplayGetsOwnerId) {
+    std::string owner;
+    log.record("a", "course-1", note("a"), 0);
+
+    log.undo([&owner](const std::string& ownerId, const UndoCommand::Action&, UndoCommand::Direction) {
+        owner = ownerId;
+    });
+
+    ASSERT_EQ(owner, "course-1");
+}
+
+
+// ====================================
+// MEMORY BUDGET TESTS
+// ====================================
+
+TEST_F(UndoLogTest, BytesCountEveryCommand) {
+    record("a", 100);
+    record("b", 50);
+
+    ASSERT_GE(log.getBytes(), 150 + 2 * sizeof(UndoCommand));
+}
+
+TEST_F(UndoLogTest, OverBudgetDropsOldest) {
+    log.setBudget(3 * (sizeof(UndoCommand) + 1100));
+    record("a", 1000);
+    record("b", 1000);
+    record("c", 1000);
+    record("d", 1000);
+
+    ASSERT_EQ(log.getUndoCount(), 3);
+    ASSERT_LE(log.getBytes(), log.getBudget());
+
+    log.undo(replay());
+    log.undo(replay());
+    log.undo(replay());
+    ASSERT_FALSE(log.canUndo());
+    ASSERT_EQ(calls, (std::vector<std::string>{"undo d", "undo c", "undo b"}));
+}
+
+TEST_F(UndoLogTest, LoweringBudgetTrims) {
+    record("a", 1000);
+    record("b", 1000);
+    log.undo(replay());
+
+    log.setBudget(sizeof(UndoCommand) + 1500);
+
+    // the oldest edit goes first, even though the redo is further from now
+    ASSERT_FALSE(log.canUndo());
+    ASSERT_STREQ(log.getRedoLabel(), "b");
+}
+
+TEST_F(UndoLogTest, CommandOverBudgetIsNotKept) {
+    log.setBudget(4096);
+    record("a");
+
+    record("huge", 8192);
+
+    ASSERT_FALSE(log.canUndo());
+    ASSERT_EQ(log.getBytes(), 0);
+}
+
+
+// ====================================
+// FUNCTION EDGE CASES
+// ====================================
+
+TEST_F(UndoLogTest, EmptyLogThrows) {
+    ASSERT_THROW(log.undo(replay()), std::logic_error);
+    ASSERT_THROW(log.redo(replay()), std::logic_error);
+    ASSERT_THROW(log.getUndoLabel(), std::logic_error);
+    ASSERT_THROW(log.getRedoLabel(), std::logic_error);
+}
+
+TEST_F(UndoLogTest, FailedUndoIsDropped) {
+    record("a", 100);
+    std::size_t bytesOfA = log.getBytes();
+    log.record("b", "", UndoCommand::Step<TermController>{[](TermController&, UndoCommand::Direction) {
+        throw std::out_of_range("Term not found.");
+    }}, 100);
+
+    ASSERT_THROW(log.undo(replay()), std::out_of_range);
+
+    ASSERT_STREQ(log.getUndoLabel(), "a");
+    ASSERT_FALSE(log.canRedo());
+    ASSERT_FALSE(log.isReplaying());
+    ASSERT_EQ(log.getBytes(), bytesOfA);
+
+    log.undo(replay());
+    ASSERT_EQ(calls, (std::vector<std::string>{"undo a"}));
+}
+
+TEST_F(UndoLogTest, FailedRedoIsDropped) {
+    bool fail = false;
+    record("a");
+    log.record("b", "", UndoCommand::Step<TermController>{[&fail](TermController&, UndoCommand::Direction) {
+        if (fail) {
+            throw std::logic_error("Course with the same title already exists.");
+        }
+    }}, 0);
+    log.undo(replay());
+    log.undo(replay());
+    log.redo(replay());
+    fail = true;
+
+    ASSERT_THROW(log.redo(replay()), std::logic_error);
+
+    ASSERT_FALSE(log.canRedo());
+    ASSERT_STREQ(log.getUndoLabel(), "a");
+    ASSERT_EQ(log.getUndoCount(), 1);
+}
+
+TEST_F(UndoLogTest, ClearEmptiesBothStacks) {
+    record("a", 100);
+    record("b", 100);
+    log.undo(replay());
+
+    log.clear();
+
+    ASSERT_FALSE(log.canUndo());
+    ASSERT_FALSE(log.canRedo());
+    ASSERT_EQ(log.getBytes(), 0);
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <sstream>      // diverts output from terminal to separate stream
+#include "io/EntityJson.hpp"
+#include "io/JsonWriter.hpp"
+
+using namespace std::chrono_literals;
+
+// test fixture for the JSON encoding of single records
+class EntityJsonTest : public testing::Test {
+    protected:
+        Assignment assignment = Assignment::fromRow("a1", "Homework 1", "", "Homework",
+            std::chrono::year_month_day{2026y/1/20}, true, 91.5f);
+};
+
+
+// ====================================
+// WRITE TESTS
+// ====================================
+
+TEST_F(EntityJsonTest, WriteAssignmentMatchesServerModel) {
+    std::ostringstream os;
+    JsonWriter writer{os};
+    io::writeAssignment(writer, "c1", assignment);
+
+    ASSERT_EQ(os.str(), "{\"id\":\"a1\",\"course_id\":\"c1\",\"title\":\"Homework 1\",\"description\":null,"
+        "\"category\":\"Homework\",\"due_date\":\"2026-01-20\",\"completed\":true,\"grade\":91.5}");
+}
+
+
+// ====================================
+// READ TESTS
+// ====================================
+
+TEST_F(EntityJsonTest, ReadSingleRecord) {
+    std::istringstream is{"{\"grade\": 91.5, \"id\": \"a1\", \"course_id\": \"c1\", \"title\": \"Homework 1\","
+        " \"category\": \"Homework\", \"due_date\": \"2026-01-20\", \"completed\": true, \"extra\": [1, {}]}"};
+    io::EntityBatch batch = io::readRecords(is, EntityKind::assignment);
+
+    ASSERT_EQ(batch.assignments.size(), 1);
+    ASSERT_EQ(batch.assignments[0].first, "c1");
+    ASSERT_EQ(batch.assignments[0].second.getId(), "a1");
+    ASSERT_FLOAT_EQ(batch.assignments[0].second.getGrade(), 91.5f);
+    ASSERT_TRUE(batch.terms.empty());
+}
+
+TEST_F(EntityJsonTest, ReadRecordArray) {
+    std::istringstream is{"[{\"id\":\"t1\",\"title\":\"Fall 2025\",\"start_date\":\"2025-08-15\",\"end_date\":\"2025-12-17\"},"
+        "{\"id\":\"t2\",\"title\":\"Spring 2026\",\"start_date\":\"2026-01-02\",\"end_date\":\"2026-05-24\",\"active\":false}]"};
+    io::EntityBatch batch = io::readRecords(is, EntityKind::term);
+
+    ASSERT_EQ(batch.terms.size(), 2);
+    ASSERT_EQ(batch.terms[1].getId(), "t2");
+    ASSERT_FALSE(batch.terms[1].getActive());
+}
+
+TEST_F(EntityJsonTest, ReadEmptyArray) {
+    std::istringstream is{"[]"};
+    io::EntityBatch batch = io::readRecords(is, EntityKind::course);
+
+    ASSERT_TRUE(batch.courses.empty());
+}
+
+TEST_F(EntityJsonTest, ReadRecordMissingField) {
+    std::istringstream is{"{\"id\":\"c1\",\"term_id\":\"t1\",\"start_date\":\"2026-01-02\",\"end_date\":\"2026-05-12\"}"};
+
+    ASSERT_THROW(io::readRecords(is, EntityKind::course), std::invalid_argument);
+}
+
+TEST_F(EntityJsonTest, ReadRecordRejectsScalarDocument) {
+    std::istringstream is{"\"a1\""};
+
+    ASSERT_THROW(io::readRecords(is, EntityKind::assignment), std::invalid_argument);
+}
+
+TEST_F(EntityJsonTest, ReadRecordRejectsNestedArrays) {
+    std::istringstream is{"[[]]"};
+
+    ASSERT_THROW(io::readRecords(is, EntityKind::assignment), std::invalid_argument);
+}
+
+TEST_F(EntityJsonTest, ReadNestedTree) {
+    std::istringstream is{"{\"id\":\"t1\",\"courses\":[{\"id\":\"c1\",\"title\":\"CMPE 142\",\"start_date\":\"2026-01-02\","
+        "\"end_date\":\"2026-05-12\",\"assignments\":[{\"id\":\"a1\",\"title\":\"Homework 1\",\"category\":\"Homework\","
+        "\"due_date\":\"2026-01-20\"}],\"num_credits\":4}],\"title\":\"Spring 2026\",\"start_date\":\"2026-01-02\","
+        "\"end_date\":\"2026-05-24\"}"};
+    io::EntityBatch batch = io::readRecords(is, EntityKind::term);
+
+    ASSERT_EQ(batch.terms.size(), 1);
+    ASSERT_EQ(batch.courses.size(), 1);
+    ASSERT_EQ(batch.assignments.size(), 1);
+    ASSERT_EQ(batch.courses[0].first, "t1");
+    ASSERT_EQ(batch.courses[0].second.getNumCredits(), 4);
+    ASSERT_EQ(batch.assignments[0].first, "c1");
+    ASSERT_EQ(batch.assignments[0].second.getId(), "a1");
+}
+
+TEST_F(EntityJsonTest, ReadNestedRecordWithOtherParent) {
+    std::istringstream is{"{\"id\":\"t1\",\"title\":\"Spring 2026\",\"start_date\":\"2026-01-02\",\"end_date\":\"2026-05-24\","
+        "\"courses\":[{\"id\":\"c1\",\"term_id\":\"t2\",\"title\":\"CMPE 142\",\"start_date\":\"2026-01-02\",\"end_date\":\"2026-05-12\"}]}"};
+
+    ASSERT_THROW(io::readRecords(is, EntityKind::term), std::invalid_argument);
+}
+
+TEST_F(EntityJsonTest, ReadNestedSectionMustBeArray) {
+    std::istringstream is{"{\"id\":\"t1\",\"courses\":{}}"};
+
+    ASSERT_THROW(io::readRecords(is, EntityKind::term), std::invalid_argument);
+}
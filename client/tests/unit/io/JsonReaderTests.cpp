@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <sstream>      // provides input from a string instead of a file
+#include <string>
+#include <vector>
+#include "io/JsonReader.hpp"
+
+namespace {
+    // records every event as a short token so tests can compare whole sequences
+    class RecordingHandler : public JsonHandler {
+        public:
+            std::vector<std::string> events{};
+
+            void startObject() override { events.push_back("{"); }
+            void endObject() override { events.push_back("}"); }
+            void startArray() override { events.push_back("["); }
+            void endArray() override { events.push_back("]"); }
+            void key(std::string_view name) override { events.push_back("key:" + std::string{name}); }
+            void stringValue(std::string_view value) override { events.push_back("str:" + std::string{value}); }
+            void numberValue(double value) override { events.push_back("num:" + std::to_string(value)); }
+            void boolValue(bool value) override { events.push_back(value ? "true" : "false"); }
+            void nullValue() override { events.push_back("null"); }
+    };
+
+    std::vector<std::string> parse(const std::string& json, std::size_t bufferSize = 64 * 1024) {
+        std::istringstream is{json};
+        JsonReader reader{is, bufferSize};
+        RecordingHandler handler;
+        reader.parse(handler);
+        return handler.events;
+    }
+}
+
+
+// ====================================
+// FUNCTION SMOKE TESTS
+// ====================================
+
+TEST(JsonReaderTest, EmptyObject) {
+    std::vector<std::string> expected{"{", "}"};
+    ASSERT_EQ(parse("{}"), expected);
+}
+
+TEST(JsonReaderTest, ObjectWithScalars) {
+    std::vector<std::string> expected{
+        "{", "key:title", "str:Homework 1", "key:grade", "num:89.500000",
+        "key:completed", "true", "key:description", "null", "}"
+    };
+
+    ASSERT_EQ(parse(R"( { "title" : "Homework 1", "grade": 89.5, "completed": true, "description": null } )"), expected);
+}
+
+TEST(JsonReaderTest, NestedArrays) {
+    std::vector<std::string> expected{"[", "[", "]", "[", "num:1.000000", "num:-2.000000", "]", "false", "]"};
+    ASSERT_EQ(parse("[[],[1,-2e0],false]"), expected);
+}
+
+TEST(JsonReaderTest, StringEscapes) {
+    std::vector<std::string> expected{"str:a\"b\\c/d\ne\tf"};
+    ASSERT_EQ(parse(R"("a\"b\\c\/d\ne\tf")"), expected);
+}
+
+TEST(JsonReaderTest, UnicodeEscapes) {
+    // U+00E9 (two bytes) and U+1F600 (surrogate pair, four bytes)
+    std::vector<std::string> expected{"str:caf\xC3\xA9 \xF0\x9F\x98\x80"};
+    ASSERT_EQ(parse(R"("caf\u00e9 \ud83d\ude00")"), expected);
+}
+
+TEST(JsonReaderTest, TinyBufferSameEvents) {
+    // tokens that straddle buffer refills must parse the same as with a large buffer
+    std::string json = R"({"terms":[{"id":"abc","title":"Fall 2025","grade":97.25}],"flag":false})";
+    ASSERT_EQ(parse(json, 1), parse(json));
+    ASSERT_EQ(parse(json, 3), parse(json));
+}
+
+
+// ====================================
+// ERROR HANDLING TESTS
+// ====================================
+
+TEST(JsonReaderTest, EmptyInput) {
+    ASSERT_THROW(parse(""), std::invalid_argument);
+}
+
+TEST(JsonReaderTest, TrailingComma) {
+    ASSERT_THROW(parse("[1,2,]"), std::invalid_argument);
+}
+
+TEST(JsonReaderTest, UnterminatedString) {
+    ASSERT_THROW(parse(R"({"title":"Home)"), std::invalid_argument);
+}
+
+TEST(JsonReaderTest, LeadingZero) {
+    ASSERT_THROW(parse("012"), std::invalid_argument);
+}
+
+TEST(JsonReaderTest, TrailingData) {
+    ASSERT_THROW(parse("{} {}"), std::invalid_argument);
+}
+
+TEST(JsonReaderTest, UnpairedSurrogate) {
+    ASSERT_THROW(parse(R"("\ud83d")"), std::invalid_argument);
+}
+
+TEST(JsonReaderTest, NestingTooDeep) {
+    ASSERT_THROW(parse(std::string(100, '[') + std::string(100, ']')), std::invalid_argument);
+}
+
+TEST(JsonReaderTest, ErrorReportsOffset) {
+    try {
+        parse("[true, fals]");
+        FAIL() << "Expected invalid_argument";
+    } catch (const std::invalid_argument& e) {
+        ASSERT_TRUE(std::string(e.what()).find("offset 11") != std::string::npos);
+    }
+}
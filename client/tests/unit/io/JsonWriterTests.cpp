@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <sstream>      // diverts output from terminal to separate stream
+#include <limits>       // for numeric_limits
+#include "io/JsonWriter.hpp"
+
+// test fixture for class JsonWriter
+class JsonWriterTest : public testing::Test {
+    protected:
+        std::ostringstream os{};
+        JsonWriter writer{os};
+};
+
+
+// ====================================
+// FUNCTION SMOKE TESTS
+// ====================================
+
+TEST_F(JsonWriterTest, EmptyObject) {
+    writer.startObject();
+    writer.endObject();
+
+    ASSERT_EQ(os.str(), "{}");
+}
+
+TEST_F(JsonWriterTest, EmptyArray) {
+    writer.startArray();
+    writer.endArray();
+
+    ASSERT_EQ(os.str(), "[]");
+}
+
+TEST_F(JsonWriterTest, ObjectWithScalars) {
+    writer.startObject();
+    writer.key("title");
+    writer.stringValue("Homework 1");
+    writer.key("num_credits");
+    writer.numberValue(3);
+    writer.key("grade");
+    writer.numberValue(89.92f);
+    writer.key("active");
+    writer.boolValue(true);
+    writer.key("description");
+    writer.nullValue();
+    writer.endObject();
+
+    ASSERT_EQ(os.str(), R"({"title":"Homework 1","num_credits":3,"grade":89.92,"active":true,"description":null})");
+}
+
+TEST_F(JsonWriterTest, NestedContainers) {
+    writer.startObject();
+    writer.key("terms");
+    writer.startArray();
+    writer.startObject();
+    writer.endObject();
+    writer.startObject();
+    writer.endObject();
+    writer.endArray();
+    writer.key("courses");
+    writer.startArray();
+    writer.endArray();
+    writer.endObject();
+
+    ASSERT_EQ(os.str(), R"({"terms":[{},{}],"courses":[]})");
+}
+
+
+// ====================================
+// EDGE CASE TESTS
+// ====================================
+
+TEST_F(JsonWriterTest, StringEscapes) {
+    writer.stringValue("quote \" backslash \\ newline \n tab \t bell \a");
+
+    ASSERT_EQ(os.str(), R"("quote \" backslash \\ newline \n tab \t bell \u0007")");
+}
+
+TEST_F(JsonWriterTest, Utf8PassesThrough) {
+    writer.stringValue("caf\xC3\xA9");
+
+    ASSERT_EQ(os.str(), "\"caf\xC3\xA9\"");
+}
+
+TEST_F(JsonWriterTest, FloatRoundTripsShortest) {
+    writer.numberValue(0.1f);
+
+    ASSERT_EQ(os.str(), "0.1");
+}
+
+TEST_F(JsonWriterTest, DoubleRoundTripsShortest) {
+    writer.numberValue(1234567.125);
+
+    ASSERT_EQ(os.str(), "1234567.125");
+}
+
+TEST_F(JsonWriterTest, NonFiniteNumber) {
+    ASSERT_THROW(writer.numberValue(std::numeric_limits<float>::infinity()), std::invalid_argument);
+}
+
+TEST_F(JsonWriterTest, CloseWithoutOpen) {
+    ASSERT_THROW(writer.endObject(), std::logic_error);
+}
@@ -0,0 +1,255 @@
+#include <gtest/gtest.h>
+#include <sstream>      // diverts output from terminal to separate stream
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "io/TermTreeJson.hpp"
+#include "controller/TermController.hpp"
+#include "utils/utils.hpp"
+
+using namespace std::chrono_literals;
+
+// test fixture for JSON import and export of the term tree
+class TermTreeJsonTest : public testing::Test {
+    protected:
+        TermController controller{};
+
+        void SetUp() override {
+            controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
+            controller.addTerm("Spring 2026", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/24}, true);
+            controller.selectTerm("Spring 2026");
+
+            CourseController& courseController = controller.getCourseController();
+            courseController.addCourse("CMPE 142", "Operating \"Systems\"", std::chrono::year_month_day{2026y/1/2},
+                std::chrono::year_month_day{2026y/5/12}, 3, true);
+            courseController.addCourse("ENGR 195A", "", std::chrono::year_month_day{2026y/1/2},
+                std::chrono::year_month_day{2026y/5/12}, 1, true);
+            courseController.selectCourse("CMPE 142");
+
+            AssignmentController& assignmentController = courseController.getAssignmentController();
+            assignmentController.addAssignment("Homework 1", "Processes", "Homework", std::chrono::year_month_day{2026y/1/20}, true, 91.37f);
+            assignmentController.addAssignment("Midterm", "", "Midterm", std::chrono::year_month_day{2026y/3/5}, true, 84.5f);
+            assignmentController.addAssignment("Final Exam", "", "Final Exam", std::chrono::year_month_day{2026y/5/10}, false, 0.0f);
+        }
+
+        std::string exportToString(const TermController& source) {
+            std::ostringstream os;
+            io::exportTermTree(source, os);
+            return os.str();
+        }
+
+        template <typename List>
+        static std::vector<std::string> idsOf(const List& list) {
+            std::vector<std::string> ids;
+            for (const auto& [id, entity] : list) {
+                ids.push_back(id);
+            }
+            return ids;
+        }
+};
+
+
+// ====================================
+// ROUND TRIP TESTS
+// ====================================
+
+TEST_F(TermTreeJsonTest, RoundTripPreservesIds) {
+    std::istringstream is{exportToString(controller)};
+    TermController imported;
+    io::importTermTree(is, imported);
+
+    ASSERT_EQ(imported.getTermList().size(), 2);
+    ASSERT_EQ(imported.getTermId("Fall 2025"), controller.getTermId("Fall 2025"));
+    ASSERT_EQ(imported.getTermId("Spring 2026"), controller.getTermId("Spring 2026"));
+
+    const Course& original = controller.findTerm("Spring 2026").findCourse(controller.getCourseController().getCourseId("CMPE 142"));
+    const Course& copy = imported.findTerm("Spring 2026").findCourse(original.getId());
+    ASSERT_EQ(copy.getTitle(), "CMPE 142");
+    ASSERT_EQ(copy.getDescription(), "Operating \"Systems\"");
+    ASSERT_EQ(copy.getAssignmentList().size(), 3);
+    ASSERT_FLOAT_EQ(copy.getGradePct(), original.getGradePct());
+    ASSERT_EQ(copy.getLetterGrade(), original.getLetterGrade());
+
+    for (const auto& [id, assignment] : original.getAssignmentList()) {
+        const Assignment& copied = copy.findAssignment(id);
+        ASSERT_EQ(copied.getTitle(), assignment.getTitle());
+        ASSERT_EQ(copied.getDescription(), assignment.getDescription());
+        ASSERT_EQ(copied.getCategory(), assignment.getCategory());
+        ASSERT_EQ(copied.getDueDate(), assignment.getDueDate());
+        ASSERT_EQ(copied.getCompleted(), assignment.getCompleted());
+        ASSERT_EQ(copied.getGrade(), assignment.getGrade());
+    }
+}
+
+TEST_F(TermTreeJsonTest, RoundTripTermOrder) {
+    std::istringstream is{exportToString(controller)};
+    TermController imported;
+    io::importTermTree(is, imported);
+
+    ASSERT_EQ(idsOf(imported.getTermList()), idsOf(controller.getTermList()));
+}
+
+TEST_F(TermTreeJsonTest, RoundTripKeepsReorderedTermsAndCourses) {
+    controller.moveTerm(controller.getTermId("Spring 2026"), 0);
+    CourseController& courseController = controller.getCourseController();
+    courseController.moveCourse(courseController.getCourseId("ENGR 195A"), 0);
+
+    std::istringstream is{exportToString(controller)};
+    TermController imported;
+    io::importTermTree(is, imported);
+
+    ASSERT_EQ(idsOf(imported.getTermList()), idsOf(controller.getTermList()));
+    ASSERT_EQ(idsOf(imported.findTerm("Spring 2026").getCourseList()),
+        idsOf(controller.findTerm("Spring 2026").getCourseList()));
+    ASSERT_EQ(imported.getTermList().front().second.getTitle(), "Spring 2026");
+}
+
+TEST_F(TermTreeJsonTest, ImportedTitlesResolveThroughControllers) {
+    std::istringstream is{exportToString(controller)};
+    TermController imported;
+    io::importTermTree(is, imported);
+
+    imported.selectTerm("Spring 2026");
+    imported.getCourseController().selectCourse("CMPE 142");
+    ASSERT_NO_THROW(imported.getCourseController().getAssignmentController().findAssignment("Homework 1"));
+}
+
+TEST_F(TermTreeJsonTest, ExportMatchesServerFieldNames) {
+    std::string json = exportToString(controller);
+
+    ASSERT_TRUE(json.find(R"("start_date":"2025-08-15")") != std::string::npos);
+    ASSERT_TRUE(json.find(R"("num_credits":3)") != std::string::npos);
+    ASSERT_TRUE(json.find(R"("due_date":"2026-01-20")") != std::string::npos);
+    ASSERT_TRUE(json.find(R"("grade":91.37)") != std::string::npos);
+    ASSERT_TRUE(json.find(R"("description":null)") != std::string::npos);
+    ASSERT_TRUE(json.find(R"("term_id":")" + controller.getTermId("Spring 2026")) != std::string::npos);
+}
+
+TEST_F(TermTreeJsonTest, SnapshotExportReportsEveryRecord) {
+    std::ostringstream os;
+    std::vector<std::pair<std::size_t, std::size_t>> reports;
+
+    io::exportTermTree(*controller.publishSnapshot(), os, [&reports](std::size_t done, std::size_t total) {
+        reports.emplace_back(done, total);
+    });
+
+    // two terms, two courses and three assignments, reported once at the end since that is under the interval
+    ASSERT_EQ(reports, (std::vector<std::pair<std::size_t, std::size_t>>{{7, 7}}));
+    ASSERT_EQ(os.str(), exportToString(controller));
+}
+
+TEST_F(TermTreeJsonTest, ReadTermsLeavesControllerToTheCaller) {
+    std::string document = exportToString(controller);
+    std::istringstream is{document};
+    std::size_t lastDone = 0;
+    std::size_t lastTotal = 0;
+
+    std::vector<Term> terms = io::readTerms(is, [&lastDone, &lastTotal](std::size_t done, std::size_t total) {
+        lastDone = done;
+        lastTotal = total;
+    });
+
+    ASSERT_EQ(terms.size(), 2);
+    ASSERT_EQ(terms[1].getCourseList().size(), 2);
+    ASSERT_EQ(lastDone, document.size());
+    ASSERT_EQ(lastTotal, document.size());
+
+    ASSERT_THROW(io::checkImport(terms, controller), std::logic_error);    // they are already there
+    TermController other;
+    ASSERT_NO_THROW(io::checkImport(terms, other));
+    io::importTerms(std::move(terms), other);
+    ASSERT_EQ(idsOf(other.getTermList()), idsOf(controller.getTermList()));
+}
+
+TEST_F(TermTreeJsonTest, ThrowingProgressStopsRead) {
+    std::istringstream is{exportToString(controller)};
+
+    ASSERT_THROW(io::readTerms(is, [](std::size_t, std::size_t) { throw std::runtime_error("stop"); }),
+        std::runtime_error);
+}
+
+
+// ====================================
+// IMPORT TESTS
+// ====================================
+
+TEST(TermTreeJsonImportTest, ServerShapeWithDefaultsAndExtraFields) {
+    std::istringstream is{R"({
+        "assignments": [
+            {"id": "a1", "course_id": "c1", "title": "Lab 1", "category": "Homework", "due_date": "2025-09-01",
+             "completed": true, "grade": 95}
+        ],
+        "courses": [
+            {"id": "c1", "term_id": "t1", "title": "CMPE 142", "start_date": "2025-08-12", "end_date": "2025-12-05"}
+        ],
+        "terms": [
+            {"id": "t1", "title": "Fall 2025", "start_date": "2025-08-12", "end_date": "2025-12-05", "extra": [1, {"x": 2}]}
+        ],
+        "version": 1
+    })"};
+    TermController controller;
+    io::importTermTree(is, controller);
+
+    const Term& term = controller.findTerm("Fall 2025");
+    ASSERT_EQ(term.getId(), "t1");
+    ASSERT_TRUE(term.getActive());
+
+    const Course& course = term.findCourse("c1");
+    ASSERT_EQ(course.getNumCredits(), 3);
+    ASSERT_EQ(course.getDescription(), "");
+    ASSERT_FLOAT_EQ(course.findAssignment("a1").getGrade(), 95.0f);
+}
+
+TEST(TermTreeJsonImportTest, MissingRequiredField) {
+    std::istringstream is{R"({"terms": [{"id": "t1", "start_date": "2025-08-12", "end_date": "2025-12-05"}]})"};
+    TermController controller;
+
+    ASSERT_THROW(io::importTermTree(is, controller), std::invalid_argument);
+}
+
+TEST(TermTreeJsonImportTest, WrongFieldType) {
+    std::istringstream is{R"({"terms": [{"id": "t1", "title": "Fall", "start_date": "2025-08-12", "end_date": "2025-12-05", "active": "yes"}]})"};
+    TermController controller;
+
+    ASSERT_THROW(io::importTermTree(is, controller), std::invalid_argument);
+}
+
+TEST(TermTreeJsonImportTest, InvalidDate) {
+    std::istringstream is{R"({"terms": [{"id": "t1", "title": "Fall", "start_date": "2025-02-30", "end_date": "2025-12-05"}]})"};
+    TermController controller;
+
+    ASSERT_THROW(io::importTermTree(is, controller), utils::DateParseError);
+}
+
+TEST(TermTreeJsonImportTest, UnknownParentLeavesControllerUntouched) {
+    std::istringstream is{R"({
+        "terms": [{"id": "t1", "title": "Fall 2025", "start_date": "2025-08-12", "end_date": "2025-12-05"}],
+        "courses": [{"id": "c1", "term_id": "missing", "title": "CMPE 142", "start_date": "2025-08-12", "end_date": "2025-12-05"}]
+    })"};
+    TermController controller;
+
+    ASSERT_THROW(io::importTermTree(is, controller), std::invalid_argument);
+    ASSERT_TRUE(controller.getTermList().empty());
+}
+
+TEST(TermTreeJsonImportTest, DuplicateTermTitle) {
+    std::istringstream is{R"({"terms": [{"id": "t1", "title": "fall 2025", "start_date": "2025-08-12", "end_date": "2025-12-05"}]})"};
+    TermController controller;
+    controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
+
+    ASSERT_THROW(io::importTermTree(is, controller), std::logic_error);
+    ASSERT_EQ(controller.getTermList().size(), 1);
+}
+
+TEST(TermTreeJsonImportTest, CheckImportRejectsTitlesRepeatedInTheFile) {
+    std::istringstream is{R"({"terms": [
+        {"id": "t1", "title": "Fall 2025", "start_date": "2025-08-12", "end_date": "2025-12-05"},
+        {"id": "t2", "title": "FALL 2025", "start_date": "2025-08-12", "end_date": "2025-12-05"}
+    ]})"};
+    TermController controller;
+
+    std::vector<Term> terms = io::readTerms(is);
+
+    ASSERT_EQ(terms.size(), 2);
+    ASSERT_THROW(io::checkImport(terms, controller), std::logic_error);
+}
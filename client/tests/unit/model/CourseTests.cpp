@@ -1003,4 +1003,111 @@ TEST_F(CourseTest, FromRowSameDayStartAndEnd) {
         3, false);
 
     ASSERT_EQ(course.getStartDate(), course.getEndDate());
-}
\ No newline at end of file
+}
+
+// ====================================
+// DUE-DATE INDEX TESTS
+// ====================================
+
+TEST_F(CourseTest, AssignmentsDueInDateOrder) {
+    Assignment late{"Homework 3", "", "Homework", std::chrono::year_month_day{2025y/10/20}};
+    Assignment early{"Homework 1", "", "Homework", std::chrono::year_month_day{2025y/9/1}, true, 90.0f};
+    Assignment middle{"Homework 2", "", "Homework", std::chrono::year_month_day{2025y/9/15}};
+    course1.addAssignment(late);
+    course1.addAssignment(early);
+    course1.addAssignment(middle);
+
+    std::vector<const Assignment*> due = course1.getAssignmentsDue(std::chrono::year_month_day{2025y/9/1},
+        std::chrono::year_month_day{2025y/10/20});
+
+    ASSERT_EQ(due.size(), 3);
+    ASSERT_EQ(due[0]->getTitle(), "Homework 1");
+    ASSERT_EQ(due[1]->getTitle(), "Homework 2");
+    ASSERT_EQ(due[2]->getTitle(), "Homework 3");
+}
+
+TEST_F(CourseTest, AssignmentsDueRangeIsInclusive) {
+    course1.addAssignment(Assignment{"Homework 1", "", "Homework", std::chrono::year_month_day{2025y/9/1}});
+    course1.addAssignment(Assignment{"Homework 2", "", "Homework", std::chrono::year_month_day{2025y/9/8}});
+    course1.addAssignment(Assignment{"Homework 3", "", "Homework", std::chrono::year_month_day{2025y/9/9}});
+
+    std::vector<const Assignment*> due = course1.getAssignmentsDue(std::chrono::year_month_day{2025y/9/2},
+        std::chrono::year_month_day{2025y/9/8});
+
+    ASSERT_EQ(due.size(), 1);
+    ASSERT_EQ(due[0]->getTitle(), "Homework 2");
+}
+
+TEST_F(CourseTest, AssignmentsDueIncompleteOnly) {
+    course1.addAssignment(Assignment{"Homework 1", "", "Homework", std::chrono::year_month_day{2025y/9/1}, true, 90.0f});
+    course1.addAssignment(Assignment{"Homework 2", "", "Homework", std::chrono::year_month_day{2025y/9/2}});
+
+    std::vector<const Assignment*> due = course1.getAssignmentsDue(std::chrono::year_month_day{2025y/9/1},
+        std::chrono::year_month_day{2025y/9/30}, true);
+
+    ASSERT_EQ(due.size(), 1);
+    ASSERT_EQ(due[0]->getTitle(), "Homework 2");
+}
+
+TEST_F(CourseTest, AssignmentsDueEmptyRange) {
+    course1.addAssignment(Assignment{"Homework 1", "", "Homework", std::chrono::year_month_day{2025y/9/1}});
+
+    ASSERT_TRUE(course1.getAssignmentsDue(std::chrono::year_month_day{2025y/9/2},
+        std::chrono::year_month_day{2025y/9/1}).empty());
+}
+
+TEST_F(CourseTest, SetAssignmentDueDateMovesIndexEntry) {
+    Assignment assignment{"Homework 1", "", "Homework", std::chrono::year_month_day{2025y/9/1}};
+    course1.addAssignment(assignment);
+
+    course1.setAssignmentDueDate(assignment.getId(), std::chrono::year_month_day{2025y/11/3});
+
+    ASSERT_TRUE(course1.getAssignmentsDue(std::chrono::year_month_day{2025y/9/1},
+        std::chrono::year_month_day{2025y/9/1}).empty());
+    ASSERT_EQ(course1.getAssignmentsDue(std::chrono::year_month_day{2025y/11/3},
+        std::chrono::year_month_day{2025y/11/3}).size(), 1);
+    ASSERT_EQ(course1.findAssignment(assignment.getId()).getDueDate(), std::chrono::year_month_day{2025y/11/3});
+}
+
+TEST_F(CourseTest, SetAssignmentDueDateInvalidKeepsIndexEntry) {
+    Assignment assignment{"Homework 1", "", "Homework", std::chrono::year_month_day{2025y/9/1}};
+    course1.addAssignment(assignment);
+
+    ASSERT_ANY_THROW(course1.setAssignmentDueDate(assignment.getId(), std::chrono::year_month_day{2025y/2/30}));
+    ASSERT_EQ(course1.getAssignmentsDue(std::chrono::year_month_day{2025y/9/1},
+        std::chrono::year_month_day{2025y/9/1}).size(), 1);
+}
+
+TEST_F(CourseTest, SetAssignmentCompletedMovesIndexEntry) {
+    Assignment assignment{"Homework 1", "", "Homework", std::chrono::year_month_day{2025y/9/1}};
+    course1.addAssignment(assignment);
+
+    course1.setAssignmentCompleted(assignment.getId(), true);
+
+    ASSERT_TRUE(course1.getAssignmentsDue(std::chrono::year_month_day{2025y/9/1},
+        std::chrono::year_month_day{2025y/9/1}, true).empty());
+    ASSERT_EQ(course1.getAssignmentsDue(std::chrono::year_month_day{2025y/9/1},
+        std::chrono::year_month_day{2025y/9/1}).size(), 1);
+    ASSERT_TRUE(course1.findAssignment(assignment.getId()).getCompleted());
+}
+
+TEST_F(CourseTest, RemoveAssignmentDropsIndexEntry) {
+    Assignment assignment{"Homework 1", "", "Homework", std::chrono::year_month_day{2025y/9/1}};
+    course1.addAssignment(assignment);
+
+    course1.removeAssignment(assignment.getId());
+
+    ASSERT_TRUE(course1.getAssignmentsDue(std::chrono::year_month_day{2025y/1/1},
+        std::chrono::year_month_day{2025y/12/31}).empty());
+}
+
+TEST_F(CourseTest, CopiedCourseKeepsIndex) {
+    course1.addAssignment(Assignment{"Homework 1", "", "Homework", std::chrono::year_month_day{2025y/9/1}});
+    Course copy{course1};
+
+    std::vector<const Assignment*> due = copy.getAssignmentsDue(std::chrono::year_month_day{2025y/9/1},
+        std::chrono::year_month_day{2025y/9/1});
+
+    ASSERT_EQ(due.size(), 1);
+    ASSERT_EQ(due[0], &copy.getAssignmentList().begin()->second);
+}
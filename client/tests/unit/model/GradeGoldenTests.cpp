@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "io/JsonReader.hpp"
+#include "io/TermTreeJson.hpp"
+
+// tests/golden/grades.json is a term tree in the import format whose terms and courses also carry the grade
+// the model must compute for them, as expected_* fields the importer skips. server/tests/test_grades.py reads the
+// same file, so the client and the server's grade routes are held to the same floats; comparisons are exact.
+namespace {
+    struct Expected {
+        float gradePct{0.0f};
+        std::string letterGrade{};
+        float gpaVal{0.0f};
+        int totalCredits{0};
+        float ovrGpa{0.0f};
+    };
+
+    // collects the expected_* fields of every record, by id
+    class ExpectedHandler : public JsonHandler {
+        public:
+            std::unordered_map<std::string, Expected> records{};
+
+            void startObject() override { ++depth_; }
+            void endObject() override {
+                if (--depth_ == 1) {
+                    records.emplace(std::move(id_), current_);
+                    current_ = Expected{};
+                }
+            }
+            void startArray() override {}
+            void endArray() override {}
+            void key(std::string_view name) override { key_ = name; }
+            void stringValue(std::string_view value) override {
+                if (key_ == "id") {
+                    id_ = value;
+                } else if (key_ == "expected_letter_grade") {
+                    current_.letterGrade = value;
+                }
+            }
+            void numberValue(double value) override {
+                if (key_ == "expected_grade_pct") {
+                    current_.gradePct = static_cast<float>(value);
+                } else if (key_ == "expected_gpa_val") {
+                    current_.gpaVal = static_cast<float>(value);
+                } else if (key_ == "expected_total_credits") {
+                    current_.totalCredits = static_cast<int>(value);
+                } else if (key_ == "expected_ovr_gpa") {
+                    current_.ovrGpa = static_cast<float>(value);
+                }
+            }
+            void boolValue(bool) override {}
+            void nullValue() override {}
+
+        private:
+            int depth_{0};
+            std::string key_{};
+            std::string id_{};
+            Expected current_{};
+    };
+}
+
+// test fixture that imports the golden tree and reads what it expects
+class GradeGoldenTest : public testing::Test {
+    protected:
+        std::vector<Term> terms;
+        std::unordered_map<std::string, Expected> expected;
+
+        void SetUp() override {
+            std::ifstream tree{GRADES_GOLDEN_FILE};
+            ASSERT_TRUE(tree.is_open());
+            terms = io::readTerms(tree);
+
+            std::ifstream fields{GRADES_GOLDEN_FILE};
+            ExpectedHandler handler;
+            JsonReader{fields}.parse(handler);
+            expected = std::move(handler.records);
+        }
+};
+
+
+// ====================================
+// GOLDEN TESTS
+// ====================================
+
+TEST_F(GradeGoldenTest, CourseGradesMatch) {
+    std::size_t checked = 0;
+
+    for (const Term& term : terms) {
+        for (const auto& [id, course] : term.getCourseList()) {
+            SCOPED_TRACE(id);
+            const Expected& want = expected.at(id);
+            ASSERT_EQ(course.getGradePct(), want.gradePct);
+            ASSERT_EQ(course.getLetterGrade(), want.letterGrade);
+            ASSERT_EQ(course.getGpaVal(), want.gpaVal);
+            ++checked;
+        }
+    }
+
+    ASSERT_EQ(checked, 16);
+}
+
+TEST_F(GradeGoldenTest, TermGpasMatch) {
+    ASSERT_EQ(terms.size(), 4);
+
+    for (const Term& term : terms) {
+        SCOPED_TRACE(term.getId());
+        const Expected& want = expected.at(term.getId());
+        ASSERT_EQ(term.getTotalCredits(), want.totalCredits);
+        ASSERT_EQ(term.getOvrGpa(), want.ovrGpa);
+        ASSERT_EQ(term.calculateOvrGpa(), want.ovrGpa);
+    }
+}
+
+
+// ====================================
+// EDGE CASES
+// ====================================
+
+TEST_F(GradeGoldenTest, CourseOrderDoesNotMoveGpa) {
+    // the server sums courses in whatever order its query returns them
+    for (Term& term : terms) {
+        std::vector<std::string> ids;
+        for (const auto& [id, course] : term.getCourseList()) {
+            ids.push_back(id);
+        }
+        for (const std::string& id : ids) {
+            term.moveCourse(id, 0);
+        }
+
+        ASSERT_EQ(term.calculateOvrGpa(), expected.at(term.getId()).ovrGpa);
+    }
+}
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include <sstream>      // diverts output from terminal to separate stream
+#include "model/MemoryAccounting.hpp"
+#include "../support/AllocationCounter.hpp"
+
+using namespace std::chrono_literals;
+using testsupport::AllocationScope;
+
+// allocation budgets for the hot mutations, as measured with libstdc++; lower one when a change saves
+// allocations, and raise one only alongside the change that needs it
+constexpr std::size_t courseAddAssignmentBudget = 11;
+constexpr std::size_t controllerAddAssignmentBudget = 42;
+constexpr std::size_t assignmentCopyBudget = 2;
+
+// test fixture for memory accounting and allocation bounds
+class MemoryAccountingTest : public testing::Test {
+    protected:
+        TermController controller{};
+        Course course{"Operating Systems and Concurrent Programming", "Processes, threads and synchronization",
+            std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/12}, 3, true};
+
+        void SetUp() override {
+            for (int i = 0; i < 8; ++i) {
+                course.addAssignment(makeAssignment(i));
+            }
+
+            controller.addTerm("Spring 2026", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/24}, true);
+            controller.selectTerm("Spring 2026");
+            CourseController& courseController = controller.getCourseController();
+            courseController.addCourse("CMPE 142", "", std::chrono::year_month_day{2026y/1/2},
+                std::chrono::year_month_day{2026y/5/12}, 3, true);
+            courseController.selectCourse("CMPE 142");
+            courseController.getAssignmentController().addAssignment("Homework 1", "", "Homework",
+                std::chrono::year_month_day{2026y/1/20}, true, 91.5f);
+        }
+
+        static Assignment makeAssignment(int i) {
+            return Assignment{"Homework " + std::to_string(i), "A description long enough to live on the heap",
+                "Homework", std::chrono::year_month_day{2026y/2/1}, true, 80.0f + static_cast<float>(i % 10)};
+        }
+};
+
+
+// ====================================
+// FOOTPRINT TESTS
+// ====================================
+
+TEST_F(MemoryAccountingTest, AssignmentFootprintCountsHeapStrings) {
+    Assignment assignment = makeAssignment(1);
+    Footprint footprint = MemoryAccounting::of(assignment);
+
+    ASSERT_GE(footprint.bytes, sizeof(Assignment) + assignment.getDescription().size());
+    ASSERT_GE(footprint.allocations, 2);     // the UUID and the description outgrow any inline buffer
+}
+
+TEST_F(MemoryAccountingTest, CourseFootprintGrowsWithAssignments) {
+    Footprint before = MemoryAccounting::of(course);
+    course.addAssignment(makeAssignment(100));
+    Footprint after = MemoryAccounting::of(course);
+
+    ASSERT_GT(after.bytes, before.bytes + sizeof(Assignment));
+    ASSERT_GT(after.allocations, before.allocations);
+}
+
+TEST_F(MemoryAccountingTest, TermFootprintIncludesCourses) {
+    const Term& term = controller.findTerm("Spring 2026");
+    const Course& child = term.getCourseList().begin()->second;
+
+    ASSERT_GT(MemoryAccounting::of(term).bytes, MemoryAccounting::of(child).bytes);
+}
+
+#if defined(__GLIBCXX__)
+// the accounting models libstdc++'s layouts, so a fresh copy must allocate exactly what it reports
+TEST_F(MemoryAccountingTest, CopiesAllocateWhatIsReported) {
+    Assignment assignment = makeAssignment(1);
+    const Term& term = controller.findTerm("Spring 2026");
+
+    {
+        AllocationScope scope;
+        Assignment copy{assignment};
+        Footprint footprint = MemoryAccounting::of(copy);
+        ASSERT_EQ(scope.getAllocations(), footprint.allocations);
+        ASSERT_EQ(scope.getBytes(), footprint.bytes - sizeof(Assignment));
+    }
+    {
+        AllocationScope scope;
+        Course copy{course};
+        Footprint footprint = MemoryAccounting::of(copy);
+        ASSERT_EQ(scope.getAllocations(), footprint.allocations);
+        ASSERT_EQ(scope.getBytes(), footprint.bytes - sizeof(Course));
+    }
+    {
+        AllocationScope scope;
+        Term copy{term};
+        Footprint footprint = MemoryAccounting::of(copy);
+        ASSERT_EQ(scope.getAllocations(), footprint.allocations);
+        ASSERT_EQ(scope.getBytes(), footprint.bytes - sizeof(Term));
+    }
+}
+#endif
+
+
+// ====================================
+// REPORT TESTS
+// ====================================
+
+TEST_F(MemoryAccountingTest, ReportSharesAddUp) {
+    controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
+    MemoryReport report = MemoryAccounting::measure(controller);
+
+    ASSERT_EQ(report.termCount, 2);
+    ASSERT_EQ(report.courseCount, 1);
+    ASSERT_EQ(report.assignmentCount, 1);
+    ASSERT_EQ(report.perTerm.size(), 2);
+
+    Footprint perTerm = report.container;
+    for (const MemoryReport::TermUsage& usage : report.perTerm) {
+        perTerm += usage.footprint;
+    }
+    ASSERT_EQ(perTerm.bytes, report.total().bytes);
+    ASSERT_EQ(perTerm.allocations, report.total().allocations);
+}
+
+TEST_F(MemoryAccountingTest, WriteReportListsTypesAndTerms) {
+    std::ostringstream os;
+    MemoryAccounting::writeReport(MemoryAccounting::measure(controller), os);
+
+    ASSERT_NE(os.str().find("Assignments"), std::string::npos);
+    ASSERT_NE(os.str().find("Spring 2026"), std::string::npos);
+}
+
+
+// ====================================
+// ALLOCATION BOUND TESTS
+// ====================================
+
+TEST_F(MemoryAccountingTest, CourseAddAssignmentAllocations) {
+    Assignment assignment = makeAssignment(100);
+
+    AllocationScope scope;
+    course.addAssignment(assignment);
+
+    ASSERT_LE(scope.getAllocations(), courseAddAssignmentBudget);
+}
+
+TEST_F(MemoryAccountingTest, ControllerAddAssignmentAllocations) {
+    AssignmentController& assignmentController = controller.getCourseController().getAssignmentController();
+
+    AllocationScope scope;
+    assignmentController.addAssignment("Homework 2", "", "Homework", std::chrono::year_month_day{2026y/2/3}, true, 88.0f);
+
+    ASSERT_LE(scope.getAllocations(), controllerAddAssignmentBudget);
+}
+
+TEST_F(MemoryAccountingTest, TitleLookupsDoNotAllocate) {
+    CourseController& courseController = controller.getCourseController();
+    AssignmentController& assignmentController = courseController.getAssignmentController();
+
+    AllocationScope scope;
+    const std::string& termId = controller.getTermId("SPRING 2026");
+    const std::string& courseId = courseController.getCourseId("cmpe 142");
+    const std::string& assignmentId = assignmentController.getAssignmentId("HOMEWORK 1");
+
+    ASSERT_EQ(scope.getAllocations(), 0u);
+    ASSERT_FALSE(termId.empty() || courseId.empty() || assignmentId.empty());
+}
+
+TEST_F(MemoryAccountingTest, AssignmentCopyAllocations) {
+    Assignment assignment = makeAssignment(1);
+
+    AllocationScope scope;
+    Assignment copy{assignment};
+
+    ASSERT_LE(scope.getAllocations(), assignmentCopyBudget);
+}
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "model/SearchIndex.hpp"
+#include "model/Term.hpp"
+
+using namespace std::chrono_literals;
+
+// test fixture for SearchIndex, built from one term with two courses
+class SearchIndexTest : public testing::Test {
+    protected:
+        Term term{"Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, true};
+        Assignment labReport{"Lab Report 1", "Measure the pendulum", "Labs", std::chrono::year_month_day{2025y/9/10}};
+        Assignment essay{"Essay", "Report on a collaborator", "Homework", std::chrono::year_month_day{2025y/9/12}};
+        SearchIndex index{};
+
+        void SetUp() override {
+            Course physics{"PHYS 2A", "Mechanics and laboratory", std::chrono::year_month_day{2025y/8/15},
+                std::chrono::year_month_day{2025y/12/10}};
+            physics.addAssignment(labReport);
+            Course english{"ENGL 1B", "", std::chrono::year_month_day{2025y/8/15},
+                std::chrono::year_month_day{2025y/12/10}};
+            english.addAssignment(essay);
+
+            term.addCourse(physics);
+            term.addCourse(english);
+            index.addTerm(term);
+        }
+
+        std::vector<std::string> idsFor(const std::string& query) const {
+            std::vector<std::string> ids;
+            for (const SearchHit& hit : index.search(query)) {
+                ids.push_back(hit.id);
+            }
+            return ids;
+        }
+
+        const Course& courseTitled(const std::string& title) const {
+            for (const auto& [id, course] : term.getCourseList()) {
+                if (course.getTitle() == title) {
+                    return course;
+                }
+            }
+            throw std::out_of_range("Course not found.");
+        }
+};
+
+
+// ====================================
+// FUNCTION SMOKE TESTS
+// ====================================
+
+TEST_F(SearchIndexTest, AddTermIndexesEverythingUnderIt) {
+    ASSERT_EQ(index.size(), 5);
+    ASSERT_TRUE(index.contains(term.getId()));
+    ASSERT_TRUE(index.contains(labReport.getId()));
+}
+
+TEST_F(SearchIndexTest, MatchesWholeWordsInAnyCase) {
+    std::vector<SearchHit> hits = index.search("PENDULUM");
+
+    ASSERT_EQ(hits.size(), 1);
+    ASSERT_EQ(hits[0].kind, EntityKind::assignment);
+    ASSERT_EQ(hits[0].id, labReport.getId());
+    ASSERT_EQ(hits[0].courseId, courseTitled("PHYS 2A").getId());
+    ASSERT_EQ(hits[0].termId, term.getId());
+}
+
+TEST_F(SearchIndexTest, MatchesInsideWords) {
+    // "labor" is inside "collaborator" and starts "laboratory"
+    ASSERT_EQ(idsFor("labor"), (std::vector<std::string>{courseTitled("PHYS 2A").getId(), essay.getId()}));
+}
+
+TEST_F(SearchIndexTest, ShortTermsMatchWordStartsOnly) {
+    ASSERT_EQ(idsFor("2a"), (std::vector<std::string>{courseTitled("PHYS 2A").getId()}));
+    ASSERT_TRUE(idsFor("ab").empty());
+}
+
+TEST_F(SearchIndexTest, EveryTermMustMatch) {
+    ASSERT_EQ(idsFor("pendulum report"), (std::vector<std::string>{labReport.getId()}));
+    ASSERT_TRUE(idsFor("pendulum essay").empty());
+}
+
+TEST_F(SearchIndexTest, TitlesOutrankCategoriesAndDescriptions) {
+    std::vector<SearchHit> hits = index.search("report");
+
+    ASSERT_EQ(hits.size(), 2);
+    ASSERT_EQ(hits[0].id, labReport.getId());
+    ASSERT_EQ(hits[1].id, essay.getId());
+    ASSERT_GT(hits[0].score, hits[1].score);
+}
+
+TEST_F(SearchIndexTest, WholeWordsOutrankPrefixes) {
+    Course labs{"Labs", "", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/10}};
+    index.addCourse(labs, term.getId());
+
+    std::vector<SearchHit> hits = index.search("lab");
+
+    // a whole word in a title, the start of one, then the start and inside of words in descriptions
+    ASSERT_EQ(hits.size(), 4);
+    ASSERT_EQ(hits[0].id, labReport.getId());
+    ASSERT_EQ(hits[1].id, labs.getId());
+    ASSERT_EQ(hits[2].id, courseTitled("PHYS 2A").getId());
+    ASSERT_EQ(hits[3].id, essay.getId());
+}
+
+TEST_F(SearchIndexTest, LimitKeepsTheBest) {
+    std::vector<SearchHit> hits = index.search("report", 1);
+
+    ASSERT_EQ(hits.size(), 1);
+    ASSERT_EQ(hits[0].id, labReport.getId());
+}
+
+TEST_F(SearchIndexTest, UpdateReplacesOldWords) {
+    essay.setTitle("Research Paper");
+    index.updateAssignment(essay);
+
+    ASSERT_EQ(idsFor("paper"), (std::vector<std::string>{essay.getId()}));
+    ASSERT_TRUE(idsFor("essay").empty());
+}
+
+TEST_F(SearchIndexTest, RemoveCourseRemovesItsAssignments) {
+    index.removeCourse(courseTitled("PHYS 2A"));
+
+    ASSERT_EQ(index.size(), 3);
+    ASSERT_TRUE(idsFor("pendulum").empty());
+    ASSERT_EQ(idsFor("report"), (std::vector<std::string>{essay.getId()}));
+}
+
+TEST_F(SearchIndexTest, FreedSlotsAreReused) {
+    index.removeAssignment(labReport);
+    Assignment quiz{"Quiz 1", "", "Homework", std::chrono::year_month_day{2025y/9/20}};
+    index.addAssignment(quiz, courseTitled("PHYS 2A").getId());
+
+    ASSERT_EQ(idsFor("quiz"), (std::vector<std::string>{quiz.getId()}));
+    ASSERT_TRUE(idsFor("pendulum").empty());
+}
+
+
+// ====================================
+// FUNCTION EDGE CASES
+// ====================================
+
+TEST_F(SearchIndexTest, EmptyQueryMatchesNothing) {
+    ASSERT_TRUE(index.search("").empty());
+    ASSERT_TRUE(index.search("  ,. ").empty());
+    ASSERT_TRUE(index.search("report", 0).empty());
+}
+
+TEST_F(SearchIndexTest, UnknownWordMatchesNothing) {
+    ASSERT_TRUE(index.search("thermodynamics").empty());
+}
+
+TEST_F(SearchIndexTest, AddToUnindexedParent) {
+    Assignment quiz{"Quiz 1", "", "Homework", std::chrono::year_month_day{2025y/9/20}};
+
+    ASSERT_THROW(index.addAssignment(quiz, "missing"), std::out_of_range);
+    ASSERT_THROW(index.updateAssignment(quiz), std::out_of_range);
+}
+
+TEST_F(SearchIndexTest, ChurnKeepsResultsExact) {
+    // enough removals to leave more stale postings than live ones, so the index compacts along the way
+    const std::string courseId = courseTitled("PHYS 2A").getId();
+    for (int i = 0; i < 200; ++i) {
+        Assignment draft{"Draft Pendulum " + std::to_string(i), "Scratch work", "Labs",
+            std::chrono::year_month_day{2025y/9/20}};
+        index.addAssignment(draft, courseId);
+        index.removeAssignment(draft);
+    }
+    essay.setTitle("Pendulum Essay");
+    index.updateAssignment(essay);
+
+    ASSERT_EQ(index.size(), 5);
+    ASSERT_EQ(idsFor("pendulum"), (std::vector<std::string>{essay.getId(), labReport.getId()}));
+    ASSERT_TRUE(idsFor("draft").empty());
+    ASSERT_TRUE(idsFor("scratch").empty());
+}
+
+TEST_F(SearchIndexTest, RemoveTermEmptiesIndex) {
+    index.removeTerm(term);
+
+    ASSERT_EQ(index.size(), 0);
+    ASSERT_TRUE(index.search("report").empty());
+}
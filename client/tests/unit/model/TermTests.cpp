@@ -181,6 +181,29 @@ TEST_F(TermTest, RemoveCourse) {
     ASSERT_THROW(term1.getCourseList().at(id), std::out_of_range);
 }
 
+TEST_F(TermTest, CourseListKeepsInsertionOrder) {
+    Course course1{"CMPE 142", "Operating Systems", std::chrono::year_month_day{2025y/8/12}, std::chrono::year_month_day{2025y/12/5}, 3, false};
+    Course course2{"ENGR 195A", "", std::chrono::year_month_day{2025y/8/14}, std::chrono::year_month_day{2025y/12/18}};
+
+    term1.addCourse(course1);
+    term1.addCourse(course2);
+
+    ASSERT_EQ(term1.getCourseList().front().first, course1.getId());
+    ASSERT_EQ(term1.getCourseList().back().first, course2.getId());
+}
+
+TEST_F(TermTest, MoveCourse) {
+    Course course1{"CMPE 142", "Operating Systems", std::chrono::year_month_day{2025y/8/12}, std::chrono::year_month_day{2025y/12/5}, 3, false};
+    Course course2{"ENGR 195A", "", std::chrono::year_month_day{2025y/8/14}, std::chrono::year_month_day{2025y/12/18}};
+
+    term1.addCourse(course1);
+    term1.addCourse(course2);
+    term1.moveCourse(course2.getId(), 0);
+
+    ASSERT_EQ(term1.getCourseList().front().first, course2.getId());
+    ASSERT_EQ(term1.getCourseList().indexOf(course1.getId()), 1);
+}
+
 TEST_F(TermTest, FindCourseConst) {
     Course course1{"CMPE 142", "Operating Systems", std::chrono::year_month_day{2025y/8/12}, std::chrono::year_month_day{2025y/12/5}, 3, false};
     Course course2{"ENGR 195A", "", std::chrono::year_month_day{2025y/8/14}, std::chrono::year_month_day{2025y/12/18}};
@@ -390,6 +413,10 @@ TEST_F(TermTest, RemoveCourseNotFound) {
     ASSERT_THROW(term1.removeCourse(id), std::out_of_range);
 }
 
+TEST_F(TermTest, MoveCourseNotFound) {
+    ASSERT_THROW(term1.moveCourse("missing", 0), std::out_of_range);
+}
+
 TEST_F(TermTest, FindCourseConstNotFound) {
     Course course1{"CMPE 142", "Operating Systems", std::chrono::year_month_day{2025y/8/12}, std::chrono::year_month_day{2025y/12/5}, 3, false};
     Course course2{"ENGR 195A", "", std::chrono::year_month_day{2025y/8/14}, std::chrono::year_month_day{2025y/12/18}};
@@ -0,0 +1,318 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <string_view>
+#include "controller/TermController.hpp"
+#include "net/ApiService.hpp"
+
+// test fixture for ApiService, called directly with requests as HttpServer would pass them
+class ApiServiceTest : public testing::Test {
+    protected:
+        static constexpr std::string_view fall =
+            R"({"id":"t1","title":"Fall 2025","start_date":"2025-08-15","end_date":"2025-12-17","active":false})";
+        static constexpr std::string_view spring =
+            R"({"id":"t2","title":"Spring 2026","start_date":"2026-01-02","end_date":"2026-05-24","active":true})";
+        static constexpr std::string_view os =
+            R"({"id":"c1","term_id":"t2","title":"CMPE 142","description":null,"start_date":"2026-01-02","end_date":"2026-05-12","num_credits":3,"active":true})";
+        static constexpr std::string_view homework =
+            R"({"id":"a1","course_id":"c1","title":"Homework 1","description":"Processes","category":"Homework","due_date":"2026-01-20","completed":true,"grade":91.5})";
+
+        TermController controller{};
+        ApiService service{controller};
+
+        HttpResponse call(std::string_view method, std::string_view target, std::string_view body = {}) {
+            HttpRequest request;
+            request.method = method;
+            request.target = target;
+            request.body = body;
+            return service.handle(request);
+        }
+
+        void SetUp() override {
+            ASSERT_EQ(call("POST", "/terms/", fall).status, 201);
+            ASSERT_EQ(call("POST", "/terms/", spring).status, 201);
+            ASSERT_EQ(call("POST", "/courses/", os).status, 201);
+            ASSERT_EQ(call("POST", "/assignments/", homework).status, 201);
+        }
+
+        static std::string detail(std::string_view message) {
+            return R"({"detail":")" + std::string{message} + R"("})";
+        }
+};
+
+
+// ====================================
+// TERM TESTS
+// ====================================
+
+TEST_F(ApiServiceTest, CreatedTermReadsBack) {
+    HttpResponse response = call("GET", "/terms/t1");
+
+    ASSERT_EQ(response.status, 200);
+    ASSERT_EQ(response.body, fall);
+    ASSERT_EQ(call("GET", "/terms/").body, "[" + std::string{fall} + "," + std::string{spring} + "]");
+    ASSERT_EQ(controller.findTerm("Fall 2025").getId(), "t1");
+}
+
+TEST_F(ApiServiceTest, DuplicateTermIsConflict) {
+    std::string sameTitle = R"({"id":"t3","title":"fall 2025","start_date":"2025-08-15","end_date":"2025-12-17"})";
+    HttpResponse byTitle = call("POST", "/terms/", sameTitle);
+    HttpResponse byId = call("POST", "/terms/", spring);
+
+    ASSERT_EQ(byTitle.status, 409);
+    ASSERT_EQ(byTitle.body, detail("A term with this title already exists"));
+    ASSERT_EQ(byId.status, 409);
+    ASSERT_EQ(byId.body, detail("A term with this ID already exists"));
+    ASSERT_EQ(controller.getTermList().size(), 2);
+}
+
+TEST_F(ApiServiceTest, UnknownTermIsNotFound) {
+    for (std::string_view method : {"GET", "PUT", "DELETE"}) {
+        HttpResponse response = call(method, "/terms/missing", fall);
+        ASSERT_EQ(response.status, 404);
+        ASSERT_EQ(response.body, detail("Term not found"));
+    }
+    ASSERT_EQ(call("GET", "/terms/missing/tree").status, 404);
+}
+
+TEST_F(ApiServiceTest, UpdateAppliesToPathAndEchoesBody) {
+    std::string renamed = R"({"id":"ignored","title":"Fall 2025 old","start_date":"2025-08-15","end_date":"2025-12-20","active":false})";
+    HttpResponse response = call("PUT", "/terms/t1", renamed);
+
+    ASSERT_EQ(response.status, 200);
+    ASSERT_EQ(response.body, renamed);
+    ASSERT_EQ(controller.findTerm("Fall 2025 old").getId(), "t1");
+    ASSERT_FALSE(controller.getTermList().contains("ignored"));
+}
+
+TEST_F(ApiServiceTest, DeletingTermDeletesWhatItHolds) {
+    HttpResponse response = call("DELETE", "/terms/t2");
+
+    ASSERT_EQ(response.status, 204);
+    ASSERT_TRUE(response.body.empty());
+    ASSERT_EQ(call("GET", "/courses/c1").status, 404);
+    ASSERT_EQ(call("GET", "/assignments/a1").status, 404);
+    ASSERT_EQ(call("GET", "/assignments/").body, "[]");
+
+    // the IDs are free again
+    ASSERT_EQ(call("POST", "/terms/", spring).status, 201);
+    ASSERT_EQ(call("POST", "/courses/", os).status, 201);
+}
+
+TEST_F(ApiServiceTest, TreeNestsCoursesAndAssignments) {
+    HttpResponse response = call("GET", "/terms/t2/tree");
+    std::string expected = std::string{spring}.insert(spring.size() - 1, R"(,"courses":[)"
+        + std::string{os}.insert(os.size() - 1, R"(,"assignments":[)" + std::string{homework} + "]") + "]");
+
+    ASSERT_EQ(response.status, 200);
+    ASSERT_EQ(response.body, expected);
+}
+
+
+// ====================================
+// COURSE TESTS
+// ====================================
+
+TEST_F(ApiServiceTest, CourseNeedsExistingTerm) {
+    std::string orphan = R"({"id":"c2","term_id":"nope","title":"ENGR 195A","start_date":"2026-01-02","end_date":"2026-05-12"})";
+    HttpResponse response = call("POST", "/courses/", orphan);
+
+    ASSERT_EQ(response.status, 400);
+    ASSERT_EQ(response.body, detail("Invalid term_id"));
+}
+
+TEST_F(ApiServiceTest, CourseTitleIsUniquePerTerm) {
+    std::string sameTerm = R"({"id":"c2","term_id":"t2","title":"CMPE 142","start_date":"2026-01-02","end_date":"2026-05-12"})";
+    std::string otherTerm = R"({"id":"c3","term_id":"t1","title":"CMPE 142","start_date":"2025-08-15","end_date":"2025-12-17"})";
+
+    ASSERT_EQ(call("POST", "/courses/", sameTerm).body, detail("A course with this title already exists in this term"));
+    ASSERT_EQ(call("POST", "/courses/", os).body, detail("A course with this ID already exists"));
+    ASSERT_EQ(call("POST", "/courses/", otherTerm).status, 201);
+    ASSERT_EQ(call("GET", "/courses/by-term/t1").body, "[" + std::string{R"({"id":"c3","term_id":"t1","title":"CMPE 142","description":null,"start_date":"2025-08-15","end_date":"2025-12-17","num_credits":3,"active":true})"} + "]");
+    ASSERT_EQ(call("GET", "/courses/by-term/missing").body, "[]");
+}
+
+TEST_F(ApiServiceTest, CourseUpdateStaysInItsTerm) {
+    std::string moved = R"({"id":"c1","term_id":"t1","title":"CMPE 142","description":"Operating Systems","start_date":"2026-01-02","end_date":"2026-05-12","num_credits":4,"active":true})";
+    HttpResponse response = call("PUT", "/courses/c1", moved);
+
+    ASSERT_EQ(response.status, 200);
+    ASSERT_EQ(response.body, moved);
+    HttpResponse stored = call("GET", "/courses/c1");
+    ASSERT_NE(stored.body.find(R"("term_id":"t2")"), std::string::npos);
+    ASSERT_NE(stored.body.find(R"("num_credits":4)"), std::string::npos);
+    ASSERT_EQ(call("GET", "/assignments/a1").body, homework);   // its assignments are untouched
+}
+
+TEST_F(ApiServiceTest, DeletingCourseDeletesItsAssignments) {
+    ASSERT_EQ(call("DELETE", "/courses/c1").status, 204);
+    ASSERT_EQ(call("DELETE", "/courses/c1").body, detail("Course not found"));
+    ASSERT_EQ(call("GET", "/assignments/a1").body, detail("Assignment not found"));
+    ASSERT_TRUE(controller.findTerm("Spring 2026").getCourseList().empty());
+}
+
+TEST_F(ApiServiceTest, DeletesLeaveSelectionHistoryAndTrackerAlone) {
+    controller.selectTerm("Fall 2025");
+
+    ASSERT_EQ(call("DELETE", "/assignments/a1").status, 204);
+    ASSERT_EQ(call("DELETE", "/courses/c1").status, 204);
+    ASSERT_EQ(call("DELETE", "/terms/t2").status, 204);
+
+    ASSERT_TRUE(controller.getChangeTracker().getPendingChanges().empty());
+    ASSERT_FALSE(controller.getUndoLog().canUndo());
+    ASSERT_EQ(controller.getActiveTerm().getId(), "t1");
+    ASSERT_EQ(controller.getTermList().size(), 1);
+}
+
+
+// ====================================
+// ASSIGNMENT TESTS
+// ====================================
+
+TEST_F(ApiServiceTest, AssignmentRoutes) {
+    std::string graded = R"({"id":"a1","course_id":"c1","title":"Homework 1","description":null,"category":"Homework","due_date":"2026-01-21","completed":true,"grade":80})";
+    std::string orphan = R"({"id":"a2","course_id":"nope","title":"Quiz","category":"Quiz","due_date":"2026-01-21"})";
+
+    ASSERT_EQ(call("GET", "/assignments/by-course/c1").body, "[" + std::string{homework} + "]");
+    ASSERT_EQ(call("POST", "/assignments/", homework).body, detail("An assignment with this ID already exists"));
+    ASSERT_EQ(call("POST", "/assignments/", orphan).body, detail("Invalid course_id"));
+
+    ASSERT_EQ(call("PUT", "/assignments/a1", graded).status, 200);
+    const Course& course = controller.findTerm("Spring 2026").getCourseList().at("c1");
+    ASSERT_FLOAT_EQ(course.getAssignmentList().at("a1").getGrade(), 80.0f);
+    ASSERT_FLOAT_EQ(course.getGradePct(), 80.0f);
+
+    ASSERT_EQ(call("DELETE", "/assignments/a1").status, 204);
+    ASSERT_EQ(call("GET", "/assignments/by-course/c1").body, "[]");
+}
+
+TEST_F(ApiServiceTest, GradeAndGpaFollowAssignments) {
+    std::string midterm = R"({"id":"a2","course_id":"c1","title":"Midterm","category":"Midterm","due_date":"2026-03-01","completed":true,"grade":84.7})";
+    std::string retaken = R"({"id":"a2","course_id":"c1","title":"Midterm","category":"Midterm","due_date":"2026-03-01","completed":true,"grade":60})";
+
+    ASSERT_EQ(call("POST", "/assignments/", midterm).status, 201);
+    ASSERT_EQ(call("GET", "/courses/c1/grade").body,
+        R"({"course_id":"c1","grade_pct":87.53,"letter_grade":"B+","gpa_val":3.3})");
+    ASSERT_EQ(call("GET", "/terms/t2/gpa").body, R"({"term_id":"t2","total_credits":3,"ovr_gpa":3.3})");
+
+    // the term's stored GPA lags an assignment change; the route doesn't
+    ASSERT_EQ(call("PUT", "/assignments/a2", retaken).status, 200);
+    ASSERT_EQ(call("GET", "/courses/c1/grade").body,
+        R"({"course_id":"c1","grade_pct":73.13,"letter_grade":"C","gpa_val":2})");
+    ASSERT_EQ(call("GET", "/terms/t2/gpa").body, R"({"term_id":"t2","total_credits":3,"ovr_gpa":2})");
+
+    ASSERT_EQ(call("GET", "/terms/t1/gpa").body, R"({"term_id":"t1","total_credits":0,"ovr_gpa":0})");
+    ASSERT_EQ(call("GET", "/courses/missing/grade").body, detail("Course not found"));
+    ASSERT_EQ(call("GET", "/terms/missing/gpa").body, detail("Term not found"));
+    ASSERT_EQ(call("POST", "/courses/c1/grade").status, 405);
+}
+
+
+// ====================================
+// ROUTING TESTS
+// ====================================
+
+TEST_F(ApiServiceTest, BadBodyIsUnprocessable) {
+    HttpResponse missing = call("POST", "/terms/", R"({"id":"t3","title":"Summer"})");
+    HttpResponse broken = call("POST", "/courses/", "{");
+    HttpResponse badDate = call("PUT", "/terms/t1", R"({"id":"t1","title":"x","start_date":"someday","end_date":"2025-12-17"})");
+
+    ASSERT_EQ(missing.status, 422);
+    ASSERT_EQ(missing.body, detail("Missing required field 'start_date'."));
+    ASSERT_EQ(broken.status, 422);
+    ASSERT_EQ(badDate.status, 422);
+}
+
+TEST_F(ApiServiceTest, UnknownRoutesAndMethods) {
+    ASSERT_EQ(call("GET", "/").status, 404);
+    ASSERT_EQ(call("GET", "/grades/").body, detail("Not Found"));
+    ASSERT_EQ(call("GET", "/terms/t1/courses").status, 404);
+    ASSERT_EQ(call("DELETE", "/terms/").body, detail("Method Not Allowed"));
+    ASSERT_EQ(call("PATCH", "/terms/t1").status, 405);
+    ASSERT_EQ(call("POST", "/terms/t1/tree").status, 405);
+}
+
+TEST_F(ApiServiceTest, TrailingSlashAndQueryAreIgnored) {
+    ASSERT_EQ(call("GET", "/terms").status, 200);
+    ASSERT_EQ(call("GET", "/terms/t1/").body, fall);
+    ASSERT_EQ(call("GET", "/terms/t1?fields=all").body, fall);
+}
+
+TEST_F(ApiServiceTest, ConditionalGetIsNotModified) {
+    HttpResponse first = call("GET", "/terms/t2/tree");
+    std::string tag = first.header("etag");
+
+    HttpRequest request;
+    request.method = "GET";
+    request.target = "/terms/t2/tree";
+    request.headers.emplace_back("If-None-Match", tag);
+    HttpResponse unchanged = service.handle(request);
+
+    ASSERT_EQ(tag.size(), 18);
+    ASSERT_EQ(unchanged.status, 304);
+    ASSERT_TRUE(unchanged.body.empty());
+    ASSERT_EQ(unchanged.header("etag"), tag);
+
+    // any change below the term changes the tree's tag
+    ASSERT_EQ(call("DELETE", "/assignments/a1").status, 204);
+    HttpResponse changed = service.handle(request);
+    ASSERT_EQ(changed.status, 200);
+    ASSERT_NE(changed.header("etag"), tag);
+    ASSERT_TRUE(call("DELETE", "/terms/t1").header("etag").empty());    // only successful GETs are tagged
+}
+
+TEST_F(ApiServiceTest, ListsArePagedByIdAfterKey) {
+    ASSERT_EQ(call("GET", "/terms/?limit=1").body, "[" + std::string{fall} + "]");
+    ASSERT_EQ(call("GET", "/terms/?after=t1&limit=1").body, "[" + std::string{spring} + "]");
+    ASSERT_EQ(call("GET", "/terms/?after=t2").body, "[]");
+    ASSERT_EQ(call("GET", "/assignments/by-course/c1?after=a0&limit=5").body, "[" + std::string{homework} + "]");
+    ASSERT_EQ(call("GET", "/courses/?after=%63%31").body, "[]");    // after=c1, percent-encoded
+}
+
+TEST_F(ApiServiceTest, PagesFollowCreatesAndDeletes) {
+    std::string early = R"({"id":"t0","title":"Summer 2025","start_date":"2025-06-01","end_date":"2025-08-01","active":false})";
+    ASSERT_EQ(call("POST", "/terms/", early).status, 201);
+    ASSERT_EQ(call("GET", "/terms/?limit=1").body, "[" + early + "]");
+    ASSERT_EQ(call("GET", "/courses/by-term/t2?limit=5").body, "[" + std::string{os} + "]");
+
+    ASSERT_EQ(call("DELETE", "/terms/t2").status, 204);
+    ASSERT_EQ(call("GET", "/terms/?after=t0").body, "[" + std::string{fall} + "]");
+    ASSERT_EQ(call("GET", "/courses/?limit=5").body, "[]");
+    ASSERT_EQ(call("GET", "/courses/by-term/t2?limit=5").body, "[]");
+    ASSERT_EQ(call("GET", "/assignments/?limit=5").body, "[]");
+}
+
+TEST_F(ApiServiceTest, NdjsonListHasOneRecordPerLine) {
+    HttpResponse response = call("GET", "/terms?format=ndjson");
+
+    ASSERT_EQ(response.status, 200);
+    ASSERT_EQ(response.body, std::string{fall} + "\n" + std::string{spring} + "\n");
+    ASSERT_EQ(response.header("content-type"), "application/x-ndjson");
+    ASSERT_EQ(call("GET", "/courses/by-term/missing?format=ndjson").body, "");
+}
+
+TEST_F(ApiServiceTest, BadListParametersAreUnprocessable) {
+    ASSERT_EQ(call("GET", "/terms/?limit=0").status, 422);
+    ASSERT_EQ(call("GET", "/terms/?limit=1001").status, 422);
+    ASSERT_EQ(call("GET", "/courses/?limit=ten").status, 422);
+    ASSERT_EQ(call("GET", "/assignments/?format=xml").body, detail("format must be 'json' or 'ndjson'."));
+}
+
+TEST_F(ApiServiceTest, ExistingTreeIsServed) {
+    TermController loaded;
+    loaded.addTerm("Fall 2026", std::chrono::year_month_day{std::chrono::year{2026}/8/15},
+        std::chrono::year_month_day{std::chrono::year{2026}/12/17}, true);
+    loaded.selectTerm("Fall 2026");
+    loaded.getCourseController().addCourse("CMPE 148", "", std::chrono::year_month_day{std::chrono::year{2026}/8/15},
+        std::chrono::year_month_day{std::chrono::year{2026}/12/10}, 3, true);
+    ApiService loadedService{loaded};
+
+    std::string target = "/courses/" + loaded.getCourseController().getCourseId("CMPE 148");
+    HttpRequest request;
+    request.method = "GET";
+    request.target = target;
+
+    HttpResponse response = loadedService.handle(request);
+    ASSERT_EQ(response.status, 200);
+    ASSERT_NE(response.body.find(R"("title":"CMPE 148")"), std::string::npos);
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include "net/HttpClient.hpp"
+#include "StubHttpServer.hpp"
+
+// test fixture for the HTTP client, backed by an in-process stub server
+class HttpClientTest : public testing::Test {
+    protected:
+        StubResponse nextResponse{};
+        StubHttpServer server{[this](const StubRequest&) { return nextResponse; }};
+        HttpClient client{"127.0.0.1", server.port()};
+};
+
+
+// ====================================
+// REQUEST TESTS
+// ====================================
+
+TEST_F(HttpClientTest, GetReturnsStatusAndBody) {
+    nextResponse = StubResponse{200, "{\"ok\":true}"};
+    HttpResponse response = client.request("GET", "/terms/");
+
+    ASSERT_EQ(response.status, 200);
+    ASSERT_EQ(response.body, "{\"ok\":true}");
+    ASSERT_EQ(server.requests().at(0).method, "GET");
+    ASSERT_EQ(server.requests().at(0).target, "/terms/");
+}
+
+TEST_F(HttpClientTest, PostSendsJsonBody) {
+    nextResponse = StubResponse{201, "{}"};
+    client.request("POST", "/terms/", "{\"id\":\"1\"}");
+
+    StubRequest request = server.requests().at(0);
+    ASSERT_EQ(request.body, "{\"id\":\"1\"}");
+
+    bool hasContentType = false;
+    for (const auto& [name, value] : request.headers) {
+        hasContentType = hasContentType || (name == "Content-Type" && value == "application/json");
+    }
+    ASSERT_TRUE(hasContentType);
+}
+
+TEST_F(HttpClientTest, HeaderLookupIsCaseInsensitive) {
+    nextResponse = StubResponse{200, "", {{"ETag", "\"abc\""}}};
+    HttpResponse response = client.request("GET", "/terms/");
+
+    ASSERT_EQ(response.header("etag"), "\"abc\"");
+    ASSERT_EQ(response.header("ETAG"), "\"abc\"");
+    ASSERT_EQ(response.header("missing"), "");
+}
+
+TEST_F(HttpClientTest, NoContentHasEmptyBody) {
+    nextResponse = StubResponse{204};
+    HttpResponse response = client.request("DELETE", "/terms/1");
+
+    ASSERT_EQ(response.status, 204);
+    ASSERT_TRUE(response.body.empty());
+}
+
+TEST_F(HttpClientTest, ChunkedBodyIsDecoded) {
+    nextResponse = StubResponse{200, "{\"title\":\"a fairly long chunked body\"}"};
+    nextResponse.chunked = true;
+    HttpResponse response = client.request("GET", "/terms/");
+
+    ASSERT_EQ(response.body, "{\"title\":\"a fairly long chunked body\"}");
+}
+
+
+// ====================================
+// CONNECTION TESTS
+// ====================================
+
+TEST_F(HttpClientTest, KeepAliveReusesConnection) {
+    nextResponse = StubResponse{200, "{}"};
+
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_EQ(client.request("GET", "/terms/").status, 200);
+    }
+
+    ASSERT_EQ(client.getConnectionCount(), 1);
+    ASSERT_EQ(server.connectionCount(), 1);
+}
+
+TEST_F(HttpClientTest, ConnectionCloseHeaderReconnects) {
+    nextResponse = StubResponse{200, "{}", {{"Connection", "close"}}};
+    nextResponse.closeAfter = true;
+    client.request("GET", "/terms/");
+    client.request("GET", "/terms/");
+
+    ASSERT_EQ(client.getConnectionCount(), 2);
+    ASSERT_EQ(server.requests().size(), 2);
+}
+
+TEST_F(HttpClientTest, StaleConnectionIsRetried) {
+    // the server drops the connection without telling the client, as an idle timeout would
+    nextResponse = StubResponse{200, "{}"};
+    nextResponse.closeAfter = true;
+    client.request("GET", "/terms/");
+
+    HttpResponse response = client.request("GET", "/courses/");
+
+    ASSERT_EQ(response.status, 200);
+    ASSERT_EQ(server.requests().back().target, "/courses/");
+}
+
+TEST_F(HttpClientTest, UnreachableServerThrows) {
+    std::uint16_t closedPort = 0;
+    {
+        StubHttpServer temporary{[](const StubRequest&) { return StubResponse{}; }};
+        closedPort = temporary.port();
+    }
+
+    HttpClient unreachable{"127.0.0.1", closedPort};
+    ASSERT_THROW(unreachable.request("GET", "/terms/"), std::runtime_error);
+}
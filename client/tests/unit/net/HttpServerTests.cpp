@@ -0,0 +1,291 @@
+#include <gtest/gtest.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <ctime>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "net/HttpClient.hpp"
+#include "net/HttpServer.hpp"
+
+// test fixture for HttpServer, running on its own thread with a handler that echoes what it was sent
+class HttpServerTest : public testing::Test {
+    protected:
+        // more than a throttled connection's socket buffers hold, but not enough to pause reading
+        static constexpr std::size_t largeSize = HttpServer::maxPendingOutput / 2;
+
+        HttpServer server{"127.0.0.1", 0, [](const HttpRequest& request) {
+            if (request.target == "/throw") {
+                throw std::runtime_error("handler failed");
+            }
+            if (request.target == "/empty") {
+                return HttpResponse{204, {}, {}};
+            }
+            if (request.target == "/large") {
+                return HttpResponse{200, {{"content-type", "text/plain"}}, std::string(largeSize, 'x')};
+            }
+            std::string body{request.method};
+            body.append(" ").append(request.target).append(" ").append(request.header("x-test"))
+                .append(" ").append(request.body);
+            return HttpResponse{200, {{"content-type", "text/plain"}}, body};
+        }};
+        std::thread loop{[this]() { server.run(); }};
+        HttpClient client{"127.0.0.1", server.getPort()};
+
+        void TearDown() override {
+            server.stop();
+            loop.join();
+        }
+
+        sockaddr_in serverAddress() const {
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            address.sin_port = htons(server.getPort());
+            return address;
+        }
+
+        // opens a raw connection; a throttled one asks for small segments and a small window before connecting, so
+        // the server's socket buffers only take a few kilobytes of what it sends before the peer reads
+        int connectRaw(bool throttled = false) const {
+            int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+            if (throttled) {
+                int segment = 536;
+                int receiveBuffer = 4096;
+                ::setsockopt(fd, IPPROTO_TCP, TCP_MAXSEG, &segment, sizeof(segment));
+                ::setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &receiveBuffer, sizeof(receiveBuffer));
+            }
+            sockaddr_in address = serverAddress();
+            if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+                ::close(fd);
+                throw std::runtime_error("Could not connect to the server under test.");
+            }
+            return fd;
+        }
+
+        // reads until the server closes the connection
+        static std::string drain(int fd) {
+            std::string received;
+            char buffer[4096];
+            for (ssize_t n = ::recv(fd, buffer, sizeof(buffer), 0); n > 0; n = ::recv(fd, buffer, sizeof(buffer), 0)) {
+                received.append(buffer, static_cast<std::size_t>(n));
+            }
+            return received;
+        }
+
+        // sends raw bytes on a fresh connection, in the given pieces, and returns everything received until the
+        // server closes it
+        std::string exchange(const std::vector<std::string>& pieces) const {
+            int fd = connectRaw();
+
+            for (const std::string& piece : pieces) {
+                ::send(fd, piece.data(), piece.size(), MSG_NOSIGNAL);
+                std::this_thread::sleep_for(std::chrono::milliseconds{5});
+            }
+
+            std::string received = drain(fd);
+            ::close(fd);
+            return received;
+        }
+
+        static std::chrono::nanoseconds cpuTime() {
+            timespec now{};
+            ::clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+            return std::chrono::seconds{now.tv_sec} + std::chrono::nanoseconds{now.tv_nsec};
+        }
+
+        static std::size_t countOf(const std::string& haystack, const std::string& needle) {
+            std::size_t count = 0;
+            for (std::size_t pos = haystack.find(needle); pos != std::string::npos; pos = haystack.find(needle, pos + 1)) {
+                ++count;
+            }
+            return count;
+        }
+};
+
+
+// ====================================
+// REQUEST TESTS
+// ====================================
+
+TEST_F(HttpServerTest, HandlerSeesMethodTargetHeadersAndBody) {
+    HttpResponse response = client.request("POST", "/terms/?x=1", "{\"id\":\"1\"}", {{"X-Test", "value"}});
+
+    ASSERT_EQ(response.status, 200);
+    ASSERT_EQ(response.body, "POST /terms/?x=1 value {\"id\":\"1\"}");
+    ASSERT_EQ(response.header("content-type"), "text/plain");
+}
+
+TEST_F(HttpServerTest, NoContentHasNoBody) {
+    HttpResponse response = client.request("DELETE", "/empty");
+
+    ASSERT_EQ(response.status, 204);
+    ASSERT_TRUE(response.body.empty());
+    ASSERT_EQ(client.request("GET", "/after").status, 200);   // the connection is still in step
+}
+
+TEST_F(HttpServerTest, HandlerExceptionIsInternalError) {
+    HttpResponse response = client.request("GET", "/throw");
+
+    ASSERT_EQ(response.status, 500);
+    ASSERT_EQ(response.header("content-type"), "application/json");
+    ASSERT_EQ(client.request("GET", "/after").status, 200);
+    ASSERT_EQ(client.getConnectionCount(), 1);
+}
+
+
+// ====================================
+// CONNECTION TESTS
+// ====================================
+
+TEST_F(HttpServerTest, KeepAliveServesManyRequests) {
+    for (int i = 0; i < 200; ++i) {
+        ASSERT_EQ(client.request("GET", "/terms/" + std::to_string(i)).body, "GET /terms/" + std::to_string(i) + "  ");
+    }
+
+    ASSERT_EQ(client.getConnectionCount(), 1);
+}
+
+TEST_F(HttpServerTest, PipelinedRequestsAreAnsweredInOrder) {
+    std::string received = exchange({
+        "GET /a HTTP/1.1\r\nHost: x\r\n\r\n"
+        "POST /b HTTP/1.1\r\nHost: x\r\nContent-Length: 2\r\n\r\nhi"
+        "GET /c HTTP/1.1\r\nHost: x\r\nConnection: close\r\n\r\n"
+    });
+
+    std::size_t a = received.find("GET /a");
+    std::size_t b = received.find("POST /b  hi");
+    std::size_t c = received.find("GET /c");
+    ASSERT_NE(a, std::string::npos);
+    ASSERT_NE(b, std::string::npos);
+    ASSERT_NE(c, std::string::npos);
+    ASSERT_LT(a, b);
+    ASSERT_LT(b, c);
+    ASSERT_EQ(countOf(received, "HTTP/1.1 200 OK"), 3);
+}
+
+TEST_F(HttpServerTest, RequestSplitAcrossPacketsIsReassembled) {
+    std::string received = exchange({
+        "PUT /split HT", "TP/1.1\r\nContent-Le", "ngth: 5\r\nConnection: close\r\n\r\nab", "cde"
+    });
+
+    ASSERT_NE(received.find("PUT /split  abcde"), std::string::npos);
+}
+
+TEST_F(HttpServerTest, ExpectContinueIsAnswered) {
+    std::string received = exchange({
+        "POST /upload HTTP/1.1\r\nExpect: 100-continue\r\nContent-Length: 3\r\nConnection: close\r\n\r\n", "abc"
+    });
+
+    ASSERT_EQ(received.rfind("HTTP/1.1 100 Continue\r\n\r\n", 0), 0);
+    ASSERT_NE(received.find("POST /upload  abc"), std::string::npos);
+}
+
+TEST_F(HttpServerTest, ConnectionCloseIsHonoured) {
+    client.request("GET", "/one", {}, {{"Connection", "close"}});
+    client.request("GET", "/two");
+
+    ASSERT_EQ(client.getConnectionCount(), 2);
+}
+
+TEST_F(HttpServerTest, HalfClosedPeerWaitsForItsResponseWithoutSpinning) {
+    // the peer shuts down its side at once, but reads nothing yet, so most of the response has to wait
+    int fd = connectRaw(true);
+    std::string request = "GET /large HTTP/1.1\r\n\r\n";
+    ::send(fd, request.data(), request.size(), MSG_NOSIGNAL);
+    ::shutdown(fd, SHUT_WR);
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+
+    // this thread only sleeps, so the process's CPU time is the server's
+    std::chrono::nanoseconds before = cpuTime();
+    std::this_thread::sleep_for(std::chrono::milliseconds{300});
+    std::chrono::nanoseconds spent = cpuTime() - before;
+
+    std::string received = drain(fd);
+    ::close(fd);
+    ASSERT_LT(spent, std::chrono::milliseconds{100});
+    ASSERT_EQ(received.rfind("HTTP/1.1 200 OK", 0), 0);
+    ASSERT_EQ(received.size() - received.find("\r\n\r\n") - 4, largeSize);
+}
+
+TEST_F(HttpServerTest, ConnectionsPastTheDescriptorLimitAreRefusedWithoutSpinning) {
+    // the sockets are made first, then the limit is lowered to the lowest free descriptor, so none can be accepted
+    std::vector<int> fds;
+    for (int i = 0; i < 3; ++i) {
+        fds.push_back(::socket(AF_INET, SOCK_STREAM, 0));
+    }
+    rlimit saved{};
+    ::getrlimit(RLIMIT_NOFILE, &saved);
+    int lowestFree = ::dup(fds[0]);
+    ::close(lowestFree);
+    rlimit lowered{static_cast<rlim_t>(lowestFree), saved.rlim_max};
+    ::setrlimit(RLIMIT_NOFILE, &lowered);
+
+    sockaddr_in address = serverAddress();
+    for (int fd : fds) {
+        ::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+
+    std::chrono::nanoseconds before = cpuTime();
+    std::this_thread::sleep_for(std::chrono::milliseconds{300});
+    std::chrono::nanoseconds spent = cpuTime() - before;
+    ::setrlimit(RLIMIT_NOFILE, &saved);
+
+    // each was accepted and closed at once, rather than left in the backlog
+    for (int fd : fds) {
+        pollfd closed{fd, POLLIN, 0};
+        char byte = 0;
+        ASSERT_EQ(::poll(&closed, 1, 1000), 1);
+        ASSERT_LE(::recv(fd, &byte, 1, 0), 0);
+        ::close(fd);
+    }
+    ASSERT_LT(spent, std::chrono::milliseconds{100});
+    ASSERT_EQ(client.request("GET", "/after").status, 200);
+}
+
+
+// ====================================
+// ERROR TESTS
+// ====================================
+
+TEST_F(HttpServerTest, MalformedRequestIsRejectedAndClosed) {
+    std::string received = exchange({"NONSENSE\r\n\r\nGET /never HTTP/1.1\r\n\r\n"});
+
+    ASSERT_EQ(received.rfind("HTTP/1.1 400 Bad Request", 0), 0);
+    ASSERT_NE(received.find("Connection: close"), std::string::npos);
+    ASSERT_EQ(received.find("/never"), std::string::npos);
+}
+
+TEST_F(HttpServerTest, ChunkedRequestIsNotImplemented) {
+    std::string received = exchange({"POST /a HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n3\r\nabc\r\n0\r\n\r\n"});
+
+    ASSERT_EQ(received.rfind("HTTP/1.1 501 Not Implemented", 0), 0);
+}
+
+TEST_F(HttpServerTest, OversizedBodyIsRejected) {
+    std::string received = exchange({"POST /a HTTP/1.1\r\nContent-Length: " + std::to_string(HttpServer::maxBodySize + 1) + "\r\n\r\n"});
+
+    ASSERT_EQ(received.rfind("HTTP/1.1 413 ", 0), 0);
+}
+
+TEST_F(HttpServerTest, LargestBodyIsAcceptedInOneBurst) {
+    std::string body(HttpServer::maxBodySize, 'b');
+    std::string received = exchange({"PUT /max HTTP/1.1\r\nContent-Length: " + std::to_string(body.size())
+        + "\r\nConnection: close\r\n\r\n" + body});
+
+    ASSERT_EQ(received.rfind("HTTP/1.1 200 OK", 0), 0);
+    ASSERT_NE(received.find("PUT /max  " + body), std::string::npos);
+}
+
+TEST_F(HttpServerTest, OversizedHeaderIsRejected) {
+    std::string received = exchange({"GET /a HTTP/1.1\r\nX-Big: " + std::string(HttpServer::maxHeaderSize + 1, 'a')});
+
+    ASSERT_EQ(received.rfind("HTTP/1.1 431 ", 0), 0);
+}
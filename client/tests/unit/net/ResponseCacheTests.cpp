@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "net/HttpClient.hpp"
+#include "net/ResponseCache.hpp"
+#include "StubHttpServer.hpp"
+
+// test fixture for the response cache, backed by a stub server that answers conditional GETs of one document
+class ResponseCacheTest : public testing::Test {
+    protected:
+        int status{200};
+        std::string body{"[{\"id\":\"t1\"}]"};
+        std::string tag{"\"v1\""};
+        StubHttpServer server{[this](const StubRequest& request) { return handle(request); }};
+        HttpClient client{"127.0.0.1", server.port()};
+        ResponseCache cache{};
+
+        StubResponse handle(const StubRequest& request) {
+            if (status != 200) {
+                return StubResponse{status, "{\"detail\":\"Term not found\"}"};
+            }
+            for (const auto& [name, value] : request.headers) {
+                if (name == "If-None-Match" && value == tag) {
+                    return StubResponse{304, "", {{"ETag", tag}}};
+                }
+            }
+
+            StubResponse response{200, body};
+            if (!tag.empty()) {
+                response.headers.emplace_back("ETag", tag);
+            }
+            return response;
+        }
+
+        std::string ifNoneMatch(std::size_t index) const {
+            std::vector<StubRequest> requests = server.requests();
+            for (const auto& [name, value] : requests.at(index).headers) {
+                if (name == "If-None-Match") {
+                    return value;
+                }
+            }
+            return "";
+        }
+};
+
+
+// ====================================
+// REVALIDATION TESTS
+// ====================================
+
+TEST_F(ResponseCacheTest, UnchangedResponseComesBackAsNotModified) {
+    HttpResponse first = cache.get(client, "/terms/");
+    HttpResponse second = cache.get(client, "/terms/");
+
+    ASSERT_EQ(first.status, 200);
+    ASSERT_EQ(ifNoneMatch(0), "");
+    ASSERT_EQ(ifNoneMatch(1), "\"v1\"");
+    ASSERT_EQ(second.status, 304);
+    ASSERT_EQ(second.body, body);
+    ASSERT_EQ(second.header("etag"), "\"v1\"");
+    ASSERT_EQ(cache.getHitCount(), 1);
+    ASSERT_EQ(client.getConnectionCount(), 1);     // the empty 304 left the connection in step
+}
+
+TEST_F(ResponseCacheTest, ChangedResponseReplacesEntry) {
+    cache.get(client, "/terms/");
+    body = "[]";
+    tag = "\"v2\"";
+
+    HttpResponse changed = cache.get(client, "/terms/");
+    HttpResponse again = cache.get(client, "/terms/");
+
+    ASSERT_EQ(changed.status, 200);
+    ASSERT_EQ(changed.body, "[]");
+    ASSERT_EQ(ifNoneMatch(2), "\"v2\"");
+    ASSERT_EQ(again.status, 304);
+    ASSERT_EQ(again.body, "[]");
+}
+
+TEST_F(ResponseCacheTest, EntriesAreKeptPerTarget) {
+    cache.get(client, "/terms/t1");
+    cache.get(client, "/terms/t2");
+    cache.erase("/terms/t1");
+
+    ASSERT_FALSE(cache.contains("/terms/t1"));
+    ASSERT_TRUE(cache.contains("/terms/t2"));
+    ASSERT_EQ(cache.get(client, "/terms/t1").status, 200);
+    ASSERT_EQ(cache.size(), 2);
+}
+
+
+// ====================================
+// EDGE CASES
+// ====================================
+
+TEST_F(ResponseCacheTest, ResponseWithoutTagIsNotStored) {
+    tag.clear();
+    cache.get(client, "/terms/");
+    cache.get(client, "/terms/");
+
+    ASSERT_EQ(cache.size(), 0);
+    ASSERT_EQ(ifNoneMatch(1), "");
+}
+
+TEST_F(ResponseCacheTest, ErrorDropsEntry) {
+    cache.get(client, "/terms/t1");
+    status = 404;
+
+    HttpResponse missing = cache.get(client, "/terms/t1");
+
+    ASSERT_EQ(missing.status, 404);
+    ASSERT_FALSE(cache.contains("/terms/t1"));
+    ASSERT_EQ(cache.getHitCount(), 0);
+}
@@ -0,0 +1,223 @@
+#ifndef STUBHTTPSERVER_HPP
+#define STUBHTTPSERVER_HPP
+
+/**
+ * @file StubHttpServer.hpp
+ * @brief A minimal in-process HTTP/1.1 server on 127.0.0.1 for tests of the networking and sync code.
+ *
+ * Each request is passed to a handler function, and every request is recorded so tests can assert
+ * exactly what went over the wire. Connections are served one at a time, with keep-alive.
+ */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+struct StubRequest {
+    std::string method{};
+    std::string target{};
+    std::vector<std::pair<std::string, std::string>> headers{};
+    std::string body{};
+};
+
+struct StubResponse {
+    int status{200};
+    std::string body{};
+    std::vector<std::pair<std::string, std::string>> headers{};
+    bool chunked{false};        // send the body with chunked transfer encoding
+    bool closeAfter{false};     // close the connection after this response, without saying so
+};
+
+class StubHttpServer {
+    public:
+        using Handler = std::function<StubResponse(const StubRequest&)>;
+
+        explicit StubHttpServer(Handler handler) : handler_{std::move(handler)} {
+            listenFd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+            int reuse = 1;
+            ::setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            address.sin_port = 0;
+
+            if (::bind(listenFd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+                ::listen(listenFd_, 8) != 0) {
+                ::close(listenFd_);
+                throw std::runtime_error("Stub server could not listen.");
+            }
+
+            socklen_t length = sizeof(address);
+            ::getsockname(listenFd_, reinterpret_cast<sockaddr*>(&address), &length);
+            port_ = ntohs(address.sin_port);
+
+            thread_ = std::thread{[this]() { serve(); }};
+        }
+
+        ~StubHttpServer() {
+            stop_ = true;
+            thread_.join();
+            ::close(listenFd_);
+        }
+
+        StubHttpServer(const StubHttpServer&) = delete;
+        StubHttpServer& operator=(const StubHttpServer&) = delete;
+
+        std::uint16_t port() const {
+            return port_;
+        }
+
+        std::vector<StubRequest> requests() const {
+            std::lock_guard lock{mutex_};
+            return requests_;
+        }
+
+        std::size_t connectionCount() const {
+            return connections_;
+        }
+
+        void clearRequests() {
+            std::lock_guard lock{mutex_};
+            requests_.clear();
+        }
+
+    private:
+        Handler handler_;
+        int listenFd_{-1};
+        std::uint16_t port_{0};
+        std::thread thread_{};
+        std::atomic<bool> stop_{false};
+        std::atomic<std::size_t> connections_{0};
+        mutable std::mutex mutex_{};
+        std::vector<StubRequest> requests_{};
+
+        // waits until fd is readable; returns false if the server is stopping
+        bool waitReadable(int fd) {
+            pollfd entry{fd, POLLIN, 0};
+            while (!stop_) {
+                if (::poll(&entry, 1, 20) > 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void serve() {
+            while (waitReadable(listenFd_)) {
+                int fd = ::accept(listenFd_, nullptr, nullptr);
+                if (fd == -1) {
+                    continue;
+                }
+                ++connections_;
+                serveConnection(fd);
+                ::close(fd);
+            }
+        }
+
+        void serveConnection(int fd) {
+            std::string buffer;
+
+            while (true) {
+                std::size_t headerEnd;
+                while ((headerEnd = buffer.find("\r\n\r\n")) == std::string::npos) {
+                    if (!receive(fd, buffer)) {
+                        return;
+                    }
+                }
+
+                StubRequest request;
+                std::string head = buffer.substr(0, headerEnd);
+                buffer.erase(0, headerEnd + 4);
+
+                std::size_t lineEnd = head.find("\r\n");
+                std::string requestLine = head.substr(0, lineEnd);
+                std::size_t firstSpace = requestLine.find(' ');
+                std::size_t secondSpace = requestLine.find(' ', firstSpace + 1);
+                request.method = requestLine.substr(0, firstSpace);
+                request.target = requestLine.substr(firstSpace + 1, secondSpace - firstSpace - 1);
+
+                std::size_t contentLength = 0;
+                while (lineEnd != std::string::npos) {
+                    std::size_t next = head.find("\r\n", lineEnd + 2);
+                    std::string line = head.substr(lineEnd + 2, next == std::string::npos ? std::string::npos : next - lineEnd - 2);
+                    std::size_t colon = line.find(':');
+                    std::string name = line.substr(0, colon);
+                    std::string value = line.substr(colon + 2);
+                    if (name == "Content-Length") {
+                        contentLength = std::stoul(value);
+                    }
+                    request.headers.emplace_back(name, value);
+                    lineEnd = next;
+                }
+
+                while (buffer.size() < contentLength) {
+                    if (!receive(fd, buffer)) {
+                        return;
+                    }
+                }
+                request.body = buffer.substr(0, contentLength);
+                buffer.erase(0, contentLength);
+
+                {
+                    std::lock_guard lock{mutex_};
+                    requests_.push_back(request);
+                }
+
+                StubResponse response = handler_(request);
+                std::string message = "HTTP/1.1 " + std::to_string(response.status) + " Stub\r\n";
+                for (const auto& [name, value] : response.headers) {
+                    message += name + ": " + value + "\r\n";
+                }
+
+                if (response.status == 204 || response.status == 304) {
+                    message += "\r\n";
+                } else if (response.chunked) {
+                    message += "Transfer-Encoding: chunked\r\n\r\n";
+                    for (std::size_t i = 0; i < response.body.size(); i += 7) {
+                        std::string piece = response.body.substr(i, 7);
+                        char size[16];
+                        std::snprintf(size, sizeof(size), "%zx\r\n", piece.size());
+                        message += size + piece + "\r\n";
+                    }
+                    message += "0\r\n\r\n";
+                } else {
+                    message += "Content-Length: " + std::to_string(response.body.size()) + "\r\n\r\n" + response.body;
+                }
+
+                ::send(fd, message.data(), message.size(), MSG_NOSIGNAL);
+
+                if (response.closeAfter) {
+                    return;
+                }
+            }
+        }
+
+        bool receive(int fd, std::string& buffer) {
+            if (!waitReadable(fd)) {
+                return false;
+            }
+
+            char chunk[4096];
+            ssize_t received = ::recv(fd, chunk, sizeof(chunk), 0);
+            if (received <= 0) {
+                return false;
+            }
+
+            buffer.append(chunk, static_cast<std::size_t>(received));
+            return true;
+        }
+};
+
+#endif  // STUBHTTPSERVER_HPP
@@ -0,0 +1,103 @@
+#include "AllocationCounter.hpp"
+
+/**
+ * @file AllocationCounter.cpp
+ * @brief Replacement global operator new/delete that count allocations per thread.
+ *
+ * The counters are plain thread_locals, so counting needs no synchronization and one thread's
+ * allocations never show up in another thread's scope. Only the throwing and nothrow forms, array
+ * forms and aligned forms of operator new exist, so those are all that need replacing.
+ */
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+    thread_local std::size_t count = 0;
+    thread_local std::size_t bytes = 0;
+
+    void* allocate(std::size_t size) {
+        ++count;
+        bytes += size;
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    void* allocateAligned(std::size_t size, std::align_val_t alignment) {
+        ++count;
+        bytes += size;
+        auto align = static_cast<std::size_t>(alignment);
+        return std::aligned_alloc(align, (size + align - 1) / align * align);
+    }
+}
+
+namespace testsupport {
+    std::size_t allocationCount() {
+        return count;
+    }
+
+    std::size_t allocatedBytes() {
+        return bytes;
+    }
+}
+
+void* operator new(std::size_t size) {
+    if (void* p = allocate(size)) {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    if (void* p = allocateAligned(size, alignment)) {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept {
+    std::free(p);
+}
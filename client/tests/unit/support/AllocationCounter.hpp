@@ -0,0 +1,41 @@
+#ifndef ALLOCATIONCOUNTER_HPP
+#define ALLOCATIONCOUNTER_HPP
+
+/**
+ * @file AllocationCounter.hpp
+ * @brief Test-only counter of global operator new calls, for allocation-bound tests.
+ *
+ * Linking AllocationCounter.cpp into a test replaces the global operator new and delete with
+ * versions that count, per thread, every allocation and the bytes requested. An AllocationScope
+ * reports what the current thread allocated since it was created:
+ *
+ *     AllocationScope scope;
+ *     course.addAssignment(assignment);
+ *     ASSERT_LE(scope.getAllocations(), 12);
+ */
+
+#include <cstddef>
+
+namespace testsupport {
+    std::size_t allocationCount();      // allocations made by this thread so far
+    std::size_t allocatedBytes();       // bytes requested by this thread so far
+
+    class AllocationScope {
+        public:
+            AllocationScope() : allocations_{allocationCount()}, bytes_{allocatedBytes()} {}
+
+            std::size_t getAllocations() const {
+                return allocationCount() - allocations_;
+            }
+
+            std::size_t getBytes() const {
+                return allocatedBytes() - bytes_;
+            }
+
+        private:
+            std::size_t allocations_;
+            std::size_t bytes_;
+    };
+}
+
+#endif  // ALLOCATIONCOUNTER_HPP
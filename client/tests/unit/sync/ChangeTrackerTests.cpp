@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include "sync/ChangeTracker.hpp"
+
+// test fixture for the per-entity dirty state and version counters
+class ChangeTrackerTest : public testing::Test {
+    protected:
+        ChangeTracker tracker{};
+};
+
+
+// ====================================
+// VERSION TESTS
+// ====================================
+
+TEST_F(ChangeTrackerTest, UpsertMarksDirty) {
+    tracker.recordUpsert(EntityKind::term, "t1");
+
+    ASSERT_TRUE(tracker.isDirty("t1"));
+    ASSERT_FALSE(tracker.isOnServer("t1"));
+    ASSERT_EQ(tracker.getVersion("t1"), 1);
+    ASSERT_EQ(tracker.getPendingCount(), 1);
+}
+
+TEST_F(ChangeTrackerTest, RepeatedEditsCoalesce) {
+    tracker.recordUpsert(EntityKind::term, "t1");
+    tracker.recordUpsert(EntityKind::term, "t1");
+    tracker.recordUpsert(EntityKind::term, "t1");
+
+    ASSERT_EQ(tracker.getVersion("t1"), 3);
+    ASSERT_EQ(tracker.getPendingCount(), 1);
+    ASSERT_EQ(tracker.getPendingChanges().size(), 1);
+}
+
+TEST_F(ChangeTrackerTest, MarkSyncedClearsDirty) {
+    tracker.recordUpsert(EntityKind::term, "t1");
+    tracker.markSynced("t1", 1);
+
+    ASSERT_FALSE(tracker.isDirty("t1"));
+    ASSERT_TRUE(tracker.isOnServer("t1"));
+    ASSERT_EQ(tracker.getPendingCount(), 0);
+}
+
+TEST_F(ChangeTrackerTest, StaleMarkSyncedKeepsDirty) {
+    tracker.recordUpsert(EntityKind::term, "t1");
+    tracker.recordUpsert(EntityKind::term, "t1");   // edited again while version 1 was in flight
+    tracker.markSynced("t1", 1);
+
+    ASSERT_TRUE(tracker.isDirty("t1"));
+    ASSERT_TRUE(tracker.isOnServer("t1"));
+    ASSERT_TRUE(tracker.getPendingChanges().at(0).onServer);
+}
+
+TEST_F(ChangeTrackerTest, RemoteIsClean) {
+    tracker.recordRemote(EntityKind::course, "c1", "t1");
+
+    ASSERT_FALSE(tracker.isDirty("c1"));
+    ASSERT_TRUE(tracker.isOnServer("c1"));
+    ASSERT_EQ(tracker.getPendingCount(), 0);
+}
+
+
+// ====================================
+// REMOVAL TESTS
+// ====================================
+
+TEST_F(ChangeTrackerTest, RemovingUnsyncedEntityForgetsIt) {
+    tracker.recordUpsert(EntityKind::assignment, "a1", "c1");
+    tracker.recordRemoval(EntityKind::assignment, "a1", "c1");
+
+    ASSERT_FALSE(tracker.isDirty("a1"));
+    ASSERT_EQ(tracker.getPendingCount(), 0);
+}
+
+TEST_F(ChangeTrackerTest, RemovingSyncedEntityIsPending) {
+    tracker.recordUpsert(EntityKind::assignment, "a1", "c1");
+    tracker.markSynced("a1", 1);
+    tracker.recordRemoval(EntityKind::assignment, "a1", "c1");
+
+    std::vector<EntityChange> changes = tracker.getPendingChanges();
+    ASSERT_EQ(changes.size(), 1);
+    ASSERT_TRUE(changes[0].removed);
+
+    tracker.markSynced("a1", changes[0].version);
+    ASSERT_EQ(tracker.getPendingCount(), 0);
+    ASSERT_FALSE(tracker.isOnServer("a1"));
+}
+
+TEST_F(ChangeTrackerTest, RemovingParentForgetsChildren) {
+    tracker.recordRemote(EntityKind::term, "t1");
+    tracker.recordUpsert(EntityKind::course, "c1", "t1");
+    tracker.recordUpsert(EntityKind::assignment, "a1", "c1");
+    tracker.recordRemoval(EntityKind::term, "t1");
+
+    std::vector<EntityChange> changes = tracker.getPendingChanges();
+    ASSERT_EQ(changes.size(), 1);
+    ASSERT_EQ(changes[0].id, "t1");
+    ASSERT_FALSE(tracker.isDirty("c1"));
+    ASSERT_FALSE(tracker.isDirty("a1"));
+}
+
+TEST_F(ChangeTrackerTest, RemovingParentKeepsOtherChildren) {
+    tracker.recordUpsert(EntityKind::course, "c1", "t1");
+    tracker.recordUpsert(EntityKind::assignment, "a1", "c1");
+    tracker.recordUpsert(EntityKind::assignment, "a2", "c1");
+    tracker.recordUpsert(EntityKind::assignment, "a3", "c2");
+    tracker.recordUpsert(EntityKind::assignment, "a4", "c2");
+    tracker.recordRemoval(EntityKind::assignment, "a1", "c1");
+    tracker.recordUpsert(EntityKind::assignment, "a4", "c1");     // moved under the course about to go
+    tracker.recordRemoval(EntityKind::course, "c1", "t1");
+
+    ASSERT_FALSE(tracker.isDirty("a2"));
+    ASSERT_FALSE(tracker.isDirty("a4"));
+    ASSERT_TRUE(tracker.isDirty("a3"));
+    ASSERT_EQ(tracker.getPendingCount(), 1);
+}
+
+TEST_F(ChangeTrackerTest, RemovingUntrackedEntityAssumesServer) {
+    tracker.recordRemoval(EntityKind::course, "c1", "t1");
+
+    std::vector<EntityChange> changes = tracker.getPendingChanges();
+    ASSERT_EQ(changes.size(), 1);
+    ASSERT_TRUE(changes[0].removed);
+    ASSERT_TRUE(changes[0].onServer);
+}
+
+
+// ====================================
+// ORDERING TESTS
+// ====================================
+
+TEST_F(ChangeTrackerTest, PendingChangesOrderParentsFirst) {
+    tracker.recordUpsert(EntityKind::assignment, "a1", "c1");
+    tracker.recordUpsert(EntityKind::course, "c1", "t1");
+    tracker.recordUpsert(EntityKind::term, "t1");
+    tracker.recordUpsert(EntityKind::course, "c2", "t1");
+
+    std::vector<EntityChange> changes = tracker.getPendingChanges();
+    ASSERT_EQ(changes.size(), 4);
+    ASSERT_EQ(changes[0].id, "t1");
+    ASSERT_EQ(changes[1].id, "c1");
+    ASSERT_EQ(changes[2].id, "c2");
+    ASSERT_EQ(changes[3].id, "a1");
+}
+
+TEST_F(ChangeTrackerTest, RemovalsComeFirst) {
+    tracker.recordRemote(EntityKind::course, "c1", "t1");
+    tracker.recordRemote(EntityKind::assignment, "a1", "c2");
+    tracker.recordUpsert(EntityKind::term, "t2");
+    tracker.recordRemoval(EntityKind::course, "c1", "t1");
+    tracker.recordRemoval(EntityKind::assignment, "a1", "c2");
+
+    std::vector<EntityChange> changes = tracker.getPendingChanges();
+    ASSERT_EQ(changes.size(), 3);
+    ASSERT_EQ(changes[0].id, "a1");
+    ASSERT_EQ(changes[1].id, "c1");
+    ASSERT_EQ(changes[2].id, "t2");
+}
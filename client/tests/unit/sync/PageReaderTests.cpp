@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "sync/PageReader.hpp"
+#include "../net/StubHttpServer.hpp"
+
+// test fixture for PageReader, backed by a stub server that pages through a list of terms by id
+class PageReaderTest : public testing::Test {
+    protected:
+        std::vector<std::string> ids{"t1", "t2", "t3", "t4", "t5"};
+        int status{200};
+        StubHttpServer server{[this](const StubRequest& request) { return handle(request); }};
+        HttpClient client{"127.0.0.1", server.port()};
+
+        static std::string parameter(const std::string& target, const std::string& name) {
+            std::size_t start = target.find(name + "=");
+            if (start == std::string::npos) {
+                return "";
+            }
+            start += name.size() + 1;
+            return target.substr(start, target.find('&', start) - start);
+        }
+
+        StubResponse handle(const StubRequest& request) {
+            if (status != 200) {
+                return StubResponse{status, "{\"detail\":\"Internal Server Error\"}"};
+            }
+
+            std::string after = parameter(request.target, "after");
+            std::size_t limit = std::stoul(parameter(request.target, "limit"));
+            std::string body = "[";
+            std::size_t count = 0;
+            for (const std::string& id : ids) {
+                if (id > after && count < limit) {
+                    body += (count++ == 0 ? "" : ",") + std::string{"{\"id\":\""} + id + "\",\"title\":\"Term " + id
+                        + "\",\"start_date\":\"2025-08-15\",\"end_date\":\"2025-12-17\",\"active\":false}";
+                }
+            }
+            return StubResponse{200, body + "]"};
+        }
+};
+
+
+// ====================================
+// PAGING TESTS
+// ====================================
+
+TEST_F(PageReaderTest, ReadsEveryRecordPageByPage) {
+    PageReader reader{client, "/terms/", EntityKind::term, 2};
+    io::EntityBatch page;
+    std::vector<std::size_t> sizes;
+    std::string last;
+
+    while (reader.next(page)) {
+        sizes.push_back(page.terms.size());
+        last = page.terms.back().getId();
+    }
+
+    ASSERT_EQ(sizes, (std::vector<std::size_t>{2, 2, 1}));
+    ASSERT_EQ(last, "t5");
+    ASSERT_EQ(reader.getRequestCount(), 3);
+    ASSERT_EQ(server.requests().at(0).target, "/terms/?limit=2");
+    ASSERT_EQ(server.requests().at(1).target, "/terms/?limit=2&after=t2");
+    ASSERT_EQ(client.getConnectionCount(), 1);
+}
+
+TEST_F(PageReaderTest, FullLastPageTakesOneMoreRequest) {
+    ids.pop_back();
+    PageReader reader{client, "/terms/", EntityKind::term, 2};
+    io::EntityBatch page;
+
+    ASSERT_TRUE(reader.next(page));
+    ASSERT_TRUE(reader.next(page));
+    ASSERT_FALSE(reader.next(page));
+    ASSERT_TRUE(page.terms.empty());
+    ASSERT_FALSE(reader.next(page));
+    ASSERT_EQ(reader.getRequestCount(), 3);
+}
+
+
+// ====================================
+// EDGE CASES
+// ====================================
+
+TEST_F(PageReaderTest, ExistingQueryAndIdsAreEncoded) {
+    ids = {"a b"};
+    PageReader reader{client, "/terms/?format=json", EntityKind::term, 1};
+    io::EntityBatch page;
+
+    reader.next(page);
+    reader.next(page);
+
+    ASSERT_EQ(server.requests().at(0).target, "/terms/?format=json&limit=1");
+    ASSERT_EQ(server.requests().at(1).target, "/terms/?format=json&limit=1&after=a%20b");
+}
+
+TEST_F(PageReaderTest, ErrorStatusThrows) {
+    status = 500;
+    PageReader reader{client, "/terms/", EntityKind::term};
+    io::EntityBatch page;
+
+    ASSERT_THROW(reader.next(page), std::runtime_error);
+    ASSERT_THROW((PageReader{client, "/terms/", EntityKind::term, 0}), std::invalid_argument);
+    ASSERT_THROW((PageReader{client, "/terms/", EntityKind::term, 1001}), std::invalid_argument);
+}
@@ -0,0 +1,499 @@
+#include <gtest/gtest.h>
+#include <functional>
+#include <map>
+#include <string>
+#include "sync/SyncEngine.hpp"
+#include "controller/TermController.hpp"
+#include "../net/StubHttpServer.hpp"
+
+using namespace std::chrono_literals;
+
+namespace {
+    // pulls the "id" value out of a record body; good enough for the bodies the engine sends
+    std::string idOf(const std::string& body) {
+        std::size_t start = body.find("\"id\":\"") + 6;
+        return body.substr(start, body.find('"', start) - start);
+    }
+}
+
+// test fixture for the sync engine, backed by a stub server that mimics the FastAPI routes
+class SyncEngineTest : public testing::Test {
+    protected:
+        std::map<std::string, std::string> rows{};     // "/collection/id" -> stored body
+        std::function<StubResponse(const StubRequest&)> intercept{};     // answers instead of the fake routes when it returns a status
+        StubHttpServer server{[this](const StubRequest& request) { return handle(request); }};
+        HttpClient client{"127.0.0.1", server.port()};
+        TermController controller{};
+        SyncEngine engine{controller, client};
+
+        std::string termId{};
+        std::string courseId{};
+        std::string assignmentId{};
+
+        StubResponse handle(const StubRequest& request) {
+            if (intercept) {
+                StubResponse response = intercept(request);
+                if (response.status != 0) {
+                    return response;
+                }
+            }
+
+            std::size_t slash = request.target.find('/', 1);
+            std::string collection = request.target.substr(0, slash);
+
+            if (request.method == "POST") {
+                std::string key = collection + "/" + idOf(request.body);
+                if (rows.contains(key)) {
+                    return StubResponse{409, "{\"detail\":\"already exists\"}"};
+                }
+                rows[key] = request.body;
+                return StubResponse{201, request.body};
+            }
+
+            if (!rows.contains(request.target)) {
+                return StubResponse{404, "{\"detail\":\"not found\"}"};
+            }
+
+            if (request.method == "PUT") {
+                rows[request.target] = request.body;
+                return StubResponse{200, request.body};
+            }
+
+            rows.erase(request.target);
+            return StubResponse{204};
+        }
+
+        // builds a term with one course and one assignment and pushes it
+        void seedAndPush() {
+            controller.addTerm("Spring 2026", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/24}, true);
+            controller.selectTerm("Spring 2026");
+            CourseController& courseController = controller.getCourseController();
+            courseController.addCourse("CMPE 142", "", std::chrono::year_month_day{2026y/1/2},
+                std::chrono::year_month_day{2026y/5/12}, 3, true);
+            courseController.selectCourse("CMPE 142");
+            courseController.getAssignmentController().addAssignment("Homework 1", "", "Homework",
+                std::chrono::year_month_day{2026y/1/20}, false, 0.0f);
+
+            termId = controller.getTermId("Spring 2026");
+            courseId = courseController.getCourseId("CMPE 142");
+            assignmentId = courseController.getAssignmentController().getAssignmentId("Homework 1");
+
+            SyncReport report = engine.push();
+            ASSERT_TRUE(report.errors.empty());
+            ASSERT_EQ(report.requestCount, 3);
+            server.clearRequests();
+        }
+};
+
+
+// ====================================
+// PUSH TESTS
+// ====================================
+
+TEST_F(SyncEngineTest, NewEntitiesArePostedParentsFirst) {
+    seedAndPush();
+
+    ASSERT_TRUE(rows.contains("/terms/" + termId));
+    ASSERT_TRUE(rows.contains("/courses/" + courseId));
+    ASSERT_TRUE(rows.contains("/assignments/" + assignmentId));
+    ASSERT_EQ(controller.getChangeTracker().getPendingCount(), 0);
+}
+
+TEST_F(SyncEngineTest, NothingPendingSendsNothing) {
+    seedAndPush();
+    SyncReport report = engine.push();
+
+    ASSERT_EQ(report.requestCount, 0);
+    ASSERT_TRUE(server.requests().empty());
+}
+
+TEST_F(SyncEngineTest, GradeEditCostsOneRequest) {
+    seedAndPush();
+    controller.getCourseController().getAssignmentController().addGrade("Homework 1", 95.5f);
+
+    SyncReport report = engine.push();
+    std::vector<StubRequest> requests = server.requests();
+
+    ASSERT_EQ(report.requestCount, 1);
+    ASSERT_EQ(requests.size(), 1);
+    ASSERT_EQ(requests[0].method, "PUT");
+    ASSERT_EQ(requests[0].target, "/assignments/" + assignmentId);
+    ASSERT_NE(requests[0].body.find("\"grade\":95.5"), std::string::npos);
+    ASSERT_NE(requests[0].body.find("\"completed\":true"), std::string::npos);
+    ASSERT_EQ(client.getConnectionCount(), 1);
+}
+
+TEST_F(SyncEngineTest, RepeatedEditsSendOneUpdate) {
+    seedAndPush();
+    controller.editActive(termId, false);
+    controller.editTitle(termId, "Spring 2026 (done)");
+
+    SyncReport report = engine.push();
+
+    ASSERT_EQ(report.requestCount, 1);
+    ASSERT_NE(rows.at("/terms/" + termId).find("Spring 2026 (done)"), std::string::npos);
+    ASSERT_NE(rows.at("/terms/" + termId).find("\"active\":false"), std::string::npos);
+}
+
+TEST_F(SyncEngineTest, CreatedThenRemovedSendsNothing) {
+    seedAndPush();
+    AssignmentController& assignmentController = controller.getCourseController().getAssignmentController();
+    assignmentController.addAssignment("Scratch", "", "Homework", std::chrono::year_month_day{2026y/2/1}, false, 0.0f);
+    assignmentController.removeAssignment("Scratch");
+
+    SyncReport report = engine.push();
+
+    ASSERT_EQ(report.requestCount, 0);
+}
+
+TEST_F(SyncEngineTest, RemovingTermSendsOneDelete) {
+    seedAndPush();
+    controller.getCourseController().getAssignmentController().addGrade("Homework 1", 80.0f);
+    controller.removeTerm("Spring 2026");
+
+    SyncReport report = engine.push();
+    std::vector<StubRequest> requests = server.requests();
+
+    ASSERT_EQ(report.requestCount, 1);
+    ASSERT_EQ(requests[0].method, "DELETE");
+    ASSERT_EQ(requests[0].target, "/terms/" + termId);
+}
+
+
+// ====================================
+// RECONCILE TESTS
+// ====================================
+
+TEST_F(SyncEngineTest, ServerCopyIsAppliedById) {
+    seedAndPush();
+
+    // the server stores a normalized title and answers with it
+    intercept = [](const StubRequest& request) {
+        StubResponse response{0};
+        if (request.method == "PUT" && request.target.starts_with("/assignments/")) {
+            std::string body = request.body;
+            body.replace(body.find("Homework 1"), 10, "HOMEWORK 1");
+            response = StubResponse{200, body};
+        }
+        return response;
+    };
+    controller.getCourseController().getAssignmentController().addGrade("Homework 1", 90.0f);
+
+    SyncReport report = engine.push();
+    AssignmentController& assignmentController = controller.getCourseController().getAssignmentController();
+
+    ASSERT_TRUE(report.errors.empty());
+    ASSERT_EQ(assignmentController.findAssignment("HOMEWORK 1").getTitle(), "HOMEWORK 1");
+    ASSERT_EQ(assignmentController.getAssignmentId("HOMEWORK 1"), assignmentId);
+    ASSERT_FLOAT_EQ(assignmentController.findAssignment("HOMEWORK 1").getGrade(), 90.0f);
+    ASSERT_FALSE(controller.getChangeTracker().isDirty(assignmentId));
+}
+
+TEST_F(SyncEngineTest, LostCreateResponseFallsBackToUpdate) {
+    controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
+    std::string id = controller.getTermId("Fall 2025");
+    rows["/terms/" + id] = "{}";   // the row made it to the server, but the client never saw the 201
+
+    SyncReport report = engine.push();
+
+    ASSERT_TRUE(report.errors.empty());
+    ASSERT_EQ(report.requestCount, 2);
+    ASSERT_EQ(server.requests().at(1).method, "PUT");
+    ASSERT_FALSE(controller.getChangeTracker().isDirty(id));
+}
+
+
+// ====================================
+// PULL TESTS
+// ====================================
+
+TEST_F(SyncEngineTest, PullTermHydratesInOneRequest) {
+    intercept = [](const StubRequest& request) {
+        StubResponse response{0};
+        if (request.method == "GET" && request.target == "/terms/t1/tree") {
+            response = StubResponse{200, "{\"id\":\"t1\",\"title\":\"Fall 2025\",\"start_date\":\"2025-08-15\","
+                "\"end_date\":\"2025-12-17\",\"active\":false,\"courses\":["
+                "{\"id\":\"c1\",\"term_id\":\"t1\",\"title\":\"CMPE 142\",\"description\":null,\"start_date\":\"2025-08-20\","
+                "\"end_date\":\"2025-12-10\",\"num_credits\":3,\"active\":false,\"assignments\":["
+                "{\"id\":\"a1\",\"course_id\":\"c1\",\"title\":\"Homework 1\",\"description\":null,\"category\":\"Homework\","
+                "\"due_date\":\"2025-09-01\",\"completed\":true,\"grade\":90.0},"
+                "{\"id\":\"a2\",\"course_id\":\"c1\",\"title\":\"Homework 2\",\"description\":null,\"category\":\"Homework\","
+                "\"due_date\":\"2025-09-08\",\"completed\":true,\"grade\":80.0}]},"
+                "{\"id\":\"c2\",\"term_id\":\"t1\",\"title\":\"CMPE 148\",\"description\":null,\"start_date\":\"2025-08-20\","
+                "\"end_date\":\"2025-12-10\",\"num_credits\":3,\"active\":false,\"assignments\":[]}]}"};
+        }
+        return response;
+    };
+
+    SyncReport report = engine.pullTerm("t1");
+    const Term& term = controller.getTermList().at("t1");
+
+    ASSERT_TRUE(report.errors.empty());
+    ASSERT_EQ(report.requestCount, 1);
+    ASSERT_EQ(server.requests().size(), 1);
+    ASSERT_EQ(report.syncedCount, 5);
+    ASSERT_EQ(term.getCourseList().size(), 2);
+    ASSERT_EQ(term.findCourse("c1").getAssignmentList().size(), 2);
+    ASSERT_FLOAT_EQ(term.findCourse("c1").getGradePct(), 85.0f);
+    ASSERT_EQ(controller.getChangeTracker().getPendingCount(), 0);
+}
+
+TEST_F(SyncEngineTest, PullKeepsUnpushedEdits) {
+    seedAndPush();
+    controller.getCourseController().getAssignmentController().addGrade("Homework 1", 95.5f);
+
+    intercept = [this](const StubRequest& request) {
+        StubResponse response{0};
+        if (request.method == "GET") {
+            response = StubResponse{200, "{\"id\":\"" + termId + "\",\"title\":\"Spring 2026\",\"start_date\":\"2026-01-02\","
+                "\"end_date\":\"2026-05-24\",\"courses\":[{\"id\":\"" + courseId + "\",\"title\":\"CMPE 142L\","
+                "\"start_date\":\"2026-01-02\",\"end_date\":\"2026-05-12\",\"assignments\":[{\"id\":\"" + assignmentId + "\","
+                "\"title\":\"Homework 1\",\"category\":\"Homework\",\"due_date\":\"2026-01-20\",\"grade\":50.0}]}]}"};
+        }
+        return response;
+    };
+
+    SyncReport report = engine.pullTerm(termId);
+    const Course& course = controller.getTermList().at(termId).findCourse(courseId);
+
+    ASSERT_TRUE(report.errors.empty());
+    ASSERT_EQ(report.syncedCount, 2);
+    ASSERT_EQ(course.getTitle(), "CMPE 142L");
+    ASSERT_FLOAT_EQ(course.findAssignment(assignmentId).getGrade(), 95.5f);
+    ASSERT_TRUE(controller.getChangeTracker().isDirty(assignmentId));
+}
+
+TEST_F(SyncEngineTest, PullUnchangedTermCostsNotModified) {
+    intercept = [](const StubRequest& request) {
+        StubResponse response{0};
+        if (request.method == "GET") {
+            for (const auto& [name, value] : request.headers) {
+                if (name == "If-None-Match" && value == "\"v1\"") {
+                    return StubResponse{304, "", {{"ETag", "\"v1\""}}};
+                }
+            }
+            response = StubResponse{200, "{\"id\":\"t1\",\"title\":\"Fall 2025\",\"start_date\":\"2025-08-15\","
+                "\"end_date\":\"2025-12-17\",\"courses\":[]}", {{"ETag", "\"v1\""}}};
+        }
+        return response;
+    };
+
+    SyncReport first = engine.pullTerm("t1");
+    SyncReport second = engine.pullTerm("t1");
+
+    ASSERT_EQ(first.syncedCount, 1);
+    ASSERT_EQ(second.requestCount, 1);
+    ASSERT_EQ(second.unchangedCount, 1);
+    ASSERT_EQ(second.syncedCount, 0);
+    ASSERT_TRUE(second.errors.empty());
+    ASSERT_EQ(server.requests().size(), 2);
+    ASSERT_EQ(controller.getTermList().at("t1").getTitle(), "Fall 2025");
+}
+
+TEST_F(SyncEngineTest, PullThatFailedToApplyIsFetchedAgain) {
+    seedAndPush();
+    CourseController& courseController = controller.getCourseController();
+    courseController.addCourse("CMPE 148", "", std::chrono::year_month_day{2026y/1/2},
+        std::chrono::year_month_day{2026y/5/12}, 3, true);     // clashes with the server's course of the same title
+
+    intercept = [this](const StubRequest& request) {
+        StubResponse response{0};
+        if (request.method == "GET") {
+            for (const auto& [name, value] : request.headers) {
+                if (name == "If-None-Match" && value == "\"v1\"") {
+                    return StubResponse{304, "", {{"ETag", "\"v1\""}}};
+                }
+            }
+            response = StubResponse{200, "{\"id\":\"" + termId + "\",\"title\":\"Spring 2026\",\"start_date\":\"2026-01-02\","
+                "\"end_date\":\"2026-05-24\",\"courses\":[{\"id\":\"c2\",\"title\":\"CMPE 148\","
+                "\"start_date\":\"2026-01-02\",\"end_date\":\"2026-05-12\",\"assignments\":[]}]}", {{"ETag", "\"v1\""}}};
+        }
+        return response;
+    };
+
+    SyncReport first = engine.pullTerm(termId);
+    courseController.editTitle(courseController.getCourseId("CMPE 148"), "CMPE 148L");
+    SyncReport second = engine.pullTerm(termId);
+
+    ASSERT_EQ(first.errors.size(), 1);
+    ASSERT_EQ(second.unchangedCount, 0);
+    ASSERT_TRUE(second.errors.empty());
+    ASSERT_TRUE(controller.getTermList().at(termId).getCourseList().contains("c2"));
+}
+
+TEST_F(SyncEngineTest, PullRemovesCourseDeletedOnServer) {
+    seedAndPush();
+    CourseController& courseController = controller.getCourseController();
+    courseController.addCourse("CMPE 148", "", std::chrono::year_month_day{2026y/1/2},
+        std::chrono::year_month_day{2026y/5/12}, 3, true);
+    std::string deletedId = courseController.getCourseId("CMPE 148");
+    ASSERT_TRUE(engine.push().errors.empty());
+    courseController.addCourse("CMPE 180", "", std::chrono::year_month_day{2026y/1/2},
+        std::chrono::year_month_day{2026y/5/12}, 3, true);     // not pushed yet, so kept
+
+    // another client deleted CMPE 148
+    intercept = [this](const StubRequest& request) {
+        StubResponse response{0};
+        if (request.method == "GET") {
+            response = StubResponse{200, "{\"id\":\"" + termId + "\",\"title\":\"Spring 2026\",\"start_date\":\"2026-01-02\","
+                "\"end_date\":\"2026-05-24\",\"courses\":[{\"id\":\"" + courseId + "\",\"title\":\"CMPE 142\","
+                "\"start_date\":\"2026-01-02\",\"end_date\":\"2026-05-12\",\"assignments\":[{\"id\":\"" + assignmentId + "\","
+                "\"title\":\"Homework 1\",\"category\":\"Homework\",\"due_date\":\"2026-01-20\"}]}]}"};
+        }
+        return response;
+    };
+
+    SyncReport report = engine.pullTerm(termId);
+    const Term& term = controller.getTermList().at(termId);
+
+    ASSERT_TRUE(report.errors.empty());
+    ASSERT_EQ(report.removedCount, 1);
+    ASSERT_FALSE(term.getCourseList().contains(deletedId));
+    ASSERT_EQ(term.getCourseList().size(), 2);
+    ASSERT_THROW(courseController.getCourseId("CMPE 148"), std::out_of_range);
+    ASSERT_FALSE(controller.getChangeTracker().isOnServer(deletedId));
+    ASSERT_EQ(controller.getChangeTracker().getPendingCount(), 1);
+    ASSERT_TRUE(controller.search("CMPE 148").empty());
+}
+
+TEST_F(SyncEngineTest, PullRemovesAssignmentDeletedOnServer) {
+    seedAndPush();
+
+    intercept = [this](const StubRequest& request) {
+        StubResponse response{0};
+        if (request.method == "GET") {
+            response = StubResponse{200, "{\"id\":\"" + termId + "\",\"title\":\"Spring 2026\",\"start_date\":\"2026-01-02\","
+                "\"end_date\":\"2026-05-24\",\"courses\":[{\"id\":\"" + courseId + "\",\"title\":\"CMPE 142\","
+                "\"start_date\":\"2026-01-02\",\"end_date\":\"2026-05-12\",\"assignments\":[]}]}"};
+        }
+        return response;
+    };
+
+    SyncReport report = engine.pullTerm(termId);
+
+    ASSERT_TRUE(report.errors.empty());
+    ASSERT_EQ(report.removedCount, 1);
+    ASSERT_TRUE(controller.getTermList().at(termId).findCourse(courseId).getAssignmentList().empty());
+    ASSERT_THROW(controller.getCourseController().getAssignmentController().getAssignmentId("Homework 1"),
+        std::out_of_range);
+}
+
+TEST_F(SyncEngineTest, PullRemovesTermDeletedOnServer) {
+    seedAndPush();
+
+    SyncReport report = engine.pullTerm(termId);
+
+    ASSERT_TRUE(report.errors.empty());
+    ASSERT_EQ(report.removedCount, 1);
+    ASSERT_TRUE(controller.getTermList().empty());
+    ASSERT_EQ(controller.getChangeTracker().getPendingCount(), 0);
+    ASSERT_FALSE(controller.getChangeTracker().isOnServer(courseId));
+}
+
+TEST_F(SyncEngineTest, PullMissingTermReportsError) {
+    SyncReport report = engine.pullTerm("missing");
+
+    ASSERT_EQ(report.requestCount, 1);
+    ASSERT_EQ(report.errors.size(), 1);
+    ASSERT_TRUE(controller.getTermList().empty());
+}
+
+
+TEST_F(SyncEngineTest, PullAllReadsTermListPageByPage) {
+    intercept = [](const StubRequest& request) {
+        StubResponse response{0};
+        if (request.method != "GET") {
+            return response;
+        }
+        auto term = [](const std::string& id) {
+            return "{\"id\":\"" + id + "\",\"title\":\"Term " + id + "\",\"start_date\":\"2025-08-15\","
+                "\"end_date\":\"2025-12-17\",\"active\":false}";
+        };
+        if (request.target == "/terms/?limit=2") {
+            response = StubResponse{200, "[" + term("t1") + "," + term("t2") + "]"};
+        } else if (request.target == "/terms/?limit=2&after=t2") {
+            response = StubResponse{200, "[" + term("t3") + "]"};
+        } else if (request.target.ends_with("/tree")) {
+            std::string id = request.target.substr(7, 2);
+            std::string body = term(id);
+            response = StubResponse{200, body.substr(0, body.size() - 1) + ",\"courses\":[]}"};
+        }
+        return response;
+    };
+
+    SyncReport report = engine.pullAll(2);
+
+    ASSERT_TRUE(report.errors.empty());
+    ASSERT_EQ(report.requestCount, 5);     // two pages and three trees
+    ASSERT_EQ(report.syncedCount, 3);
+    ASSERT_EQ(controller.getTermList().size(), 3);
+    ASSERT_EQ(controller.getChangeTracker().getPendingCount(), 0);
+}
+
+TEST_F(SyncEngineTest, PullAllRemovesTermsTheListNoLongerHolds) {
+    seedAndPush();
+    controller.addTerm("Fall 2026", std::chrono::year_month_day{2026y/8/15}, std::chrono::year_month_day{2026y/12/17}, false);
+
+    intercept = [](const StubRequest& request) {
+        StubResponse response{0};
+        if (request.method == "GET") {
+            response = StubResponse{200, "[]"};
+        }
+        return response;
+    };
+
+    SyncReport report = engine.pullAll();
+
+    ASSERT_TRUE(report.errors.empty());
+    ASSERT_EQ(report.requestCount, 1);
+    ASSERT_EQ(report.removedCount, 1);
+    ASSERT_FALSE(controller.getTermList().contains(termId));
+    ASSERT_EQ(controller.getTermList().size(), 1);     // Fall 2026 has not been pushed, so it stays
+}
+
+// ====================================
+// FAILURE TESTS
+// ====================================
+
+TEST_F(SyncEngineTest, RejectedParentSkipsChildren) {
+    intercept = [](const StubRequest& request) {
+        StubResponse response{0};
+        if (request.target == "/courses/") {
+            response = StubResponse{400, "{\"detail\":\"Invalid term_id\"}"};
+        }
+        return response;
+    };
+
+    controller.addTerm("Spring 2026", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/24}, true);
+    controller.selectTerm("Spring 2026");
+    controller.getCourseController().addCourse("CMPE 142", "", std::chrono::year_month_day{2026y/1/2},
+        std::chrono::year_month_day{2026y/5/12}, 3, true);
+    controller.getCourseController().selectCourse("CMPE 142");
+    controller.getCourseController().getAssignmentController().addAssignment("Homework 1", "", "Homework",
+        std::chrono::year_month_day{2026y/1/20}, false, 0.0f);
+
+    SyncReport report = engine.push();
+
+    ASSERT_EQ(report.requestCount, 2);
+    ASSERT_EQ(report.syncedCount, 1);
+    ASSERT_EQ(report.errors.size(), 2);
+    ASSERT_EQ(controller.getChangeTracker().getPendingCount(), 2);
+}
+
+TEST_F(SyncEngineTest, UnreachableServerKeepsChangesPending) {
+    std::uint16_t closedPort = 0;
+    {
+        StubHttpServer temporary{[](const StubRequest&) { return StubResponse{}; }};
+        closedPort = temporary.port();
+    }
+
+    HttpClient unreachable{"127.0.0.1", closedPort};
+    SyncEngine offline{controller, unreachable};
+    controller.addTerm("Fall 2025", std::chrono::year_month_day{2025y/8/15}, std::chrono::year_month_day{2025y/12/17}, false);
+
+    SyncReport report = offline.push();
+
+    ASSERT_EQ(report.syncedCount, 0);
+    ASSERT_EQ(report.errors.size(), 1);
+    ASSERT_EQ(controller.getChangeTracker().getPendingCount(), 1);
+}
@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+#include <regex>
+#include <sstream>      // diverts output from terminal to separate stream
+#include <unordered_set>
+#include "synth/HistoryGenerator.hpp"
+#include "io/TermTreeJson.hpp"
+
+// test fixture for the synthetic history generator
+class HistoryGeneratorTest : public testing::Test {
+    protected:
+        synth::HistoryConfig config{42, 4, 6, 12, 2022};
+
+        std::string json(const synth::HistoryConfig& c) {
+            std::ostringstream os;
+            synth::HistoryGenerator{c}.writeJson(os);
+            return os.str();
+        }
+
+        std::string sql(const synth::HistoryConfig& c) {
+            std::ostringstream os;
+            synth::HistoryGenerator{c}.writeSql(os);
+            return os.str();
+        }
+
+        static std::size_t count(const std::string& text, const std::string& needle) {
+            std::size_t n = 0;
+            for (std::size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + 1)) {
+                ++n;
+            }
+            return n;
+        }
+};
+
+
+// ====================================
+// REPRODUCIBILITY TESTS
+// ====================================
+
+TEST_F(HistoryGeneratorTest, SameSeedSameOutput) {
+    ASSERT_EQ(json(config), json(config));
+    ASSERT_EQ(sql(config), sql(config));
+}
+
+TEST_F(HistoryGeneratorTest, DifferentSeedDifferentOutput) {
+    synth::HistoryConfig other = config;
+    other.seed = 43;
+    ASSERT_NE(json(config), json(other));
+}
+
+TEST_F(HistoryGeneratorTest, TermsDoNotDependOnLaterCounts) {
+    synth::HistoryConfig larger = config;
+    larger.coursesPerTerm = 20;
+    larger.assignmentsPerCourse = 30;
+
+    synth::HistoryGenerator small{config};
+    synth::HistoryGenerator large{larger};
+    Term a = small.buildTerm(1);
+    Term b = large.buildTerm(1);
+    ASSERT_EQ(a.getId(), b.getId());
+    for (const auto& [id, course] : a.getCourseList()) {
+        ASSERT_EQ(b.findCourse(id).getTitle(), course.getTitle());
+    }
+}
+
+
+// ====================================
+// SHAPE TESTS
+// ====================================
+
+TEST_F(HistoryGeneratorTest, BuildTermHasConfiguredCounts) {
+    synth::HistoryGenerator generator{config};
+    Term term = generator.buildTerm(0);
+
+    ASSERT_EQ(term.getId(), generator.makeTerm(0).getId());
+    ASSERT_TRUE(std::regex_match(term.getId(),
+        std::regex{"[0-9a-f]{8}-[0-9a-f]{4}-4[0-9a-f]{3}-[89ab][0-9a-f]{3}-[0-9a-f]{12}"}));
+    ASSERT_EQ(term.getTitle(), "Fall 2022");
+    ASSERT_EQ(term.getCourseList().size(), 6);
+    for (const auto& [id, course] : term.getCourseList()) {
+        ASSERT_EQ(course.getAssignmentList().size(), 12);
+    }
+    ASSERT_EQ(generator.getAssignmentCount(), 4 * 6 * 12);
+}
+
+TEST_F(HistoryGeneratorTest, TermsCycleThroughSeasons) {
+    synth::HistoryGenerator generator{config};
+
+    ASSERT_EQ(generator.makeTerm(0).getTitle(), "Fall 2022");
+    ASSERT_EQ(generator.makeTerm(1).getTitle(), "Spring 2023");
+    ASSERT_EQ(generator.makeTerm(2).getTitle(), "Summer 2023");
+    ASSERT_EQ(generator.makeTerm(3).getTitle(), "Fall 2023");
+    ASSERT_FALSE(generator.makeTerm(2).getActive());
+    ASSERT_TRUE(generator.makeTerm(3).getActive());
+}
+
+TEST_F(HistoryGeneratorTest, AssignmentsFallWithinTerm) {
+    synth::HistoryGenerator generator{config};
+
+    for (std::size_t t = 0; t < config.terms; ++t) {
+        Term term = generator.buildTerm(t);
+        for (const auto& [courseId, course] : term.getCourseList()) {
+            std::size_t finals = 0;
+            for (const auto& [id, assignment] : course.getAssignmentList()) {
+                ASSERT_GE(std::chrono::sys_days{assignment.getDueDate()}, std::chrono::sys_days{term.getStartDate()});
+                ASSERT_LE(std::chrono::sys_days{assignment.getDueDate()}, std::chrono::sys_days{term.getEndDate()});
+                ASSERT_GE(assignment.getGrade(), 0.0f);
+                ASSERT_LE(assignment.getGrade(), 100.0f);
+                finals += assignment.getCategory() == "Final Exam";
+            }
+            ASSERT_EQ(finals, 1);
+        }
+    }
+}
+
+TEST_F(HistoryGeneratorTest, ActiveTermIsPartlyCompleted) {
+    synth::HistoryGenerator generator{config};
+    Term past = generator.buildTerm(0);
+    Term active = generator.buildTerm(3);
+
+    auto completedShare = [](const Term& term) {
+        std::size_t completed = 0;
+        std::size_t total = 0;
+        for (const auto& [courseId, course] : term.getCourseList()) {
+            for (const auto& [id, assignment] : course.getAssignmentList()) {
+                completed += assignment.getCompleted();
+                ++total;
+            }
+        }
+        return static_cast<double>(completed) / static_cast<double>(total);
+    };
+
+    ASSERT_GT(completedShare(past), 0.9);
+    ASSERT_GT(completedShare(active), 0.2);
+    ASSERT_LT(completedShare(active), 0.7);
+    ASSERT_GT(past.getOvrGpa(), 0.0f);
+}
+
+TEST_F(HistoryGeneratorTest, CourseTitlesUniqueWithinLargeTerm) {
+    synth::HistoryConfig large = config;
+    large.coursesPerTerm = 2000;
+    large.assignmentsPerCourse = 0;
+    Term term = synth::HistoryGenerator{large}.buildTerm(0);
+
+    std::unordered_set<std::string> titles;
+    for (const auto& [id, course] : term.getCourseList()) {
+        titles.insert(course.getTitle());
+    }
+    ASSERT_EQ(titles.size(), 2000);
+}
+
+TEST_F(HistoryGeneratorTest, RejectsYearsPastFourDigits) {
+    synth::HistoryConfig late = config;
+    late.firstYear = 9998;
+    late.terms = 9;
+    ASSERT_THROW(synth::HistoryGenerator{late}, std::invalid_argument);
+}
+
+
+// ====================================
+// OUTPUT TESTS
+// ====================================
+
+TEST_F(HistoryGeneratorTest, FillAddsEveryTerm) {
+    synth::HistoryGenerator generator{config};
+    TermController controller;
+    generator.fill(controller);
+
+    ASSERT_EQ(controller.getTermList().size(), 4);
+    const Term& term = controller.findTerm("Spring 2023");
+    ASSERT_EQ(term.getId(), generator.makeTerm(1).getId());
+    ASSERT_EQ(term.getCourseList().size(), 6);
+}
+
+TEST_F(HistoryGeneratorTest, JsonImportsAsBuiltTerms) {
+    synth::HistoryGenerator generator{config};
+    std::istringstream is{json(config)};
+    TermController controller;
+    io::importTermTree(is, controller);
+
+    ASSERT_EQ(controller.getTermList().size(), 4);
+    for (std::size_t t = 0; t < config.terms; ++t) {
+        Term built = generator.buildTerm(t);
+        const Term& imported = controller.findTerm(built.getTitle());
+        ASSERT_EQ(imported.getId(), built.getId());
+        ASSERT_EQ(imported.getCourseList().size(), built.getCourseList().size());
+        ASSERT_FLOAT_EQ(imported.getOvrGpa(), built.getOvrGpa());
+        for (const auto& [id, course] : built.getCourseList()) {
+            ASSERT_FLOAT_EQ(imported.findCourse(id).getGradePct(), course.getGradePct());
+        }
+    }
+}
+
+TEST_F(HistoryGeneratorTest, SqlBatchesRowsPerTable) {
+    synth::HistoryConfig large = config;
+    large.coursesPerTerm = 30;
+    large.assignmentsPerCourse = 10;
+    std::string text = sql(large);
+
+    ASSERT_EQ(count(text, "INSERT INTO terms "), 1);
+    ASSERT_EQ(count(text, "INSERT INTO courses "), 1);
+    ASSERT_EQ(count(text, "INSERT INTO assignments "), 2);   // 1200 rows at 1000 per statement
+    ASSERT_LT(text.find("INSERT INTO terms "), text.find("INSERT INTO courses "));
+    ASSERT_LT(text.find("INSERT INTO courses "), text.find("INSERT INTO assignments "));
+}
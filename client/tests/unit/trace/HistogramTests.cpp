@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include "trace/Histogram.hpp"
+
+using trace::Histogram;
+
+// test fixture for the log-linear latency histogram
+class HistogramTest : public testing::Test {
+    protected:
+        Histogram histogram{};
+};
+
+
+// ====================================
+// BUCKET TESTS
+// ====================================
+
+TEST_F(HistogramTest, SmallValuesAreExact) {
+    for (std::uint64_t value = 0; value < Histogram::subBuckets; ++value) {
+        ASSERT_EQ(Histogram::bucketIndex(value), value);
+        ASSERT_EQ(Histogram::bucketUpperBound(value), value);
+    }
+}
+
+TEST_F(HistogramTest, BucketsAreContiguous) {
+    std::uint64_t previous = Histogram::bucketUpperBound(Histogram::subBuckets - 1);
+    for (std::size_t i = Histogram::subBuckets; i < Histogram::bucketCount; ++i) {
+        ASSERT_EQ(Histogram::bucketIndex(previous + 1), i);
+        std::uint64_t upper = Histogram::bucketUpperBound(i);
+        ASSERT_EQ(Histogram::bucketIndex(upper), i);
+        previous = upper;
+    }
+    ASSERT_EQ(previous, UINT64_MAX);
+}
+
+TEST_F(HistogramTest, RelativeErrorIsBounded) {
+    for (std::uint64_t value = 1; value < (std::uint64_t{1} << 40); value = value * 3 + 1) {
+        std::uint64_t upper = Histogram::bucketUpperBound(Histogram::bucketIndex(value));
+        ASSERT_GE(upper, value);
+        ASSERT_LE(static_cast<double>(upper - value) / static_cast<double>(value), 1.0 / Histogram::subBuckets);
+    }
+}
+
+
+// ====================================
+// STATISTICS TESTS
+// ====================================
+
+TEST_F(HistogramTest, EmptyHistogram) {
+    ASSERT_EQ(histogram.getCount(), 0);
+    ASSERT_EQ(histogram.getMin(), 0);
+    ASSERT_EQ(histogram.getMax(), 0);
+    ASSERT_EQ(histogram.getPercentile(50), 0);
+}
+
+TEST_F(HistogramTest, PercentilesOfUniformValues) {
+    for (std::uint64_t value = 1; value <= 1000; ++value) {
+        histogram.record(value * 1000);
+    }
+
+    ASSERT_EQ(histogram.getCount(), 1000);
+    ASSERT_EQ(histogram.getTotal(), 500500000);
+    ASSERT_EQ(histogram.getMin(), 1000);
+    ASSERT_EQ(histogram.getMax(), 1000000);
+    ASSERT_NEAR(static_cast<double>(histogram.getPercentile(50)), 500000.0, 500000.0 / Histogram::subBuckets);
+    ASSERT_NEAR(static_cast<double>(histogram.getPercentile(99)), 990000.0, 990000.0 / Histogram::subBuckets);
+    ASSERT_EQ(histogram.getPercentile(100), 1000000);
+}
+
+TEST_F(HistogramTest, MergeAddsCounts) {
+    Histogram other;
+    histogram.record(10);
+    other.record(5000);
+    other.record(7);
+
+    histogram.merge(other);
+
+    ASSERT_EQ(histogram.getCount(), 3);
+    ASSERT_EQ(histogram.getTotal(), 5017);
+    ASSERT_EQ(histogram.getMin(), 7);
+    ASSERT_EQ(histogram.getMax(), 5000);
+}
+
+TEST_F(HistogramTest, ResetClearsEverything) {
+    histogram.record(42);
+    histogram.reset();
+
+    ASSERT_EQ(histogram.getCount(), 0);
+    ASSERT_EQ(histogram.getTotal(), 0);
+    ASSERT_EQ(histogram.getPercentile(50), 0);
+}
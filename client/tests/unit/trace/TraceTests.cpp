@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <sstream>      // diverts output from terminal to separate stream
+#include <thread>
+#include <vector>
+#include "trace/Trace.hpp"
+#include "controller/TermController.hpp"
+#include "io/JsonReader.hpp"
+
+using namespace std::chrono_literals;
+
+// test fixture for the tracing layer; every test starts enabled and empty
+class TraceTest : public testing::Test {
+    protected:
+        void SetUp() override {
+            trace::reset();
+            trace::enable();
+        }
+
+        void TearDown() override {
+            trace::disable();
+        }
+
+        static const trace::TimerStats* findTimer(const std::vector<trace::TimerStats>& timers, const std::string& name) {
+            auto it = std::find_if(timers.begin(), timers.end(), [&](const trace::TimerStats& t) { return t.name == name; });
+            return it == timers.end() ? nullptr : &*it;
+        }
+
+        static std::int64_t counterValue(const std::string& name) {
+            for (const trace::CounterStats& counter : trace::collectCounters()) {
+                if (counter.name == name) {
+                    return counter.value;
+                }
+            }
+            return 0;
+        }
+};
+
+// counts the complete events in a parsed Chrome trace
+class EventCounter : public JsonHandler {
+    public:
+        int events{0};
+
+        void startObject() override {}
+        void endObject() override {}
+        void startArray() override {}
+        void endArray() override {}
+        void key(std::string_view) override {}
+        void stringValue(std::string_view value) override {
+            events += value == "X";
+        }
+        void numberValue(double) override {}
+        void boolValue(bool) override {}
+        void nullValue() override {}
+};
+
+void tracedWork() {
+    TRACE_SCOPE("TraceTest::tracedWork");
+    TRACE_COUNT("TraceTest::items", 3);
+}
+
+
+// ====================================
+// RECORDING TESTS
+// ====================================
+
+TEST_F(TraceTest, ScopeRecordsTimer) {
+    tracedWork();
+    tracedWork();
+
+    std::vector<trace::TimerStats> timers = trace::collectTimers();
+    const trace::TimerStats* timer = findTimer(timers, "TraceTest::tracedWork");
+    ASSERT_NE(timer, nullptr);
+    ASSERT_EQ(timer->count, 2);
+    ASSERT_LE(timer->min, timer->p50);
+    ASSERT_LE(timer->p99, timer->max);
+    ASSERT_EQ(counterValue("TraceTest::items"), 6);
+}
+
+TEST_F(TraceTest, DisabledRecordsNothing) {
+    trace::disable();
+    tracedWork();
+
+    std::vector<trace::TimerStats> timers = trace::collectTimers();
+    ASSERT_EQ(findTimer(timers, "TraceTest::tracedWork"), nullptr);
+    ASSERT_EQ(counterValue("TraceTest::items"), 0);
+}
+
+TEST_F(TraceTest, ThreadsAreMerged) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            for (int i = 0; i < 1000; ++i) {
+                tracedWork();
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<trace::TimerStats> timers = trace::collectTimers();
+    const trace::TimerStats* timer = findTimer(timers, "TraceTest::tracedWork");
+    ASSERT_NE(timer, nullptr);
+    ASSERT_EQ(timer->count, 4000);
+    ASSERT_EQ(counterValue("TraceTest::items"), 12000);
+}
+
+TEST_F(TraceTest, SitesWithSameNameShareTimer) {
+    {
+        TRACE_SCOPE("TraceTest::shared");
+    }
+    {
+        TRACE_SCOPE("TraceTest::shared");
+    }
+
+    std::vector<trace::TimerStats> timers = trace::collectTimers();
+    const trace::TimerStats* timer = findTimer(timers, "TraceTest::shared");
+    ASSERT_NE(timer, nullptr);
+    ASSERT_EQ(timer->count, 2);
+}
+
+TEST_F(TraceTest, SiteKindMismatch) {
+    trace::Site timer{"TraceTest::kind", trace::SiteKind::timer};
+    ASSERT_THROW((trace::Site{"TraceTest::kind", trace::SiteKind::counter}), std::invalid_argument);
+}
+
+TEST_F(TraceTest, ControllerMutationsAreTraced) {
+    TermController controller;
+    controller.addTerm("Spring 2026", std::chrono::year_month_day{2026y/1/2}, std::chrono::year_month_day{2026y/5/24}, true);
+    controller.selectTerm("Spring 2026");
+    controller.getCourseController().addCourse("CMPE 142", "", std::chrono::year_month_day{2026y/1/2},
+        std::chrono::year_month_day{2026y/5/12}, 3, true);
+
+    std::vector<trace::TimerStats> timers = trace::collectTimers();
+    ASSERT_NE(findTimer(timers, "TermController::addTerm"), nullptr);
+    ASSERT_NE(findTimer(timers, "CourseController::addCourse"), nullptr);
+    ASSERT_NE(findTimer(timers, "Term::calculateOvrGpa"), nullptr);
+}
+
+
+// ====================================
+// OUTPUT TESTS
+// ====================================
+
+TEST_F(TraceTest, SummaryListsTimersAndCounters) {
+    tracedWork();
+    std::ostringstream os;
+    trace::writeSummary(os);
+
+    ASSERT_NE(os.str().find("p99 us"), std::string::npos);
+    ASSERT_NE(os.str().find("TraceTest::tracedWork"), std::string::npos);
+    ASSERT_NE(os.str().find("TraceTest::items"), std::string::npos);
+}
+
+TEST_F(TraceTest, ChromeTraceHasEvents) {
+    tracedWork();
+    std::ostringstream os;
+    trace::writeChromeTrace(os);
+    std::string text = os.str();
+
+    std::istringstream is{text};
+    EventCounter counter;
+    JsonReader{is}.parse(counter);
+    ASSERT_EQ(counter.events, 1);
+    ASSERT_NE(text.find(R"("name":"TraceTest::tracedWork","ph":"X")"), std::string::npos);
+    ASSERT_NE(text.find(R"("TraceTest::items":3)"), std::string::npos);
+}
+
+TEST_F(TraceTest, ResetHidesEarlierEvents) {
+    tracedWork();
+    trace::reset();
+    std::ostringstream os;
+    trace::writeChromeTrace(os);
+
+    ASSERT_EQ(os.str().find("TraceTest::tracedWork"), std::string::npos);
+    ASSERT_TRUE(trace::collectTimers().empty());
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "utils/OrderedMap.hpp"
+
+// test fixture for utils::OrderedMap, filled with a -> 1, b -> 2, c -> 3, d -> 4
+class OrderedMapTest : public testing::Test {
+    protected:
+        utils::OrderedMap<std::string, int> map{};
+
+        void SetUp() override {
+            map.emplace("a", 1);
+            map.emplace("b", 2);
+            map.emplace("c", 3);
+            map.emplace("d", 4);
+        }
+
+        static std::vector<std::string> keysOf(const utils::OrderedMap<std::string, int>& source) {
+            std::vector<std::string> keys;
+            for (const auto& [key, value] : source) {
+                keys.push_back(key);
+            }
+            return keys;
+        }
+};
+
+
+// ====================================
+// FUNCTION SMOKE TESTS
+// ====================================
+
+TEST_F(OrderedMapTest, IteratesInInsertionOrder) {
+    ASSERT_EQ(keysOf(map), (std::vector<std::string>{"a", "b", "c", "d"}));
+    ASSERT_EQ(map.size(), 4);
+}
+
+TEST_F(OrderedMapTest, FindAndAt) {
+    ASSERT_EQ(map.find("c")->second, 3);
+    ASSERT_EQ(map.at("b"), 2);
+    ASSERT_TRUE(map.contains("d"));
+    ASSERT_EQ(map.find("z"), map.end());
+}
+
+TEST_F(OrderedMapTest, EmplaceExistingKeepsValueAndOrder) {
+    auto [it, inserted] = map.emplace("b", 20);
+
+    ASSERT_FALSE(inserted);
+    ASSERT_EQ(it->second, 2);
+    ASSERT_EQ(keysOf(map), (std::vector<std::string>{"a", "b", "c", "d"}));
+}
+
+TEST_F(OrderedMapTest, EraseKeepsOrderOfTheRest) {
+    ASSERT_EQ(map.erase("b"), 1);
+    ASSERT_EQ(map.erase("b"), 0);
+    map.erase(map.find("d"));
+
+    ASSERT_EQ(keysOf(map), (std::vector<std::string>{"a", "c"}));
+    ASSERT_FALSE(map.contains("b"));
+}
+
+TEST_F(OrderedMapTest, ReferencesSurviveOtherChanges) {
+    int* c = &map.at("c");
+    for (int i = 0; i < 100; ++i) {
+        map.emplace("key " + std::to_string(i), i);
+    }
+    map.erase("a");
+    map.move("c", 50);
+
+    ASSERT_EQ(c, &map.at("c"));
+}
+
+TEST_F(OrderedMapTest, MoveToFrontMiddleAndBack) {
+    map.move("d", 0);
+    ASSERT_EQ(keysOf(map), (std::vector<std::string>{"d", "a", "b", "c"}));
+
+    map.move("d", 2);
+    ASSERT_EQ(keysOf(map), (std::vector<std::string>{"a", "b", "d", "c"}));
+
+    map.move("a", 100);
+    ASSERT_EQ(keysOf(map), (std::vector<std::string>{"b", "d", "c", "a"}));
+    ASSERT_EQ(map.indexOf("c"), 2);
+}
+
+TEST_F(OrderedMapTest, MoveBeforeEntry) {
+    map.moveBefore(map.find("d"), map.find("b"));
+
+    ASSERT_EQ(keysOf(map), (std::vector<std::string>{"a", "d", "b", "c"}));
+}
+
+TEST_F(OrderedMapTest, MoveBeforeKey) {
+    map.moveBefore("a", "d");
+    ASSERT_EQ(keysOf(map), (std::vector<std::string>{"b", "c", "a", "d"}));
+    ASSERT_EQ(*map.nextKey("c"), "a");
+
+    map.moveBefore("b", "z");       // no such entry, so to the back
+    ASSERT_EQ(keysOf(map), (std::vector<std::string>{"c", "a", "d", "b"}));
+    ASSERT_EQ(map.nextKey("b"), nullptr);
+}
+
+TEST_F(OrderedMapTest, CopyIsIndependent) {
+    utils::OrderedMap<std::string, int> copy{map};
+    copy.erase("a");
+    copy.at("b") = 20;
+
+    ASSERT_EQ(keysOf(copy), (std::vector<std::string>{"b", "c", "d"}));
+    ASSERT_EQ(copy.at("b"), 20);
+    ASSERT_EQ(map.at("b"), 2);
+    ASSERT_TRUE(map.contains("a"));
+}
+
+TEST_F(OrderedMapTest, MovedMapStillFindsKeys) {
+    utils::OrderedMap<std::string, int> moved{std::move(map)};
+    moved.emplace("e", 5);
+
+    ASSERT_EQ(moved.at("a"), 1);
+    ASSERT_EQ(keysOf(moved), (std::vector<std::string>{"a", "b", "c", "d", "e"}));
+}
+
+
+// ====================================
+// FUNCTION EDGE CASES
+// ====================================
+
+TEST_F(OrderedMapTest, AtNotFound) {
+    ASSERT_THROW(map.at("z"), std::out_of_range);
+}
+
+TEST_F(OrderedMapTest, MoveNotFound) {
+    ASSERT_THROW(map.move("z", 0), std::out_of_range);
+    ASSERT_THROW(map.indexOf("z"), std::out_of_range);
+    ASSERT_THROW(map.moveBefore("z", "a"), std::out_of_range);
+    ASSERT_THROW(map.nextKey("z"), std::out_of_range);
+}
+
+TEST_F(OrderedMapTest, MoveToOwnPositionIsNoOp) {
+    map.move("b", 1);
+
+    ASSERT_EQ(keysOf(map), (std::vector<std::string>{"a", "b", "c", "d"}));
+}
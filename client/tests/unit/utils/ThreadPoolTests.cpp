@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "utils/ThreadPool.hpp"
+
+// test fixture for utils::ThreadPool, with four threads counting the caller
+class ThreadPoolTest : public testing::Test {
+    protected:
+        utils::ThreadPool pool{4};
+};
+
+
+// ====================================
+// FUNCTION SMOKE TESTS
+// ====================================
+
+TEST_F(ThreadPoolTest, ThreadCountIncludesCaller) {
+    ASSERT_EQ(pool.getThreadCount(), 4);
+    ASSERT_EQ(utils::ThreadPool{1}.getThreadCount(), 1);
+}
+
+TEST_F(ThreadPoolTest, EveryIndexRunsOnce) {
+    std::vector<std::atomic<int>> visits(10000);
+
+    pool.parallelFor(visits.size(), [&visits](std::size_t i) { ++visits[i]; });
+
+    for (const std::atomic<int>& count : visits) {
+        ASSERT_EQ(count.load(), 1);
+    }
+}
+
+TEST_F(ThreadPoolTest, SingleThreadRunsInline) {
+    utils::ThreadPool serial{1};
+    std::vector<std::size_t> order;
+
+    serial.parallelFor(5, [&order](std::size_t i) { order.push_back(i); });
+
+    ASSERT_EQ(order, (std::vector<std::size_t>{0, 1, 2, 3, 4}));
+}
+
+TEST_F(ThreadPoolTest, GroupWaitsForEveryTask) {
+    std::atomic<int> count{0};
+    utils::TaskGroup group{pool};
+
+    for (int i = 0; i < 100; ++i) {
+        group.run([&count]() { ++count; });
+    }
+    group.wait();
+
+    ASSERT_EQ(count.load(), 100);
+}
+
+TEST_F(ThreadPoolTest, TasksCanSpawnIntoTheirGroup) {
+    std::atomic<int> leaves{0};
+    utils::TaskGroup group{pool};
+    std::function<void(int)> spawn = [&](int depth) {
+        if (depth == 0) {
+            ++leaves;
+            return;
+        }
+        group.run([&spawn, depth]() { spawn(depth - 1); });
+        group.run([&spawn, depth]() { spawn(depth - 1); });
+    };
+
+    group.run([&spawn]() { spawn(10); });
+    group.wait();
+
+    ASSERT_EQ(leaves.load(), 1024);
+}
+
+TEST_F(ThreadPoolTest, WorkSpreadsAcrossThreads) {
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+
+    // each item sleeps, so the caller alone can't get through them before the workers steal some
+    pool.parallelFor(64, [&mutex, &threads](std::size_t) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        std::lock_guard lock{mutex};
+        threads.insert(std::this_thread::get_id());
+    });
+
+    ASSERT_GT(threads.size(), 1);
+}
+
+TEST_F(ThreadPoolTest, RepeatedLoopsReuseWorkers) {
+    std::atomic<std::size_t> total{0};
+
+    for (int run = 0; run < 200; ++run) {
+        pool.parallelFor(64, [&total](std::size_t i) { total += i; });
+    }
+
+    ASSERT_EQ(total.load(), 200 * (63 * 64 / 2));
+}
+
+
+// ====================================
+// FUNCTION EDGE CASES
+// ====================================
+
+TEST_F(ThreadPoolTest, EmptyLoopRunsNothing) {
+    bool ran = false;
+
+    pool.parallelFor(0, [&ran](std::size_t) { ran = true; });
+
+    ASSERT_FALSE(ran);
+}
+
+TEST_F(ThreadPoolTest, NestedLoopsDoNotDeadlock) {
+    std::atomic<int> inner{0};
+
+    pool.parallelFor(8, [this, &inner](std::size_t) {
+        pool.parallelFor(8, [&inner](std::size_t) { ++inner; });
+    });
+
+    ASSERT_EQ(inner.load(), 64);
+}
+
+TEST_F(ThreadPoolTest, CancelSkipsQueuedTasks) {
+    utils::ThreadPool serial{1};
+    utils::TaskGroup group{serial};
+    int ran = 0;
+
+    // with no workers nothing starts until wait(), so every task is still queued when the group is cancelled
+    for (int i = 0; i < 10; ++i) {
+        group.run([&ran]() { ++ran; });
+    }
+    group.cancel();
+    group.wait();
+
+    ASSERT_TRUE(group.isCancelled());
+    ASSERT_EQ(ran, 0);
+}
+
+TEST_F(ThreadPoolTest, WaitRunsOnlyItsOwnGroup) {
+    utils::ThreadPool serial{1};
+    utils::TaskGroup other{serial};
+    utils::TaskGroup group{serial};
+    bool otherRan = false;
+    bool ran = false;
+
+    other.run([&otherRan]() { otherRan = true; });
+    group.run([&ran]() { ran = true; });
+    group.wait();
+
+    ASSERT_TRUE(ran);
+    ASSERT_FALSE(otherRan);
+
+    other.wait();
+    ASSERT_TRUE(otherRan);
+}
+
+TEST_F(ThreadPoolTest, SharedPoolRunsHandedOffWork) {
+    // work handed to the shared pool runs on a worker while the thread that handed it off does something else,
+    // even on one core
+    utils::ThreadPool& shared = utils::ThreadPool::shared();
+    utils::TaskGroup group{shared};
+    std::atomic<bool> ran{false};
+
+    ASSERT_GE(shared.getThreadCount(), 2);
+    group.run([&ran]() { ran = true; });
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!ran.load() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+
+    ASSERT_TRUE(ran.load());
+    group.wait();
+}
+
+TEST_F(ThreadPoolTest, RunningTasksSeeCancellation) {
+    utils::TaskGroup group{pool};
+    std::atomic<bool> sawCancel{false};
+
+    group.run([&group, &sawCancel]() {
+        group.cancel();
+        sawCancel = group.isCancelled();
+    });
+    group.wait();
+
+    ASSERT_TRUE(sawCancel.load());
+}
+
+TEST_F(ThreadPoolTest, GroupExceptionReachesWait) {
+    utils::TaskGroup group{pool};
+
+    group.run([]() { throw std::runtime_error("failed"); });
+
+    ASSERT_THROW(group.wait(), std::runtime_error);
+    ASSERT_TRUE(group.isCancelled());
+    ASSERT_NO_THROW(group.wait());  // handed over once
+}
+
+TEST_F(ThreadPoolTest, ExceptionReachesCaller) {
+    ASSERT_THROW(pool.parallelFor(1000, [](std::size_t i) {
+        if (i == 500) {
+            throw std::runtime_error("failed");
+        }
+    }), std::runtime_error);
+
+    // the pool is still usable afterwards
+    std::atomic<int> count{0};
+    pool.parallelFor(100, [&count](std::size_t) { ++count; });
+    ASSERT_EQ(count.load(), 100);
+}
@@ -180,6 +180,40 @@ TEST(UtilsTest, StringLowerMixedCase) {
     ASSERT_EQ(utils::stringLower(input3), "testing");
 }
 
+TEST(UtilsTest, TitleKeyFoldsCase) {
+    ASSERT_EQ(utils::titleKey("CMPE 142 Lab"), "cmpe 142 lab");
+    ASSERT_EQ(utils::titleKey(""), "");
+}
+
+TEST(UtilsTest, CaseInsensitiveHashAndEqualIgnoreCase) {
+    utils::CaseInsensitiveHash hash;
+    utils::CaseInsensitiveEqual equal;
+
+    ASSERT_EQ(hash("Homework 1"), hash("HOMEWORK 1"));
+    ASSERT_TRUE(equal("Homework 1", "hOMEWORK 1"));
+    ASSERT_FALSE(equal("Homework 1", "Homework 10"));
+    ASSERT_FALSE(equal("Homework 1", "Homework 2"));
+}
+
+TEST(UtilsTest, TitleIndexFindsAnyCase) {
+    utils::TitleIndex index;
+    index.emplace(utils::titleKey("Fall 2025"), "id-1");
+    std::string_view query{"FALL 2025"};
+
+    ASSERT_TRUE(index.contains(query));
+    ASSERT_EQ(index.find("fall 2025")->second, "id-1");
+    ASSERT_FALSE(index.contains("Fall 2026"));
+}
+
+TEST(UtilsTest, EraseTitleRemovesAnyCase) {
+    utils::TitleIndex index;
+    index.emplace(utils::titleKey("Fall 2025"), "id-1");
+
+    ASSERT_FALSE(utils::eraseTitle(index, "Spring 2026"));
+    ASSERT_TRUE(utils::eraseTitle(index, "fALL 2025"));
+    ASSERT_TRUE(index.empty());
+}
+
 TEST(UtilsTest, StringTrimLeadingWhitespace) {
     std::string str{"      sock"};
     ASSERT_EQ(utils::stringTrim(str), "sock");
@@ -196,6 +230,99 @@ TEST(UtilsTest, StringTrimNoWhitespace) {
 }
 
 
+// ====================================
+// DATE PARSING TESTS
+// ====================================
+
+TEST(UtilsTest, ParseDateZeroPadded) {
+    ASSERT_EQ(utils::parseDate("2025-08-05"), std::chrono::year_month_day(2025y/8/5));
+}
+
+TEST(UtilsTest, ParseDateSingleDigitFields) {
+    ASSERT_EQ(utils::parseDate("2025-1-2"), std::chrono::year_month_day(2025y/1/2));
+}
+
+TEST(UtilsTest, ParseDateSurroundingWhitespace) {
+    ASSERT_EQ(utils::parseDate("  2025-12-31\r"), std::chrono::year_month_day(2025y/12/31));
+}
+
+TEST(UtilsTest, ParseDateLeapDay) {
+    ASSERT_EQ(utils::parseDate("2028-2-29"), std::chrono::year_month_day(2028y/2/29));
+    ASSERT_THROW(utils::parseDate("2025-2-29"), utils::DateParseError);
+}
+
+TEST(UtilsTest, ParseDateWrongOrder) {
+    // year must come first and have four digits
+    ASSERT_THROW(utils::parseDate("1-10-2025"), std::invalid_argument);
+}
+
+TEST(UtilsTest, ParseDateTrailingCharacters) {
+    ASSERT_THROW(utils::parseDate("2025-1-10x"), std::invalid_argument);
+    ASSERT_THROW(utils::parseDate("2025-1-100"), std::invalid_argument);
+}
+
+TEST(UtilsTest, ParseDateEmpty) {
+    ASSERT_THROW(utils::parseDate(""), std::invalid_argument);
+}
+
+TEST(UtilsTest, ParseDateErrorPositionSeparator) {
+    try {
+        utils::parseDate("2025/01/10");
+        FAIL() << "Expected DateParseError";
+    } catch (const utils::DateParseError& e) {
+        ASSERT_EQ(e.getPosition(), 4);
+    }
+}
+
+TEST(UtilsTest, ParseDateErrorPositionMonth) {
+    try {
+        utils::parseDate(" 2025-13-01");
+        FAIL() << "Expected DateParseError";
+    } catch (const utils::DateParseError& e) {
+        ASSERT_EQ(e.getPosition(), 6);
+    }
+}
+
+TEST(UtilsTest, ParseDateErrorPositionDay) {
+    try {
+        utils::parseDate("2025-6-31");
+        FAIL() << "Expected DateParseError";
+    } catch (const utils::DateParseError& e) {
+        ASSERT_EQ(e.getPosition(), 7);
+    }
+}
+
+TEST(UtilsTest, ParseDatesBatch) {
+    std::vector<std::string_view> inputs{"2025-1-10", "2025-05-23", "2026-12-1"};
+    std::vector<std::chrono::year_month_day> outputs(inputs.size());
+
+    utils::parseDates(inputs, outputs);
+
+    ASSERT_EQ(outputs[0], std::chrono::year_month_day(2025y/1/10));
+    ASSERT_EQ(outputs[1], std::chrono::year_month_day(2025y/5/23));
+    ASSERT_EQ(outputs[2], std::chrono::year_month_day(2026y/12/1));
+}
+
+TEST(UtilsTest, ParseDatesBatchInvalidEntry) {
+    std::vector<std::string_view> inputs{"2025-1-10", "2025-1-x"};
+    std::vector<std::chrono::year_month_day> outputs(inputs.size());
+
+    try {
+        utils::parseDates(inputs, outputs);
+        FAIL() << "Expected DateParseError";
+    } catch (const utils::DateParseError& e) {
+        ASSERT_EQ(e.getPosition(), 7);
+        ASSERT_TRUE(std::string(e.what()).starts_with("Date 1:"));
+    }
+}
+
+TEST(UtilsTest, ParseDatesBatchOutputTooSmall) {
+    std::vector<std::string_view> inputs{"2025-1-10", "2025-1-11"};
+    std::vector<std::chrono::year_month_day> outputs(1);
+
+    ASSERT_THROW(utils::parseDates(inputs, outputs), std::out_of_range);
+}
+
 // ====================================
 // QT DATE CONVERSION TESTS
 // ====================================
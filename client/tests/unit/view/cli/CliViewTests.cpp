@@ -55,7 +55,7 @@ TEST(CliViewTest, AddTerm) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
     
     // check that Term was added to the list
@@ -97,7 +97,7 @@ TEST(CliViewTest, EditTerm) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check that info was updated in list
@@ -135,7 +135,7 @@ TEST(CliViewTest, SelectTerm) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check user output for both the prompt and the success message
@@ -171,7 +171,7 @@ TEST(CliViewTest, RemoveTerm) {
     view.run();
 
     // check that termList size is 1
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check that termList does not include removed Term
@@ -213,7 +213,7 @@ TEST(CliViewTest, AddCourse) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
     
     // check that Course was added to the list
@@ -271,7 +271,7 @@ TEST(CliViewTest, EditCourse) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check that info was updated in list
@@ -323,7 +323,7 @@ TEST(CliViewTest, SelectCourse) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check user output for both the prompt and the success message
@@ -373,7 +373,7 @@ TEST(CliViewTest, RemoveCourse) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is 1
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check that courseList does not include removed Course
@@ -1482,7 +1482,7 @@ TEST(CliViewTest, EditTermNotFound) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check for intro and term not found message
@@ -1514,7 +1514,7 @@ TEST(CliViewTest, EditTermNoEditFields) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check for intro and fields to update message (no error should be thrown)
@@ -1548,7 +1548,7 @@ TEST(CliViewTest, EditTermNewTitleEmpty) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check for intro and invalid input message
@@ -1586,7 +1586,7 @@ TEST(CliViewTest, EditTermNewTitleAlreadyExists) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 2);
 
     // check for intro and invalid input message
@@ -1620,7 +1620,7 @@ TEST(CliViewTest, EditTermNewStartDateEmpty) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check for intro and invalid input message
@@ -1654,7 +1654,7 @@ TEST(CliViewTest, EditTermNewStartDateWrongFormat) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check for intro and invalid input message
@@ -1688,7 +1688,7 @@ TEST(CliViewTest, EditTermNewStartDateNonexistent) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check for intro and invalid input message
@@ -1722,7 +1722,7 @@ TEST(CliViewTest, EditTermNewStartDateAfterEndDate) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check for intro and invalid input message
@@ -1755,7 +1755,7 @@ TEST(CliViewTest, EditTermNewStartDateUnchanged) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check for intro and unchanged message
@@ -1789,7 +1789,7 @@ TEST(CliViewTest, EditTermNewEndDateEmpty) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check for intro and invalid input message
@@ -1823,7 +1823,7 @@ TEST(CliViewTest, EditTermNewEndDateWrongFormat) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check for intro and invalid input message
@@ -1857,7 +1857,7 @@ TEST(CliViewTest, EditTermNewEndDateNonexistent) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check for intro and invalid input message
@@ -1891,7 +1891,7 @@ TEST(CliViewTest, EditTermNewEndDateBeforeStartDate) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check for intro and invalid input message
@@ -1924,7 +1924,7 @@ TEST(CliViewTest, EditTermNewEndDateUnchanged) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check for intro and unchanged message
@@ -1958,7 +1958,7 @@ TEST(CliViewTest, EditTermNewStartDateEndDateCombo) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check for intro and edit results message
@@ -1992,7 +1992,7 @@ TEST(CliViewTest, EditTermNewStartDateEndDateComboUnchanged) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check for intro and unchanged message
@@ -2026,7 +2026,7 @@ TEST(CliViewTest, EditTermNewActiveEmpty) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check for intro and invalid input message
@@ -2060,7 +2060,7 @@ TEST(CliViewTest, EditTermNewActiveInvalid) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check for intro and invalid input message
@@ -2093,7 +2093,7 @@ TEST(CliViewTest, EditTermNewActiveUnchanged) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check for intro and unchanged message
@@ -2124,7 +2124,7 @@ TEST(CliViewTest, SelectTermNotFound) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check for intro and term not found message
@@ -2161,7 +2161,7 @@ TEST(CliViewTest, RemoveTermNotFound) {
     view.run();
 
     // check that termList size is 2 since Term was not removed
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 2);
 
     // check for intro and term not found message
@@ -2199,7 +2199,7 @@ TEST(CliViewTest, RemoveTermInvalidBool) {
     view.run();
 
     // check that termList size is not 0
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 1);
 
     // check for intro and invalid response message
@@ -2236,7 +2236,7 @@ TEST(CliViewTest, RemoveTermNotConfirmed) {
     view.run();
 
     // check that termList size is 2 since Term was not removed
-    const std::unordered_map<std::string, Term>& listOfTerms = controller.getTermList();
+    const TermList& listOfTerms = controller.getTermList();
     ASSERT_EQ(listOfTerms.size(), 2);
 
     // check for intro and operation cancelled message
@@ -2791,7 +2791,7 @@ TEST(CliViewTest, EditCourseNotFound) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and course not found message
@@ -2835,7 +2835,7 @@ TEST(CliViewTest, EditCourseNoEditFields) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and fields to update message (no error should be thrown)
@@ -2882,7 +2882,7 @@ TEST(CliViewTest, EditCourseNewTitleEmpty) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and invalid input message
@@ -2929,7 +2929,7 @@ TEST(CliViewTest, EditCourseNewTitleAlreadyExists) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and invalid input message
@@ -2976,7 +2976,7 @@ TEST(CliViewTest, EditCourseNewStartDateEmpty) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and invalid input message
@@ -3023,7 +3023,7 @@ TEST(CliViewTest, EditCourseNewStartDateWrongFormat) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and invalid input message
@@ -3070,7 +3070,7 @@ TEST(CliViewTest, EditCourseNewStartDateNonexistent) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and invalid input message
@@ -3117,7 +3117,7 @@ TEST(CliViewTest, EditCourseNewStartDateAfterEndDate) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and invalid input message
@@ -3163,7 +3163,7 @@ TEST(CliViewTest, EditCourseNewStartDateUnchanged) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and unchanged message
@@ -3210,7 +3210,7 @@ TEST(CliViewTest, EditCourseNewEndDateEmpty) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and invalid input message
@@ -3257,7 +3257,7 @@ TEST(CliViewTest, EditCourseNewEndDateWrongFormat) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and invalid input message
@@ -3304,7 +3304,7 @@ TEST(CliViewTest, EditCourseNewEndDateNonexistent) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and invalid input message
@@ -3351,7 +3351,7 @@ TEST(CliViewTest, EditCourseNewEndDateBeforeStartDate) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and invalid input message
@@ -3397,7 +3397,7 @@ TEST(CliViewTest, EditCourseNewEndDateUnchanged) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and unchanged message
@@ -3444,7 +3444,7 @@ TEST(CliViewTest, EditCourseNewStartDateEndDateCombo) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and invalid input message
@@ -3491,7 +3491,7 @@ TEST(CliViewTest, EditCourseNewStartDateEndDateComboUnchanged) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and unchanged message
@@ -3538,7 +3538,7 @@ TEST(CliViewTest, EditCourseNewNumCreditsEmpty) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and default input message
@@ -3585,7 +3585,7 @@ TEST(CliViewTest, EditCourseNewNumCreditsLessThanZero) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and default input message
@@ -3631,7 +3631,7 @@ TEST(CliViewTest, EditCourseNewNumCreditsUnchanged) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and unchanged message
@@ -3678,7 +3678,7 @@ TEST(CliViewTest, EditCourseNewActiveEmpty) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and invalid input message
@@ -3725,7 +3725,7 @@ TEST(CliViewTest, EditCourseNewActiveInvalid) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and invalid input message
@@ -3771,7 +3771,7 @@ TEST(CliViewTest, EditCourseNewActiveUnchanged) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and unchanged message
@@ -3815,7 +3815,7 @@ TEST(CliViewTest, SelectCourseNotFound) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and invalid input message
@@ -3867,7 +3867,7 @@ TEST(CliViewTest, RemoveCourseNotFound) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is 2 since nothing was removed
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 2);
 
     // check for intro and invalid input message
@@ -3920,7 +3920,7 @@ TEST(CliViewTest, RemoveCourseInvalidBool) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is not 0
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 1);
 
     // check for intro and invalid input message
@@ -3972,7 +3972,7 @@ TEST(CliViewTest, RemoveCourseNotConfirmed) {
     CourseController& courseController = controller.getCourseController();
 
     // check that courseList size is 2 since nothing was removed
-    const std::unordered_map<std::string, Course>& listOfCourses = courseController.getCourseList();
+    const CourseList& listOfCourses = courseController.getCourseList();
     ASSERT_EQ(listOfCourses.size(), 2);
 
     // check for intro and invalid input message
@@ -6849,4 +6849,157 @@ TEST(CliViewTest, ViewAssignmentsInvalidSelection) {
     ASSERT_TRUE(userOut.find("would you like to view") != std::string::npos);
     ASSERT_TRUE(userOut.find("Invalid selection") != std::string::npos);
     ASSERT_TRUE(userOut.find("Please try again") != std::string::npos);
-}
\ No newline at end of file
+}
+TEST(CliViewTest, ViewDueDatesAcrossTerms) {
+    std::chrono::year_month_day today = utils::getTodayDate();
+    std::chrono::year_month_day nextWeek{std::chrono::sys_days{today} + std::chrono::days{5}};
+    std::chrono::year_month_day nextMonth{std::chrono::sys_days{today} + std::chrono::days{30}};
+
+    TermController controller;
+    controller.addTerm("Spring 2025", std::chrono::year_month_day{2025y/1/10}, std::chrono::year_month_day{2025y/5/23}, true);
+    controller.selectTerm("Spring 2025");
+    controller.getCourseController().addCourse("CMPE 142", "", std::chrono::year_month_day{2025y/1/10},
+        std::chrono::year_month_day{2025y/5/23}, 3, true);
+    controller.getCourseController().selectCourse("CMPE 142");
+    AssignmentController& assignmentController = controller.getCourseController().getAssignmentController();
+    assignmentController.addAssignment("Homework 1", "", "Homework", nextWeek, false, 0.0f);
+    assignmentController.addAssignment("Homework 2", "", "Homework", today, true, 90.0f);
+    assignmentController.addAssignment("Homework 3", "", "Homework", nextMonth, false, 0.0f);
+
+    std::istringstream input(
+        // view due dates in the next 7 days, incomplete only
+        "D\n"
+        "7\n"
+        "yes\n"
+        // exit
+        "X\n"
+    );
+    std::ostringstream output;
+
+    CliView view(controller, input, output);
+    view.run();
+
+    // only the incomplete assignment inside the window is listed, with its term and course
+    const std::string userOut = output.str();
+    ASSERT_TRUE(userOut.find("Spring 2025 / CMPE 142 / Homework 1") != std::string::npos);
+    ASSERT_TRUE(userOut.find("Homework 2") == std::string::npos);
+    ASSERT_TRUE(userOut.find("Homework 3") == std::string::npos);
+}
+
+TEST(CliViewTest, ViewDueDatesInCourseIncludingCompleted) {
+    std::chrono::year_month_day today = utils::getTodayDate();
+
+    TermController controller;
+    controller.addTerm("Spring 2025", std::chrono::year_month_day{2025y/1/10}, std::chrono::year_month_day{2025y/5/23}, true);
+    controller.selectTerm("Spring 2025");
+    controller.getCourseController().addCourse("CMPE 142", "", std::chrono::year_month_day{2025y/1/10},
+        std::chrono::year_month_day{2025y/5/23}, 3, true);
+    controller.getCourseController().selectCourse("CMPE 142");
+    controller.getCourseController().getAssignmentController().addAssignment("Homework 1", "", "Homework", today,
+        true, 90.0f);
+
+    std::istringstream input(
+        // select term and course
+        "S\n"
+        "Spring 2025\n"
+        "S\n"
+        "CMPE 142\n"
+        // view assignments due in the next 7 days, completed included
+        "V\n"
+        "D\n"
+        "7\n"
+        "no\n"
+        // exit
+        "X\n"
+        "X\n"
+        "X\n"
+    );
+    std::ostringstream output;
+
+    CliView view(controller, input, output);
+    view.run();
+
+    const std::string userOut = output.str();
+    ASSERT_TRUE(userOut.find("Homework 1 (completed)") != std::string::npos);
+    ASSERT_TRUE(userOut.find("CMPE 142 / Homework 1") == std::string::npos);
+}
+
+TEST(CliViewTest, ViewDueDatesNoneDue) {
+    TermController controller;
+    controller.addTerm("Spring 2025", std::chrono::year_month_day{2025y/1/10}, std::chrono::year_month_day{2025y/5/23}, true);
+
+    std::istringstream input(
+        "D\n"
+        "\n"
+        "\n"
+        "X\n"
+    );
+    std::ostringstream output;
+
+    CliView view(controller, input, output);
+    view.run();
+
+    ASSERT_TRUE(output.str().find("No assignments due from") != std::string::npos);
+}
+
+TEST(CliViewTest, SearchAcrossTerms) {
+    TermController controller;
+    controller.addTerm("Spring 2025", std::chrono::year_month_day{2025y/1/10}, std::chrono::year_month_day{2025y/5/23}, true);
+    controller.selectTerm("Spring 2025");
+    controller.getCourseController().addCourse("PHYS 2A", "Mechanics", std::chrono::year_month_day{2025y/1/10},
+        std::chrono::year_month_day{2025y/5/23}, 3, true);
+    controller.getCourseController().selectCourse("PHYS 2A");
+    AssignmentController& assignmentController = controller.getCourseController().getAssignmentController();
+    assignmentController.addAssignment("Lab Report 1", "Pendulum", "Homework", std::chrono::year_month_day{2025y/2/1},
+        false, 0.0f);
+    assignmentController.addAssignment("Homework 1", "", "Homework", std::chrono::year_month_day{2025y/2/8},
+        false, 0.0f);
+
+    std::istringstream input(
+        // search for a word in an assignment title, then for one that matches nothing
+        "F\n"
+        "lab report\n"
+        "F\n"
+        "thermodynamics\n"
+        // exit
+        "X\n"
+    );
+    std::ostringstream output;
+
+    CliView view(controller, input, output);
+    view.run();
+
+    const std::string userOut = output.str();
+    ASSERT_TRUE(userOut.find("[Assignment] Spring 2025 / PHYS 2A / Lab Report 1") != std::string::npos);
+    ASSERT_TRUE(userOut.find("/ Homework 1") == std::string::npos);
+    ASSERT_TRUE(userOut.find("No matches for 'thermodynamics'.") != std::string::npos);
+}
+
+TEST(CliViewTest, UndoAndRedoFromTermMenu) {
+    TermController controller;
+    controller.addTerm("Spring 2025", std::chrono::year_month_day{2025y/1/10}, std::chrono::year_month_day{2025y/5/23}, true);
+
+    std::istringstream input(
+        // remove the term, undo the removal, redo it, then undo it again
+        "R\n"
+        "Spring 2025\n"
+        "yes\n"
+        "U\n"
+        "Y\n"
+        "U\n"
+        // exit
+        "X\n"
+    );
+    std::ostringstream output;
+
+    CliView view(controller, input, output);
+    view.run();
+
+    const std::string userOut = output.str();
+    ASSERT_TRUE(userOut.find("[U] Undo add term") != std::string::npos);
+    ASSERT_TRUE(userOut.find("[U] Undo remove term") != std::string::npos);
+    ASSERT_TRUE(userOut.find("[Y] Redo remove term") != std::string::npos);
+    ASSERT_TRUE(userOut.find("Undid: remove term") != std::string::npos);
+    ASSERT_TRUE(userOut.find("Redid: remove term") != std::string::npos);
+    ASSERT_NO_THROW(controller.findTerm("Spring 2025"));
+}
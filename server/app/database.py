@@ -1,15 +1,23 @@
 import os
+import threading
 from collections.abc import Generator
 
 import pymysql
 from dotenv import load_dotenv
+from fastapi import HTTPException
 from pymysql.connections import Connection
+from pymysql.constants import CLIENT
 from pymysql.cursors import DictCursor
 
+from app.pool import ConnectionPool, PoolTimeout
+
 load_dotenv()
 
+pool: ConnectionPool | None = None
+pool_lock = threading.Lock()
 
-def get_db() -> Generator[Connection[DictCursor], None, None]:
+
+def connect() -> Connection[DictCursor]:
     db_user = os.getenv("DB_USER")
     db_password = os.getenv("DB_PASSWORD")
     db_name = os.getenv("DB_NAME")
@@ -23,16 +31,53 @@ def get_db() -> Generator[Connection[DictCursor], None, None]:
     if not db_name:
         raise ValueError("DB_NAME not set")
 
-    conn: Connection[DictCursor] = pymysql.connect(
+    return pymysql.connect(
         host=os.getenv("DB_HOST") or "localhost",
         port=int(os.getenv("DB_PORT") or 3306),
         user=db_user,
         password=db_password,
         database=db_name,
         cursorclass=DictCursor,
+        # report matched rather than changed rows, so an UPDATE that
+        # rewrites identical values (e.g. a retried sync) is not a 404
+        client_flag=CLIENT.FOUND_ROWS,
     )
 
+
+def get_pool() -> ConnectionPool:
+    global pool
+
+    with pool_lock:
+        if pool is None:
+            pool = ConnectionPool(
+                connect,
+                max_size=int(os.getenv("DB_POOL_SIZE") or 10),
+                timeout=float(os.getenv("DB_POOL_TIMEOUT") or 5),
+                recycle=float(os.getenv("DB_POOL_RECYCLE") or 3600),
+                ping_after=float(os.getenv("DB_POOL_PING_AFTER") or 30),
+            )
+
+        return pool
+
+
+def close_pool() -> None:
+    global pool
+
+    with pool_lock:
+        if pool is not None:
+            pool.close()
+            pool = None
+
+
+def get_db() -> Generator[Connection[DictCursor], None, None]:
+    connections = get_pool()
+
+    try:
+        conn = connections.acquire()
+    except PoolTimeout:
+        raise HTTPException(status_code=503, detail="Database is busy")
+
     try:
         yield conn
     finally:
-        conn.close()
+        connections.release(conn)
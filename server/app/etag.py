@@ -0,0 +1,58 @@
+from __future__ import annotations
+
+import hashlib
+from typing import Any
+
+from fastapi import HTTPException, Request, Response
+from pymysql.connections import Connection
+
+
+def entity_tag(*parts: Any) -> str:
+    digest = hashlib.blake2b(repr(parts).encode(), digest_size=12)
+    return f'"{digest.hexdigest()}"'
+
+
+def matches(if_none_match: str | None, tag: str) -> bool:
+    """Whether an If-None-Match header names the tag, compared weakly as
+    RFC 9110 asks for this header."""
+    if not if_none_match:
+        return False
+
+    for candidate in if_none_match.split(","):
+        candidate = candidate.strip().removeprefix("W/")
+        if candidate == "*" or candidate == tag:
+            return True
+
+    return False
+
+
+def check(
+    request: Request,
+    response: Response,
+    db: Connection,
+    query: str,
+    params: tuple[Any, ...] = (),
+) -> None:
+    """Tags a GET from one row of version columns and answers 304 Not
+    Modified, with no body, if the client already holds that version.
+
+    The query is meant to be cheap: a row's updated_at, or a count and the
+    newest updated_at of a set of rows, which changes whenever a row in the
+    set is inserted, updated or deleted. It runs on the request's connection
+    before the route does, in the same transaction, so the tag describes
+    the rows the route then reads. No row means there is nothing to tag and
+    the route answers 404 itself.
+    """
+    with db.cursor() as cursor:
+        cursor.execute(query, params)
+        row = cursor.fetchone()
+
+    if row is None:
+        return
+
+    tag = entity_tag(request.url.path, request.url.query, *row.values())
+
+    if matches(request.headers.get("if-none-match"), tag):
+        raise HTTPException(status_code=304, headers={"ETag": tag})
+
+    response.headers["ETag"] = tag
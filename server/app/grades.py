@@ -0,0 +1,187 @@
+from __future__ import annotations
+
+import math
+import struct
+from collections.abc import Iterable, Mapping
+from dataclasses import dataclass
+from typing import Any
+
+
+def f32(value: float) -> float:
+    """Rounds a double to the nearest float, as a C++ float would hold it.
+
+    One operation on floats done in double and rounded once to float gives
+    the same result as doing it in float, so each C++ float step below is
+    one Python operation wrapped in f32.
+    """
+    return struct.unpack("f", struct.pack("f", value))[0]
+
+
+# Course's gradeWeightsDefault_, gradeScaleDefault_ and gpaScale_; the
+# server stores no per-course weights or scale, so the defaults always apply
+WEIGHTS = {
+    "Homework": f32(0.25),
+    "Midterm": f32(0.35),
+    "Final Exam": f32(0.4),
+}
+
+SCALE = [
+    (f32(97.0), "A+"),
+    (f32(93.0), "A"),
+    (f32(90.0), "A-"),
+    (f32(87.0), "B+"),
+    (f32(83.0), "B"),
+    (f32(80.0), "B-"),
+    (f32(77.0), "C+"),
+    (f32(73.0), "C"),
+    (f32(70.0), "C-"),
+    (f32(67.0), "D+"),
+    (f32(63.0), "D"),
+    (f32(60.0), "D-"),
+    (f32(0.0), "F"),
+]
+
+GPA_VALUES = {
+    "A+": f32(4.0),
+    "A": f32(4.0),
+    "A-": f32(3.7),
+    "B+": f32(3.3),
+    "B": f32(3.0),
+    "B-": f32(2.7),
+    "C+": f32(2.3),
+    "C": f32(2.0),
+    "C-": f32(1.7),
+    "D+": f32(1.3),
+    "D": f32(1.0),
+    "D-": f32(0.7),
+    "F": f32(0.0),
+    "N/A": f32(0.0),
+}
+
+
+def float_round(value: float, places: int = 2) -> float:
+    """utils::floatRound: scale, round half away from zero, unscale, all in
+    float."""
+    scale = f32(10.0**places)
+    scaled = f32(value * scale)
+    rounded = math.copysign(math.floor(abs(scaled) + 0.5), scaled)
+    return f32(rounded / scale)
+
+
+def hundredths(grade: float) -> float:
+    """An assignment's grade as Assignment holds it: a float rounded to
+    hundredths. Storing grades this way is what lets SQL sum them to the
+    client's totals."""
+    if not abs(grade) < 1e38:
+        raise ValueError("grade is out of range")
+
+    return shortest(float_round(f32(grade)))
+
+
+def shortest(value: float) -> float:
+    """The shortest decimal that reads back as the same float, which is what
+    the client's JsonWriter writes for one."""
+    for digits in range(1, 10):
+        candidate = float(f"{value:.{digits}g}")
+        if f32(candidate) == value:
+            return candidate
+    return value
+
+
+def letter_grade(grade_pct: float, completed: int) -> str:
+    if grade_pct == 0.0 and completed == 0:
+        return "N/A"
+
+    for threshold, letter in SCALE:
+        if grade_pct >= threshold:
+            return letter
+
+    return SCALE[-1][1]
+
+
+@dataclass(frozen=True)
+class CourseGrade:
+    grade_pct: float
+    letter_grade: str
+    gpa_val: float
+
+
+@dataclass(frozen=True)
+class TermGpa:
+    total_credits: int
+    ovr_gpa: float
+
+
+def grade_course(rows: Iterable[Mapping[str, Any]]) -> CourseGrade:
+    """Course::calculateGradePct and the letter grade and GPA value it
+    leads to, from one course's completed assignments grouped by category.
+
+    Each row has a category, a count and a total, the SUM of the FLOAT
+    grades, which MySQL adds in double as the client does. Categories
+    without a weight count as completed work but not toward the grade.
+    """
+    completed = 0
+    grades: dict[str, float] = {}
+
+    for row in rows:
+        if not row["count"]:
+            continue
+
+        completed += row["count"]
+        if row["category"] in WEIGHTS:
+            mean = f32(row["total"] / row["count"])
+            grades[row["category"]] = float_round(mean)
+
+    grade_pct = 0.0
+    active = sum(WEIGHTS[category] for category in grades)
+
+    if completed and f32(active) != 0.0:
+        total = sum(
+            f32(grade * f32(WEIGHTS[category] / active))
+            for category, grade in grades.items()
+        )
+        grade_pct = float_round(f32(total))
+
+    letter = letter_grade(grade_pct, completed)
+    return CourseGrade(
+        shortest(grade_pct), letter, shortest(GPA_VALUES[letter])
+    )
+
+
+def grade_term(
+    courses: Iterable[tuple[int, CourseGrade]],
+) -> TermGpa:
+    """Term::calculateOvrGpa from each course's credits and grade; every
+    course counts toward the credits, graded or not."""
+    credits = 0
+    total = 0.0
+
+    for num_credits, grade in courses:
+        credits += num_credits
+        total += f32(f32(grade.gpa_val) * num_credits)
+
+    if credits == 0:
+        return TermGpa(0, 0.0)
+
+    return TermGpa(credits, shortest(float_round(f32(total / credits))))
+
+
+def grade_rows(
+    rows: Iterable[Mapping[str, Any]],
+) -> dict[str, tuple[int, CourseGrade]]:
+    """Splits rows of (course_id, num_credits, category, count, total), as
+    the grade queries return them, into each course's credits and grade."""
+    by_course: dict[str, tuple[int, list[Mapping[str, Any]]]] = {}
+
+    for row in rows:
+        if row["course_id"] is None:
+            continue
+        _, course_rows = by_course.setdefault(
+            row["course_id"], (row["num_credits"], [])
+        )
+        course_rows.append(row)
+
+    return {
+        course_id: (num_credits, grade_course(course_rows))
+        for course_id, (num_credits, course_rows) in by_course.items()
+    }
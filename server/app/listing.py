@@ -0,0 +1,104 @@
+from __future__ import annotations
+
+from collections.abc import Iterator
+from dataclasses import dataclass
+from typing import Annotated, Any, Literal
+
+from fastapi import Query, Response
+from fastapi.responses import StreamingResponse
+from pydantic import BaseModel
+from pymysql.connections import Connection
+from pymysql.cursors import SSDictCursor
+
+DEFAULT_LIMIT = 100
+MAX_LIMIT = 1000
+FETCH_SIZE = 500
+
+
+@dataclass
+class Page:
+    """The query parameters every list route takes.
+
+    Without after or limit a route returns every row, as it always has.
+    With either, it returns rows in id order starting after the given id,
+    at most limit of them; a client pages through a table by passing the
+    last id it received as the next after, and has reached the end when a
+    page comes back shorter than its limit. format=ndjson streams the same
+    rows one JSON object per line instead of as an array.
+    """
+
+    after: str | None = None
+    limit: Annotated[int | None, Query(ge=1, le=MAX_LIMIT)] = None
+    format: Literal["json", "ndjson"] = "json"
+
+    @property
+    def paged(self) -> bool:
+        return self.after is not None or self.limit is not None
+
+
+def fetch_list(
+    db: Connection,
+    select: str,
+    where: str | None,
+    params: tuple[Any, ...],
+    page: Page,
+    model: type[BaseModel],
+    response: Response,
+) -> Any:
+    """Runs a list route's query, narrowed to one page if one was asked
+    for, and answers with a JSON array or an NDJSON stream."""
+    conditions = [] if where is None else [where]
+    arguments = list(params)
+    query = select
+
+    if page.after is not None:
+        conditions.append("id > %s")
+        arguments.append(page.after)
+
+    if conditions:
+        query += " WHERE " + " AND ".join(conditions)
+
+    if page.paged:
+        # keyset pagination on the primary key: each page is an index range
+        # scan however deep into the table it starts
+        query += " ORDER BY id LIMIT %s"
+        arguments.append(page.limit or DEFAULT_LIMIT)
+
+    if page.format == "ndjson":
+        return stream(db, query, tuple(arguments), model, response)
+
+    with db.cursor() as cursor:
+        cursor.execute(query, tuple(arguments))
+        return cursor.fetchall()
+
+
+def stream(
+    db: Connection,
+    query: str,
+    params: tuple[Any, ...],
+    model: type[BaseModel],
+    response: Response,
+) -> StreamingResponse:
+    # an unbuffered cursor leaves the result set on the server and reads it
+    # FETCH_SIZE rows at a time, so memory stays flat however many rows
+    # there are; the connection is held until the stream ends
+    cursor = db.cursor(SSDictCursor)
+    cursor.execute(query, params)
+
+    def lines() -> Iterator[str]:
+        try:
+            while rows := cursor.fetchmany(FETCH_SIZE):
+                yield "".join(
+                    model.model_validate(row).model_dump_json() + "\n"
+                    for row in rows
+                )
+        finally:
+            cursor.close()
+
+    # a returned response doesn't pick up headers set by dependencies, such
+    # as the ETag, so they are carried over here
+    return StreamingResponse(
+        lines(),
+        media_type="application/x-ndjson",
+        headers=dict(response.headers),
+    )
@@ -1,8 +1,18 @@
+from contextlib import asynccontextmanager
+
 from fastapi import FastAPI
 
+from app.database import close_pool
 from app.routes import assignments, courses, terms
 
-app = FastAPI(title="Course Companion API")
+
+@asynccontextmanager
+async def lifespan(app: FastAPI):
+    yield
+    close_pool()
+
+
+app = FastAPI(title="Course Companion API", lifespan=lifespan)
 
 app.include_router(terms.router, prefix="/terms", tags=["terms"])
 app.include_router(courses.router, prefix="/courses", tags=["courses"])
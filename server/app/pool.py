@@ -0,0 +1,156 @@
+from __future__ import annotations
+
+import threading
+import time
+from collections.abc import Callable
+from dataclasses import dataclass, field
+
+import pymysql
+from pymysql.connections import Connection
+from pymysql.constants import SERVER_STATUS
+from pymysql.cursors import DictCursor
+
+
+class PoolTimeout(Exception):
+    pass
+
+
+@dataclass
+class PooledConnection:
+    conn: Connection[DictCursor]
+    created_at: float
+    idle_since: float = field(default=0.0)
+
+
+class ConnectionPool:
+    """A bounded pool of open connections, handed out most recently used
+    first so the warmest connections stay in use.
+
+    At most max_size connections are open at once; acquire blocks for up to
+    timeout seconds when all of them are checked out. A connection that has
+    been idle for ping_after seconds is pinged before it is handed out, and
+    one older than recycle seconds is replaced, so connections dropped by the
+    server's wait_timeout are never given to a request.
+    """
+
+    def __init__(
+        self,
+        connect: Callable[[], Connection[DictCursor]],
+        max_size: int = 10,
+        timeout: float = 5.0,
+        recycle: float = 3600.0,
+        ping_after: float = 30.0,
+        clock: Callable[[], float] = time.monotonic,
+    ) -> None:
+        if max_size < 1:
+            raise ValueError("max_size must be at least 1")
+
+        self.connect = connect
+        self.max_size = max_size
+        self.timeout = timeout
+        self.recycle = recycle
+        self.ping_after = ping_after
+        self.clock = clock
+        self.idle: list[PooledConnection] = []
+        self.checked_out: dict[int, PooledConnection] = {}
+        self.size = 0
+        self.closed = False
+        self.condition = threading.Condition()
+
+    def acquire(self) -> Connection[DictCursor]:
+        deadline = self.clock() + self.timeout
+        pooled = None
+
+        with self.condition:
+            while True:
+                if self.closed:
+                    raise PoolTimeout("Connection pool is closed")
+
+                if self.idle:
+                    pooled = self.idle.pop()
+                    break
+
+                if self.size < self.max_size:
+                    self.size += 1
+                    break
+
+                remaining = deadline - self.clock()
+                if remaining <= 0 or not self.condition.wait(remaining):
+                    raise PoolTimeout("No database connection available")
+
+        try:
+            if pooled is None or not self.healthy(pooled):
+                if pooled is not None:
+                    self.close_quietly(pooled.conn)
+                pooled = PooledConnection(self.connect(), self.clock())
+        except BaseException:
+            with self.condition:
+                self.size -= 1
+                self.condition.notify()
+            raise
+
+        with self.condition:
+            self.checked_out[id(pooled.conn)] = pooled
+
+        return pooled.conn
+
+    def release(
+        self, conn: Connection[DictCursor], discard: bool = False
+    ) -> None:
+        with self.condition:
+            pooled = self.checked_out.pop(id(conn))
+
+        # a request that failed mid-transaction must not leak its snapshot
+        # or locks into the next one; a clean connection skips the round trip
+        if not discard and conn.open:
+            try:
+                if conn.server_status & SERVER_STATUS.SERVER_STATUS_IN_TRANS:
+                    conn.rollback()
+            except pymysql.Error:
+                discard = True
+
+        discard = discard or not conn.open or self.closed
+
+        with self.condition:
+            if discard:
+                self.size -= 1
+            else:
+                pooled.idle_since = self.clock()
+                self.idle.append(pooled)
+            self.condition.notify()
+
+        if discard:
+            self.close_quietly(conn)
+
+    def healthy(self, pooled: PooledConnection) -> bool:
+        now = self.clock()
+
+        if not pooled.conn.open or now - pooled.created_at >= self.recycle:
+            return False
+
+        if now - pooled.idle_since < self.ping_after:
+            return True
+
+        try:
+            pooled.conn.ping(reconnect=False)
+        except pymysql.Error:
+            return False
+
+        return True
+
+    def close(self) -> None:
+        with self.condition:
+            self.closed = True
+            idle, self.idle = self.idle, []
+            self.size -= len(idle)
+            self.condition.notify_all()
+
+        for pooled in idle:
+            self.close_quietly(pooled.conn)
+
+    @staticmethod
+    def close_quietly(conn: Connection[DictCursor]) -> None:
+        try:
+            conn.close()
+        except pymysql.Error:
+            pass
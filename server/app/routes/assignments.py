@@ -1,12 +1,14 @@
 from datetime import date
-from typing import Optional
+from typing import Annotated, Optional
 
 import pymysql
-from fastapi import APIRouter, Depends, HTTPException
-from pydantic import BaseModel
+from fastapi import APIRouter, Depends, HTTPException, Request, Response
+from pydantic import BaseModel, field_validator
 from pymysql.connections import Connection
 
+from app import etag, grades
 from app.database import get_db
+from app.listing import Page, fetch_list
 
 router = APIRouter()
 
@@ -21,6 +23,11 @@ class AssignmentCreate(BaseModel):
     completed: bool = False
     grade: float = 0.0
 
+    @field_validator("grade")
+    @classmethod
+    def round_grade(cls, grade: float) -> float:
+        return grades.hundredths(grade)
+
 
 class AssignmentResponse(AssignmentCreate):
     pass
@@ -55,30 +62,99 @@ def handle_integrity_error(error: pymysql.IntegrityError):
     )
 
 
-@router.get("/", response_model=list[AssignmentResponse])
-def get_assignments(db: Connection = Depends(get_db)):
-    with db.cursor() as cursor:
-        cursor.execute(
-            "SELECT id, course_id, title, description, category, due_date, "
-            "completed, grade FROM assignments"
-        )
-        return cursor.fetchall()
+def assignments_version(
+    request: Request, response: Response, db: Connection = Depends(get_db)
+):
+    etag.check(
+        request,
+        response,
+        db,
+        "SELECT COUNT(*) AS count, MAX(updated_at) AS updated "
+        "FROM assignments",
+    )
 
 
-@router.get("/by-course/{course_id}", response_model=list[AssignmentResponse])
+def assignments_by_course_version(
+    course_id: str,
+    request: Request,
+    response: Response,
+    db: Connection = Depends(get_db),
+):
+    etag.check(
+        request,
+        response,
+        db,
+        "SELECT COUNT(*) AS count, MAX(updated_at) AS updated "
+        "FROM assignments WHERE course_id = %s",
+        (course_id,),
+    )
+
+
+def assignment_version(
+    assignment_id: str,
+    request: Request,
+    response: Response,
+    db: Connection = Depends(get_db),
+):
+    etag.check(
+        request,
+        response,
+        db,
+        "SELECT updated_at FROM assignments WHERE id = %s",
+        (assignment_id,),
+    )
+
+
+@router.get(
+    "/",
+    response_model=list[AssignmentResponse],
+    dependencies=[Depends(assignments_version)],
+)
+def get_assignments(
+    page: Annotated[Page, Depends()],
+    response: Response,
+    db: Connection = Depends(get_db),
+):
+    return fetch_list(
+        db,
+        "SELECT id, course_id, title, description, category, due_date, "
+        "completed, grade FROM assignments",
+        None,
+        (),
+        page,
+        AssignmentResponse,
+        response,
+    )
+
+
+@router.get(
+    "/by-course/{course_id}",
+    response_model=list[AssignmentResponse],
+    dependencies=[Depends(assignments_by_course_version)],
+)
 def get_assignments_by_course(
-    course_id: str, db: Connection = Depends(get_db)
+    course_id: str,
+    page: Annotated[Page, Depends()],
+    response: Response,
+    db: Connection = Depends(get_db),
 ):
-    with db.cursor() as cursor:
-        cursor.execute(
-            "SELECT id, course_id, title, description, category, due_date, "
-            "completed, grade FROM assignments WHERE course_id = %s",
-            (course_id,),
-        )
-        return cursor.fetchall()
+    return fetch_list(
+        db,
+        "SELECT id, course_id, title, description, category, due_date, "
+        "completed, grade FROM assignments",
+        "course_id = %s",
+        (course_id,),
+        page,
+        AssignmentResponse,
+        response,
+    )
 
 
-@router.get("/{assignment_id}", response_model=AssignmentResponse)
+@router.get(
+    "/{assignment_id}",
+    response_model=AssignmentResponse,
+    dependencies=[Depends(assignment_version)],
+)
 def get_assignment(assignment_id: str, db: Connection = Depends(get_db)):
     with db.cursor() as cursor:
         cursor.execute(
@@ -1,12 +1,14 @@
 from datetime import date
-from typing import Optional
+from typing import Annotated, Optional
 
 import pymysql
-from fastapi import APIRouter, Depends, HTTPException
+from fastapi import APIRouter, Depends, HTTPException, Request, Response
 from pydantic import BaseModel
 from pymysql.connections import Connection
 
+from app import etag, grades
 from app.database import get_db
+from app.listing import Page, fetch_list
 
 router = APIRouter()
 
@@ -26,6 +28,13 @@ class CourseResponse(CourseCreate):
     pass
 
 
+class CourseGradeResponse(BaseModel):
+    course_id: str
+    grade_pct: float
+    letter_grade: str
+    gpa_val: float
+
+
 def handle_integrity_error(error: pymysql.IntegrityError):
     error_code = error.args[0]
     error_message = str(error)
@@ -54,28 +63,120 @@ def handle_integrity_error(error: pymysql.IntegrityError):
     )
 
 
-@router.get("/", response_model=list[CourseResponse])
-def get_courses(db: Connection = Depends(get_db)):
-    with db.cursor() as cursor:
-        cursor.execute(
-            "SELECT id, term_id, title, description, start_date, end_date, "
-            "num_credits, active FROM courses"
-        )
-        return cursor.fetchall()
+def courses_version(
+    request: Request, response: Response, db: Connection = Depends(get_db)
+):
+    etag.check(
+        request,
+        response,
+        db,
+        "SELECT COUNT(*) AS count, MAX(updated_at) AS updated FROM courses",
+    )
 
 
-@router.get("/by-term/{term_id}", response_model=list[CourseResponse])
-def get_courses_by_term(term_id: str, db: Connection = Depends(get_db)):
-    with db.cursor() as cursor:
-        cursor.execute(
-            "SELECT id, term_id, title, description, start_date, end_date, "
-            "num_credits, active FROM courses WHERE term_id = %s",
-            (term_id,),
-        )
-        return cursor.fetchall()
+def courses_by_term_version(
+    term_id: str,
+    request: Request,
+    response: Response,
+    db: Connection = Depends(get_db),
+):
+    etag.check(
+        request,
+        response,
+        db,
+        "SELECT COUNT(*) AS count, MAX(updated_at) AS updated FROM courses "
+        "WHERE term_id = %s",
+        (term_id,),
+    )
+
+
+def course_version(
+    course_id: str,
+    request: Request,
+    response: Response,
+    db: Connection = Depends(get_db),
+):
+    etag.check(
+        request,
+        response,
+        db,
+        "SELECT updated_at FROM courses WHERE id = %s",
+        (course_id,),
+    )
 
 
-@router.get("/{course_id}", response_model=CourseResponse)
+# the course's grade depends only on its assignments, so its tag follows
+# them; selecting from courses leaves a missing course with no tag to match
+def course_grade_version(
+    course_id: str,
+    request: Request,
+    response: Response,
+    db: Connection = Depends(get_db),
+):
+    etag.check(
+        request,
+        response,
+        db,
+        "SELECT "
+        "(SELECT COUNT(*) FROM assignments a WHERE a.course_id = c.id) "
+        "AS assignments, "
+        "(SELECT MAX(a.updated_at) FROM assignments a "
+        "WHERE a.course_id = c.id) AS assignments_updated "
+        "FROM courses c WHERE c.id = %s",
+        (course_id,),
+    )
+
+
+@router.get(
+    "/",
+    response_model=list[CourseResponse],
+    dependencies=[Depends(courses_version)],
+)
+def get_courses(
+    page: Annotated[Page, Depends()],
+    response: Response,
+    db: Connection = Depends(get_db),
+):
+    return fetch_list(
+        db,
+        "SELECT id, term_id, title, description, start_date, end_date, "
+        "num_credits, active FROM courses",
+        None,
+        (),
+        page,
+        CourseResponse,
+        response,
+    )
+
+
+@router.get(
+    "/by-term/{term_id}",
+    response_model=list[CourseResponse],
+    dependencies=[Depends(courses_by_term_version)],
+)
+def get_courses_by_term(
+    term_id: str,
+    page: Annotated[Page, Depends()],
+    response: Response,
+    db: Connection = Depends(get_db),
+):
+    return fetch_list(
+        db,
+        "SELECT id, term_id, title, description, start_date, end_date, "
+        "num_credits, active FROM courses",
+        "term_id = %s",
+        (term_id,),
+        page,
+        CourseResponse,
+        response,
+    )
+
+
+@router.get(
+    "/{course_id}",
+    response_model=CourseResponse,
+    dependencies=[Depends(course_version)],
+)
 def get_course(course_id: str, db: Connection = Depends(get_db)):
     with db.cursor() as cursor:
         cursor.execute(
@@ -91,6 +192,31 @@ def get_course(course_id: str, db: Connection = Depends(get_db)):
     return course
 
 
+@router.get(
+    "/{course_id}/grade",
+    response_model=CourseGradeResponse,
+    dependencies=[Depends(course_grade_version)],
+)
+def get_course_grade(course_id: str, db: Connection = Depends(get_db)):
+    # completed assignments are summed per category in SQL; only the few
+    # weighted category averages are combined here, see app/grades.py
+    with db.cursor() as cursor:
+        cursor.execute(
+            "SELECT c.id AS course_id, c.num_credits, a.category, "
+            "COUNT(a.id) AS count, SUM(a.grade) AS total FROM courses c "
+            "LEFT JOIN assignments a ON a.course_id = c.id AND a.completed "
+            "WHERE c.id = %s GROUP BY c.id, c.num_credits, a.category",
+            (course_id,),
+        )
+        rows = cursor.fetchall()
+
+    if not rows:
+        raise HTTPException(status_code=404, detail="Course not found")
+
+    [(_, grade)] = grades.grade_rows(rows).values()
+    return {"course_id": course_id, **vars(grade)}
+
+
 @router.post("/", response_model=CourseResponse, status_code=201)
 def create_course(course: CourseCreate, db: Connection = Depends(get_db)):
     try:
@@ -1,11 +1,16 @@
 from datetime import date
+from typing import Annotated
 
 import pymysql
-from fastapi import APIRouter, Depends, HTTPException
+from fastapi import APIRouter, Depends, HTTPException, Request, Response
 from pydantic import BaseModel
 from pymysql.connections import Connection
 
+from app import etag, grades
 from app.database import get_db
+from app.listing import Page, fetch_list
+from app.routes.assignments import AssignmentResponse
+from app.routes.courses import CourseResponse
 
 router = APIRouter()
 
@@ -22,6 +27,20 @@ class TermResponse(TermCreate):
     pass
 
 
+class CourseTreeResponse(CourseResponse):
+    assignments: list[AssignmentResponse] = []
+
+
+class TermTreeResponse(TermResponse):
+    courses: list[CourseTreeResponse] = []
+
+
+class TermGpaResponse(BaseModel):
+    term_id: str
+    total_credits: int
+    ovr_gpa: float
+
+
 def handle_integrity_error(error: pymysql.IntegrityError):
     error_code = error.args[0]
     error_message = str(error)
@@ -45,16 +64,84 @@ def handle_integrity_error(error: pymysql.IntegrityError):
     )
 
 
-@router.get("/", response_model=list[TermResponse])
-def get_terms(db: Connection = Depends(get_db)):
-    with db.cursor() as cursor:
-        cursor.execute(
-            "SELECT id, title, start_date, end_date, active FROM terms"
-        )
-        return cursor.fetchall()
+def terms_version(
+    request: Request, response: Response, db: Connection = Depends(get_db)
+):
+    etag.check(
+        request,
+        response,
+        db,
+        "SELECT COUNT(*) AS count, MAX(updated_at) AS updated FROM terms",
+    )
 
 
-@router.get("/{term_id}", response_model=TermResponse)
+def term_version(
+    term_id: str,
+    request: Request,
+    response: Response,
+    db: Connection = Depends(get_db),
+):
+    etag.check(
+        request,
+        response,
+        db,
+        "SELECT updated_at FROM terms WHERE id = %s",
+        (term_id,),
+    )
+
+
+def term_tree_version(
+    term_id: str,
+    request: Request,
+    response: Response,
+    db: Connection = Depends(get_db),
+):
+    # the term's own stamp, then a count and newest stamp per level
+    etag.check(
+        request,
+        response,
+        db,
+        "SELECT t.updated_at, "
+        "(SELECT COUNT(*) FROM courses c WHERE c.term_id = t.id) "
+        "AS courses, "
+        "(SELECT MAX(c.updated_at) FROM courses c WHERE c.term_id = t.id) "
+        "AS courses_updated, "
+        "(SELECT COUNT(*) FROM assignments a JOIN courses c "
+        "ON c.id = a.course_id WHERE c.term_id = t.id) AS assignments, "
+        "(SELECT MAX(a.updated_at) FROM assignments a JOIN courses c "
+        "ON c.id = a.course_id WHERE c.term_id = t.id) "
+        "AS assignments_updated "
+        "FROM terms t WHERE t.id = %s",
+        (term_id,),
+    )
+
+
+@router.get(
+    "/",
+    response_model=list[TermResponse],
+    dependencies=[Depends(terms_version)],
+)
+def get_terms(
+    page: Annotated[Page, Depends()],
+    response: Response,
+    db: Connection = Depends(get_db),
+):
+    return fetch_list(
+        db,
+        "SELECT id, title, start_date, end_date, active FROM terms",
+        None,
+        (),
+        page,
+        TermResponse,
+        response,
+    )
+
+
+@router.get(
+    "/{term_id}",
+    response_model=TermResponse,
+    dependencies=[Depends(term_version)],
+)
 def get_term(term_id: str, db: Connection = Depends(get_db)):
     with db.cursor() as cursor:
         cursor.execute(
@@ -70,6 +157,77 @@ def get_term(term_id: str, db: Connection = Depends(get_db)):
     return term
 
 
+@router.get(
+    "/{term_id}/tree",
+    response_model=TermTreeResponse,
+    dependencies=[Depends(term_tree_version)],
+)
+def get_term_tree(term_id: str, db: Connection = Depends(get_db)):
+    # one query per level rather than one per course, then nest in memory
+    with db.cursor() as cursor:
+        cursor.execute(
+            "SELECT id, title, start_date, end_date, active FROM terms WHERE "
+            "id = %s",
+            (term_id,),
+        )
+        term = cursor.fetchone()
+
+        if not term:
+            raise HTTPException(status_code=404, detail="Term not found")
+
+        cursor.execute(
+            "SELECT id, term_id, title, description, start_date, end_date, "
+            "num_credits, active FROM courses WHERE term_id = %s",
+            (term_id,),
+        )
+        courses = cursor.fetchall()
+
+        cursor.execute(
+            "SELECT a.id, a.course_id, a.title, a.description, a.category, "
+            "a.due_date, a.completed, a.grade FROM assignments a "
+            "JOIN courses c ON c.id = a.course_id WHERE c.term_id = %s",
+            (term_id,),
+        )
+        assignments = cursor.fetchall()
+
+    by_course = {course["id"]: [] for course in courses}
+    for assignment in assignments:
+        by_course[assignment["course_id"]].append(assignment)
+
+    term["courses"] = [
+        {**course, "assignments": by_course[course["id"]]}
+        for course in courses
+    ]
+    return term
+
+
+# credits and grades both come from the tree, so the GPA shares its tag
+@router.get(
+    "/{term_id}/gpa",
+    response_model=TermGpaResponse,
+    dependencies=[Depends(term_tree_version)],
+)
+def get_term_gpa(term_id: str, db: Connection = Depends(get_db)):
+    # one row per course and category with completed assignments, plus one
+    # per course without any, rather than every assignment in the term
+    with db.cursor() as cursor:
+        cursor.execute(
+            "SELECT c.id AS course_id, c.num_credits, a.category, "
+            "COUNT(a.id) AS count, SUM(a.grade) AS total FROM terms t "
+            "LEFT JOIN courses c ON c.term_id = t.id "
+            "LEFT JOIN assignments a ON a.course_id = c.id AND a.completed "
+            "WHERE t.id = %s GROUP BY c.id, c.num_credits, a.category",
+            (term_id,),
+        )
+        rows = cursor.fetchall()
+
+    if not rows:
+        raise HTTPException(status_code=404, detail="Term not found")
+
+    gpa = grades.grade_term(grades.grade_rows(rows).values())
+    return {"term_id": term_id, **vars(gpa)}
+
+
 @router.post("/", response_model=TermResponse, status_code=201)
 def create_term(term: TermCreate, db: Connection = Depends(get_db)):
     try:
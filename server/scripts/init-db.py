@@ -1,9 +1,14 @@
 import os
+import sys
 from pathlib import Path
 
 import pymysql
 from dotenv import load_dotenv
 
+sys.path.insert(0, str(Path(__file__).parent.parent))
+
+from app import grades  # noqa: E402
+
 load_dotenv(Path(__file__).parent.parent / ".env")
 
 conn = pymysql.connect(
@@ -19,6 +24,57 @@ schemas = [
 ]
 
 
+def add_updated_at(
+    cursor: pymysql.cursors.Cursor,
+    table: str,
+    index: str | None = None,
+    parent: str | None = None,
+) -> None:
+    # brings a table created before the GET routes sent ETags up to date;
+    # existing rows are stamped with the time of the upgrade
+    cursor.execute(f"SHOW COLUMNS FROM `{table}` LIKE 'updated_at'")
+    if cursor.fetchone() is not None:
+        return
+
+    cursor.execute(
+        f"ALTER TABLE `{table}` ADD COLUMN updated_at TIMESTAMP(6) NOT NULL "
+        "DEFAULT CURRENT_TIMESTAMP(6) ON UPDATE CURRENT_TIMESTAMP(6)"
+    )
+    if index is not None:
+        cursor.execute(
+            f"ALTER TABLE `{table}` ADD INDEX {index} ({parent}, updated_at)"
+        )
+
+
+def add_index(
+    cursor: pymysql.cursors.Cursor, table: str, index: str, columns: str
+) -> None:
+    # adds an index introduced after the table was first created
+    cursor.execute(f"SHOW INDEX FROM `{table}` WHERE Key_name = %s", (index,))
+    if cursor.fetchone() is not None:
+        return
+
+    cursor.execute(f"ALTER TABLE `{table}` ADD INDEX {index} ({columns})")
+
+
+def normalize_grades(cursor: pymysql.cursors.Cursor) -> None:
+    # rounds grades stored before the routes did so to hundredths, the way
+    # Assignment holds them, so the grade routes' SQL sums match the client;
+    # rows already rounded are left alone, so running it again changes
+    # nothing, and a changed row's updated_at moves so its ETag does too
+    cursor.execute("SELECT id, grade FROM assignments")
+    updates = []
+    for assignment_id, grade in cursor.fetchall():
+        rounded = grades.hundredths(grade)
+        if rounded != grade:
+            updates.append((rounded, assignment_id))
+
+    if updates:
+        cursor.executemany(
+            "UPDATE assignments SET grade = %s WHERE id = %s", updates
+        )
+
+
 def init_schema(cursor: pymysql.cursors.Cursor, schema: str) -> None:
     cursor.execute(f"CREATE DATABASE IF NOT EXISTS `{schema}`")
     cursor.execute(f"USE `{schema}`")
@@ -28,7 +84,9 @@ def init_schema(cursor: pymysql.cursors.Cursor, schema: str) -> None:
             title       VARCHAR(255)    NOT NULL UNIQUE,
             start_date  DATE            NOT NULL,
             end_date    DATE            NOT NULL,
-            active      BOOLEAN         NOT NULL DEFAULT TRUE
+            active      BOOLEAN         NOT NULL DEFAULT TRUE,
+            updated_at  TIMESTAMP(6)    NOT NULL
+                DEFAULT CURRENT_TIMESTAMP(6) ON UPDATE CURRENT_TIMESTAMP(6)
         )
     """)
     cursor.execute("""
@@ -41,7 +99,10 @@ def init_schema(cursor: pymysql.cursors.Cursor, schema: str) -> None:
             end_date      DATE            NOT NULL,
             num_credits   INT             NOT NULL DEFAULT 3,
             active        BOOLEAN         NOT NULL DEFAULT TRUE,
+            updated_at    TIMESTAMP(6)    NOT NULL
+                DEFAULT CURRENT_TIMESTAMP(6) ON UPDATE CURRENT_TIMESTAMP(6),
             UNIQUE (term_id, title),
+            INDEX term_updated (term_id, updated_at),
             FOREIGN KEY (term_id) REFERENCES terms(id) ON DELETE CASCADE
         )
     """)
@@ -55,11 +116,27 @@ def init_schema(cursor: pymysql.cursors.Cursor, schema: str) -> None:
             due_date    DATE            NOT NULL,
             completed   BOOLEAN         NOT NULL DEFAULT FALSE,
             grade       FLOAT           NOT NULL DEFAULT 0.0,
+            updated_at  TIMESTAMP(6)    NOT NULL
+                DEFAULT CURRENT_TIMESTAMP(6) ON UPDATE CURRENT_TIMESTAMP(6),
             UNIQUE (course_id, title),
+            INDEX course_updated (course_id, updated_at),
+            INDEX course_graded (course_id, completed, category, grade),
             FOREIGN KEY (course_id) REFERENCES courses(id) ON DELETE CASCADE
         )
     """)
 
+    add_updated_at(cursor, "terms")
+    add_updated_at(cursor, "courses", "term_updated", "term_id")
+    add_updated_at(cursor, "assignments", "course_updated", "course_id")
+    # covers the grade routes' per-category SUM, so it never reads the rows
+    add_index(
+        cursor,
+        "assignments",
+        "course_graded",
+        "course_id, completed, category, grade",
+    )
+    normalize_grades(cursor)
+
 
 with conn.cursor() as cursor:
     for schema in schemas:
@@ -0,0 +1,103 @@
+"""Compare per-request connections against the connection pool.
+
+Runs --requests point lookups from --workers threads, first opening and
+closing a connection for each one (the old get_db) and then borrowing one
+from the pool, and prints p50/p99 latency for both. Uses the same .env
+settings as the server; any MySQL will do, e.g.
+
+    docker run -d -p 3306:3306 -e MYSQL_ROOT_PASSWORD=pw mysql:8
+    uv run python scripts/init-db.py
+    uv run python scripts/load-test-db.py --workers 16
+"""
+
+import argparse
+import statistics
+import sys
+import time
+from collections.abc import Callable
+from concurrent.futures import ThreadPoolExecutor
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).parent.parent))
+
+from app.database import connect  # noqa: E402
+from app.pool import ConnectionPool  # noqa: E402
+
+QUERY = (
+    "SELECT id, title, start_date, end_date, active FROM terms WHERE id = %s"
+)
+
+
+def lookup(conn) -> None:
+    with conn.cursor() as cursor:
+        cursor.execute(QUERY, ("00000000-0000-0000-0000-000000000000",))
+        cursor.fetchone()
+
+
+def per_request() -> None:
+    conn = connect()
+    try:
+        lookup(conn)
+    finally:
+        conn.close()
+
+
+def pooled(pool: ConnectionPool) -> Callable[[], None]:
+    def request() -> None:
+        conn = pool.acquire()
+        try:
+            lookup(conn)
+        finally:
+            pool.release(conn)
+
+    return request
+
+
+def run(request: Callable[[], None], requests: int, workers: int) -> dict:
+    def timed(_: int) -> float:
+        start = time.perf_counter()
+        request()
+        return (time.perf_counter() - start) * 1000.0
+
+    start = time.perf_counter()
+
+    with ThreadPoolExecutor(max_workers=workers) as executor:
+        latencies = sorted(executor.map(timed, range(requests)))
+
+    elapsed = time.perf_counter() - start
+    cuts = statistics.quantiles(latencies, n=100)
+
+    return {
+        "p50_ms": cuts[49],
+        "p99_ms": cuts[98],
+        "requests_per_sec": requests / elapsed,
+    }
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--requests", type=int, default=5000)
+    parser.add_argument("--workers", type=int, default=8)
+    parser.add_argument("--pool-size", type=int, default=10)
+    args = parser.parse_args()
+
+    pool = ConnectionPool(connect, max_size=args.pool_size)
+
+    try:
+        for name, request in (
+            ("per-request", per_request),
+            ("pooled", pooled(pool)),
+        ):
+            request()  # fail fast on a bad .env before timing anything
+            result = run(request, args.requests, args.workers)
+            print(
+                f"{name:>11}: p50 {result['p50_ms']:7.2f} ms  "
+                f"p99 {result['p99_ms']:7.2f} ms  "
+                f"{result['requests_per_sec']:9.1f} req/s"
+            )
+    finally:
+        pool.close()
+
+
+if __name__ == "__main__":
+    main()
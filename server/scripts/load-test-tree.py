@@ -0,0 +1,173 @@
+"""Compare hydrating a term through /terms/{id}/tree against the per-resource
+routes on a running server.
+
+Seeds one term with --courses courses of --assignments assignments each,
+hydrates it --rounds times from --workers threads both ways, prints latency
+percentiles and request counts, then deletes the term again.
+
+    uv run python scripts/load-test-tree.py --base-url http://localhost:8000
+"""
+
+import argparse
+import http.client
+import json
+import statistics
+import time
+import uuid
+from concurrent.futures import ThreadPoolExecutor
+from urllib.parse import urlsplit
+
+
+class Client:
+    """One keep-alive connection, as the C++ client holds."""
+
+    def __init__(self, base_url: str) -> None:
+        parts = urlsplit(base_url)
+        self.conn = http.client.HTTPConnection(parts.hostname, parts.port)
+        self.requests = 0
+
+    def send(self, method: str, path: str, body: object = None) -> object:
+        payload = None if body is None else json.dumps(body)
+        headers = {"Content-Type": "application/json"} if payload else {}
+        self.conn.request(method, path, body=payload, headers=headers)
+        response = self.conn.getresponse()
+        data = response.read()
+        self.requests += 1
+
+        if response.status >= 400:
+            raise RuntimeError(f"{method} {path}: HTTP {response.status}")
+
+        return json.loads(data) if data else None
+
+
+def seed(client: Client, courses: int, assignments: int) -> str:
+    term_id = str(uuid.uuid4())
+    client.send(
+        "POST",
+        "/terms/",
+        {
+            "id": term_id,
+            "title": f"Load test {term_id[:8]}",
+            "start_date": "2026-01-02",
+            "end_date": "2026-05-24",
+        },
+    )
+
+    for c in range(courses):
+        course_id = str(uuid.uuid4())
+        client.send(
+            "POST",
+            "/courses/",
+            {
+                "id": course_id,
+                "term_id": term_id,
+                "title": f"Course {c}",
+                "start_date": "2026-01-02",
+                "end_date": "2026-05-12",
+            },
+        )
+
+        for a in range(assignments):
+            client.send(
+                "POST",
+                "/assignments/",
+                {
+                    "id": str(uuid.uuid4()),
+                    "course_id": course_id,
+                    "title": f"Assignment {a}",
+                    "category": "Homework",
+                    "due_date": "2026-02-01",
+                    "grade": 90.0,
+                },
+            )
+
+    return term_id
+
+
+def hydrate_per_resource(client: Client, term_id: str) -> int:
+    client.send("GET", f"/terms/{term_id}")
+    courses = client.send("GET", f"/courses/by-term/{term_id}")
+    count = 0
+
+    for course in courses:
+        count += len(
+            client.send("GET", f"/assignments/by-course/{course['id']}")
+        )
+
+    return count
+
+
+def hydrate_tree(client: Client, term_id: str) -> int:
+    tree = client.send("GET", f"/terms/{term_id}/tree")
+    return sum(len(course["assignments"]) for course in tree["courses"])
+
+
+def run(base_url: str, term_id: str, hydrate, rounds: int, workers: int):
+    def worker(share: int) -> tuple[list[float], int]:
+        client = Client(base_url)
+        latencies = []
+
+        for _ in range(share):
+            start = time.perf_counter()
+            hydrate(client, term_id)
+            latencies.append((time.perf_counter() - start) * 1000.0)
+
+        return latencies, client.requests
+
+    shares = [
+        rounds // workers + (i < rounds % workers) for i in range(workers)
+    ]
+    start = time.perf_counter()
+
+    with ThreadPoolExecutor(max_workers=workers) as pool:
+        results = list(pool.map(worker, shares))
+
+    elapsed = time.perf_counter() - start
+    latencies = sorted(ms for result in results for ms in result[0])
+    requests = sum(result[1] for result in results)
+    cuts = statistics.quantiles(latencies, n=100)
+
+    return {
+        "p50_ms": cuts[49],
+        "p99_ms": cuts[98],
+        "requests_per_hydrate": requests / rounds,
+        "hydrates_per_sec": rounds / elapsed,
+    }
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--base-url", default="http://localhost:8000")
+    parser.add_argument("--courses", type=int, default=8)
+    parser.add_argument("--assignments", type=int, default=20)
+    parser.add_argument("--rounds", type=int, default=500)
+    parser.add_argument("--workers", type=int, default=8)
+    args = parser.parse_args()
+
+    setup = Client(args.base_url)
+    term_id = seed(setup, args.courses, args.assignments)
+
+    try:
+        expected = args.courses * args.assignments
+        for name, hydrate in (
+            ("per-resource", hydrate_per_resource),
+            ("tree", hydrate_tree),
+        ):
+            if hydrate(setup, term_id) != expected:
+                raise RuntimeError(f"{name} returned an incomplete term")
+
+            result = run(
+                args.base_url, term_id, hydrate, args.rounds, args.workers
+            )
+            print(
+                f"{name:>12}: p50 {result['p50_ms']:7.2f} ms  "
+                f"p99 {result['p99_ms']:7.2f} ms  "
+                f"{result['requests_per_hydrate']:5.1f} req/hydrate  "
+                f"{result['hydrates_per_sec']:8.1f} hydrate/s"
+            )
+    finally:
+        setup.send("DELETE", f"/terms/{term_id}")
+
+
+if __name__ == "__main__":
+    main()
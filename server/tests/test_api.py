@@ -0,0 +1,372 @@
+"""HTTP-level tests of the REST routes, run against whatever server
+API_BASE_URL points at: the FastAPI app under uvicorn, or the client's
+CourseCompanion_daemon. Skipped when API_BASE_URL is not set.
+
+Every record is created with fresh UUIDs and titles and deleted again,
+so the tests can share a server that already holds data.
+"""
+
+from __future__ import annotations
+
+import json
+import os
+import struct
+import urllib.error
+import urllib.request
+import uuid
+from pathlib import Path
+from typing import Any, Generator
+
+import pytest
+
+BASE_URL = os.getenv("API_BASE_URL", "").rstrip("/")
+
+pytestmark = pytest.mark.skipif(not BASE_URL, reason="API_BASE_URL not set")
+
+GOLDEN = (
+    Path(__file__).parents[2] / "client" / "tests" / "golden" / "grades.json"
+)
+
+
+def call(
+    method: str, path: str, body: dict[str, Any] | None = None
+) -> tuple[int, Any]:
+    data = None if body is None else json.dumps(body).encode()
+    request = urllib.request.Request(
+        BASE_URL + path,
+        data=data,
+        method=method,
+        headers={"Content-Type": "application/json"},
+    )
+
+    try:
+        with urllib.request.urlopen(request) as response:
+            raw = response.read()
+            return response.status, json.loads(raw) if raw else None
+    except urllib.error.HTTPError as error:
+        raw = error.read()
+        return error.code, json.loads(raw) if raw else None
+
+
+def get_tagged(path: str, tag: str | None = None) -> tuple[int, str, bytes]:
+    headers = {} if tag is None else {"If-None-Match": tag}
+    request = urllib.request.Request(BASE_URL + path, headers=headers)
+
+    try:
+        with urllib.request.urlopen(request) as response:
+            return response.status, response.headers["ETag"], response.read()
+    except urllib.error.HTTPError as error:
+        return error.code, error.headers["ETag"], error.read()
+
+
+def new_id() -> str:
+    return str(uuid.uuid4())
+
+
+def as_float(value: float) -> float:
+    # grades are C++ floats on both servers; compare them as floats
+    return struct.unpack("f", struct.pack("f", value))[0]
+
+
+@pytest.fixture
+def term() -> Generator[dict[str, Any], None, None]:
+    record = {
+        "id": new_id(),
+        "title": f"Term {new_id()}",
+        "start_date": "2025-08-12",
+        "end_date": "2025-12-05",
+        "active": False,
+    }
+    status, _ = call("POST", "/terms/", record)
+    assert status == 201
+
+    yield record
+    call("DELETE", f"/terms/{record['id']}")
+
+
+@pytest.fixture
+def course(term: dict[str, Any]) -> dict[str, Any]:
+    record = {
+        "id": new_id(),
+        "term_id": term["id"],
+        "title": "CMPE 142",
+        "description": "Operating Systems",
+        "start_date": "2025-08-12",
+        "end_date": "2025-12-05",
+        "num_credits": 3,
+        "active": False,
+    }
+    status, _ = call("POST", "/courses/", record)
+    assert status == 201
+    return record
+
+
+@pytest.fixture
+def assignment(course: dict[str, Any]) -> dict[str, Any]:
+    record = {
+        "id": new_id(),
+        "course_id": course["id"],
+        "title": "Homework 1",
+        "description": None,
+        "category": "Homework",
+        "due_date": "2025-09-01",
+        "completed": True,
+        "grade": 91.5,
+    }
+    status, _ = call("POST", "/assignments/", record)
+    assert status == 201
+    return record
+
+
+# ====================================
+# TERM TESTS
+# ====================================
+
+
+def test_term_reads_back(term: dict[str, Any]) -> None:
+    status, body = call("GET", f"/terms/{term['id']}")
+
+    assert status == 200
+    assert body == term
+    assert term in call("GET", "/terms/")[1]
+
+
+def test_duplicate_term_is_conflict(term: dict[str, Any]) -> None:
+    same_title = {**term, "id": new_id()}
+
+    assert call("POST", "/terms/", term) == (
+        409,
+        {"detail": "A term with this ID already exists"},
+    )
+    assert call("POST", "/terms/", same_title) == (
+        409,
+        {"detail": "A term with this title already exists"},
+    )
+
+
+def test_update_term(term: dict[str, Any]) -> None:
+    updated = {**term, "end_date": "2025-12-20", "active": True}
+
+    assert call("PUT", f"/terms/{term['id']}", updated) == (200, updated)
+    assert call("GET", f"/terms/{term['id']}")[1] == updated
+
+
+def test_unknown_term_is_not_found() -> None:
+    missing = new_id()
+
+    assert call("GET", f"/terms/{missing}") == (
+        404,
+        {"detail": "Term not found"},
+    )
+    assert call("DELETE", f"/terms/{missing}")[0] == 404
+
+
+def test_tree_nests_courses_and_assignments(
+    term: dict[str, Any],
+    course: dict[str, Any],
+    assignment: dict[str, Any],
+) -> None:
+    status, body = call("GET", f"/terms/{term['id']}/tree")
+
+    assert status == 200
+    assert body == {
+        **term,
+        "courses": [{**course, "assignments": [assignment]}],
+    }
+
+
+def test_unchanged_term_is_not_modified(term: dict[str, Any]) -> None:
+    path = f"/terms/{term['id']}"
+    status, tag, _ = get_tagged(path)
+
+    assert status == 200
+    assert tag
+    assert get_tagged(path, tag) == (304, tag, b"")
+    assert get_tagged(path, f'W/{tag}, "other"')[0] == 304
+
+    call("PUT", path, {**term, "active": True})
+    assert get_tagged(path, tag)[0] == 200
+
+
+def test_tree_tag_follows_its_assignments(
+    term: dict[str, Any], assignment: dict[str, Any]
+) -> None:
+    path = f"/terms/{term['id']}/tree"
+    _, tag, _ = get_tagged(path)
+
+    assert get_tagged(path, tag)[0] == 304
+
+    call("PUT", f"/assignments/{assignment['id']}", {**assignment, "grade": 0})
+    status, changed, body = get_tagged(path, tag)
+
+    assert status == 200
+    assert changed != tag
+    assert b'"grade":0' in body
+
+
+# ====================================
+# COURSE AND ASSIGNMENT TESTS
+# ====================================
+
+
+def test_course_needs_existing_term() -> None:
+    orphan = {
+        "id": new_id(),
+        "term_id": new_id(),
+        "title": "CMPE 142",
+        "start_date": "2025-08-12",
+        "end_date": "2025-12-05",
+    }
+
+    assert call("POST", "/courses/", orphan) == (
+        400,
+        {"detail": "Invalid term_id"},
+    )
+
+
+def test_course_title_is_unique_per_term(course: dict[str, Any]) -> None:
+    same_title = {**course, "id": new_id()}
+
+    assert call("POST", "/courses/", same_title) == (
+        409,
+        {"detail": "A course with this title already exists in this term"},
+    )
+    assert call("GET", f"/courses/by-term/{course['term_id']}")[1] == [course]
+
+
+def test_assignment_routes(assignment: dict[str, Any]) -> None:
+    graded = {**assignment, "grade": 80.0}
+    path = f"/assignments/{assignment['id']}"
+
+    assert call("GET", path) == (200, assignment)
+    assert call("PUT", path, graded) == (200, graded)
+    listed = call("GET", f"/assignments/by-course/{assignment['course_id']}")
+    assert listed == (200, [graded])
+    assert call("DELETE", path) == (204, None)
+    assert call("GET", path) == (404, {"detail": "Assignment not found"})
+
+
+def test_list_tag_follows_deletes(
+    course: dict[str, Any], assignment: dict[str, Any]
+) -> None:
+    path = f"/assignments/by-course/{course['id']}"
+    _, tag, _ = get_tagged(path)
+
+    assert get_tagged(path, tag)[0] == 304
+
+    call("DELETE", f"/assignments/{assignment['id']}")
+    status, changed, body = get_tagged(path, tag)
+
+    assert (status, body) == (200, b"[]")
+    assert changed != tag
+
+
+def test_list_pages_follow_ids(course: dict[str, Any]) -> None:
+    others = [
+        {**course, "id": new_id(), "title": f"CMPE {number}"}
+        for number in (148, 152)
+    ]
+    for other in others:
+        assert call("POST", "/courses/", other)[0] == 201
+
+    path = f"/courses/by-term/{course['term_id']}"
+    ordered = sorted([course, *others], key=lambda record: record["id"])
+    first = call("GET", f"{path}?limit=2")
+    rest = call("GET", f"{path}?after={ordered[1]['id']}&limit=2")
+
+    assert first == (200, ordered[:2])
+    assert rest == (200, ordered[2:])
+    assert call("GET", f"{path}?limit=0")[0] == 422
+
+
+def test_ndjson_list_has_one_record_per_line(course: dict[str, Any]) -> None:
+    status, _, body = get_tagged(
+        f"/courses/by-term/{course['term_id']}?format=ndjson"
+    )
+    lines = body.decode().splitlines()
+
+    assert status == 200
+    assert [json.loads(line) for line in lines] == [course]
+
+
+def test_deleting_term_deletes_what_it_holds(
+    term: dict[str, Any], course: dict[str, Any], assignment: dict[str, Any]
+) -> None:
+    assert call("DELETE", f"/terms/{term['id']}") == (204, None)
+
+    assert call("GET", f"/courses/{course['id']}")[0] == 404
+    assert call("GET", f"/assignments/{assignment['id']}")[0] == 404
+
+
+@pytest.fixture
+def golden() -> Generator[dict[str, list[dict[str, Any]]], None, None]:
+    # the shared golden tree under fresh ids, posted through the routes
+    tree = json.loads(GOLDEN.read_text())
+    ids = {
+        record["id"]: new_id()
+        for kind in ("terms", "courses", "assignments")
+        for record in tree[kind]
+    }
+    for kind in ("terms", "courses", "assignments"):
+        for record in tree[kind]:
+            for key in ("id", "term_id", "course_id"):
+                if key in record:
+                    record[key] = ids[record[key]]
+            if kind == "terms":
+                record["title"] = f"{record['title']} {record['id']}"
+
+            body = {
+                key: value
+                for key, value in record.items()
+                if not key.startswith("expected_")
+            }
+            assert call("POST", f"/{kind}/", body)[0] == 201
+
+    yield tree
+    for term in tree["terms"]:
+        call("DELETE", f"/terms/{term['id']}")
+
+
+# ====================================
+# GRADE TESTS
+# ====================================
+
+
+def test_golden_grades_match(golden: dict[str, list[dict[str, Any]]]) -> None:
+    for course in golden["courses"]:
+        status, grade = call("GET", f"/courses/{course['id']}/grade")
+
+        assert status == 200
+        assert as_float(grade["grade_pct"]) == as_float(
+            course["expected_grade_pct"]
+        )
+        assert grade["letter_grade"] == course["expected_letter_grade"]
+        assert as_float(grade["gpa_val"]) == as_float(
+            course["expected_gpa_val"]
+        )
+
+    for term in golden["terms"]:
+        status, gpa = call("GET", f"/terms/{term['id']}/gpa")
+
+        assert status == 200
+        assert gpa["total_credits"] == term["expected_total_credits"]
+        assert as_float(gpa["ovr_gpa"]) == as_float(term["expected_ovr_gpa"])
+
+
+def test_grade_follows_its_assignments(
+    course: dict[str, Any], assignment: dict[str, Any]
+) -> None:
+    path = f"/courses/{course['id']}/grade"
+    _, tag, _ = get_tagged(path)
+
+    assert call("GET", path)[1]["grade_pct"] == 91.5
+    assert get_tagged(path, tag)[0] == 304
+
+    call(
+        "PUT", f"/assignments/{assignment['id']}", {**assignment, "grade": 77}
+    )
+    status, gpa = call("GET", f"/terms/{course['term_id']}/gpa")
+
+    assert call("GET", path)[1]["letter_grade"] == "C+"
+    assert (status, gpa["ovr_gpa"]) == (200, 2.3)
+    assert call("GET", f"/terms/{new_id()}/gpa")[0] == 404
@@ -0,0 +1,150 @@
+from __future__ import annotations
+
+import uuid
+from collections.abc import Callable
+
+import pytest
+from fastapi import HTTPException, Request, Response
+from pymysql.connections import Connection
+from pymysql.cursors import DictCursor
+
+from app.etag import entity_tag, matches
+from app.routes.courses import course_grade_version, courses_by_term_version
+from app.routes.terms import term_tree_version, term_version
+
+
+def get_request(path: str, if_none_match: str | None = None) -> Request:
+    headers = []
+    if if_none_match is not None:
+        headers.append((b"if-none-match", if_none_match.encode()))
+
+    return Request(
+        {"type": "http", "method": "GET", "path": path, "headers": headers}
+    )
+
+
+def tag_of(
+    version: Callable[..., None], key: str, db: Connection[DictCursor]
+) -> str | None:
+    response = Response()
+    version(key, get_request("/"), response, db)
+    return response.headers.get("etag")
+
+
+def insert_course(db: Connection[DictCursor], term_id: str, title: str) -> str:
+    course_id = str(uuid.uuid4())
+    with db.cursor() as cursor:
+        cursor.execute(
+            "INSERT INTO courses (id, term_id, title, start_date, end_date) "
+            "VALUES (%s, %s, %s, %s, %s)",
+            (course_id, term_id, title, "2025-08-12", "2025-12-05"),
+        )
+    return course_id
+
+
+# ====================================
+# SMOKE TESTS
+# ====================================
+
+
+def test_matches_listed_tag() -> None:
+    tag = entity_tag("/terms/", 2, None)
+
+    assert matches(tag, tag)
+    assert matches(f'"other", W/{tag}', tag)
+    assert matches("*", tag)
+    assert not matches('"other"', tag)
+    assert not matches(None, tag)
+
+
+def test_tag_depends_on_every_part() -> None:
+    assert entity_tag("/terms/", 2, None) == entity_tag("/terms/", 2, None)
+    assert entity_tag("/terms/", 2, None) != entity_tag("/terms/", 3, None)
+    assert entity_tag("/a", 1) != entity_tag("/b", 1)
+
+
+def test_term_tag_changes_on_update(
+    db: Connection[DictCursor], parent_term: dict[str, object]
+) -> None:
+    term_id = str(parent_term["id"])
+    before = tag_of(term_version, term_id, db)
+
+    with db.cursor() as cursor:
+        cursor.execute(
+            "UPDATE terms SET active = TRUE WHERE id = %s", (term_id,)
+        )
+
+    assert before is not None
+    assert tag_of(term_version, term_id, db) != before
+
+
+def test_matching_tag_is_not_modified(
+    db: Connection[DictCursor], parent_term: dict[str, object]
+) -> None:
+    term_id = str(parent_term["id"])
+    tag = tag_of(term_version, term_id, db)
+
+    with pytest.raises(HTTPException) as error:
+        term_version(term_id, get_request("/", tag), Response(), db)
+
+    assert error.value.status_code == 304
+    assert error.value.headers == {"ETag": tag}
+
+
+# ====================================
+# EDGE CASES
+# ====================================
+
+
+def test_missing_row_is_not_tagged(db: Connection[DictCursor]) -> None:
+    assert tag_of(term_version, str(uuid.uuid4()), db) is None
+
+
+def test_list_tag_follows_inserts_and_deletes(
+    db: Connection[DictCursor], parent_term: dict[str, object]
+) -> None:
+    term_id = str(parent_term["id"])
+    empty = tag_of(courses_by_term_version, term_id, db)
+    course_id = insert_course(db, term_id, "CMPE 142")
+    one = tag_of(courses_by_term_version, term_id, db)
+
+    with db.cursor() as cursor:
+        cursor.execute("DELETE FROM courses WHERE id = %s", (course_id,))
+
+    assert len({empty, one}) == 2
+    assert tag_of(courses_by_term_version, term_id, db) == empty
+
+
+def test_tree_tag_follows_assignments(
+    db: Connection[DictCursor], parent_course: dict[str, object]
+) -> None:
+    term_id = str(parent_course["term_id"])
+    before = tag_of(term_tree_version, term_id, db)
+
+    with db.cursor() as cursor:
+        cursor.execute(
+            "INSERT INTO assignments (id, course_id, title, category, "
+            "due_date) VALUES (%s, %s, %s, %s, %s)",
+            (
+                str(uuid.uuid4()),
+                parent_course["id"],
+                "Homework 1",
+                "Homework",
+                "2025-11-20",
+            ),
+        )
+
+    assert tag_of(term_tree_version, term_id, db) != before
+
+
+def test_grade_tag_is_dropped_with_its_course(
+    db: Connection[DictCursor], parent_term: dict[str, object]
+) -> None:
+    course_id = insert_course(db, str(parent_term["id"]), "CMPE 142")
+    empty = tag_of(course_grade_version, course_id, db)
+
+    with db.cursor() as cursor:
+        cursor.execute("DELETE FROM courses WHERE id = %s", (course_id,))
+
+    assert empty is not None
+    assert tag_of(course_grade_version, course_id, db) is None
@@ -0,0 +1,160 @@
+from __future__ import annotations
+
+import json
+from pathlib import Path
+from typing import Any
+
+import pytest
+from fastapi import HTTPException
+from pymysql.connections import Connection
+from pymysql.cursors import DictCursor
+
+from app.grades import f32, float_round, grade_course, hundredths, shortest
+from app.routes.assignments import AssignmentCreate
+from app.routes.courses import get_course_grade
+from app.routes.terms import get_term_gpa
+
+# shared with the client's GradeGoldenTests: a term tree whose terms and
+# courses carry the grades Course and Term compute for them
+GOLDEN = (
+    Path(__file__).parents[2] / "client" / "tests" / "golden" / "grades.json"
+)
+
+
+@pytest.fixture(scope="module")
+def golden() -> dict[str, list[dict[str, Any]]]:
+    return json.loads(GOLDEN.read_text())
+
+
+@pytest.fixture
+def golden_tree(
+    db: Connection[DictCursor], golden: dict[str, list[dict[str, Any]]]
+) -> dict[str, list[dict[str, Any]]]:
+    # titles are made unique so the tree can sit beside other data; grades
+    # go through AssignmentCreate to be stored as the routes store them
+    with db.cursor() as cursor:
+        for term in golden["terms"]:
+            cursor.execute(
+                "INSERT INTO terms (id, title, start_date, end_date) "
+                "VALUES (%s, %s, %s, %s)",
+                (
+                    term["id"],
+                    f"{term['title']} {term['id']} golden",
+                    term["start_date"],
+                    term["end_date"],
+                ),
+            )
+        for course in golden["courses"]:
+            cursor.execute(
+                "INSERT INTO courses (id, term_id, title, start_date, "
+                "end_date, num_credits) VALUES (%s, %s, %s, %s, %s, %s)",
+                (
+                    course["id"],
+                    course["term_id"],
+                    course["title"],
+                    course["start_date"],
+                    course["end_date"],
+                    course["num_credits"],
+                ),
+            )
+        for record in golden["assignments"]:
+            assignment = AssignmentCreate(**record)
+            cursor.execute(
+                "INSERT INTO assignments (id, course_id, title, category, "
+                "due_date, completed, grade) VALUES (%s, %s, %s, %s, %s, "
+                "%s, %s)",
+                (
+                    assignment.id,
+                    assignment.course_id,
+                    assignment.title,
+                    assignment.category,
+                    assignment.due_date,
+                    assignment.completed,
+                    assignment.grade,
+                ),
+            )
+    return golden
+
+
+# ====================================
+# SMOKE TESTS
+# ====================================
+
+
+def test_float_round_rounds_in_float() -> None:
+    # 89.995 is held a little above itself as a float, and scaling that by
+    # 100 in float lands on 8999.5 exactly, which rounds away from zero
+    assert float_round(f32(89.995)) == f32(90.0)
+    assert float_round(f32(89.99)) == f32(89.99)
+    assert float_round(f32(33.333332)) == f32(33.33)
+
+
+def test_hundredths_are_shortest_floats() -> None:
+    assert hundredths(77.226) == 77.23
+    assert hundredths(91.5) == 91.5
+    assert shortest(f32(88.66)) == 88.66
+
+
+def test_course_grade_redistributes_weights() -> None:
+    grade = grade_course(
+        [
+            {"category": "Midterm", "count": 1, "total": f32(72.6)},
+            {"category": "Final Exam", "count": 1, "total": f32(68.15)},
+        ]
+    )
+
+    assert (grade.grade_pct, grade.letter_grade, grade.gpa_val) == (
+        70.23,
+        "C-",
+        1.7,
+    )
+
+
+def test_golden_courses_match(
+    db: Connection[DictCursor], golden_tree: dict[str, list[dict[str, Any]]]
+) -> None:
+    for course in golden_tree["courses"]:
+        grade = get_course_grade(course["id"], db)
+
+        assert f32(grade["grade_pct"]) == f32(course["expected_grade_pct"])
+        assert grade["letter_grade"] == course["expected_letter_grade"]
+        assert f32(grade["gpa_val"]) == f32(course["expected_gpa_val"])
+
+
+def test_golden_terms_match(
+    db: Connection[DictCursor], golden_tree: dict[str, list[dict[str, Any]]]
+) -> None:
+    for term in golden_tree["terms"]:
+        gpa = get_term_gpa(term["id"], db)
+
+        assert gpa["total_credits"] == term["expected_total_credits"]
+        assert f32(gpa["ovr_gpa"]) == f32(term["expected_ovr_gpa"])
+
+
+# ====================================
+# EDGE CASES
+# ====================================
+
+
+def test_course_without_completed_work_is_not_graded() -> None:
+    grade = grade_course(
+        [{"category": None, "count": 0, "total": None}],
+    )
+
+    assert (grade.grade_pct, grade.letter_grade, grade.gpa_val) == (
+        0.0,
+        "N/A",
+        0.0,
+    )
+
+
+def test_unknown_course_and_term_are_not_found(
+    db: Connection[DictCursor],
+) -> None:
+    with pytest.raises(HTTPException) as course:
+        get_course_grade("missing", db)
+    with pytest.raises(HTTPException) as term:
+        get_term_gpa("missing", db)
+
+    assert course.value.status_code == 404
+    assert term.value.status_code == 404
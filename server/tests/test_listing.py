@@ -0,0 +1,111 @@
+from __future__ import annotations
+
+import asyncio
+import json
+import uuid
+
+import pytest
+from fastapi import Response
+from fastapi.responses import StreamingResponse
+from pymysql.connections import Connection
+from pymysql.cursors import DictCursor
+
+from app.listing import Page
+from app.routes.courses import get_courses_by_term
+
+
+@pytest.fixture
+def course_ids(
+    db: Connection[DictCursor], parent_term: dict[str, object]
+) -> list[str]:
+    ids = sorted(str(uuid.uuid4()) for _ in range(5))
+    with db.cursor() as cursor:
+        for number, course_id in enumerate(ids):
+            cursor.execute(
+                "INSERT INTO courses (id, term_id, title, start_date, "
+                "end_date) VALUES (%s, %s, %s, %s, %s)",
+                (
+                    course_id,
+                    parent_term["id"],
+                    f"CMPE {number}",
+                    "2025-08-12",
+                    "2025-12-05",
+                ),
+            )
+    return ids
+
+
+def list_ids(
+    db: Connection[DictCursor], term_id: str, page: Page
+) -> list[str]:
+    rows = get_courses_by_term(term_id, page, Response(), db)
+    return [row["id"] for row in rows]
+
+
+def read_stream(response: StreamingResponse) -> str:
+    async def collect() -> str:
+        return "".join([chunk async for chunk in response.body_iterator])
+
+    return asyncio.run(collect())
+
+
+# ====================================
+# SMOKE TESTS
+# ====================================
+
+
+def test_pages_follow_ids(
+    db: Connection[DictCursor],
+    parent_term: dict[str, object],
+    course_ids: list[str],
+) -> None:
+    term_id = str(parent_term["id"])
+
+    assert list_ids(db, term_id, Page(limit=2)) == course_ids[:2]
+    assert list_ids(db, term_id, Page(after=course_ids[1], limit=2)) == (
+        course_ids[2:4]
+    )
+    assert list_ids(db, term_id, Page(after=course_ids[3], limit=2)) == (
+        course_ids[4:]
+    )
+
+
+def test_unpaged_list_returns_every_row(
+    db: Connection[DictCursor],
+    parent_term: dict[str, object],
+    course_ids: list[str],
+) -> None:
+    assert sorted(list_ids(db, str(parent_term["id"]), Page())) == course_ids
+
+
+def test_ndjson_streams_one_record_per_line(
+    db: Connection[DictCursor],
+    parent_term: dict[str, object],
+    course_ids: list[str],
+) -> None:
+    response = get_courses_by_term(
+        str(parent_term["id"]),
+        Page(after=course_ids[0], format="ndjson"),
+        Response(),
+        db,
+    )
+    records = [json.loads(line) for line in read_stream(response).splitlines()]
+
+    assert response.media_type == "application/x-ndjson"
+    assert [record["id"] for record in records] == course_ids[1:]
+    assert records[0]["active"] is True
+
+
+# ====================================
+# EDGE CASES
+# ====================================
+
+
+def test_after_last_id_is_empty(
+    db: Connection[DictCursor],
+    parent_term: dict[str, object],
+    course_ids: list[str],
+) -> None:
+    page = Page(after=course_ids[-1])
+
+    assert list_ids(db, str(parent_term["id"]), page) == []
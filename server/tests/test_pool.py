@@ -0,0 +1,216 @@
+from __future__ import annotations
+
+import threading
+
+import pymysql
+import pytest
+from pymysql.constants import SERVER_STATUS
+
+from app.pool import ConnectionPool, PoolTimeout
+
+
+class FakeConnection:
+    """Stands in for a pymysql connection; tracks the calls the pool makes."""
+
+    def __init__(self) -> None:
+        self.open = True
+        self.server_status = 0
+        self.pings = 0
+        self.rollbacks = 0
+        self.ping_fails = False
+
+    def ping(self, reconnect: bool = True) -> None:
+        self.pings += 1
+        if self.ping_fails:
+            raise pymysql.OperationalError(2006, "MySQL server has gone away")
+
+    def rollback(self) -> None:
+        self.rollbacks += 1
+        self.server_status &= ~SERVER_STATUS.SERVER_STATUS_IN_TRANS
+
+    def close(self) -> None:
+        if not self.open:
+            raise pymysql.Error("Already closed")
+        self.open = False
+
+
+class FakeClock:
+    def __init__(self) -> None:
+        self.now = 0.0
+
+    def __call__(self) -> float:
+        return self.now
+
+
+@pytest.fixture
+def clock() -> FakeClock:
+    return FakeClock()
+
+
+@pytest.fixture
+def opened() -> list[FakeConnection]:
+    return []
+
+
+@pytest.fixture
+def pool(clock: FakeClock, opened: list[FakeConnection]) -> ConnectionPool:
+    def connect() -> FakeConnection:
+        conn = FakeConnection()
+        opened.append(conn)
+        return conn
+
+    return ConnectionPool(
+        connect,  # type: ignore[arg-type]
+        max_size=2,
+        timeout=0.05,
+        recycle=3600.0,
+        ping_after=30.0,
+        clock=clock,
+    )
+
+
+# ====================================
+# SMOKE TESTS
+# ====================================
+
+
+def test_released_connection_is_reused(
+    pool: ConnectionPool, opened: list[FakeConnection]
+) -> None:
+    conn = pool.acquire()
+    pool.release(conn)
+
+    assert pool.acquire() is conn
+    assert len(opened) == 1
+
+
+def test_warm_connection_is_not_pinged(pool: ConnectionPool) -> None:
+    conn = pool.acquire()
+    pool.release(conn)
+    pool.acquire()
+
+    assert conn.pings == 0  # type: ignore[attr-defined]
+
+
+def test_clean_release_skips_rollback(pool: ConnectionPool) -> None:
+    conn = pool.acquire()
+    pool.release(conn)
+
+    assert conn.rollbacks == 0  # type: ignore[attr-defined]
+
+
+def test_open_transaction_is_rolled_back(pool: ConnectionPool) -> None:
+    conn = pool.acquire()
+    conn.server_status |= SERVER_STATUS.SERVER_STATUS_IN_TRANS
+    pool.release(conn)
+
+    assert conn.rollbacks == 1  # type: ignore[attr-defined]
+    assert pool.acquire() is conn
+
+
+# ====================================
+# HEALTH CHECK TESTS
+# ====================================
+
+
+def test_idle_connection_is_pinged(
+    pool: ConnectionPool, clock: FakeClock
+) -> None:
+    conn = pool.acquire()
+    pool.release(conn)
+    clock.now += 60.0
+
+    assert pool.acquire() is conn
+    assert conn.pings == 1  # type: ignore[attr-defined]
+
+
+def test_dead_connection_is_replaced(
+    pool: ConnectionPool, clock: FakeClock, opened: list[FakeConnection]
+) -> None:
+    conn = pool.acquire()
+    pool.release(conn)
+    conn.ping_fails = True  # type: ignore[attr-defined]
+    clock.now += 60.0
+
+    replacement = pool.acquire()
+
+    assert replacement is not conn
+    assert not conn.open
+    assert len(opened) == 2
+    assert pool.size == 1
+
+
+def test_old_connection_is_recycled(
+    pool: ConnectionPool, clock: FakeClock
+) -> None:
+    conn = pool.acquire()
+    pool.release(conn)
+    clock.now += 4000.0
+
+    assert pool.acquire() is not conn
+    assert not conn.open
+
+
+def test_broken_connection_is_discarded(pool: ConnectionPool) -> None:
+    conn = pool.acquire()
+    conn.open = False  # type: ignore[misc]
+    pool.release(conn)
+
+    assert pool.size == 0
+    assert pool.idle == []
+
+
+# ====================================
+# BOUND TESTS
+# ====================================
+
+
+def test_exhausted_pool_times_out(pool: ConnectionPool) -> None:
+    pool.acquire()
+    pool.acquire()
+
+    with pytest.raises(PoolTimeout):
+        pool.acquire()
+
+
+def test_waiter_gets_released_connection(
+    pool: ConnectionPool, opened: list[FakeConnection]
+) -> None:
+    pool.timeout = 5.0
+    first = pool.acquire()
+    pool.acquire()
+    acquired = []
+
+    waiter = threading.Thread(target=lambda: acquired.append(pool.acquire()))
+    waiter.start()
+    pool.release(first)
+    waiter.join()
+
+    assert acquired == [first]
+    assert len(opened) == 2
+
+
+def test_failed_connect_frees_slot(pool: ConnectionPool) -> None:
+    def refuse() -> None:
+        raise pymysql.OperationalError(2003, "Can't connect")
+
+    pool.connect = refuse  # type: ignore[assignment]
+
+    with pytest.raises(pymysql.OperationalError):
+        pool.acquire()
+
+    assert pool.size == 0
+
+
+def test_close_discards_checked_out_connections(
+    pool: ConnectionPool,
+) -> None:
+    idle = pool.acquire()
+    busy = pool.acquire()
+    pool.release(idle)
+    pool.close()
+    pool.release(busy)
+
+    assert not idle.open
+    assert not busy.open
+    assert pool.size == 0
@@ -0,0 +1,139 @@
+from __future__ import annotations
+
+import uuid
+from typing import Any
+
+import pytest
+from fastapi import HTTPException
+from pymysql.connections import Connection
+from pymysql.cursors import DictCursor
+
+from app.routes.terms import get_term_tree
+
+
+class CountingConnection:
+    """Wraps a connection and counts the statements run through it."""
+
+    def __init__(self, conn: Connection[DictCursor]) -> None:
+        self.conn = conn
+        self.queries = 0
+
+    def cursor(self) -> Any:
+        cursor = self.conn.cursor()
+        execute = cursor.execute
+
+        def counted(*args: Any, **kwargs: Any) -> Any:
+            self.queries += 1
+            return execute(*args, **kwargs)
+
+        cursor.execute = counted
+        return cursor
+
+
+def insert_course(db: Connection[DictCursor], term_id: str, title: str) -> str:
+    course_id = str(uuid.uuid4())
+    with db.cursor() as cursor:
+        cursor.execute(
+            "INSERT INTO courses (id, term_id, title, start_date, end_date) "
+            "VALUES (%s, %s, %s, %s, %s)",
+            (course_id, term_id, title, "2025-08-12", "2025-12-05"),
+        )
+    return course_id
+
+
+def insert_assignment(
+    db: Connection[DictCursor], course_id: str, title: str
+) -> str:
+    assignment_id = str(uuid.uuid4())
+    with db.cursor() as cursor:
+        cursor.execute(
+            "INSERT INTO assignments (id, course_id, title, category, "
+            "due_date) VALUES (%s, %s, %s, %s, %s)",
+            (assignment_id, course_id, title, "Homework", "2025-11-20"),
+        )
+    return assignment_id
+
+
+# ====================================
+# SMOKE TESTS
+# ====================================
+
+
+def test_tree_nests_courses_and_assignments(
+    db: Connection[DictCursor], parent_course: dict[str, object]
+) -> None:
+    term_id = str(parent_course["term_id"])
+    other_id = insert_course(db, term_id, "CMPE 148")
+    insert_assignment(db, str(parent_course["id"]), "Homework 1")
+    insert_assignment(db, str(parent_course["id"]), "Homework 2")
+    insert_assignment(db, other_id, "Lab 1")
+
+    tree = get_term_tree(term_id, db)
+    courses = {course["id"]: course for course in tree["courses"]}
+
+    assert tree["id"] == term_id
+    assert len(courses) == 2
+    assert len(courses[parent_course["id"]]["assignments"]) == 2
+    assert courses[other_id]["assignments"][0]["title"] == "Lab 1"
+
+
+def test_tree_uses_three_queries(
+    db: Connection[DictCursor], parent_course: dict[str, object]
+) -> None:
+    term_id = str(parent_course["term_id"])
+    for i in range(5):
+        course_id = insert_course(db, term_id, f"Course {i}")
+        insert_assignment(db, course_id, "Homework 1")
+
+    counting = CountingConnection(db)
+    get_term_tree(term_id, counting)
+
+    assert counting.queries == 3
+
+
+def test_tree_course_without_assignments(
+    db: Connection[DictCursor], parent_course: dict[str, object]
+) -> None:
+    tree = get_term_tree(str(parent_course["term_id"]), db)
+
+    assert tree["courses"][0]["assignments"] == []
+
+
+# ====================================
+# EDGE CASES
+# ====================================
+
+
+def test_tree_term_without_courses(
+    db: Connection[DictCursor], parent_term: dict[str, object]
+) -> None:
+    tree = get_term_tree(str(parent_term["id"]), db)
+
+    assert tree["courses"] == []
+
+
+def test_tree_excludes_other_terms(
+    db: Connection[DictCursor], parent_course: dict[str, object]
+) -> None:
+    other_term = str(uuid.uuid4())
+    with db.cursor() as cursor:
+        cursor.execute(
+            "INSERT INTO terms (id, title, start_date, end_date) "
+            "VALUES (%s, %s, %s, %s)",
+            (other_term, "Spring 2026", "2026-01-20", "2026-05-23"),
+        )
+    other_course = insert_course(db, other_term, "CMPE 148")
+    insert_assignment(db, other_course, "Homework 1")
+
+    tree = get_term_tree(str(parent_course["term_id"]), db)
+
+    assert [course["id"] for course in tree["courses"]] == [
+        parent_course["id"]
+    ]
+
+
+def test_tree_missing_term_raises(db: Connection[DictCursor]) -> None:
+    with pytest.raises(HTTPException) as error:
+        get_term_tree(str(uuid.uuid4()), db)
+
+    assert error.value.status_code == 404